@@ -0,0 +1,31 @@
+#include <gfx/bitmap.h>
+
+char	hires[8000];
+Bitmap	sbm;
+
+int main(void)
+{
+	bm_init(&sbm, hires, 40, 25);
+	bm_fill(&sbm, 0);
+
+	for(int i=0; i<320; i+=16)
+	{
+		bmu_line(&sbm, i, 0, 319 - i, 199, 0xff, LINOP_SET);
+		bmu_line(&sbm, 0, i * 5 / 8, 319, 199 - i * 5 / 8, 0xff, LINOP_XOR);
+	}
+
+	bmu_rect_fill(&sbm, 20, 20, 100, 60);
+	bmu_rect_clear(&sbm, 40, 40, 60, 20);
+
+	ClipRect	cr = {0, 0, 320, 200};
+	static const char pat[8] = {0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa};
+
+	bm_circle_fill(&sbm, &cr, 240, 100, 50, pat);
+	bm_triangle_fill(&sbm, &cr, 10, 190, 150, 120, 300, 195, pat);
+
+	unsigned	sum = 0;
+	for(int i=0; i<8000; i++)
+		sum += hires[i];
+
+	return sum == 0;
+}
@@ -0,0 +1,29 @@
+#include <math.h>
+
+int main(void)
+{
+	float	s = 0, c = 0, r = 0, e = 0;
+
+	for(int i=0; i<40; i++)
+	{
+		float	x = i * 0.1;
+		s += sin(x);
+		c += cos(x);
+		r += sqrt(x);
+		e += exp(x * 0.1) + log(x + 1);
+	}
+
+	float	t = 0;
+	for(int i=0; i<40; i++)
+	{
+		float	x = i * 0.1;
+		t += sin(x) * sin(x) + cos(x) * cos(x);
+	}
+
+	if (fabs(t - 40) > 0.01)
+		return 1;
+	if (fabs(s - 16.901) > 0.01 || fabs(r - 52.270) > 0.01)
+		return 2;
+
+	return 0;
+}
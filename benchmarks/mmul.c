@@ -0,0 +1,54 @@
+#define N	12
+
+int		ia[N][N], ib[N][N], ic[N][N];
+float	fa[N][N], fb[N][N], fc[N][N];
+
+void imul(void)
+{
+	for(char i=0; i<N; i++)
+		for(char j=0; j<N; j++)
+		{
+			int	s = 0;
+			for(char k=0; k<N; k++)
+				s += ia[i][k] * ib[k][j];
+			ic[i][j] = s;
+		}
+}
+
+void fmul(void)
+{
+	for(char i=0; i<N; i++)
+		for(char j=0; j<N; j++)
+		{
+			float	s = 0;
+			for(char k=0; k<N; k++)
+				s += fa[i][k] * fb[k][j];
+			fc[i][j] = s;
+		}
+}
+
+int main(void)
+{
+	for(char i=0; i<N; i++)
+		for(char j=0; j<N; j++)
+		{
+			ia[i][j] = i + j;
+			ib[i][j] = i == j ? 2 : 0;
+			fa[i][j] = i - j;
+			fb[i][j] = i == j ? 0.5 : 0.0;
+		}
+
+	imul();
+	fmul();
+
+	for(char i=0; i<N; i++)
+		for(char j=0; j<N; j++)
+		{
+			if (ic[i][j] != 2 * (i + j))
+				return 1;
+			if (fc[i][j] * 2 != fa[i][j])
+				return 2;
+		}
+
+	return 0;
+}
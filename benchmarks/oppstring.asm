@@ -0,0 +1,1763 @@
+; Compiled with 1.32.273
+--------------------------------------------------------------------
+startup: ; startup
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f ; (startup + 62)
+0809 : 31 00 __ AND ($00),y 
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e f4 16 STX $16f4 ; (spentry + 0)
+0811 : a2 16 __ LDX #$16
+0813 : a0 f5 __ LDY #$f5
+0815 : a9 00 __ LDA #$00
+0817 : 85 19 __ STA IP + 0 
+0819 : 86 1a __ STX IP + 1 
+081b : e0 16 __ CPX #$16
+081d : f0 0b __ BEQ $082a ; (startup + 41)
+081f : 91 19 __ STA (IP + 0),y 
+0821 : c8 __ __ INY
+0822 : d0 fb __ BNE $081f ; (startup + 30)
+0824 : e8 __ __ INX
+0825 : d0 f2 __ BNE $0819 ; (startup + 24)
+0827 : 91 19 __ STA (IP + 0),y 
+0829 : c8 __ __ INY
+082a : c0 f9 __ CPY #$f9
+082c : d0 f9 __ BNE $0827 ; (startup + 38)
+082e : a9 00 __ LDA #$00
+0830 : a2 f7 __ LDX #$f7
+0832 : d0 03 __ BNE $0837 ; (startup + 54)
+0834 : 95 00 __ STA $00,x 
+0836 : e8 __ __ INX
+0837 : e0 f7 __ CPX #$f7
+0839 : d0 f9 __ BNE $0834 ; (startup + 51)
+083b : a9 fe __ LDA #$fe
+083d : 85 23 __ STA SP + 0 
+083f : a9 9f __ LDA #$9f
+0841 : 85 24 __ STA SP + 1 
+0843 : a9 69 __ LDA #$69
+0845 : 85 19 __ STA IP + 0 
+0847 : a9 08 __ LDA #$08
+0849 : 85 1a __ STA IP + 1 
+084b : a0 00 __ LDY #$00
+084d : f0 03 __ BEQ $0852 ; (startup + 81)
+084f : a4 02 __ LDY $02 
+0851 : c8 __ __ INY
+0852 : b1 19 __ LDA (IP + 0),y 
+0854 : 8d 59 08 STA $0859 ; (startup + 88)
+0857 : c8 __ __ INY
+0858 : 6c 00 09 JMP ($0900)
+085b : 98 __ __ TYA
+085c : a0 00 __ LDY #$00
+085e : 18 __ __ CLC
+085f : 65 19 __ ADC IP + 0 
+0861 : 85 19 __ STA IP + 0 
+0863 : 90 ed __ BCC $0852 ; (startup + 81)
+0865 : e6 1a __ INC IP + 1 
+0867 : d0 e9 __ BNE $0852 ; (startup + 81)
+0869 : f2 __ __ INV
+086a : 00 __ __ BRK
+086b : 0a __ __ ASL
+086c : 02 __ __ INV
+086d : a9 4c __ LDA #$4c
+086f : 85 54 __ STA $54 
+0871 : a9 00 __ LDA #$00
+0873 : 85 13 __ STA P6 
+0875 : a9 19 __ LDA #$19
+0877 : 85 16 __ STA P9 
+0879 : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	12, 24
+0a04:	PUSH	#$0002
+0a07:	LEA	P0, 0(FP)
+0a0b:	CALL	opp::string::+string + 0
+0a0e:	MOV	T0, #0
+0a11:	LEA	T1, 2(FP)
+0a15:	LEA	T2, $0bfc
+0a19:	LEA	T3, 4(FP)
+0a1d:	LEA	T4, 0(FP)
+0a21:	LEA	T5, $0eb1
+0a25:	MOV	ACCU, T1
+0a27:	MOV	P0, ACCU
+0a29:	MOV	ACCU, T2
+0a2b:	MOV	P2, ACCU
+0a2d:	CALL	opp::string::+string + 0
+0a30:	MOV	ACCU, T3
+0a32:	MOV	P5, ACCU
+0a34:	MOV	ACCU, T0
+0a36:	MOV	P7, ACCU
+0a38:	CALL	opp::to_string + 0
+0a3b:	MOV	ACCU, T1
+0a3d:	MOV	P0, ACCU
+0a3f:	MOV	ACCU, T3
+0a41:	MOV	P2, ACCU
+0a43:	CALL	opp::string::operator+= + 0
+0a46:	MOV	ACCU, T3
+0a48:	MOV	P0, ACCU
+0a4a:	CALL	opp::string::~string + 0
+0a4d:	MOV	ACCU, T4
+0a4f:	MOV	P0, ACCU
+0a51:	MOV	ACCU, T1
+0a53:	MOV	P2, ACCU
+0a55:	CALL	opp::string::operator+= + 0
+0a58:	MOV	ACCU, T4
+0a5a:	MOV	P0, ACCU
+0a5c:	MOV	ACCU, T5
+0a5e:	MOV	P2, ACCU
+0a60:	CALL	opp::string::operator+= + 0
+0a63:	MOV	ACCU, T1
+0a65:	MOV	P0, ACCU
+0a67:	CALL	opp::string::~string + 0
+0a6a:	ADD	T0, #$0001
+0a6e:	MOVB	ACCU, T0
+0a70:	CMPUB	ACCU, #$0014
+0a72:	BNE	$0A25
+0a74:	MOV	T3, #0
+0a77:	MOV	T0, #0
+0a7a:	MOV	T1, 0(FP)
+0a7d:	LEA	T4, 0(FP)
+0a81:	MOV	ACCU, T1
+0a83:	BNEF	$0B55
+0a86:	MOVB	ACCU, T0
+0a88:	MOV	ACCU, T4
+0a8a:	MOV	P8, ACCU
+0a8c:	MOVB	P10, #4
+0a8f:	MOVB	P11, #10
+0a92:	LEA	T2, 6(FP)
+0a96:	MOV	ACCU, T2
+0a98:	MOV	P6, ACCU
+0a9a:	CALL	opp::string::substr + 0
+0a9d:	LEA	T5, 8(FP)
+0aa1:	MOV	ACCU, T5
+0aa3:	MOV	P0, ACCU
+0aa5:	LEA	P2, $0f8b
+0aa9:	CALL	opp::string::+string + 0
+0aac:	MOV	T0, 6(FP)
+0aaf:	MOV	ACCU, T0
+0ab1:	BNE	$0B23
+0ab3:	MOV	ACCU, 8(FP)
+0ab6:	BEQ	$0AD7
+0ab8:	MOV	ACCU, T5
+0aba:	MOV	P0, ACCU
+0abc:	CALL	opp::string::~string + 0
+0abf:	MOV	ACCU, T2
+0ac1:	MOV	P0, ACCU
+0ac3:	CALL	opp::string::~string + 0
+0ac6:	MOV	ACCU, T4
+0ac8:	MOV	P0, ACCU
+0aca:	CALL	opp::string::~string + 0
+0acd:	MOV	ACCU, #1
+0ad0:	POP	#$0002
+0ad3:	RETURN	12, 24
+0ad7:	MOV	ACCU, T5
+0ad9:	MOV	P0, ACCU
+0adb:	CALL	opp::string::~string + 0
+0ade:	NOP
+0adf:	MOV	ACCU, T4
+0ae1:	MOV	P0, ACCU
+0ae3:	MOVB	P4, #0
+0ae6:	LEA	P2, $0fd4
+0aea:	CALL	opp::string::find + 0
+0aed:	MOV	T0, ACCU
+0aef:	MOV	ACCU, T2
+0af1:	MOV	P0, ACCU
+0af3:	MOV	ACCU, T0
+0af5:	BGE	$0B06
+0af7:	CALL	opp::string::~string + 0
+0afa:	MOV	ACCU, T4
+0afc:	MOV	P0, ACCU
+0afe:	CALL	opp::string::~string + 0
+0b01:	MOV	ACCU, #2
+0b04:	JUMP	$0AD0
+0b06:	CALL	opp::string::~string + 0
+0b09:	MOV	ACCU, T4
+0b0b:	MOV	P0, ACCU
+0b0d:	CALL	opp::string::~string + 0
+0b10:	MOV	ACCU, T3
+0b12:	CMPU	ACCU, #$0014
+0b15:	BEQ	$0B1C
+0b17:	MOV	T0, #3
+0b1a:	JUMP	$0B1F
+0b1c:	MOV	T0, #0
+0b1f:	MOV	ACCU, T0
+0b21:	JUMP	$0AD0
+0b23:	MOV	T1, 8(FP)
+0b26:	MOV	ACCU, T1
+0b28:	BEQ	$0B4D
+0b2a:	ADD	T0, #$0001
+0b2e:	MOV	ACCU, T0
+0b30:	MOV	P0, ACCU
+0b32:	ADD	T1, #$0001
+0b36:	MOV	ACCU, T1
+0b38:	MOV	P2, ACCU
+0b3a:	CALL	opp::scmp + 0
+0b3d:	MOV	T0, ACCU
+0b3f:	MOV	ACCU, T5
+0b41:	MOV	P0, ACCU
+0b43:	CALL	opp::string::~string + 0
+0b46:	MOV	ACCU, T0
+0b48:	BNEF	$0ABF
+0b4b:	JUMP	$0ADF
+0b4d:	MOV	ACCU, T0
+0b4f:	BNEF	$0AB8
+0b52:	JUMPF	$0AB3
+0b55:	MOV	ADDR, T1
+0b57:	MOVUB	ACCU, 0(ADDR)
+0b5a:	CMPU	ACCU, T0
+0b5c:	BGEF	$0A88
+0b5f:	MOVB	ACCU, T0
+0b61:	LEAX	ADDR, T1 + ACCU
+0b63:	MOVUB	ACCU, 1(ADDR)
+0b66:	CMPUB	ACCU, #$002C
+0b68:	BNE	$0B6E
+0b6a:	ADD	T3, #$0001
+0b6e:	ADD	T0, #$0001
+0b72:	JUMPF	$0A7D
+--------------------------------------------------------------------
+opp::string::+string:
+0b75:	ENTER	0, 2
+0b79:	MOV	ADDR, P0
+0b7b:	LEA	T1, $0000
+0b7f:	MOV	0(ADDR), T1
+0b82:	RETURN	0, 2
+--------------------------------------------------------------------
+opp::string::+string:
+0b86:	ENTER	0, 2
+0b8a:	MOV	ACCU, P2
+0b8c:	MOV	T0, ACCU
+0b8e:	BEQ	$0BF1
+0b90:	MOVB	T4, #0
+0b93:	MOVB	ACCU, T4
+0b95:	MOV	T1, ACCU
+0b97:	LEAX	ADDR, T0 + ACCU
+0b99:	MOVUB	ACCU, 0(ADDR)
+0b9c:	BEQ	$0BA3
+0b9e:	ADDB	T4, #$0001
+0ba1:	JUMP	$0B93
+0ba3:	MOV	ACCU, P0
+0ba5:	MOV	T2, ACCU
+0ba7:	MOVB	ACCU, T4
+0ba9:	BNE	$0BB8
+0bab:	LEA	T0, $0000
+0baf:	MOV	ADDR, T2
+0bb1:	MOV	0(ADDR), T0
+0bb4:	RETURN	0, 2
+0bb8:	ADD	T1, #$0002
+0bbc:	MOVB	ACCU, T1
+0bbe:	MALLOC	ACCU
+0bbf:	MOV	T3, ACCU
+0bc1:	MOV	ADDR, T3
+0bc3:	MOVB	0(ADDR), T4
+0bc6:	MOV	ADDR, T2
+0bc8:	MOV	0(ADDR), T3
+0bcb:	ADD	T1, #$FFFF
+0bcf:	ADD	T3, #$0001
+0bd3:	MOVB	T5, #0
+0bd6:	MOVB	ACCU, T5
+0bd8:	MOV	T2, ACCU
+0bda:	LEAX	ADDR, T0 + ACCU
+0bdc:	MOVB	T4, 0(ADDR)
+0bdf:	MOV	ACCU, T3
+0be1:	LEAX	ADDR, T2 + ACCU
+0be3:	MOVB	0(ADDR), T4
+0be6:	ADDB	T5, #$0001
+0be9:	MOVB	ACCU, T1
+0beb:	CMPUB	ACCU, T5
+0bed:	BLT	$0BD6
+0bef:	JUMP	$0BB4
+0bf1:	MOV	ADDR, P0
+0bf3:	LEA	T1, $0000
+0bf7:	MOV	0(ADDR), T1
+0bfa:	JUMP	$0BB4
+--------------------------------------------------------------------
+0bfc : __ __ __ BYT 69 74 65 6d 00                                  : item.
+--------------------------------------------------------------------
+opp::string::operator+=:
+0c01:	ENTER	4, 6
+0c05:	MOV	ACCU, P0
+0c07:	MOV	T0, ACCU
+0c09:	MOV	ADDR, P2
+0c0b:	MOV	T1, 0(ADDR)
+0c0e:	MOV	ACCU, T1
+0c10:	BNE	$0C18
+0c12:	MOV	ACCU, T0
+0c14:	RETURN	4, 6
+0c18:	MOV	ADDR, T0
+0c1a:	MOV	T2, 0(ADDR)
+0c1d:	MOV	ACCU, T2
+0c1f:	BNE	$0C26
+0c21:	MOVB	T9, #0
+0c24:	JUMP	$0C2B
+0c26:	MOV	ADDR, T2
+0c28:	MOVB	T9, 0(ADDR)
+0c2b:	MOV	ADDR, T1
+0c2d:	MOVB	T3, 0(ADDR)
+0c30:	AND	T3, #$00FF
+0c34:	MOVB	ACCU, T9
+0c36:	MOV	T4, ACCU
+0c38:	ADD	T3, ACCU
+0c3a:	MOVB	ACCU, T3
+0c3c:	ADDB	ACCU, #$0002
+0c3f:	MALLOC	ACCU
+0c40:	MOV	T5, ACCU
+0c42:	MOV	ADDR, T5
+0c44:	MOVB	0(ADDR), T3
+0c47:	MOVB	ACCU, T9
+0c49:	BEQ	$0C7B
+0c4b:	MOVB	ACCU, T9
+0c4d:	BEQ	$0C7B
+0c4f:	MOV	ACCU, T2
+0c51:	ADD	ACCU, #$0001
+0c55:	MOV	T3, ACCU
+0c57:	MOV	ACCU, T5
+0c59:	ADD	ACCU, #$0001
+0c5d:	MOV	T6, ACCU
+0c5f:	MOVB	T10, #0
+0c62:	MOVB	ACCU, T10
+0c64:	MOV	T7, ACCU
+0c66:	LEAX	ADDR, T3 + ACCU
+0c68:	MOVB	T8, 0(ADDR)
+0c6b:	MOV	ACCU, T6
+0c6d:	LEAX	ADDR, T7 + ACCU
+0c6f:	MOVB	0(ADDR), T8
+0c72:	ADDB	T10, #$0001
+0c75:	MOVB	ACCU, T9
+0c77:	CMPUB	ACCU, T10
+0c79:	BLT	$0C62
+0c7b:	MOV	ACCU, T5
+0c7d:	ADD	ACCU, #$0001
+0c81:	ADD	ACCU, T4
+0c83:	MOV	T3, ACCU
+0c85:	MOV	ADDR, T1
+0c87:	MOVB	T4, 0(ADDR)
+0c8a:	AND	T4, #$00FF
+0c8e:	ADD	T4, #$0001
+0c92:	ADD	T1, #$0001
+0c96:	MOVB	T8, #0
+0c99:	MOVB	ACCU, T8
+0c9b:	MOV	T6, ACCU
+0c9d:	LEAX	ADDR, T1 + ACCU
+0c9f:	MOVB	T7, 0(ADDR)
+0ca2:	MOV	ACCU, T3
+0ca4:	LEAX	ADDR, T6 + ACCU
+0ca6:	MOVB	0(ADDR), T7
+0ca9:	ADDB	T8, #$0001
+0cac:	MOVB	ACCU, T4
+0cae:	CMPUB	ACCU, T8
+0cb0:	BLT	$0C99
+0cb2:	MOV	ACCU, T2
+0cb4:	FREE	ACCU
+0cb5:	MOV	ADDR, T0
+0cb7:	MOV	0(ADDR), T5
+0cba:	JUMPF	$0C12
+--------------------------------------------------------------------
+opp::to_string:
+0cbd:	ENTER	0, 12
+0cc1:	PUSH	#$0002
+0cc4:	MOV	ACCU, P5
+0cc6:	MOV	P0, ACCU
+0cc8:	MOV	ACCU, P7
+0cca:	MOV	T0, ACCU
+0ccc:	BLT	$0CD3
+0cce:	MOVB	T3, #0
+0cd1:	JUMP	$0CD9
+0cd3:	NEG	ACCU
+0cd4:	MOV	T0, ACCU
+0cd6:	MOVB	T3, #1
+0cd9:	MOV	ACCU, T0
+0cdb:	BEQ	$0D3F
+0cdd:	MOVB	T4, #10
+0ce0:	MOV	ACCU, T0
+0ce2:	MOV	ADDR, #10
+0ce5:	MODU	ACCU, ADDR
+0ce7:	MOV	T1, ACCU
+0ce9:	MOV	ACCU, T0
+0ceb:	MOV	ADDR, #10
+0cee:	DIVU	ACCU, ADDR
+0cf0:	MOV	T0, ACCU
+0cf2:	AND	T1, #$00FF
+0cf6:	ADD	T1, #$0030
+0cfa:	MOVB	ACCU, T4
+0cfc:	LEA	T2, 65535(FP)
+0d00:	LEAX	ADDR, T2 + ACCU
+0d02:	MOVB	0(ADDR), T1
+0d05:	ADDB	T4, #$00FF
+0d08:	MOV	ACCU, T0
+0d0a:	BNE	$0CE0
+0d0c:	MOVB	ACCU, T3
+0d0e:	BEQ	$0D21
+0d10:	MOVB	ACCU, T4
+0d12:	LEA	T0, 65535(FP)
+0d16:	LEAX	ADDR, T0 + ACCU
+0d18:	MOV	ACCU, #45
+0d1b:	MOVB	0(ADDR), ACCU
+0d1e:	ADDB	T4, #$00FF
+0d21:	MOVB	ACCU, T4
+0d23:	MOV	T0, ACCU
+0d25:	LEA	ACCU, 0(FP)
+0d29:	ADD	ACCU, T0
+0d2b:	MOV	P2, ACCU
+0d2d:	SUBR	T0, #$000A
+0d31:	MOVB	ACCU, T0
+0d33:	MOVB	P4, ACCU
+0d35:	CALL	opp::string::+string + 0
+0d38:	POP	#$0002
+0d3b:	RETURN	0, 12
+0d3f:	MOV	ACCU, #48
+0d42:	MOVB	9(FP), ACCU
+0d45:	MOVB	T4, #9
+0d48:	MOVB	ACCU, T3
+0d4a:	BNE	$0D10
+0d4c:	JUMP	$0D21
+--------------------------------------------------------------------
+opp::string::+string:
+0d4e:	ENTER	0, 2
+0d52:	MOV	ACCU, P0
+0d54:	MOV	T0, ACCU
+0d56:	MOVB	ACCU, P4
+0d58:	MOVB	T6, ACCU
+0d5a:	MOVB	ACCU, ACCU
+0d5c:	BNE	$0D6B
+0d5e:	LEA	T1, $0000
+0d62:	MOV	ADDR, T0
+0d64:	MOV	0(ADDR), T1
+0d67:	RETURN	0, 2
+0d6b:	MOVB	ACCU, T6
+0d6d:	MOV	T1, ACCU
+0d6f:	ADDB	ACCU, #$0002
+0d72:	MOVB	ACCU, ACCU
+0d74:	MALLOC	ACCU
+0d75:	MOV	T2, ACCU
+0d77:	MOV	ADDR, T2
+0d79:	MOVB	0(ADDR), T6
+0d7c:	MOV	ADDR, T0
+0d7e:	MOV	0(ADDR), T2
+0d81:	MOVB	ACCU, T6
+0d83:	BNE	$0D91
+0d85:	MOV	ACCU, T1
+0d87:	LEAX	ADDR, T2 + ACCU
+0d89:	MOV	ACCU, #0
+0d8c:	MOVB	1(ADDR), ACCU
+0d8f:	JUMP	$0D67
+0d91:	MOV	ACCU, T2
+0d93:	ADD	ACCU, #$0001
+0d97:	MOV	T0, ACCU
+0d99:	MOVB	T7, #0
+0d9c:	MOV	ACCU, P2
+0d9e:	MOV	T3, ACCU
+0da0:	MOVB	ACCU, T7
+0da2:	MOV	T4, ACCU
+0da4:	LEAX	ADDR, T3 + ACCU
+0da6:	MOVB	T5, 0(ADDR)
+0da9:	MOV	ACCU, T0
+0dab:	LEAX	ADDR, T4 + ACCU
+0dad:	MOVB	0(ADDR), T5
+0db0:	ADDB	T7, #$0001
+0db3:	MOVB	ACCU, T6
+0db5:	CMPUB	ACCU, T7
+0db7:	BLT	$0DA0
+0db9:	JUMP	$0D85
+--------------------------------------------------------------------
+opp::string::~string:
+0dbb:	ENTER	0, 2
+0dbf:	MOV	ADDR, P0
+0dc1:	MOV	ACCU, 0(ADDR)
+0dc4:	FREE	ACCU
+0dc5:	RETURN	0, 2
+--------------------------------------------------------------------
+opp::string::operator+=:
+0dc9:	ENTER	4, 6
+0dcd:	MOV	ACCU, P2
+0dcf:	MOV	T0, ACCU
+0dd1:	BNE	$0DD9
+0dd3:	MOV	ACCU, P0
+0dd5:	RETURN	4, 6
+0dd9:	MOVB	T4, #0
+0ddc:	MOVB	ACCU, T4
+0dde:	MOV	T1, ACCU
+0de0:	LEAX	ADDR, T0 + ACCU
+0de2:	MOVUB	ACCU, 0(ADDR)
+0de5:	BEQ	$0DEC
+0de7:	ADDB	T4, #$0001
+0dea:	JUMP	$0DDC
+0dec:	MOVB	ACCU, T4
+0dee:	BEQ	$0DD3
+0df0:	MOV	ACCU, P0
+0df2:	MOV	T2, ACCU
+0df4:	MOV	ADDR, T2
+0df6:	MOV	T3, 0(ADDR)
+0df9:	MOV	ACCU, T3
+0dfb:	BNE	$0E34
+0dfd:	ADD	T1, #$0002
+0e01:	MOVB	ACCU, T1
+0e03:	MALLOC	ACCU
+0e04:	MOV	T3, ACCU
+0e06:	MOV	0(ADDR), T3
+0e09:	MOV	ADDR, T3
+0e0b:	MOVB	0(ADDR), T4
+0e0e:	ADD	T1, #$FFFF
+0e12:	ADD	T3, #$0001
+0e16:	MOVB	T5, #0
+0e19:	MOVB	ACCU, T5
+0e1b:	MOV	T2, ACCU
+0e1d:	LEAX	ADDR, T0 + ACCU
+0e1f:	MOVB	T4, 0(ADDR)
+0e22:	MOV	ACCU, T3
+0e24:	LEAX	ADDR, T2 + ACCU
+0e26:	MOVB	0(ADDR), T4
+0e29:	ADDB	T5, #$0001
+0e2c:	MOVB	ACCU, T1
+0e2e:	CMPUB	ACCU, T5
+0e30:	BLT	$0E19
+0e32:	JUMP	$0DD3
+0e34:	MOV	ADDR, T3
+0e36:	MOVUB	ACCU, 0(ADDR)
+0e39:	ADD	ACCU, T1
+0e3b:	MOV	T4, ACCU
+0e3d:	MOVB	ACCU, ACCU
+0e3f:	ADDB	ACCU, #$0002
+0e42:	MALLOC	ACCU
+0e43:	MOV	T5, ACCU
+0e45:	MOV	ADDR, T5
+0e47:	MOVB	0(ADDR), T4
+0e4a:	ADD	ACCU, #$0001
+0e4e:	MOV	T4, ACCU
+0e50:	MOV	ADDR, T3
+0e52:	MOVB	T9, 0(ADDR)
+0e55:	MOVB	ACCU, T9
+0e57:	BEQ	$0E7D
+0e59:	MOV	ACCU, T3
+0e5b:	ADD	ACCU, #$0001
+0e5f:	MOV	T6, ACCU
+0e61:	MOVB	T10, #0
+0e64:	MOVB	ACCU, T10
+0e66:	MOV	T7, ACCU
+0e68:	LEAX	ADDR, T6 + ACCU
+0e6a:	MOVB	T8, 0(ADDR)
+0e6d:	MOV	ACCU, T4
+0e6f:	LEAX	ADDR, T7 + ACCU
+0e71:	MOVB	0(ADDR), T8
+0e74:	ADDB	T10, #$0001
+0e77:	MOVB	ACCU, T9
+0e79:	CMPUB	ACCU, T10
+0e7b:	BLT	$0E64
+0e7d:	MOV	ADDR, T3
+0e7f:	MOVUB	ACCU, 0(ADDR)
+0e82:	ADD	T4, ACCU
+0e84:	ADD	T1, #$0001
+0e88:	MOVB	T8, #0
+0e8b:	MOVB	ACCU, T8
+0e8d:	MOV	T6, ACCU
+0e8f:	LEAX	ADDR, T0 + ACCU
+0e91:	MOVB	T7, 0(ADDR)
+0e94:	MOV	ACCU, T4
+0e96:	LEAX	ADDR, T6 + ACCU
+0e98:	MOVB	0(ADDR), T7
+0e9b:	ADDB	T8, #$0001
+0e9e:	MOVB	ACCU, T1
+0ea0:	CMPUB	ACCU, T8
+0ea2:	BLT	$0E8B
+0ea4:	MOV	ACCU, T3
+0ea6:	FREE	ACCU
+0ea7:	MOV	ADDR, T2
+0ea9:	MOV	0(ADDR), T5
+0eac:	MOV	ACCU, T2
+0eae:	JUMPF	$0DD5
+--------------------------------------------------------------------
+0eb1 : __ __ __ BYT 2c 00                                           : ,.
+--------------------------------------------------------------------
+opp::string::substr:
+0eb3:	ENTER	0, 2
+0eb7:	PUSH	#$0002
+0eba:	MOV	ADDR, P8
+0ebc:	MOV	T0, 0(ADDR)
+0ebf:	MOV	ACCU, T0
+0ec1:	BEQ	$0EDA
+0ec3:	MOVB	ACCU, P11
+0ec5:	MOVB	T2, ACCU
+0ec7:	MOVB	ACCU, ACCU
+0ec9:	BEQ	$0EDA
+0ecb:	MOVB	ACCU, P10
+0ecd:	MOVB	T1, ACCU
+0ecf:	MOV	ADDR, T0
+0ed1:	MOVB	T3, 0(ADDR)
+0ed4:	MOVB	ACCU, T3
+0ed6:	CMPUB	ACCU, T1
+0ed8:	BLT	$0EE8
+0eda:	MOV	ACCU, P6
+0edc:	MOV	P0, ACCU
+0ede:	CALL	opp::string::+string + 0
+0ee1:	POP	#$0002
+0ee4:	RETURN	0, 2
+0ee8:	AND	T1, #$00FF
+0eec:	ADD	T0, #$0001
+0ef0:	MOV	ACCU, T1
+0ef2:	ADD	ACCU, T0
+0ef4:	MOV	P2, ACCU
+0ef6:	MOVB	ACCU, T2
+0ef8:	ADD	ACCU, T1
+0efa:	MOV	T0, ACCU
+0efc:	MOVB	ACCU, T3
+0efe:	MOV	T2, ACCU
+0f00:	CMPU	ACCU, T0
+0f02:	BLE	$0F0A
+0f04:	MOVB	ACCU, T2
+0f06:	SUB	ACCU, T1
+0f08:	MOVB	P11, ACCU
+0f0a:	MOVB	ACCU, P11
+0f0c:	MOVB	T2, ACCU
+0f0e:	MOVB	ACCU, ACCU
+0f10:	MOV	T0, ACCU
+0f12:	MOV	P4, ACCU
+0f14:	ADD	T0, #$0002
+0f18:	MOV	ACCU, T0
+0f1a:	MALLOC	ACCU
+0f1b:	MOV	T1, ACCU
+0f1d:	ADD	ACCU, #$0001
+0f21:	MOV	P0, ACCU
+0f23:	JSR	memcpy + 0
+0f26:	MOVB	ACCU, T2
+0f28:	MOVB	P2, ACCU
+0f2a:	MOV	ACCU, T1
+0f2c:	MOV	P3, ACCU
+0f2e:	MOV	ACCU, P6
+0f30:	MOV	P0, ACCU
+0f32:	CALL	opp::string::+string + 0
+0f35:	JUMP	$0EE1
+--------------------------------------------------------------------
+memcpy: ; memcpy(void*,const void*,i16)->void*
+;  30, "/root/repo/include/string.h"
+.s1:
+0f37 : ea __ __ NOP
+.s4:
+0f38 : a6 12 __ LDX P5 
+0f3a : f0 10 __ BEQ $0f4c ; (memcpy.s4 + 20)
+0f3c : a0 00 __ LDY #$00
+0f3e : b1 0f __ LDA (P2),y 
+0f40 : 91 0d __ STA (P0),y ; (dst + 0)
+0f42 : c8 __ __ INY
+0f43 : d0 f9 __ BNE $0f3e ; (memcpy.s4 + 6)
+0f45 : e6 10 __ INC P3 
+0f47 : e6 0e __ INC P1 ; (dst + 1)
+0f49 : ca __ __ DEX
+0f4a : d0 f2 __ BNE $0f3e ; (memcpy.s4 + 6)
+0f4c : a4 11 __ LDY P4 
+0f4e : f0 0e __ BEQ $0f5e ; (memcpy.s4 + 38)
+0f50 : 88 __ __ DEY
+0f51 : f0 07 __ BEQ $0f5a ; (memcpy.s4 + 34)
+0f53 : b1 0f __ LDA (P2),y 
+0f55 : 91 0d __ STA (P0),y ; (dst + 0)
+0f57 : 88 __ __ DEY
+0f58 : d0 f9 __ BNE $0f53 ; (memcpy.s4 + 27)
+0f5a : b1 0f __ LDA (P2),y 
+0f5c : 91 0d __ STA (P0),y ; (dst + 0)
+0f5e : a5 0d __ LDA P0 ; (dst + 0)
+0f60 : 85 1b __ STA ACCU + 0 
+0f62 : a5 0e __ LDA P1 ; (dst + 1)
+0f64 : 85 1c __ STA ACCU + 1 
+.s3:
+0f66 : 60 __ __ RTS
+--------------------------------------------------------------------
+opp::string::+string:
+0f67:	ENTER	0, 2
+0f6b:	MOV	ADDR, P0
+0f6d:	MOV	ACCU, P3
+0f6f:	MOV	T1, ACCU
+0f71:	MOV	0(ADDR), T1
+0f74:	MOVB	ACCU, P2
+0f76:	MOVB	T0, ACCU
+0f78:	MOV	ADDR, T1
+0f7a:	MOVB	0(ADDR), T0
+0f7d:	MOVB	ACCU, T0
+0f7f:	LEAX	ADDR, T1 + ACCU
+0f81:	MOV	ACCU, #0
+0f84:	MOVB	1(ADDR), ACCU
+0f87:	RETURN	0, 2
+--------------------------------------------------------------------
+0f8b : __ __ __ BYT 30 2c 69 74 65 6d 31 2c 69 74 00                : 0,item1,it.
+--------------------------------------------------------------------
+opp::scmp:
+0f96:	ENTER	0, 2
+0f9a:	MOVB	T4, #0
+0f9d:	MOV	ACCU, P2
+0f9f:	MOV	T0, ACCU
+0fa1:	MOV	ACCU, P0
+0fa3:	MOV	T1, ACCU
+0fa5:	MOVB	ACCU, T4
+0fa7:	MOV	T2, ACCU
+0fa9:	LEAX	ADDR, T1 + ACCU
+0fab:	MOVB	T3, 0(ADDR)
+0fae:	MOV	ACCU, T0
+0fb0:	LEAX	ADDR, T2 + ACCU
+0fb2:	MOVB	T2, 0(ADDR)
+0fb5:	MOVB	ACCU, T2
+0fb7:	BNE	$0FBF
+0fb9:	MOVB	ACCU, T3
+0fbb:	RETURN	0, 2
+0fbf:	MOVB	ACCU, T2
+0fc1:	CMPUB	ACCU, T3
+0fc3:	BEQ	$0FCF
+0fc5:	MOVB	ACCU, T2
+0fc7:	MOV	T0, ACCU
+0fc9:	MOVB	ACCU, T3
+0fcb:	SUB	ACCU, T0
+0fcd:	JUMP	$0FBB
+0fcf:	ADDB	T4, #$0001
+0fd2:	JUMP	$0FA5
+--------------------------------------------------------------------
+0fd4 : __ __ __ BYT 69 74 65 6d 31 39 00                            : item19.
+--------------------------------------------------------------------
+opp::string::find:
+0fdb:	ENTER	0, 2
+0fdf:	MOV	ADDR, P0
+0fe1:	MOV	T0, 0(ADDR)
+0fe4:	MOV	ACCU, T0
+0fe6:	BNE	$0FEF
+0fe8:	MOV	ACCU, #-1
+0feb:	RETURN	0, 2
+0fef:	MOVB	T4, #0
+0ff2:	MOV	ADDR, T0
+0ff4:	MOVB	T5, 0(ADDR)
+0ff7:	MOV	ACCU, P2
+0ff9:	MOV	T1, ACCU
+0ffb:	MOVB	ACCU, T4
+0ffd:	MOV	T2, ACCU
+0fff:	LEAX	ADDR, T1 + ACCU
+1001:	MOVUB	ACCU, 0(ADDR)
+1004:	BEQ	$100B
+1006:	ADDB	T4, #$0001
+1009:	JUMP	$0FFB
+100b:	MOVB	ACCU, T5
+100d:	CMPUB	ACCU, T4
+100f:	BGT	$0FE8
+1011:	MOVB	ACCU, T5
+1013:	SUB	ACCU, T2
+1015:	MOV	T2, ACCU
+1017:	MOVB	ACCU, P4
+1019:	MOVB	T3, ACCU
+101b:	MOVB	ACCU, T2
+101d:	CMPUB	ACCU, T3
+101f:	BGT	$0FE8
+1021:	MOVB	T5, #0
+1024:	MOVB	ACCU, T5
+1026:	MOV	T3, ACCU
+1028:	LEAX	ADDR, T1 + ACCU
+102a:	MOVB	T6, 0(ADDR)
+102d:	MOVB	ACCU, T6
+102f:	BNE	$1035
+1031:	MOVB	ACCU, P4
+1033:	JUMP	$0FEB
+1035:	MOVB	ACCU, P4
+1037:	MOVB	T7, ACCU
+1039:	MOVB	ACCU, ACCU
+103b:	ADD	T3, ACCU
+103d:	MOV	ACCU, T0
+103f:	LEAX	ADDR, T3 + ACCU
+1041:	MOVUB	ACCU, 1(ADDR)
+1044:	CMPUB	ACCU, T6
+1046:	BNE	$104D
+1048:	ADDB	T5, #$0001
+104b:	JUMP	$1024
+104d:	MOVB	ACCU, T6
+104f:	BEQ	$1031
+1051:	MOVB	ACCU, T7
+1053:	ADDB	ACCU, #$0001
+1056:	MOVB	T3, ACCU
+1058:	MOVB	P4, ACCU
+105a:	JUMP	$101B
+--------------------------------------------------------------------
+divmod: ; divmod
+105c : a5 1c __ LDA ACCU + 1 
+105e : d0 3b __ BNE $109b ; (divmod + 63)
+1060 : a5 04 __ LDA WORK + 1 
+1062 : d0 1e __ BNE $1082 ; (divmod + 38)
+1064 : 85 06 __ STA WORK + 3 
+1066 : a2 04 __ LDX #$04
+1068 : 06 1b __ ASL ACCU + 0 
+106a : 2a __ __ ROL
+106b : c5 03 __ CMP WORK + 0 
+106d : 90 02 __ BCC $1071 ; (divmod + 21)
+106f : e5 03 __ SBC WORK + 0 
+1071 : 26 1b __ ROL ACCU + 0 
+1073 : 2a __ __ ROL
+1074 : c5 03 __ CMP WORK + 0 
+1076 : 90 02 __ BCC $107a ; (divmod + 30)
+1078 : e5 03 __ SBC WORK + 0 
+107a : 26 1b __ ROL ACCU + 0 
+107c : ca __ __ DEX
+107d : d0 eb __ BNE $106a ; (divmod + 14)
+107f : 85 05 __ STA WORK + 2 
+1081 : 60 __ __ RTS
+1082 : a5 1b __ LDA ACCU + 0 
+1084 : 85 05 __ STA WORK + 2 
+1086 : a5 1c __ LDA ACCU + 1 
+1088 : 85 06 __ STA WORK + 3 
+108a : a9 00 __ LDA #$00
+108c : 85 1b __ STA ACCU + 0 
+108e : 85 1c __ STA ACCU + 1 
+1090 : 60 __ __ RTS
+1091 : 85 03 __ STA WORK + 0 
+1093 : a9 00 __ LDA #$00
+1095 : 85 04 __ STA WORK + 1 
+1097 : a5 1c __ LDA ACCU + 1 
+1099 : f0 c9 __ BEQ $1064 ; (divmod + 8)
+109b : a5 04 __ LDA WORK + 1 
+109d : d0 1f __ BNE $10be ; (divmod + 98)
+109f : a5 03 __ LDA WORK + 0 
+10a1 : 30 1b __ BMI $10be ; (divmod + 98)
+10a3 : a9 00 __ LDA #$00
+10a5 : 85 06 __ STA WORK + 3 
+10a7 : a2 10 __ LDX #$10
+10a9 : 06 1b __ ASL ACCU + 0 
+10ab : 26 1c __ ROL ACCU + 1 
+10ad : 2a __ __ ROL
+10ae : c5 03 __ CMP WORK + 0 
+10b0 : 90 02 __ BCC $10b4 ; (divmod + 88)
+10b2 : e5 03 __ SBC WORK + 0 
+10b4 : 26 1b __ ROL ACCU + 0 
+10b6 : 26 1c __ ROL ACCU + 1 
+10b8 : ca __ __ DEX
+10b9 : d0 f2 __ BNE $10ad ; (divmod + 81)
+10bb : 85 05 __ STA WORK + 2 
+10bd : 60 __ __ RTS
+10be : a9 00 __ LDA #$00
+10c0 : 85 05 __ STA WORK + 2 
+10c2 : 85 06 __ STA WORK + 3 
+10c4 : a0 10 __ LDY #$10
+10c6 : 18 __ __ CLC
+10c7 : 26 1b __ ROL ACCU + 0 
+10c9 : 26 1c __ ROL ACCU + 1 
+10cb : 26 05 __ ROL WORK + 2 
+10cd : 26 06 __ ROL WORK + 3 
+10cf : 38 __ __ SEC
+10d0 : a5 05 __ LDA WORK + 2 
+10d2 : e5 03 __ SBC WORK + 0 
+10d4 : aa __ __ TAX
+10d5 : a5 06 __ LDA WORK + 3 
+10d7 : e5 04 __ SBC WORK + 1 
+10d9 : 90 04 __ BCC $10df ; (divmod + 131)
+10db : 86 05 __ STX WORK + 2 
+10dd : 85 06 __ STA WORK + 3 
+10df : 88 __ __ DEY
+10e0 : d0 e5 __ BNE $10c7 ; (divmod + 107)
+10e2 : 26 1b __ ROL ACCU + 0 
+10e4 : 26 1c __ ROL ACCU + 1 
+10e6 : 60 __ __ RTS
+--------------------------------------------------------------------
+crt_malloc: ; crt_malloc
+10e7 : 18 __ __ CLC
+10e8 : a5 1b __ LDA ACCU + 0 
+10ea : 69 05 __ ADC #$05
+10ec : 29 fc __ AND #$fc
+10ee : 85 03 __ STA WORK + 0 
+10f0 : a5 1c __ LDA ACCU + 1 
+10f2 : 69 00 __ ADC #$00
+10f4 : 85 04 __ STA WORK + 1 
+10f6 : ad f7 16 LDA $16f7 ; (HeapNode.end + 0)
+10f9 : d0 26 __ BNE $1121 ; (crt_malloc + 58)
+10fb : a9 00 __ LDA #$00
+10fd : 8d 02 17 STA $1702 
+1100 : 8d 03 17 STA $1703 
+1103 : ee f7 16 INC $16f7 ; (HeapNode.end + 0)
+1106 : a9 00 __ LDA #$00
+1108 : 09 02 __ ORA #$02
+110a : 8d f5 16 STA $16f5 ; (HeapNode.next + 0)
+110d : a9 17 __ LDA #$17
+110f : 8d f6 16 STA $16f6 ; (HeapNode.next + 1)
+1112 : 38 __ __ SEC
+1113 : a9 00 __ LDA #$00
+1115 : e9 02 __ SBC #$02
+1117 : 8d 04 17 STA $1704 
+111a : a9 90 __ LDA #$90
+111c : e9 00 __ SBC #$00
+111e : 8d 05 17 STA $1705 
+1121 : a9 f5 __ LDA #$f5
+1123 : a2 16 __ LDX #$16
+1125 : 85 1d __ STA ACCU + 2 
+1127 : 86 1e __ STX ACCU + 3 
+1129 : 18 __ __ CLC
+112a : a0 00 __ LDY #$00
+112c : b1 1d __ LDA (ACCU + 2),y 
+112e : 85 1b __ STA ACCU + 0 
+1130 : 65 03 __ ADC WORK + 0 
+1132 : 85 05 __ STA WORK + 2 
+1134 : c8 __ __ INY
+1135 : b1 1d __ LDA (ACCU + 2),y 
+1137 : 85 1c __ STA ACCU + 1 
+1139 : f0 20 __ BEQ $115b ; (crt_malloc + 116)
+113b : 65 04 __ ADC WORK + 1 
+113d : 85 06 __ STA WORK + 3 
+113f : b0 14 __ BCS $1155 ; (crt_malloc + 110)
+1141 : a0 02 __ LDY #$02
+1143 : b1 1b __ LDA (ACCU + 0),y 
+1145 : c5 05 __ CMP WORK + 2 
+1147 : c8 __ __ INY
+1148 : b1 1b __ LDA (ACCU + 0),y 
+114a : e5 06 __ SBC WORK + 3 
+114c : b0 0e __ BCS $115c ; (crt_malloc + 117)
+114e : a5 1b __ LDA ACCU + 0 
+1150 : a6 1c __ LDX ACCU + 1 
+1152 : 4c 25 11 JMP $1125 ; (crt_malloc + 62)
+1155 : a9 00 __ LDA #$00
+1157 : 85 1b __ STA ACCU + 0 
+1159 : 85 1c __ STA ACCU + 1 
+115b : 60 __ __ RTS
+115c : a5 05 __ LDA WORK + 2 
+115e : 85 07 __ STA WORK + 4 
+1160 : a5 06 __ LDA WORK + 3 
+1162 : 85 08 __ STA WORK + 5 
+1164 : a0 02 __ LDY #$02
+1166 : a5 07 __ LDA WORK + 4 
+1168 : d1 1b __ CMP (ACCU + 0),y 
+116a : d0 15 __ BNE $1181 ; (crt_malloc + 154)
+116c : c8 __ __ INY
+116d : a5 08 __ LDA WORK + 5 
+116f : d1 1b __ CMP (ACCU + 0),y 
+1171 : d0 0e __ BNE $1181 ; (crt_malloc + 154)
+1173 : a0 00 __ LDY #$00
+1175 : b1 1b __ LDA (ACCU + 0),y 
+1177 : 91 1d __ STA (ACCU + 2),y 
+1179 : c8 __ __ INY
+117a : b1 1b __ LDA (ACCU + 0),y 
+117c : 91 1d __ STA (ACCU + 2),y 
+117e : 4c 9e 11 JMP $119e ; (crt_malloc + 183)
+1181 : a0 00 __ LDY #$00
+1183 : b1 1b __ LDA (ACCU + 0),y 
+1185 : 91 07 __ STA (WORK + 4),y 
+1187 : a5 07 __ LDA WORK + 4 
+1189 : 91 1d __ STA (ACCU + 2),y 
+118b : c8 __ __ INY
+118c : b1 1b __ LDA (ACCU + 0),y 
+118e : 91 07 __ STA (WORK + 4),y 
+1190 : a5 08 __ LDA WORK + 5 
+1192 : 91 1d __ STA (ACCU + 2),y 
+1194 : c8 __ __ INY
+1195 : b1 1b __ LDA (ACCU + 0),y 
+1197 : 91 07 __ STA (WORK + 4),y 
+1199 : c8 __ __ INY
+119a : b1 1b __ LDA (ACCU + 0),y 
+119c : 91 07 __ STA (WORK + 4),y 
+119e : a0 00 __ LDY #$00
+11a0 : a5 05 __ LDA WORK + 2 
+11a2 : 91 1b __ STA (ACCU + 0),y 
+11a4 : c8 __ __ INY
+11a5 : a5 06 __ LDA WORK + 3 
+11a7 : 91 1b __ STA (ACCU + 0),y 
+11a9 : 18 __ __ CLC
+11aa : a5 1b __ LDA ACCU + 0 
+11ac : 69 02 __ ADC #$02
+11ae : 85 1b __ STA ACCU + 0 
+11b0 : 90 02 __ BCC $11b4 ; (crt_malloc + 205)
+11b2 : e6 1c __ INC ACCU + 1 
+11b4 : 60 __ __ RTS
+--------------------------------------------------------------------
+crt_free: ; crt_free
+11b5 : a5 1b __ LDA ACCU + 0 
+11b7 : 05 1c __ ORA ACCU + 1 
+11b9 : d0 01 __ BNE $11bc ; (crt_free + 7)
+11bb : 60 __ __ RTS
+11bc : 38 __ __ SEC
+11bd : a5 1b __ LDA ACCU + 0 
+11bf : e9 02 __ SBC #$02
+11c1 : 85 1b __ STA ACCU + 0 
+11c3 : b0 02 __ BCS $11c7 ; (crt_free + 18)
+11c5 : c6 1c __ DEC ACCU + 1 
+11c7 : a0 00 __ LDY #$00
+11c9 : b1 1b __ LDA (ACCU + 0),y 
+11cb : 85 1d __ STA ACCU + 2 
+11cd : c8 __ __ INY
+11ce : b1 1b __ LDA (ACCU + 0),y 
+11d0 : 85 1e __ STA ACCU + 3 
+11d2 : a9 f5 __ LDA #$f5
+11d4 : a2 16 __ LDX #$16
+11d6 : 85 05 __ STA WORK + 2 
+11d8 : 86 06 __ STX WORK + 3 
+11da : a0 01 __ LDY #$01
+11dc : b1 05 __ LDA (WORK + 2),y 
+11de : f0 28 __ BEQ $1208 ; (crt_free + 83)
+11e0 : aa __ __ TAX
+11e1 : 88 __ __ DEY
+11e2 : b1 05 __ LDA (WORK + 2),y 
+11e4 : e4 1e __ CPX ACCU + 3 
+11e6 : 90 ee __ BCC $11d6 ; (crt_free + 33)
+11e8 : d0 1e __ BNE $1208 ; (crt_free + 83)
+11ea : c5 1d __ CMP ACCU + 2 
+11ec : 90 e8 __ BCC $11d6 ; (crt_free + 33)
+11ee : d0 18 __ BNE $1208 ; (crt_free + 83)
+11f0 : a0 00 __ LDY #$00
+11f2 : b1 1d __ LDA (ACCU + 2),y 
+11f4 : 91 1b __ STA (ACCU + 0),y 
+11f6 : c8 __ __ INY
+11f7 : b1 1d __ LDA (ACCU + 2),y 
+11f9 : 91 1b __ STA (ACCU + 0),y 
+11fb : c8 __ __ INY
+11fc : b1 1d __ LDA (ACCU + 2),y 
+11fe : 91 1b __ STA (ACCU + 0),y 
+1200 : c8 __ __ INY
+1201 : b1 1d __ LDA (ACCU + 2),y 
+1203 : 91 1b __ STA (ACCU + 0),y 
+1205 : 4c 1d 12 JMP $121d ; (crt_free + 104)
+1208 : a0 00 __ LDY #$00
+120a : b1 05 __ LDA (WORK + 2),y 
+120c : 91 1b __ STA (ACCU + 0),y 
+120e : c8 __ __ INY
+120f : b1 05 __ LDA (WORK + 2),y 
+1211 : 91 1b __ STA (ACCU + 0),y 
+1213 : c8 __ __ INY
+1214 : a5 1d __ LDA ACCU + 2 
+1216 : 91 1b __ STA (ACCU + 0),y 
+1218 : c8 __ __ INY
+1219 : a5 1e __ LDA ACCU + 3 
+121b : 91 1b __ STA (ACCU + 0),y 
+121d : a0 02 __ LDY #$02
+121f : b1 05 __ LDA (WORK + 2),y 
+1221 : c5 1b __ CMP ACCU + 0 
+1223 : d0 1d __ BNE $1242 ; (crt_free + 141)
+1225 : c8 __ __ INY
+1226 : b1 05 __ LDA (WORK + 2),y 
+1228 : c5 1c __ CMP ACCU + 1 
+122a : d0 16 __ BNE $1242 ; (crt_free + 141)
+122c : a0 00 __ LDY #$00
+122e : b1 1b __ LDA (ACCU + 0),y 
+1230 : 91 05 __ STA (WORK + 2),y 
+1232 : c8 __ __ INY
+1233 : b1 1b __ LDA (ACCU + 0),y 
+1235 : 91 05 __ STA (WORK + 2),y 
+1237 : c8 __ __ INY
+1238 : b1 1b __ LDA (ACCU + 0),y 
+123a : 91 05 __ STA (WORK + 2),y 
+123c : c8 __ __ INY
+123d : b1 1b __ LDA (ACCU + 0),y 
+123f : 91 05 __ STA (WORK + 2),y 
+1241 : 60 __ __ RTS
+1242 : a0 00 __ LDY #$00
+1244 : a5 1b __ LDA ACCU + 0 
+1246 : 91 05 __ STA (WORK + 2),y 
+1248 : c8 __ __ INY
+1249 : a5 1c __ LDA ACCU + 1 
+124b : 91 05 __ STA (WORK + 2),y 
+124d : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_nop: ; inp_nop
+124e : 4c 5b 08 JMP $085b ; (startup + 90)
+--------------------------------------------------------------------
+inp_const_8: ; inp_const_8
+1251 : b1 19 __ LDA (IP + 0),y 
+1253 : aa __ __ TAX
+1254 : c8 __ __ INY
+1255 : b1 19 __ LDA (IP + 0),y 
+1257 : 95 00 __ STA $00,x 
+1259 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_p8: ; inp_const_p8
+125c : b1 19 __ LDA (IP + 0),y 
+125e : aa __ __ TAX
+125f : c8 __ __ INY
+1260 : b1 19 __ LDA (IP + 0),y 
+1262 : 95 00 __ STA $00,x 
+1264 : a9 00 __ LDA #$00
+1266 : 95 01 __ STA $01,x 
+1268 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_n8: ; inp_const_n8
+126b : b1 19 __ LDA (IP + 0),y 
+126d : aa __ __ TAX
+126e : c8 __ __ INY
+126f : b1 19 __ LDA (IP + 0),y 
+1271 : 95 00 __ STA $00,x 
+1273 : a9 ff __ LDA #$ff
+1275 : 95 01 __ STA $01,x 
+1277 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_reg_8: ; inp_load_reg_8
+127a : b1 19 __ LDA (IP + 0),y 
+127c : aa __ __ TAX
+127d : b5 00 __ LDA $00,x 
+127f : 85 1b __ STA ACCU + 0 
+1281 : a9 00 __ LDA #$00
+1283 : 85 1c __ STA ACCU + 1 
+1285 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_reg_8: ; inp_store_reg_8
+1288 : b1 19 __ LDA (IP + 0),y 
+128a : aa __ __ TAX
+128b : a5 1b __ LDA ACCU + 0 
+128d : 95 00 __ STA $00,x 
+128f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_reg_16: ; inp_load_reg_16
+1292 : b1 19 __ LDA (IP + 0),y 
+1294 : aa __ __ TAX
+1295 : b5 00 __ LDA $00,x 
+1297 : 85 1b __ STA ACCU + 0 
+1299 : b5 01 __ LDA $01,x 
+129b : 85 1c __ STA ACCU + 1 
+129d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_reg_16: ; inp_store_reg_16
+12a0 : b1 19 __ LDA (IP + 0),y 
+12a2 : aa __ __ TAX
+12a3 : a5 1b __ LDA ACCU + 0 
+12a5 : 95 00 __ STA $00,x 
+12a7 : a5 1c __ LDA ACCU + 1 
+12a9 : 95 01 __ STA $01,x 
+12ab : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_addr_reg: ; inp_addr_reg
+12ae : b1 19 __ LDA (IP + 0),y 
+12b0 : aa __ __ TAX
+12b1 : b5 00 __ LDA $00,x 
+12b3 : 85 1f __ STA ADDR + 0 
+12b5 : b5 01 __ LDA $01,x 
+12b7 : 85 20 __ STA ADDR + 1 
+12b9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_abs: ; inp_lea_abs
+12bc : b1 19 __ LDA (IP + 0),y 
+12be : aa __ __ TAX
+12bf : c8 __ __ INY
+12c0 : b1 19 __ LDA (IP + 0),y 
+12c2 : 95 00 __ STA $00,x 
+12c4 : c8 __ __ INY
+12c5 : b1 19 __ LDA (IP + 0),y 
+12c7 : 95 01 __ STA $01,x 
+12c9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_accu_index: ; inp_lea_accu_index
+12cc : b1 19 __ LDA (IP + 0),y 
+12ce : aa __ __ TAX
+12cf : 18 __ __ CLC
+12d0 : b5 00 __ LDA $00,x 
+12d2 : 65 1b __ ADC ACCU + 0 
+12d4 : 85 1f __ STA ADDR + 0 
+12d6 : b5 01 __ LDA $01,x 
+12d8 : 65 1c __ ADC ACCU + 1 
+12da : 85 20 __ STA ADDR + 1 
+12dc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_local_16: ; inp_load_local_16
+12df : b1 19 __ LDA (IP + 0),y 
+12e1 : aa __ __ TAX
+12e2 : c8 __ __ INY
+12e3 : b1 19 __ LDA (IP + 0),y 
+12e5 : 84 02 __ STY $02 
+12e7 : a8 __ __ TAY
+12e8 : b1 25 __ LDA (FP + 0),y 
+12ea : 95 00 __ STA $00,x 
+12ec : c8 __ __ INY
+12ed : b1 25 __ LDA (FP + 0),y 
+12ef : 95 01 __ STA $01,x 
+12f1 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_local_8: ; inp_store_local_8
+12f4 : b1 19 __ LDA (IP + 0),y 
+12f6 : aa __ __ TAX
+12f7 : c8 __ __ INY
+12f8 : b1 19 __ LDA (IP + 0),y 
+12fa : 84 02 __ STY $02 
+12fc : a8 __ __ TAY
+12fd : b5 00 __ LDA $00,x 
+12ff : 91 25 __ STA (FP + 0),y 
+1301 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_lea_local: ; inp_lea_local
+1304 : b1 19 __ LDA (IP + 0),y 
+1306 : aa __ __ TAX
+1307 : c8 __ __ INY
+1308 : 18 __ __ CLC
+1309 : b1 19 __ LDA (IP + 0),y 
+130b : 65 25 __ ADC FP + 0 
+130d : 95 00 __ STA $00,x 
+130f : c8 __ __ INY
+1310 : b1 19 __ LDA (IP + 0),y 
+1312 : 65 26 __ ADC FP + 1 
+1314 : 95 01 __ STA $01,x 
+1316 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_abs_8: ; inp_load_abs_8
+1319 : b1 19 __ LDA (IP + 0),y 
+131b : 85 1f __ STA ADDR + 0 
+131d : c8 __ __ INY
+131e : b1 19 __ LDA (IP + 0),y 
+1320 : 85 20 __ STA ADDR + 1 
+1322 : c8 __ __ INY
+1323 : b1 19 __ LDA (IP + 0),y 
+1325 : aa __ __ TAX
+1326 : 84 02 __ STY $02 
+1328 : a0 00 __ LDY #$00
+132a : b1 1f __ LDA (ADDR + 0),y 
+132c : 95 00 __ STA $00,x 
+132e : 4c 4f 08 JMP $084f ; (startup + 78)
+1331 : b1 19 __ LDA (IP + 0),y 
+1333 : aa __ __ TAX
+1334 : c8 __ __ INY
+1335 : b1 19 __ LDA (IP + 0),y 
+1337 : 84 02 __ STY $02 
+1339 : a8 __ __ TAY
+133a : 4c 2a 13 JMP $132a ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_u8: ; inp_load_abs_u8
+133d : b1 19 __ LDA (IP + 0),y 
+133f : 85 1f __ STA ADDR + 0 
+1341 : c8 __ __ INY
+1342 : b1 19 __ LDA (IP + 0),y 
+1344 : 85 20 __ STA ADDR + 1 
+1346 : c8 __ __ INY
+1347 : b1 19 __ LDA (IP + 0),y 
+1349 : aa __ __ TAX
+134a : 84 02 __ STY $02 
+134c : a0 00 __ LDY #$00
+134e : b1 1f __ LDA (ADDR + 0),y 
+1350 : 95 00 __ STA $00,x 
+1352 : a9 00 __ LDA #$00
+1354 : 95 01 __ STA $01,x 
+1356 : 4c 4f 08 JMP $084f ; (startup + 78)
+1359 : b1 19 __ LDA (IP + 0),y 
+135b : aa __ __ TAX
+135c : c8 __ __ INY
+135d : b1 19 __ LDA (IP + 0),y 
+135f : 84 02 __ STY $02 
+1361 : a8 __ __ TAY
+1362 : 4c 4e 13 JMP $134e ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16: ; inp_load_abs_16
+1365 : b1 19 __ LDA (IP + 0),y 
+1367 : 85 1f __ STA ADDR + 0 
+1369 : c8 __ __ INY
+136a : b1 19 __ LDA (IP + 0),y 
+136c : 85 20 __ STA ADDR + 1 
+136e : c8 __ __ INY
+136f : b1 19 __ LDA (IP + 0),y 
+1371 : aa __ __ TAX
+1372 : 84 02 __ STY $02 
+1374 : a0 00 __ LDY #$00
+1376 : b1 1f __ LDA (ADDR + 0),y 
+1378 : 95 00 __ STA $00,x 
+137a : c8 __ __ INY
+137b : b1 1f __ LDA (ADDR + 0),y 
+137d : 95 01 __ STA $01,x 
+137f : 4c 4f 08 JMP $084f ; (startup + 78)
+1382 : b1 19 __ LDA (IP + 0),y 
+1384 : aa __ __ TAX
+1385 : c8 __ __ INY
+1386 : b1 19 __ LDA (IP + 0),y 
+1388 : 84 02 __ STY $02 
+138a : a8 __ __ TAY
+138b : 4c 76 13 JMP $1376 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8: ; inp_store_abs_8
+138e : b1 19 __ LDA (IP + 0),y 
+1390 : 85 1f __ STA ADDR + 0 
+1392 : c8 __ __ INY
+1393 : b1 19 __ LDA (IP + 0),y 
+1395 : 85 20 __ STA ADDR + 1 
+1397 : c8 __ __ INY
+1398 : b1 19 __ LDA (IP + 0),y 
+139a : aa __ __ TAX
+139b : 84 02 __ STY $02 
+139d : a0 00 __ LDY #$00
+139f : b5 00 __ LDA $00,x 
+13a1 : 91 1f __ STA (ADDR + 0),y 
+13a3 : 4c 4f 08 JMP $084f ; (startup + 78)
+13a6 : b1 19 __ LDA (IP + 0),y 
+13a8 : aa __ __ TAX
+13a9 : c8 __ __ INY
+13aa : b1 19 __ LDA (IP + 0),y 
+13ac : 84 02 __ STY $02 
+13ae : a8 __ __ TAY
+13af : 4c 9f 13 JMP $139f ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16: ; inp_store_abs_16
+13b2 : b1 19 __ LDA (IP + 0),y 
+13b4 : 85 1f __ STA ADDR + 0 
+13b6 : c8 __ __ INY
+13b7 : b1 19 __ LDA (IP + 0),y 
+13b9 : 85 20 __ STA ADDR + 1 
+13bb : c8 __ __ INY
+13bc : b1 19 __ LDA (IP + 0),y 
+13be : aa __ __ TAX
+13bf : 84 02 __ STY $02 
+13c1 : a0 00 __ LDY #$00
+13c3 : b5 00 __ LDA $00,x 
+13c5 : 91 1f __ STA (ADDR + 0),y 
+13c7 : c8 __ __ INY
+13c8 : b5 01 __ LDA $01,x 
+13ca : 91 1f __ STA (ADDR + 0),y 
+13cc : 4c 4f 08 JMP $084f ; (startup + 78)
+13cf : b1 19 __ LDA (IP + 0),y 
+13d1 : aa __ __ TAX
+13d2 : c8 __ __ INY
+13d3 : b1 19 __ LDA (IP + 0),y 
+13d5 : 84 02 __ STY $02 
+13d7 : a8 __ __ TAY
+13d8 : 4c c3 13 JMP $13c3 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16: ; inp_binop_addr_16
+13db : b1 19 __ LDA (IP + 0),y 
+13dd : aa __ __ TAX
+13de : 18 __ __ CLC
+13df : a5 1b __ LDA ACCU + 0 
+13e1 : 75 00 __ ADC $00,x 
+13e3 : 85 1b __ STA ACCU + 0 
+13e5 : a5 1c __ LDA ACCU + 1 
+13e7 : 75 01 __ ADC $01,x 
+13e9 : 85 1c __ STA ACCU + 1 
+13eb : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_subr_16: ; inp_binop_subr_16
+13ee : b1 19 __ LDA (IP + 0),y 
+13f0 : aa __ __ TAX
+13f1 : 38 __ __ SEC
+13f2 : a5 1b __ LDA ACCU + 0 
+13f4 : f5 00 __ SBC $00,x 
+13f6 : 85 1b __ STA ACCU + 0 
+13f8 : a5 1c __ LDA ACCU + 1 
+13fa : f5 01 __ SBC $01,x 
+13fc : 85 1c __ STA ACCU + 1 
+13fe : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_divr_u16: ; inp_binop_divr_u16
+1401 : b1 19 __ LDA (IP + 0),y 
+1403 : aa __ __ TAX
+1404 : b5 00 __ LDA $00,x 
+1406 : 85 03 __ STA WORK + 0 
+1408 : b5 01 __ LDA $01,x 
+140a : 85 04 __ STA WORK + 1 
+140c : 84 02 __ STY $02 
+140e : 20 5c 10 JSR $105c ; (divmod + 0)
+1411 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_binop_modr_u16: ; inp_binop_modr_u16
+1414 : b1 19 __ LDA (IP + 0),y 
+1416 : aa __ __ TAX
+1417 : b5 00 __ LDA $00,x 
+1419 : 85 03 __ STA WORK + 0 
+141b : b5 01 __ LDA $01,x 
+141d : 85 04 __ STA WORK + 1 
+141f : 84 02 __ STY $02 
+1421 : 20 5c 10 JSR $105c ; (divmod + 0)
+1424 : a5 05 __ LDA WORK + 2 
+1426 : 85 1b __ STA ACCU + 0 
+1428 : a5 06 __ LDA WORK + 3 
+142a : 85 1c __ STA ACCU + 1 
+142c : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_binop_adda_16: ; inp_binop_adda_16
+142f : b1 19 __ LDA (IP + 0),y 
+1431 : aa __ __ TAX
+1432 : 18 __ __ CLC
+1433 : b5 00 __ LDA $00,x 
+1435 : 65 1b __ ADC ACCU + 0 
+1437 : 95 00 __ STA $00,x 
+1439 : b5 01 __ LDA $01,x 
+143b : 65 1c __ ADC ACCU + 1 
+143d : 95 01 __ STA $01,x 
+143f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_addi_16: ; inp_binop_addi_16
+1442 : b1 19 __ LDA (IP + 0),y 
+1444 : c8 __ __ INY
+1445 : aa __ __ TAX
+1446 : 18 __ __ CLC
+1447 : b5 00 __ LDA $00,x 
+1449 : 71 19 __ ADC (IP + 0),y 
+144b : c8 __ __ INY
+144c : 95 00 __ STA $00,x 
+144e : b5 01 __ LDA $01,x 
+1450 : 71 19 __ ADC (IP + 0),y 
+1452 : 95 01 __ STA $01,x 
+1454 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_subi_16: ; inp_binop_subi_16
+1457 : b1 19 __ LDA (IP + 0),y 
+1459 : c8 __ __ INY
+145a : aa __ __ TAX
+145b : 38 __ __ SEC
+145c : b1 19 __ LDA (IP + 0),y 
+145e : c8 __ __ INY
+145f : f5 00 __ SBC $00,x 
+1461 : 95 00 __ STA $00,x 
+1463 : b1 19 __ LDA (IP + 0),y 
+1465 : f5 01 __ SBC $01,x 
+1467 : 95 01 __ STA $01,x 
+1469 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_andi_16: ; inp_binop_andi_16
+146c : b1 19 __ LDA (IP + 0),y 
+146e : c8 __ __ INY
+146f : aa __ __ TAX
+1470 : b5 00 __ LDA $00,x 
+1472 : 31 19 __ AND (IP + 0),y 
+1474 : c8 __ __ INY
+1475 : 95 00 __ STA $00,x 
+1477 : b5 01 __ LDA $01,x 
+1479 : 31 19 __ AND (IP + 0),y 
+147b : 95 01 __ STA $01,x 
+147d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_addi_8: ; inp_binop_addi_8
+1480 : b1 19 __ LDA (IP + 0),y 
+1482 : c8 __ __ INY
+1483 : aa __ __ TAX
+1484 : 18 __ __ CLC
+1485 : b5 00 __ LDA $00,x 
+1487 : 71 19 __ ADC (IP + 0),y 
+1489 : 95 00 __ STA $00,x 
+148b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+cmp16: ; cmp16
+148e : b1 19 __ LDA (IP + 0),y 
+1490 : aa __ __ TAX
+1491 : 38 __ __ SEC
+1492 : b5 01 __ LDA $01,x 
+1494 : e5 1c __ SBC ACCU + 1 
+1496 : f0 11 __ BEQ $14a9 ; (cmp16 + 27)
+1498 : 50 02 __ BVC $149c ; (cmp16 + 14)
+149a : 49 80 __ EOR #$80
+149c : 30 2a __ BMI $14c8 ; (cmp16 + 58)
+149e : 10 33 __ BPL $14d3 ; (cmp16 + 69)
+14a0 : b1 19 __ LDA (IP + 0),y 
+14a2 : aa __ __ TAX
+14a3 : b5 01 __ LDA $01,x 
+14a5 : c5 1c __ CMP ACCU + 1 
+14a7 : d0 28 __ BNE $14d1 ; (cmp16 + 67)
+14a9 : b5 00 __ LDA $00,x 
+14ab : c5 1b __ CMP ACCU + 0 
+14ad : d0 22 __ BNE $14d1 ; (cmp16 + 67)
+14af : f0 0e __ BEQ $14bf ; (cmp16 + 49)
+14b1 : b1 19 __ LDA (IP + 0),y 
+14b3 : aa __ __ TAX
+14b4 : c8 __ __ INY
+14b5 : b1 19 __ LDA (IP + 0),y 
+14b7 : c5 1c __ CMP ACCU + 1 
+14b9 : d0 16 __ BNE $14d1 ; (cmp16 + 67)
+14bb : e4 1b __ CPX ACCU + 0 
+14bd : d0 12 __ BNE $14d1 ; (cmp16 + 67)
+14bf : a9 00 __ LDA #$00
+14c1 : 85 1b __ STA ACCU + 0 
+14c3 : 85 1c __ STA ACCU + 1 
+14c5 : 4c 51 08 JMP $0851 ; (startup + 80)
+14c8 : a9 ff __ LDA #$ff
+14ca : 85 1b __ STA ACCU + 0 
+14cc : 85 1c __ STA ACCU + 1 
+14ce : 4c 51 08 JMP $0851 ; (startup + 80)
+14d1 : 90 f5 __ BCC $14c8 ; (cmp16 + 58)
+14d3 : a9 01 __ LDA #$01
+14d5 : 85 1b __ STA ACCU + 0 
+14d7 : a9 00 __ LDA #$00
+14d9 : 85 1c __ STA ACCU + 1 
+14db : 4c 51 08 JMP $0851 ; (startup + 80)
+14de : b1 19 __ LDA (IP + 0),y 
+14e0 : c8 __ __ INY
+14e1 : aa __ __ TAX
+14e2 : b1 19 __ LDA (IP + 0),y 
+14e4 : 38 __ __ SEC
+14e5 : e5 1c __ SBC ACCU + 1 
+14e7 : d0 af __ BNE $1498 ; (cmp16 + 10)
+14e9 : e4 1b __ CPX ACCU + 0 
+14eb : d0 e4 __ BNE $14d1 ; (cmp16 + 67)
+14ed : f0 d0 __ BEQ $14bf ; (cmp16 + 49)
+14ef : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8: ; cmp8
+14f0 : b1 19 __ LDA (IP + 0),y 
+14f2 : aa __ __ TAX
+14f3 : 38 __ __ SEC
+14f4 : b5 00 __ LDA $00,x 
+14f6 : e5 1b __ SBC ACCU + 0 
+14f8 : f0 19 __ BEQ $1513 ; (cmp8 + 35)
+14fa : 50 02 __ BVC $14fe ; (cmp8 + 14)
+14fc : 49 80 __ EOR #$80
+14fe : 30 1c __ BMI $151c ; (cmp8 + 44)
+1500 : 10 25 __ BPL $1527 ; (cmp8 + 55)
+1502 : b1 19 __ LDA (IP + 0),y 
+1504 : aa __ __ TAX
+1505 : b5 00 __ LDA $00,x 
+1507 : c5 1b __ CMP ACCU + 0 
+1509 : d0 1a __ BNE $1525 ; (cmp8 + 53)
+150b : f0 06 __ BEQ $1513 ; (cmp8 + 35)
+150d : b1 19 __ LDA (IP + 0),y 
+150f : c5 1b __ CMP ACCU + 0 
+1511 : d0 12 __ BNE $1525 ; (cmp8 + 53)
+1513 : a9 00 __ LDA #$00
+1515 : 85 1b __ STA ACCU + 0 
+1517 : 85 1c __ STA ACCU + 1 
+1519 : 4c 51 08 JMP $0851 ; (startup + 80)
+151c : a9 ff __ LDA #$ff
+151e : 85 1b __ STA ACCU + 0 
+1520 : 85 1c __ STA ACCU + 1 
+1522 : 4c 51 08 JMP $0851 ; (startup + 80)
+1525 : 90 f5 __ BCC $151c ; (cmp8 + 44)
+1527 : a9 01 __ LDA #$01
+1529 : 85 1b __ STA ACCU + 0 
+152b : a9 00 __ LDA #$00
+152d : 85 1c __ STA ACCU + 1 
+152f : 4c 51 08 JMP $0851 ; (startup + 80)
+1532 : b1 19 __ LDA (IP + 0),y 
+1534 : 38 __ __ SEC
+1535 : e5 1b __ SBC ACCU + 0 
+1537 : d0 c1 __ BNE $14fa ; (cmp8 + 10)
+1539 : f0 d8 __ BEQ $1513 ; (cmp8 + 35)
+153b : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16: ; inp_op_negate_16
+153c : 38 __ __ SEC
+153d : a9 00 __ LDA #$00
+153f : e5 1b __ SBC ACCU + 0 
+1541 : 85 1b __ STA ACCU + 0 
+1543 : a9 00 __ LDA #$00
+1545 : e5 1c __ SBC ACCU + 1 
+1547 : 85 1c __ STA ACCU + 1 
+1549 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+bra: ; bra
+154c : b1 19 __ LDA (IP + 0),y 
+154e : 30 0c __ BMI $155c ; (bra + 16)
+1550 : 38 __ __ SEC
+1551 : 65 19 __ ADC IP + 0 
+1553 : 85 19 __ STA IP + 0 
+1555 : 90 02 __ BCC $1559 ; (bra + 13)
+1557 : e6 1a __ INC IP + 1 
+1559 : 4c 5b 08 JMP $085b ; (startup + 90)
+155c : 38 __ __ SEC
+155d : 65 19 __ ADC IP + 0 
+155f : 85 19 __ STA IP + 0 
+1561 : b0 02 __ BCS $1565 ; (bra + 25)
+1563 : c6 1a __ DEC IP + 1 
+1565 : 4c 5b 08 JMP $085b ; (startup + 90)
+1568 : a5 1b __ LDA ACCU + 0 
+156a : 05 1c __ ORA ACCU + 1 
+156c : f0 de __ BEQ $154c ; (bra + 0)
+156e : 4c 51 08 JMP $0851 ; (startup + 80)
+1571 : a5 1b __ LDA ACCU + 0 
+1573 : 05 1c __ ORA ACCU + 1 
+1575 : d0 d5 __ BNE $154c ; (bra + 0)
+1577 : 4c 51 08 JMP $0851 ; (startup + 80)
+157a : a5 1c __ LDA ACCU + 1 
+157c : 30 04 __ BMI $1582 ; (bra + 54)
+157e : 05 1b __ ORA ACCU + 0 
+1580 : d0 ca __ BNE $154c ; (bra + 0)
+1582 : 4c 51 08 JMP $0851 ; (startup + 80)
+1585 : a5 1c __ LDA ACCU + 1 
+1587 : 10 c3 __ BPL $154c ; (bra + 0)
+1589 : 4c 51 08 JMP $0851 ; (startup + 80)
+158c : a5 1c __ LDA ACCU + 1 
+158e : 30 bc __ BMI $154c ; (bra + 0)
+1590 : 4c 51 08 JMP $0851 ; (startup + 80)
+1593 : a5 1c __ LDA ACCU + 1 
+1595 : 30 b5 __ BMI $154c ; (bra + 0)
+1597 : 05 1b __ ORA ACCU + 0 
+1599 : f0 b1 __ BEQ $154c ; (bra + 0)
+159b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+braf: ; braf
+159e : 38 __ __ SEC
+159f : b1 19 __ LDA (IP + 0),y 
+15a1 : 65 19 __ ADC IP + 0 
+15a3 : aa __ __ TAX
+15a4 : c8 __ __ INY
+15a5 : b1 19 __ LDA (IP + 0),y 
+15a7 : 65 1a __ ADC IP + 1 
+15a9 : 85 1a __ STA IP + 1 
+15ab : 86 19 __ STX IP + 0 
+15ad : 4c 5b 08 JMP $085b ; (startup + 90)
+15b0 : a5 1b __ LDA ACCU + 0 
+15b2 : 05 1c __ ORA ACCU + 1 
+15b4 : f0 e8 __ BEQ $159e ; (braf + 0)
+15b6 : c8 __ __ INY
+15b7 : 4c 51 08 JMP $0851 ; (startup + 80)
+15ba : a5 1b __ LDA ACCU + 0 
+15bc : 05 1c __ ORA ACCU + 1 
+15be : d0 de __ BNE $159e ; (braf + 0)
+15c0 : c8 __ __ INY
+15c1 : 4c 51 08 JMP $0851 ; (startup + 80)
+15c4 : a5 1c __ LDA ACCU + 1 
+15c6 : 30 04 __ BMI $15cc ; (braf + 46)
+15c8 : 05 1b __ ORA ACCU + 0 
+15ca : d0 d2 __ BNE $159e ; (braf + 0)
+15cc : c8 __ __ INY
+15cd : 4c 51 08 JMP $0851 ; (startup + 80)
+15d0 : a5 1c __ LDA ACCU + 1 
+15d2 : 10 ca __ BPL $159e ; (braf + 0)
+15d4 : c8 __ __ INY
+15d5 : 4c 51 08 JMP $0851 ; (startup + 80)
+15d8 : a5 1c __ LDA ACCU + 1 
+15da : 30 c2 __ BMI $159e ; (braf + 0)
+15dc : c8 __ __ INY
+15dd : 4c 51 08 JMP $0851 ; (startup + 80)
+15e0 : a5 1c __ LDA ACCU + 1 
+15e2 : 30 ba __ BMI $159e ; (braf + 0)
+15e4 : 05 1b __ ORA ACCU + 0 
+15e6 : f0 b6 __ BEQ $159e ; (braf + 0)
+15e8 : c8 __ __ INY
+15e9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_malloc: ; inp_malloc
+15ec : 84 02 __ STY $02 
+15ee : 20 e7 10 JSR $10e7 ; (crt_malloc + 0)
+15f1 : a4 02 __ LDY $02 
+15f3 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_free: ; inp_free
+15f6 : 84 02 __ STY $02 
+15f8 : 20 b5 11 JSR $11b5 ; (crt_free + 0)
+15fb : a4 02 __ LDY $02 
+15fd : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_jsr: ; inp_jsr
+1600 : b1 19 __ LDA (IP + 0),y 
+1602 : 8d 16 16 STA $1616 ; (inp_jsr + 22)
+1605 : c8 __ __ INY
+1606 : b1 19 __ LDA (IP + 0),y 
+1608 : 8d 17 16 STA $1617 ; (inp_jsr + 23)
+160b : 98 __ __ TYA
+160c : 38 __ __ SEC
+160d : 65 19 __ ADC IP + 0 
+160f : 85 19 __ STA IP + 0 
+1611 : 90 02 __ BCC $1615 ; (inp_jsr + 21)
+1613 : e6 1a __ INC IP + 1 
+1615 : 20 00 00 JSR $0000 
+1618 : 4c 4b 08 JMP $084b ; (startup + 74)
+--------------------------------------------------------------------
+inp_native: ; inp_native
+161b : 98 __ __ TYA
+161c : 18 __ __ CLC
+161d : 65 19 __ ADC IP + 0 
+161f : 8d 2a 16 STA $162a ; (inp_native + 15)
+1622 : a5 1a __ LDA IP + 1 
+1624 : 69 00 __ ADC #$00
+1626 : 8d 2b 16 STA $162b ; (inp_native + 16)
+1629 : 20 00 00 JSR $0000 
+162c : a0 00 __ LDY #$00
+162e : b1 23 __ LDA (SP + 0),y 
+1630 : 85 19 __ STA IP + 0 
+1632 : c8 __ __ INY
+1633 : b1 23 __ LDA (SP + 0),y 
+1635 : 85 1a __ STA IP + 1 
+1637 : 88 __ __ DEY
+1638 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_enter: ; inp_enter
+163b : 38 __ __ SEC
+163c : a5 23 __ LDA SP + 0 
+163e : f1 19 __ SBC (IP + 0),y 
+1640 : c8 __ __ INY
+1641 : 85 23 __ STA SP + 0 
+1643 : a5 24 __ LDA SP + 1 
+1645 : f1 19 __ SBC (IP + 0),y 
+1647 : c8 __ __ INY
+1648 : 85 24 __ STA SP + 1 
+164a : b1 19 __ LDA (IP + 0),y 
+164c : 84 02 __ STY $02 
+164e : a8 __ __ TAY
+164f : a5 25 __ LDA FP + 0 
+1651 : 91 23 __ STA (SP + 0),y 
+1653 : c8 __ __ INY
+1654 : a5 26 __ LDA FP + 1 
+1656 : 91 23 __ STA (SP + 0),y 
+1658 : 98 __ __ TYA
+1659 : 38 __ __ SEC
+165a : 65 23 __ ADC SP + 0 
+165c : 85 25 __ STA FP + 0 
+165e : a9 00 __ LDA #$00
+1660 : 65 24 __ ADC SP + 1 
+1662 : 85 26 __ STA FP + 1 
+1664 : 88 __ __ DEY
+1665 : f0 08 __ BEQ $166f ; (inp_enter + 52)
+1667 : b9 52 00 LDA $0052,y 
+166a : 88 __ __ DEY
+166b : 91 23 __ STA (SP + 0),y 
+166d : d0 f8 __ BNE $1667 ; (inp_enter + 44)
+166f : a4 02 __ LDY $02 
+1671 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_return: ; inp_return
+1674 : b1 19 __ LDA (IP + 0),y 
+1676 : c8 __ __ INY
+1677 : 84 02 __ STY $02 
+1679 : a8 __ __ TAY
+167a : b1 23 __ LDA (SP + 0),y 
+167c : 85 25 __ STA FP + 0 
+167e : c8 __ __ INY
+167f : b1 23 __ LDA (SP + 0),y 
+1681 : 85 26 __ STA FP + 1 
+1683 : 88 __ __ DEY
+1684 : f0 09 __ BEQ $168f ; (inp_return + 27)
+1686 : 88 __ __ DEY
+1687 : b1 23 __ LDA (SP + 0),y 
+1689 : 99 53 00 STA $0053,y 
+168c : 88 __ __ DEY
+168d : 10 f8 __ BPL $1687 ; (inp_return + 19)
+168f : a4 02 __ LDY $02 
+1691 : 18 __ __ CLC
+1692 : b1 19 __ LDA (IP + 0),y 
+1694 : c8 __ __ INY
+1695 : 65 23 __ ADC SP + 0 
+1697 : 85 23 __ STA SP + 0 
+1699 : b1 19 __ LDA (IP + 0),y 
+169b : c8 __ __ INY
+169c : 65 24 __ ADC SP + 1 
+169e : 85 24 __ STA SP + 1 
+16a0 : a0 01 __ LDY #$01
+16a2 : b1 23 __ LDA (SP + 0),y 
+16a4 : 85 1a __ STA IP + 1 
+16a6 : 88 __ __ DEY
+16a7 : b1 23 __ LDA (SP + 0),y 
+16a9 : 85 19 __ STA IP + 0 
+16ab : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_call: ; inp_call
+16ae : b1 19 __ LDA (IP + 0),y 
+16b0 : 85 1f __ STA ADDR + 0 
+16b2 : c8 __ __ INY
+16b3 : b1 19 __ LDA (IP + 0),y 
+16b5 : 85 20 __ STA ADDR + 1 
+16b7 : c8 __ __ INY
+16b8 : 98 __ __ TYA
+16b9 : a0 00 __ LDY #$00
+16bb : 18 __ __ CLC
+16bc : 65 19 __ ADC IP + 0 
+16be : 91 23 __ STA (SP + 0),y 
+16c0 : c8 __ __ INY
+16c1 : a5 1a __ LDA IP + 1 
+16c3 : 69 00 __ ADC #$00
+16c5 : 91 23 __ STA (SP + 0),y 
+16c7 : a5 1f __ LDA ADDR + 0 
+16c9 : 85 19 __ STA IP + 0 
+16cb : a5 20 __ LDA ADDR + 1 
+16cd : 85 1a __ STA IP + 1 
+16cf : 4c 4b 08 JMP $084b ; (startup + 74)
+--------------------------------------------------------------------
+inp_push_frame: ; inp_push_frame
+16d2 : 38 __ __ SEC
+16d3 : a5 23 __ LDA SP + 0 
+16d5 : f1 19 __ SBC (IP + 0),y 
+16d7 : c8 __ __ INY
+16d8 : 85 23 __ STA SP + 0 
+16da : a5 24 __ LDA SP + 1 
+16dc : f1 19 __ SBC (IP + 0),y 
+16de : 85 24 __ STA SP + 1 
+16e0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_pop_frame: ; inp_pop_frame
+16e3 : 18 __ __ CLC
+16e4 : b1 19 __ LDA (IP + 0),y 
+16e6 : c8 __ __ INY
+16e7 : 65 23 __ ADC SP + 0 
+16e9 : 85 23 __ STA SP + 0 
+16eb : b1 19 __ LDA (IP + 0),y 
+16ed : 65 24 __ ADC SP + 1 
+16ef : 85 24 __ STA SP + 1 
+16f1 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+spentry:
+16f4 : __ __ __ BYT 00                                              : .
+--------------------------------------------------------------------
+HeapNode:
+16f5 : __ __ __ BSS	4
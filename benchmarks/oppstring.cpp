@@ -0,0 +1,31 @@
+#include <opp/string.h>
+
+using namespace opp;
+
+int main(void)
+{
+	string	s;
+
+	for(char i=0; i<20; i++)
+	{
+		string	t("item");
+		t += to_string(int(i));
+		s += t;
+		s += ",";
+	}
+
+	int	n = 0;
+	for(int i=0; i<s.size(); i++)
+		if (s[i] == ',')
+			n++;
+
+	string	u = s.substr(4, 10);
+	if (u != string("0,item1,it"))
+		return 1;
+
+	int	p = s.find("item19");
+	if (p < 0)
+		return 2;
+
+	return n == 20 ? 0 : 3;
+}
@@ -0,0 +1,49 @@
+#include <math.h>
+#include <string.h>
+
+static const char sintab[256] = {
+#for(i,256) (char)(128 + 127 * sin(i * PI / 128)),
+};
+
+char	screen[1000];
+char	xbuf[40], ybuf[25];
+
+void plasma(char c1a, char c1b, char c2a, char c2b)
+{
+	for(char i=0; i<25; i++)
+	{
+		ybuf[i] = sintab[c1a] + sintab[c1b];
+		c1a += 4;
+		c1b += 9;
+	}
+
+	for(char i=0; i<40; i++)
+	{
+		xbuf[i] = sintab[c2a] + sintab[c2b];
+		c2a += 3;
+		c2b += 7;
+	}
+
+	char	*	sp = screen;
+	for(char y=0; y<25; y++)
+	{
+		char	t = ybuf[y];
+		for(char x=0; x<40; x++)
+			sp[x] = (xbuf[x] + t) >> 4;
+		sp += 40;
+	}
+}
+
+int main(void)
+{
+	unsigned	sum = 0;
+
+	for(char f=0; f<8; f++)
+	{
+		plasma(f * 3, f * 5, f * 2, f * 7);
+		for(int i=0; i<1000; i++)
+			sum += screen[i];
+	}
+
+	return sum == 0;
+}
@@ -0,0 +1,738 @@
+; Compiled with 1.32.273
+--------------------------------------------------------------------
+startup: ; startup
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f ; (startup + 62)
+0809 : 31 00 __ AND ($00),y 
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e bc 0e STX $0ebc ; (spentry + 0)
+0811 : a2 0e __ LDX #$0e
+0813 : a0 bd __ LDY #$bd
+0815 : a9 00 __ LDA #$00
+0817 : 85 19 __ STA IP + 0 
+0819 : 86 1a __ STX IP + 1 
+081b : e0 11 __ CPX #$11
+081d : f0 0b __ BEQ $082a ; (startup + 41)
+081f : 91 19 __ STA (IP + 0),y 
+0821 : c8 __ __ INY
+0822 : d0 fb __ BNE $081f ; (startup + 30)
+0824 : e8 __ __ INX
+0825 : d0 f2 __ BNE $0819 ; (startup + 24)
+0827 : 91 19 __ STA (IP + 0),y 
+0829 : c8 __ __ INY
+082a : c0 de __ CPY #$de
+082c : d0 f9 __ BNE $0827 ; (startup + 38)
+082e : a9 00 __ LDA #$00
+0830 : a2 f7 __ LDX #$f7
+0832 : d0 03 __ BNE $0837 ; (startup + 54)
+0834 : 95 00 __ STA $00,x 
+0836 : e8 __ __ INX
+0837 : e0 f7 __ CPX #$f7
+0839 : d0 f9 __ BNE $0834 ; (startup + 51)
+083b : a9 fe __ LDA #$fe
+083d : 85 23 __ STA SP + 0 
+083f : a9 9f __ LDA #$9f
+0841 : 85 24 __ STA SP + 1 
+0843 : a9 69 __ LDA #$69
+0845 : 85 19 __ STA IP + 0 
+0847 : a9 08 __ LDA #$08
+0849 : 85 1a __ STA IP + 1 
+084b : a0 00 __ LDY #$00
+084d : f0 03 __ BEQ $0852 ; (startup + 81)
+084f : a4 02 __ LDY $02 
+0851 : c8 __ __ INY
+0852 : b1 19 __ LDA (IP + 0),y 
+0854 : 8d 59 08 STA $0859 ; (startup + 88)
+0857 : c8 __ __ INY
+0858 : 6c 00 09 JMP ($0900)
+085b : 98 __ __ TYA
+085c : a0 00 __ LDY #$00
+085e : 18 __ __ CLC
+085f : 65 19 __ ADC IP + 0 
+0861 : 85 19 __ STA IP + 0 
+0863 : 90 ed __ BCC $0852 ; (startup + 81)
+0865 : e6 1a __ INC IP + 1 
+0867 : d0 e9 __ BNE $0852 ; (startup + 81)
+0869 : f2 __ __ INV
+086a : 00 __ __ BRK
+086b : 0a __ __ ASL
+086c : 02 __ __ INV
+086d : a9 4c __ LDA #$4c
+086f : 85 54 __ STA $54 
+0871 : a9 00 __ LDA #$00
+0873 : 85 13 __ STA P6 
+0875 : a9 19 __ LDA #$19
+0877 : 85 16 __ STA P9 
+0879 : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	0, 2
+0a04:	PUSH	#$0006
+0a07:	MOV	T0, #$7ab7
+0a0b:	LEA	T1, data + 0
+0a0f:	MOV	T2, #$fe70
+0a13:	MOV	ACCU, #$0805
+0a17:	MUL	ACCU, T0
+0a19:	MOV	T0, ACCU
+0a1b:	ADD	T0, #$3619
+0a1f:	MOV	ADDR, T1
+0a21:	MOV	0(ADDR), T0
+0a24:	ADD	T1, #$0002
+0a28:	ADD	T2, #$0001
+0a2c:	MOV	ACCU, T2
+0a2e:	BNE	$0A13
+0a30:	MOV	ACCU, #$0190
+0a34:	MOV	4(SP), ACCU
+0a37:	LEA	T0, data + 0
+0a3b:	MOV	2(SP), T0
+0a3e:	CALL	qsortr + 0
+0a41:	MOV	T0, #1
+0a44:	MOV	ACCU, T0
+0a46:	SHL	ACCU, #1
+0a48:	LEAX	ADDR, spentry + 0 + ACCU
+0a4c:	MOV	T2, 0(ADDR)
+0a4f:	MOV	ACCU, 2(ADDR)
+0a52:	CMPS	ACCU, T2
+0a54:	BLE	$0A60
+0a56:	MOV	ACCU, #1
+0a59:	POP	#$0006
+0a5c:	RETURN	0, 2
+0a60:	ADD	T0, #$0001
+0a64:	MOV	ACCU, T0
+0a66:	CMPU	ACCU, #$0190
+0a69:	BGT	$0A44
+0a6b:	MOV	ACCU, #0
+0a6e:	JUMP	$0A59
+--------------------------------------------------------------------
+qsortr:
+0a70:	ENTER	6, 8
+0a74:	PUSH	#$0006
+0a77:	MOV	T0, 4(FP)
+0a7a:	MOV	ACCU, T0
+0a7c:	CMPS	ACCU, #$0001
+0a7f:	BLT	$0A88
+0a81:	POP	#$0006
+0a84:	RETURN	6, 8
+0a88:	MOV	ACCU, T0
+0a8a:	ADD	ACCU, #$FFFF
+0a8e:	MOV	T1, ACCU
+0a90:	MOV	T2, #0
+0a93:	AND	T0, #$7FFE
+0a97:	MOV	T3, 2(FP)
+0a9a:	MOV	ACCU, T3
+0a9c:	LEAX	ADDR, T0 + ACCU
+0a9e:	MOV	T0, 0(ADDR)
+0aa1:	MOV	ACCU, T1
+0aa3:	CMPS	ACCU, T2
+0aa5:	BGT	$0AF3
+0aa7:	MOV	ACCU, T2
+0aa9:	SHL	ACCU, #1
+0aab:	ADD	ACCU, T3
+0aad:	MOV	T4, ACCU
+0aaf:	MOV	ADDR, T4
+0ab1:	MOV	T5, 0(ADDR)
+0ab4:	MOV	ACCU, T0
+0ab6:	CMPS	ACCU, T5
+0ab8:	BGE	$0AC0
+0aba:	ADD	T2, #$0001
+0abe:	JUMP	$0AA7
+0ac0:	MOV	ACCU, T1
+0ac2:	SHL	ACCU, #1
+0ac4:	ADD	ACCU, T3
+0ac6:	MOV	T6, ACCU
+0ac8:	MOV	ADDR, T6
+0aca:	MOV	T7, 0(ADDR)
+0acd:	MOV	ACCU, T0
+0acf:	CMPS	ACCU, T7
+0ad1:	BLE	$0AD9
+0ad3:	ADD	T1, #$FFFF
+0ad7:	JUMP	$0AC0
+0ad9:	MOV	ACCU, T1
+0adb:	CMPS	ACCU, T2
+0add:	BGT	$0AF3
+0adf:	MOV	ADDR, T4
+0ae1:	MOV	0(ADDR), T7
+0ae4:	MOV	ADDR, T6
+0ae6:	MOV	0(ADDR), T5
+0ae9:	ADD	T2, #$0001
+0aed:	ADD	T1, #$FFFF
+0af1:	JUMP	$0AA1
+0af3:	MOV	ACCU, T2
+0af5:	SHL	ACCU, #1
+0af7:	ADD	ACCU, T3
+0af9:	MOV	T4, ACCU
+0afb:	MOV	ACCU, 4(FP)
+0afe:	SUB	ACCU, T2
+0b00:	MOV	T0, ACCU
+0b02:	ADD	T1, #$0001
+0b06:	CMPS	ACCU, T1
+0b08:	BLT	$0B19
+0b0a:	MOV	2(SP), T4
+0b0d:	MOV	4(SP), T0
+0b10:	CALL	qsortr + 0
+0b13:	MOV	4(FP), T1
+0b16:	JUMPF	$0A77
+0b19:	MOV	2(SP), T3
+0b1c:	MOV	4(SP), T1
+0b1f:	CALL	qsortr + 0
+0b22:	MOV	2(FP), T4
+0b25:	MOV	4(FP), T0
+0b28:	JUMPF	$0A77
+--------------------------------------------------------------------
+inp_nop: ; inp_nop
+0b2b : 4c 5b 08 JMP $085b ; (startup + 90)
+--------------------------------------------------------------------
+inp_const_p8: ; inp_const_p8
+0b2e : b1 19 __ LDA (IP + 0),y 
+0b30 : aa __ __ TAX
+0b31 : c8 __ __ INY
+0b32 : b1 19 __ LDA (IP + 0),y 
+0b34 : 95 00 __ STA $00,x 
+0b36 : a9 00 __ LDA #$00
+0b38 : 95 01 __ STA $01,x 
+0b3a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_16: ; inp_const_16
+0b3d : b1 19 __ LDA (IP + 0),y 
+0b3f : aa __ __ TAX
+0b40 : c8 __ __ INY
+0b41 : b1 19 __ LDA (IP + 0),y 
+0b43 : 95 00 __ STA $00,x 
+0b45 : c8 __ __ INY
+0b46 : b1 19 __ LDA (IP + 0),y 
+0b48 : 95 01 __ STA $01,x 
+0b4a : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_reg_16: ; inp_load_reg_16
+0b4d : b1 19 __ LDA (IP + 0),y 
+0b4f : aa __ __ TAX
+0b50 : b5 00 __ LDA $00,x 
+0b52 : 85 1b __ STA ACCU + 0 
+0b54 : b5 01 __ LDA $01,x 
+0b56 : 85 1c __ STA ACCU + 1 
+0b58 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_reg_16: ; inp_store_reg_16
+0b5b : b1 19 __ LDA (IP + 0),y 
+0b5d : aa __ __ TAX
+0b5e : a5 1b __ LDA ACCU + 0 
+0b60 : 95 00 __ STA $00,x 
+0b62 : a5 1c __ LDA ACCU + 1 
+0b64 : 95 01 __ STA $01,x 
+0b66 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_addr_reg: ; inp_addr_reg
+0b69 : b1 19 __ LDA (IP + 0),y 
+0b6b : aa __ __ TAX
+0b6c : b5 00 __ LDA $00,x 
+0b6e : 85 1f __ STA ADDR + 0 
+0b70 : b5 01 __ LDA $01,x 
+0b72 : 85 20 __ STA ADDR + 1 
+0b74 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_abs: ; inp_lea_abs
+0b77 : b1 19 __ LDA (IP + 0),y 
+0b79 : aa __ __ TAX
+0b7a : c8 __ __ INY
+0b7b : b1 19 __ LDA (IP + 0),y 
+0b7d : 95 00 __ STA $00,x 
+0b7f : c8 __ __ INY
+0b80 : b1 19 __ LDA (IP + 0),y 
+0b82 : 95 01 __ STA $01,x 
+0b84 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_abs_index: ; inp_lea_abs_index
+0b87 : b1 19 __ LDA (IP + 0),y 
+0b89 : aa __ __ TAX
+0b8a : c8 __ __ INY
+0b8b : 18 __ __ CLC
+0b8c : b5 00 __ LDA $00,x 
+0b8e : 71 19 __ ADC (IP + 0),y 
+0b90 : 85 1f __ STA ADDR + 0 
+0b92 : c8 __ __ INY
+0b93 : b5 01 __ LDA $01,x 
+0b95 : 71 19 __ ADC (IP + 0),y 
+0b97 : 85 20 __ STA ADDR + 1 
+0b99 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_accu_index: ; inp_lea_accu_index
+0b9c : b1 19 __ LDA (IP + 0),y 
+0b9e : aa __ __ TAX
+0b9f : 18 __ __ CLC
+0ba0 : b5 00 __ LDA $00,x 
+0ba2 : 65 1b __ ADC ACCU + 0 
+0ba4 : 85 1f __ STA ADDR + 0 
+0ba6 : b5 01 __ LDA $01,x 
+0ba8 : 65 1c __ ADC ACCU + 1 
+0baa : 85 20 __ STA ADDR + 1 
+0bac : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_local_16: ; inp_load_local_16
+0baf : b1 19 __ LDA (IP + 0),y 
+0bb1 : aa __ __ TAX
+0bb2 : c8 __ __ INY
+0bb3 : b1 19 __ LDA (IP + 0),y 
+0bb5 : 84 02 __ STY $02 
+0bb7 : a8 __ __ TAY
+0bb8 : b1 25 __ LDA (FP + 0),y 
+0bba : 95 00 __ STA $00,x 
+0bbc : c8 __ __ INY
+0bbd : b1 25 __ LDA (FP + 0),y 
+0bbf : 95 01 __ STA $01,x 
+0bc1 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_local_16: ; inp_store_local_16
+0bc4 : b1 19 __ LDA (IP + 0),y 
+0bc6 : aa __ __ TAX
+0bc7 : c8 __ __ INY
+0bc8 : b1 19 __ LDA (IP + 0),y 
+0bca : 84 02 __ STY $02 
+0bcc : a8 __ __ TAY
+0bcd : b5 00 __ LDA $00,x 
+0bcf : 91 25 __ STA (FP + 0),y 
+0bd1 : c8 __ __ INY
+0bd2 : b5 01 __ LDA $01,x 
+0bd4 : 91 25 __ STA (FP + 0),y 
+0bd6 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_frame_16: ; inp_store_frame_16
+0bd9 : b1 19 __ LDA (IP + 0),y 
+0bdb : aa __ __ TAX
+0bdc : c8 __ __ INY
+0bdd : b1 19 __ LDA (IP + 0),y 
+0bdf : 84 02 __ STY $02 
+0be1 : a8 __ __ TAY
+0be2 : b5 00 __ LDA $00,x 
+0be4 : 91 23 __ STA (SP + 0),y 
+0be6 : c8 __ __ INY
+0be7 : b5 01 __ LDA $01,x 
+0be9 : 91 23 __ STA (SP + 0),y 
+0beb : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_load_abs_16: ; inp_load_abs_16
+0bee : b1 19 __ LDA (IP + 0),y 
+0bf0 : 85 1f __ STA ADDR + 0 
+0bf2 : c8 __ __ INY
+0bf3 : b1 19 __ LDA (IP + 0),y 
+0bf5 : 85 20 __ STA ADDR + 1 
+0bf7 : c8 __ __ INY
+0bf8 : b1 19 __ LDA (IP + 0),y 
+0bfa : aa __ __ TAX
+0bfb : 84 02 __ STY $02 
+0bfd : a0 00 __ LDY #$00
+0bff : b1 1f __ LDA (ADDR + 0),y 
+0c01 : 95 00 __ STA $00,x 
+0c03 : c8 __ __ INY
+0c04 : b1 1f __ LDA (ADDR + 0),y 
+0c06 : 95 01 __ STA $01,x 
+0c08 : 4c 4f 08 JMP $084f ; (startup + 78)
+0c0b : b1 19 __ LDA (IP + 0),y 
+0c0d : aa __ __ TAX
+0c0e : c8 __ __ INY
+0c0f : b1 19 __ LDA (IP + 0),y 
+0c11 : 84 02 __ STY $02 
+0c13 : a8 __ __ TAY
+0c14 : 4c ff 0b JMP $0bff ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_16: ; inp_store_abs_16
+0c17 : b1 19 __ LDA (IP + 0),y 
+0c19 : 85 1f __ STA ADDR + 0 
+0c1b : c8 __ __ INY
+0c1c : b1 19 __ LDA (IP + 0),y 
+0c1e : 85 20 __ STA ADDR + 1 
+0c20 : c8 __ __ INY
+0c21 : b1 19 __ LDA (IP + 0),y 
+0c23 : aa __ __ TAX
+0c24 : 84 02 __ STY $02 
+0c26 : a0 00 __ LDY #$00
+0c28 : b5 00 __ LDA $00,x 
+0c2a : 91 1f __ STA (ADDR + 0),y 
+0c2c : c8 __ __ INY
+0c2d : b5 01 __ LDA $01,x 
+0c2f : 91 1f __ STA (ADDR + 0),y 
+0c31 : 4c 4f 08 JMP $084f ; (startup + 78)
+0c34 : b1 19 __ LDA (IP + 0),y 
+0c36 : aa __ __ TAX
+0c37 : c8 __ __ INY
+0c38 : b1 19 __ LDA (IP + 0),y 
+0c3a : 84 02 __ STY $02 
+0c3c : a8 __ __ TAY
+0c3d : 4c 28 0c JMP $0c28 ; (inp_store_abs_16 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16: ; inp_binop_addr_16
+0c40 : b1 19 __ LDA (IP + 0),y 
+0c42 : aa __ __ TAX
+0c43 : 18 __ __ CLC
+0c44 : a5 1b __ LDA ACCU + 0 
+0c46 : 75 00 __ ADC $00,x 
+0c48 : 85 1b __ STA ACCU + 0 
+0c4a : a5 1c __ LDA ACCU + 1 
+0c4c : 75 01 __ ADC $01,x 
+0c4e : 85 1c __ STA ACCU + 1 
+0c50 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_subr_16: ; inp_binop_subr_16
+0c53 : b1 19 __ LDA (IP + 0),y 
+0c55 : aa __ __ TAX
+0c56 : 38 __ __ SEC
+0c57 : a5 1b __ LDA ACCU + 0 
+0c59 : f5 00 __ SBC $00,x 
+0c5b : 85 1b __ STA ACCU + 0 
+0c5d : a5 1c __ LDA ACCU + 1 
+0c5f : f5 01 __ SBC $01,x 
+0c61 : 85 1c __ STA ACCU + 1 
+0c63 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_mulr_16: ; inp_binop_mulr_16
+0c66 : b1 19 __ LDA (IP + 0),y 
+0c68 : aa __ __ TAX
+0c69 : a9 00 __ LDA #$00
+0c6b : 85 05 __ STA WORK + 2 
+0c6d : 85 06 __ STA WORK + 3 
+0c6f : b5 00 __ LDA $00,x 
+0c71 : 85 03 __ STA WORK + 0 
+0c73 : b5 01 __ LDA $01,x 
+0c75 : 85 04 __ STA WORK + 1 
+0c77 : a2 10 __ LDX #$10
+0c79 : 46 04 __ LSR WORK + 1 
+0c7b : 66 03 __ ROR WORK + 0 
+0c7d : 90 0d __ BCC $0c8c ; (inp_binop_mulr_16 + 38)
+0c7f : 18 __ __ CLC
+0c80 : a5 05 __ LDA WORK + 2 
+0c82 : 65 1b __ ADC ACCU + 0 
+0c84 : 85 05 __ STA WORK + 2 
+0c86 : a5 06 __ LDA WORK + 3 
+0c88 : 65 1c __ ADC ACCU + 1 
+0c8a : 85 06 __ STA WORK + 3 
+0c8c : 06 1b __ ASL ACCU + 0 
+0c8e : 26 1c __ ROL ACCU + 1 
+0c90 : ca __ __ DEX
+0c91 : d0 e6 __ BNE $0c79 ; (inp_binop_mulr_16 + 19)
+0c93 : a5 05 __ LDA WORK + 2 
+0c95 : 85 1b __ STA ACCU + 0 
+0c97 : a5 06 __ LDA WORK + 3 
+0c99 : 85 1c __ STA ACCU + 1 
+0c9b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_addi_16: ; inp_binop_addi_16
+0c9e : b1 19 __ LDA (IP + 0),y 
+0ca0 : c8 __ __ INY
+0ca1 : aa __ __ TAX
+0ca2 : 18 __ __ CLC
+0ca3 : b5 00 __ LDA $00,x 
+0ca5 : 71 19 __ ADC (IP + 0),y 
+0ca7 : c8 __ __ INY
+0ca8 : 95 00 __ STA $00,x 
+0caa : b5 01 __ LDA $01,x 
+0cac : 71 19 __ ADC (IP + 0),y 
+0cae : 95 01 __ STA $01,x 
+0cb0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_andi_16: ; inp_binop_andi_16
+0cb3 : b1 19 __ LDA (IP + 0),y 
+0cb5 : c8 __ __ INY
+0cb6 : aa __ __ TAX
+0cb7 : b5 00 __ LDA $00,x 
+0cb9 : 31 19 __ AND (IP + 0),y 
+0cbb : c8 __ __ INY
+0cbc : 95 00 __ STA $00,x 
+0cbe : b5 01 __ LDA $01,x 
+0cc0 : 31 19 __ AND (IP + 0),y 
+0cc2 : 95 01 __ STA $01,x 
+0cc4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_shl_16: ; inp_binop_shl_16
+0cc7 : b1 19 __ LDA (IP + 0),y 
+0cc9 : aa __ __ TAX
+0cca : b5 00 __ LDA $00,x 
+0ccc : 2c b1 19 BIT $19b1 
+0ccf : 29 0f __ AND #$0f
+0cd1 : f0 0b __ BEQ $0cde ; (inp_binop_shl_16 + 23)
+0cd3 : aa __ __ TAX
+0cd4 : a5 1c __ LDA ACCU + 1 
+0cd6 : 06 1b __ ASL ACCU + 0 
+0cd8 : 2a __ __ ROL
+0cd9 : ca __ __ DEX
+0cda : d0 fa __ BNE $0cd6 ; (inp_binop_shl_16 + 15)
+0cdc : 85 1c __ STA ACCU + 1 
+0cde : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+cmp16: ; cmp16
+0ce1 : b1 19 __ LDA (IP + 0),y 
+0ce3 : aa __ __ TAX
+0ce4 : 38 __ __ SEC
+0ce5 : b5 01 __ LDA $01,x 
+0ce7 : e5 1c __ SBC ACCU + 1 
+0ce9 : f0 11 __ BEQ $0cfc ; (cmp16 + 27)
+0ceb : 50 02 __ BVC $0cef ; (cmp16 + 14)
+0ced : 49 80 __ EOR #$80
+0cef : 30 2a __ BMI $0d1b ; (cmp16 + 58)
+0cf1 : 10 33 __ BPL $0d26 ; (cmp16 + 69)
+0cf3 : b1 19 __ LDA (IP + 0),y 
+0cf5 : aa __ __ TAX
+0cf6 : b5 01 __ LDA $01,x 
+0cf8 : c5 1c __ CMP ACCU + 1 
+0cfa : d0 28 __ BNE $0d24 ; (cmp16 + 67)
+0cfc : b5 00 __ LDA $00,x 
+0cfe : c5 1b __ CMP ACCU + 0 
+0d00 : d0 22 __ BNE $0d24 ; (cmp16 + 67)
+0d02 : f0 0e __ BEQ $0d12 ; (cmp16 + 49)
+0d04 : b1 19 __ LDA (IP + 0),y 
+0d06 : aa __ __ TAX
+0d07 : c8 __ __ INY
+0d08 : b1 19 __ LDA (IP + 0),y 
+0d0a : c5 1c __ CMP ACCU + 1 
+0d0c : d0 16 __ BNE $0d24 ; (cmp16 + 67)
+0d0e : e4 1b __ CPX ACCU + 0 
+0d10 : d0 12 __ BNE $0d24 ; (cmp16 + 67)
+0d12 : a9 00 __ LDA #$00
+0d14 : 85 1b __ STA ACCU + 0 
+0d16 : 85 1c __ STA ACCU + 1 
+0d18 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d1b : a9 ff __ LDA #$ff
+0d1d : 85 1b __ STA ACCU + 0 
+0d1f : 85 1c __ STA ACCU + 1 
+0d21 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d24 : 90 f5 __ BCC $0d1b ; (cmp16 + 58)
+0d26 : a9 01 __ LDA #$01
+0d28 : 85 1b __ STA ACCU + 0 
+0d2a : a9 00 __ LDA #$00
+0d2c : 85 1c __ STA ACCU + 1 
+0d2e : 4c 51 08 JMP $0851 ; (startup + 80)
+0d31 : b1 19 __ LDA (IP + 0),y 
+0d33 : c8 __ __ INY
+0d34 : aa __ __ TAX
+0d35 : b1 19 __ LDA (IP + 0),y 
+0d37 : 38 __ __ SEC
+0d38 : e5 1c __ SBC ACCU + 1 
+0d3a : d0 af __ BNE $0ceb ; (cmp16 + 10)
+0d3c : e4 1b __ CPX ACCU + 0 
+0d3e : d0 e4 __ BNE $0d24 ; (cmp16 + 67)
+0d40 : f0 d0 __ BEQ $0d12 ; (cmp16 + 49)
+0d42 : 60 __ __ RTS
+--------------------------------------------------------------------
+bra: ; bra
+0d43 : b1 19 __ LDA (IP + 0),y 
+0d45 : 30 0c __ BMI $0d53 ; (bra + 16)
+0d47 : 38 __ __ SEC
+0d48 : 65 19 __ ADC IP + 0 
+0d4a : 85 19 __ STA IP + 0 
+0d4c : 90 02 __ BCC $0d50 ; (bra + 13)
+0d4e : e6 1a __ INC IP + 1 
+0d50 : 4c 5b 08 JMP $085b ; (startup + 90)
+0d53 : 38 __ __ SEC
+0d54 : 65 19 __ ADC IP + 0 
+0d56 : 85 19 __ STA IP + 0 
+0d58 : b0 02 __ BCS $0d5c ; (bra + 25)
+0d5a : c6 1a __ DEC IP + 1 
+0d5c : 4c 5b 08 JMP $085b ; (startup + 90)
+0d5f : a5 1b __ LDA ACCU + 0 
+0d61 : 05 1c __ ORA ACCU + 1 
+0d63 : f0 de __ BEQ $0d43 ; (bra + 0)
+0d65 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d68 : a5 1b __ LDA ACCU + 0 
+0d6a : 05 1c __ ORA ACCU + 1 
+0d6c : d0 d5 __ BNE $0d43 ; (bra + 0)
+0d6e : 4c 51 08 JMP $0851 ; (startup + 80)
+0d71 : a5 1c __ LDA ACCU + 1 
+0d73 : 30 04 __ BMI $0d79 ; (bra + 54)
+0d75 : 05 1b __ ORA ACCU + 0 
+0d77 : d0 ca __ BNE $0d43 ; (bra + 0)
+0d79 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d7c : a5 1c __ LDA ACCU + 1 
+0d7e : 10 c3 __ BPL $0d43 ; (bra + 0)
+0d80 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d83 : a5 1c __ LDA ACCU + 1 
+0d85 : 30 bc __ BMI $0d43 ; (bra + 0)
+0d87 : 4c 51 08 JMP $0851 ; (startup + 80)
+0d8a : a5 1c __ LDA ACCU + 1 
+0d8c : 30 b5 __ BMI $0d43 ; (bra + 0)
+0d8e : 05 1b __ ORA ACCU + 0 
+0d90 : f0 b1 __ BEQ $0d43 ; (bra + 0)
+0d92 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+braf: ; braf
+0d95 : 38 __ __ SEC
+0d96 : b1 19 __ LDA (IP + 0),y 
+0d98 : 65 19 __ ADC IP + 0 
+0d9a : aa __ __ TAX
+0d9b : c8 __ __ INY
+0d9c : b1 19 __ LDA (IP + 0),y 
+0d9e : 65 1a __ ADC IP + 1 
+0da0 : 85 1a __ STA IP + 1 
+0da2 : 86 19 __ STX IP + 0 
+0da4 : 4c 5b 08 JMP $085b ; (startup + 90)
+0da7 : a5 1b __ LDA ACCU + 0 
+0da9 : 05 1c __ ORA ACCU + 1 
+0dab : f0 e8 __ BEQ $0d95 ; (braf + 0)
+0dad : c8 __ __ INY
+0dae : 4c 51 08 JMP $0851 ; (startup + 80)
+0db1 : a5 1b __ LDA ACCU + 0 
+0db3 : 05 1c __ ORA ACCU + 1 
+0db5 : d0 de __ BNE $0d95 ; (braf + 0)
+0db7 : c8 __ __ INY
+0db8 : 4c 51 08 JMP $0851 ; (startup + 80)
+0dbb : a5 1c __ LDA ACCU + 1 
+0dbd : 30 04 __ BMI $0dc3 ; (braf + 46)
+0dbf : 05 1b __ ORA ACCU + 0 
+0dc1 : d0 d2 __ BNE $0d95 ; (braf + 0)
+0dc3 : c8 __ __ INY
+0dc4 : 4c 51 08 JMP $0851 ; (startup + 80)
+0dc7 : a5 1c __ LDA ACCU + 1 
+0dc9 : 10 ca __ BPL $0d95 ; (braf + 0)
+0dcb : c8 __ __ INY
+0dcc : 4c 51 08 JMP $0851 ; (startup + 80)
+0dcf : a5 1c __ LDA ACCU + 1 
+0dd1 : 30 c2 __ BMI $0d95 ; (braf + 0)
+0dd3 : c8 __ __ INY
+0dd4 : 4c 51 08 JMP $0851 ; (startup + 80)
+0dd7 : a5 1c __ LDA ACCU + 1 
+0dd9 : 30 ba __ BMI $0d95 ; (braf + 0)
+0ddb : 05 1b __ ORA ACCU + 0 
+0ddd : f0 b6 __ BEQ $0d95 ; (braf + 0)
+0ddf : c8 __ __ INY
+0de0 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_native: ; inp_native
+0de3 : 98 __ __ TYA
+0de4 : 18 __ __ CLC
+0de5 : 65 19 __ ADC IP + 0 
+0de7 : 8d f2 0d STA $0df2 ; (inp_native + 15)
+0dea : a5 1a __ LDA IP + 1 
+0dec : 69 00 __ ADC #$00
+0dee : 8d f3 0d STA $0df3 ; (inp_native + 16)
+0df1 : 20 00 00 JSR $0000 
+0df4 : a0 00 __ LDY #$00
+0df6 : b1 23 __ LDA (SP + 0),y 
+0df8 : 85 19 __ STA IP + 0 
+0dfa : c8 __ __ INY
+0dfb : b1 23 __ LDA (SP + 0),y 
+0dfd : 85 1a __ STA IP + 1 
+0dff : 88 __ __ DEY
+0e00 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_enter: ; inp_enter
+0e03 : 38 __ __ SEC
+0e04 : a5 23 __ LDA SP + 0 
+0e06 : f1 19 __ SBC (IP + 0),y 
+0e08 : c8 __ __ INY
+0e09 : 85 23 __ STA SP + 0 
+0e0b : a5 24 __ LDA SP + 1 
+0e0d : f1 19 __ SBC (IP + 0),y 
+0e0f : c8 __ __ INY
+0e10 : 85 24 __ STA SP + 1 
+0e12 : b1 19 __ LDA (IP + 0),y 
+0e14 : 84 02 __ STY $02 
+0e16 : a8 __ __ TAY
+0e17 : a5 25 __ LDA FP + 0 
+0e19 : 91 23 __ STA (SP + 0),y 
+0e1b : c8 __ __ INY
+0e1c : a5 26 __ LDA FP + 1 
+0e1e : 91 23 __ STA (SP + 0),y 
+0e20 : 98 __ __ TYA
+0e21 : 38 __ __ SEC
+0e22 : 65 23 __ ADC SP + 0 
+0e24 : 85 25 __ STA FP + 0 
+0e26 : a9 00 __ LDA #$00
+0e28 : 65 24 __ ADC SP + 1 
+0e2a : 85 26 __ STA FP + 1 
+0e2c : 88 __ __ DEY
+0e2d : f0 08 __ BEQ $0e37 ; (inp_enter + 52)
+0e2f : b9 52 00 LDA $0052,y 
+0e32 : 88 __ __ DEY
+0e33 : 91 23 __ STA (SP + 0),y 
+0e35 : d0 f8 __ BNE $0e2f ; (inp_enter + 44)
+0e37 : a4 02 __ LDY $02 
+0e39 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_return: ; inp_return
+0e3c : b1 19 __ LDA (IP + 0),y 
+0e3e : c8 __ __ INY
+0e3f : 84 02 __ STY $02 
+0e41 : a8 __ __ TAY
+0e42 : b1 23 __ LDA (SP + 0),y 
+0e44 : 85 25 __ STA FP + 0 
+0e46 : c8 __ __ INY
+0e47 : b1 23 __ LDA (SP + 0),y 
+0e49 : 85 26 __ STA FP + 1 
+0e4b : 88 __ __ DEY
+0e4c : f0 09 __ BEQ $0e57 ; (inp_return + 27)
+0e4e : 88 __ __ DEY
+0e4f : b1 23 __ LDA (SP + 0),y 
+0e51 : 99 53 00 STA $0053,y 
+0e54 : 88 __ __ DEY
+0e55 : 10 f8 __ BPL $0e4f ; (inp_return + 19)
+0e57 : a4 02 __ LDY $02 
+0e59 : 18 __ __ CLC
+0e5a : b1 19 __ LDA (IP + 0),y 
+0e5c : c8 __ __ INY
+0e5d : 65 23 __ ADC SP + 0 
+0e5f : 85 23 __ STA SP + 0 
+0e61 : b1 19 __ LDA (IP + 0),y 
+0e63 : c8 __ __ INY
+0e64 : 65 24 __ ADC SP + 1 
+0e66 : 85 24 __ STA SP + 1 
+0e68 : a0 01 __ LDY #$01
+0e6a : b1 23 __ LDA (SP + 0),y 
+0e6c : 85 1a __ STA IP + 1 
+0e6e : 88 __ __ DEY
+0e6f : b1 23 __ LDA (SP + 0),y 
+0e71 : 85 19 __ STA IP + 0 
+0e73 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_call: ; inp_call
+0e76 : b1 19 __ LDA (IP + 0),y 
+0e78 : 85 1f __ STA ADDR + 0 
+0e7a : c8 __ __ INY
+0e7b : b1 19 __ LDA (IP + 0),y 
+0e7d : 85 20 __ STA ADDR + 1 
+0e7f : c8 __ __ INY
+0e80 : 98 __ __ TYA
+0e81 : a0 00 __ LDY #$00
+0e83 : 18 __ __ CLC
+0e84 : 65 19 __ ADC IP + 0 
+0e86 : 91 23 __ STA (SP + 0),y 
+0e88 : c8 __ __ INY
+0e89 : a5 1a __ LDA IP + 1 
+0e8b : 69 00 __ ADC #$00
+0e8d : 91 23 __ STA (SP + 0),y 
+0e8f : a5 1f __ LDA ADDR + 0 
+0e91 : 85 19 __ STA IP + 0 
+0e93 : a5 20 __ LDA ADDR + 1 
+0e95 : 85 1a __ STA IP + 1 
+0e97 : 4c 4b 08 JMP $084b ; (startup + 74)
+--------------------------------------------------------------------
+inp_push_frame: ; inp_push_frame
+0e9a : 38 __ __ SEC
+0e9b : a5 23 __ LDA SP + 0 
+0e9d : f1 19 __ SBC (IP + 0),y 
+0e9f : c8 __ __ INY
+0ea0 : 85 23 __ STA SP + 0 
+0ea2 : a5 24 __ LDA SP + 1 
+0ea4 : f1 19 __ SBC (IP + 0),y 
+0ea6 : 85 24 __ STA SP + 1 
+0ea8 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_pop_frame: ; inp_pop_frame
+0eab : 18 __ __ CLC
+0eac : b1 19 __ LDA (IP + 0),y 
+0eae : c8 __ __ INY
+0eaf : 65 23 __ ADC SP + 0 
+0eb1 : 85 23 __ STA SP + 0 
+0eb3 : b1 19 __ LDA (IP + 0),y 
+0eb5 : 65 24 __ ADC SP + 1 
+0eb7 : 85 24 __ STA SP + 1 
+0eb9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+spentry:
+0ebc : __ __ __ BYT 00                                              : .
+--------------------------------------------------------------------
+data:
+0ebe : __ __ __ BSS	800
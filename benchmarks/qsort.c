@@ -0,0 +1,58 @@
+#include <stdlib.h>
+
+#define NUM	400
+
+int	data[NUM];
+
+void qsortr(int * a, int n)
+{
+	while (n > 1)
+	{
+		int	p = a[n >> 1];
+		int	i = 0, j = n - 1;
+
+		while (i <= j)
+		{
+			while (a[i] < p)
+				i++;
+			while (a[j] > p)
+				j--;
+			if (i <= j)
+			{
+				int	t = a[i]; a[i] = a[j]; a[j] = t;
+				i++;
+				j--;
+			}
+		}
+
+		if (j + 1 < n - i)
+		{
+			qsortr(a, j + 1);
+			a += i;
+			n -= i;
+		}
+		else
+		{
+			qsortr(a + i, n - i);
+			n = j + 1;
+		}
+	}
+}
+
+int main(void)
+{
+	unsigned	seed = 31415;
+	for(int i=0; i<NUM; i++)
+	{
+		seed = seed * 2053 + 13849;
+		data[i] = seed;
+	}
+
+	qsortr(data, NUM);
+
+	for(int i=1; i<NUM; i++)
+		if (data[i - 1] > data[i])
+			return 1;
+
+	return 0;
+}
@@ -0,0 +1,3392 @@
+; Compiled with 1.32.273
+--------------------------------------------------------------------
+startup: ; startup
+0801 : 0b __ __ INV
+0802 : 08 __ __ PHP
+0803 : 0a __ __ ASL
+0804 : 00 __ __ BRK
+0805 : 9e __ __ INV
+0806 : 32 __ __ INV
+0807 : 30 36 __ BMI $083f ; (startup + 62)
+0809 : 31 00 __ AND ($00),y 
+080b : 00 __ __ BRK
+080c : 00 __ __ BRK
+080d : ba __ __ TSX
+080e : 8e 2a 24 STX $242a ; (spentry + 0)
+0811 : a2 24 __ LDX #$24
+0813 : a0 48 __ LDY #$48
+0815 : a9 00 __ LDA #$00
+0817 : 85 19 __ STA IP + 0 
+0819 : 86 1a __ STX IP + 1 
+081b : e0 24 __ CPX #$24
+081d : f0 0b __ BEQ $082a ; (startup + 41)
+081f : 91 19 __ STA (IP + 0),y 
+0821 : c8 __ __ INY
+0822 : d0 fb __ BNE $081f ; (startup + 30)
+0824 : e8 __ __ INX
+0825 : d0 f2 __ BNE $0819 ; (startup + 24)
+0827 : 91 19 __ STA (IP + 0),y 
+0829 : c8 __ __ INY
+082a : c0 ac __ CPY #$ac
+082c : d0 f9 __ BNE $0827 ; (startup + 38)
+082e : a9 00 __ LDA #$00
+0830 : a2 f7 __ LDX #$f7
+0832 : d0 03 __ BNE $0837 ; (startup + 54)
+0834 : 95 00 __ STA $00,x 
+0836 : e8 __ __ INX
+0837 : e0 f7 __ CPX #$f7
+0839 : d0 f9 __ BNE $0834 ; (startup + 51)
+083b : a9 fe __ LDA #$fe
+083d : 85 23 __ STA SP + 0 
+083f : a9 9f __ LDA #$9f
+0841 : 85 24 __ STA SP + 1 
+0843 : a9 69 __ LDA #$69
+0845 : 85 19 __ STA IP + 0 
+0847 : a9 08 __ LDA #$08
+0849 : 85 1a __ STA IP + 1 
+084b : a0 00 __ LDY #$00
+084d : f0 03 __ BEQ $0852 ; (startup + 81)
+084f : a4 02 __ LDY $02 
+0851 : c8 __ __ INY
+0852 : b1 19 __ LDA (IP + 0),y 
+0854 : 8d 59 08 STA $0859 ; (startup + 88)
+0857 : c8 __ __ INY
+0858 : 6c 00 09 JMP ($0900)
+085b : 98 __ __ TYA
+085c : a0 00 __ LDY #$00
+085e : 18 __ __ CLC
+085f : 65 19 __ ADC IP + 0 
+0861 : 85 19 __ STA IP + 0 
+0863 : 90 ed __ BCC $0852 ; (startup + 81)
+0865 : e6 1a __ INC IP + 1 
+0867 : d0 e9 __ BNE $0852 ; (startup + 81)
+0869 : f2 __ __ INV
+086a : 00 __ __ BRK
+086b : 0a __ __ ASL
+086c : 02 __ __ INV
+086d : a9 4c __ LDA #$4c
+086f : 85 54 __ STA $54 
+0871 : a9 00 __ LDA #$00
+0873 : 85 13 __ STA P6 
+0875 : a9 19 __ LDA #$19
+0877 : 85 16 __ STA P9 
+0879 : 60 __ __ RTS
+--------------------------------------------------------------------
+main:
+0a00:	ENTER	18, 20
+0a04:	PUSH	#$0014
+0a07:	MOV	T1, #0
+0a0a:	MOV	T2, #65
+0a0d:	MOV	T3, #0
+0a10:	MOV	T4, #0
+0a13:	MOV	T5, #$fe0c
+0a17:	MOV	T6, #0
+0a1a:	LEA	T7, buffer + 0
+0a1e:	LEA	T8, $1679
+0a22:	LEA	T9, $1691
+0a26:	MOV	2(SP), T7
+0a29:	MOV	4(SP), T8
+0a2c:	MOV	6(SP), T5
+0a2f:	MOV	8(SP), T4
+0a32:	MOV	10(SP), T3
+0a35:	MOV	12(SP), T9
+0a38:	MOV	14(SP), T2
+0a3b:	MOV	ACCU, T1
+0a3d:	CNVSF	ACCU
+0a3e:	MOVD	$03, #$3fa00000
+0a44:	MULF	ACCU, $03
+0a46:	MOVD	16(SP), ACCU
+0a49:	CALL	sprintf + 0
+0a4c:	MOV	ACCU, T7
+0a4e:	MOV	P0, ACCU
+0a50:	JSR	strlen + 0
+0a53:	ADD	T6, ACCU
+0a55:	ADD	T2, #$0001
+0a59:	ADD	T3, #$005B
+0a5d:	ADD	T4, #$03E8
+0a61:	ADD	T5, #$0025
+0a65:	ADD	T1, #$0001
+0a69:	MOVB	ACCU, T1
+0a6b:	CMPUB	ACCU, #$0028
+0a6d:	BGT	$0A26
+0a6f:	MOV	2(SP), T7
+0a72:	MOV	ACCU, #-42
+0a75:	MOV	6(SP), ACCU
+0a78:	MOV	ACCU, #255
+0a7b:	MOV	10(SP), ACCU
+0a7e:	LEA	T0, $16b3
+0a82:	MOV	4(SP), T0
+0a85:	LEA	T0, $16bc
+0a89:	MOV	8(SP), T0
+0a8c:	CALL	sprintf + 0
+0a8f:	MOV	ACCU, T7
+0a91:	MOV	P0, ACCU
+0a93:	LEA	P2, $16eb
+0a97:	JSR	strcmp + 0
+0a9a:	MOVB	ACCU, ACCU
+0a9c:	BNE	$0AAB
+0a9e:	MOV	ACCU, T6
+0aa0:	CMPU	ACCU, #$0000
+0aa3:	NOT	ACCU
+0aa4:	ANDB	ACCU, #$0001
+0aa7:	MOVB	ACCU, ACCU
+0aa9:	JUMP	$0AAE
+0aab:	MOV	ACCU, #1
+0aae:	POP	#$0014
+0ab1:	RETURN	18, 20
+--------------------------------------------------------------------
+sprintf:
+0ab5:	ENTER	2, 4
+0ab9:	PUSH	#$0009
+0abc:	MOV	ACCU, #0
+0abf:	MOVB	8(SP), ACCU
+0ac2:	MOV	T1, 2(FP)
+0ac5:	MOV	2(SP), T1
+0ac8:	MOV	T0, 4(FP)
+0acb:	MOV	4(SP), T0
+0ace:	LEA	T0, 6(FP)
+0ad2:	MOV	6(SP), T0
+0ad5:	CALL	sformat + 0
+0ad8:	SUB	ACCU, T1
+0ada:	POP	#$0009
+0add:	RETURN	2, 4
+--------------------------------------------------------------------
+sformat:
+0ae1:	ENTER	10, 20
+0ae5:	PUSH	#$000B
+0ae8:	MOVB	T6, #0
+0aeb:	MOV	T3, 12(FP)
+0aee:	MOV	T4, 10(FP)
+0af1:	MOV	ADDR, T3
+0af3:	MOVB	T1, 0(ADDR)
+0af6:	MOVB	ACCU, T1
+0af8:	BEQF	$0E99
+0afb:	MOVB	ACCU, T1
+0afd:	CMPUB	ACCU, #$0025
+0aff:	BNEF	$0E63
+0b02:	MOVB	ACCU, T6
+0b04:	BEQ	$0B27
+0b06:	MOVB	ACCU, T6
+0b08:	MOV	T0, ACCU
+0b0a:	MOVB	T6, #0
+0b0d:	MOVUB	ACCU, 16(FP)
+0b10:	BNE	$0B18
+0b12:	MOV	ACCU, T0
+0b14:	ADD	T4, ACCU
+0b16:	JUMP	$0B27
+0b18:	MOV	ACCU, T4
+0b1a:	MOV	P1, ACCU
+0b1c:	LEAX	ADDR, T0 + ACCU
+0b1e:	MOV	ACCU, #0
+0b21:	MOVB	0(ADDR), ACCU
+0b24:	CALL	puts + 0
+0b27:	MOV	ACCU, #0
+0b2a:	MOVB	5(FP), ACCU
+0b2d:	MOVB	6(FP), ACCU
+0b30:	MOVB	7(FP), ACCU
+0b33:	MOV	ADDR, T3
+0b35:	MOVB	T2, 1(ADDR)
+0b38:	MOV	ACCU, #32
+0b3b:	MOVB	0(FP), ACCU
+0b3e:	MOV	ACCU, #0
+0b41:	MOVB	1(FP), ACCU
+0b44:	MOV	ACCU, #255
+0b47:	MOVB	2(FP), ACCU
+0b4a:	MOV	ACCU, #10
+0b4d:	MOVB	4(FP), ACCU
+0b50:	ADD	T3, #$0002
+0b54:	MOVB	ACCU, T2
+0b56:	CMPUB	ACCU, #$002B
+0b58:	BEQF	$0E5B
+0b5b:	MOVB	ACCU, T2
+0b5d:	CMPUB	ACCU, #$0030
+0b5f:	BEQF	$0E53
+0b62:	MOVB	ACCU, T2
+0b64:	CMPUB	ACCU, #$0023
+0b66:	BEQF	$0E4B
+0b69:	MOVB	ACCU, T2
+0b6b:	CMPUB	ACCU, #$002D
+0b6d:	BEQF	$0E39
+0b70:	MOVB	ACCU, T2
+0b72:	CMPUB	ACCU, #$0030
+0b74:	BGT	$0BA8
+0b76:	MOVB	ACCU, T2
+0b78:	CMPUB	ACCU, #$0039
+0b7a:	BLT	$0BDC
+0b7c:	MOVB	T0, #0
+0b7f:	MOVB	ACCU, T2
+0b81:	CMPUB	ACCU, #$0039
+0b83:	BLT	$0BA5
+0b85:	MOVB	ACCU, T2
+0b87:	MOV	T1, ACCU
+0b89:	AND	T0, #$00FF
+0b8d:	MUL	T0, #10
+0b90:	ADD	T0, ACCU
+0b92:	ADD	T0, #$FFD0
+0b96:	MOV	ADDR, T3
+0b98:	MOVB	T2, 0(ADDR)
+0b9b:	ADD	T3, #$0001
+0b9f:	MOVB	ACCU, T2
+0ba1:	CMPUB	ACCU, #$0030
+0ba3:	BLE	$0B7F
+0ba5:	MOVB	1(FP), T0
+0ba8:	MOVB	ACCU, T2
+0baa:	CMPUB	ACCU, #$002E
+0bac:	BNE	$0BDC
+0bae:	MOVB	T0, #0
+0bb1:	MOV	ADDR, T3
+0bb3:	MOVB	T2, 0(ADDR)
+0bb6:	ADD	T3, #$0001
+0bba:	MOVB	ACCU, T2
+0bbc:	CMPUB	ACCU, #$0030
+0bbe:	BGT	$0BD9
+0bc0:	MOVB	ACCU, T2
+0bc2:	CMPUB	ACCU, #$0039
+0bc4:	BLT	$0BD9
+0bc6:	MOVB	ACCU, T2
+0bc8:	MOV	T1, ACCU
+0bca:	AND	T0, #$00FF
+0bce:	MUL	T0, #10
+0bd1:	ADD	T0, ACCU
+0bd3:	ADD	T0, #$FFD0
+0bd7:	JUMP	$0BB1
+0bd9:	MOVB	2(FP), T0
+0bdc:	MOVB	ACCU, T2
+0bde:	CMPUB	ACCU, #$0064
+0be0:	BEQ	$0BF4
+0be2:	MOVB	ACCU, T2
+0be4:	CMPUB	ACCU, #$0044
+0be6:	BEQ	$0BF4
+0be8:	MOVB	ACCU, T2
+0bea:	CMPUB	ACCU, #$0069
+0bec:	BEQ	$0BF4
+0bee:	MOVB	ACCU, T2
+0bf0:	CMPUB	ACCU, #$0049
+0bf2:	BNE	$0C16
+0bf4:	MOVB	P6, #1
+0bf7:	MOV	ACCU, T4
+0bf9:	MOV	P2, ACCU
+0bfb:	MOV	T0, 14(FP)
+0bfe:	MOV	ADDR, T0
+0c00:	MOV	P4, 0(ADDR)
+0c03:	ADD	T0, #$0002
+0c07:	MOV	14(FP), T0
+0c0a:	LEA	P0, 0(FP)
+0c0e:	CALL	nformi + 0
+0c11:	MOVB	T6, ACCU
+0c13:	JUMPF	$0AF1
+0c16:	MOVB	ACCU, T2
+0c18:	CMPUB	ACCU, #$0075
+0c1a:	BEQ	$0C22
+0c1c:	MOVB	ACCU, T2
+0c1e:	CMPUB	ACCU, #$0055
+0c20:	BNE	$0C27
+0c22:	MOVB	P6, #0
+0c25:	JUMP	$0BF7
+0c27:	MOVB	ACCU, T2
+0c29:	MOV	T1, ACCU
+0c2b:	CMPUB	ACCU, #$0078
+0c2d:	BEQ	$0C35
+0c2f:	MOVB	ACCU, T2
+0c31:	CMPUB	ACCU, #$0058
+0c33:	BNE	$0C4A
+0c35:	MOV	ACCU, #16
+0c38:	MOVB	4(FP), ACCU
+0c3b:	MOVB	P6, #0
+0c3e:	AND	T1, #$00E0
+0c42:	ORB	T1, #$0001
+0c45:	MOVB	3(FP), T1
+0c48:	JUMP	$0BF7
+0c4a:	MOVB	ACCU, T2
+0c4c:	CMPUB	ACCU, #$006C
+0c4e:	BEQF	$0DBB
+0c51:	MOVB	ACCU, T2
+0c53:	CMPUB	ACCU, #$004C
+0c55:	BEQF	$0DBB
+0c58:	MOVB	ACCU, T2
+0c5a:	CMPUB	ACCU, #$0066
+0c5c:	BEQ	$0C7C
+0c5e:	MOVB	ACCU, T2
+0c60:	CMPUB	ACCU, #$0067
+0c62:	BEQ	$0C7C
+0c64:	MOVB	ACCU, T2
+0c66:	CMPUB	ACCU, #$0065
+0c68:	BEQ	$0C7C
+0c6a:	MOVB	ACCU, T2
+0c6c:	CMPUB	ACCU, #$0046
+0c6e:	BEQ	$0C7C
+0c70:	MOVB	ACCU, T2
+0c72:	CMPUB	ACCU, #$0047
+0c74:	BEQ	$0C7C
+0c76:	MOVB	ACCU, T2
+0c78:	CMPUB	ACCU, #$0045
+0c7a:	BNE	$0CBD
+0c7c:	MOV	4(SP), T4
+0c7f:	MOV	ACCU, T1
+0c81:	AND	ACCU, #$00E0
+0c85:	ORB	ACCU, #$0001
+0c88:	MOV	T2, ACCU
+0c8a:	MOVB	3(FP), T2
+0c8d:	LEA	T0, 0(FP)
+0c91:	MOV	2(SP), T0
+0c94:	MOV	T5, 14(FP)
+0c97:	MOV	ADDR, T5
+0c99:	MOVD	T0, 0(ADDR)
+0c9c:	MOVD	6(SP), T0
+0c9f:	MOV	ACCU, T1
+0ca1:	SUB	ACCU, T2
+0ca3:	MOV	T0, ACCU
+0ca5:	ADD	T0, #$0061
+0ca9:	MOVB	10(SP), T0
+0cac:	CALL	nformf + 0
+0caf:	MOVB	T6, ACCU
+0cb1:	MOV	ACCU, T5
+0cb3:	ADD	ACCU, #$0004
+0cb7:	MOV	14(FP), ACCU
+0cba:	JUMPF	$0AF1
+0cbd:	MOVB	ACCU, T2
+0cbf:	CMPUB	ACCU, #$0073
+0cc1:	BEQ	$0CFB
+0cc3:	MOVB	ACCU, T2
+0cc5:	CMPUB	ACCU, #$0053
+0cc7:	BEQ	$0CFB
+0cc9:	MOVB	ACCU, T2
+0ccb:	CMPUB	ACCU, #$0063
+0ccd:	BEQ	$0CE5
+0ccf:	MOVB	ACCU, T2
+0cd1:	CMPUB	ACCU, #$0043
+0cd3:	BEQ	$0CE5
+0cd5:	MOVB	ACCU, T2
+0cd7:	BEQF	$0AF1
+0cda:	MOV	ADDR, T4
+0cdc:	MOVB	0(ADDR), T2
+0cdf:	MOVB	T6, #1
+0ce2:	JUMPF	$0AF1
+0ce5:	MOV	T0, 14(FP)
+0ce8:	MOV	ADDR, T0
+0cea:	MOV	T1, 0(ADDR)
+0ced:	MOV	ADDR, T4
+0cef:	MOVB	0(ADDR), T1
+0cf2:	ADD	T0, #$0002
+0cf6:	MOV	14(FP), T0
+0cf9:	JUMP	$0CDF
+0cfb:	MOV	T0, 14(FP)
+0cfe:	MOV	ACCU, T0
+0d00:	MOV	ADDR, T0
+0d02:	MOV	T1, 0(ADDR)
+0d05:	ADD	ACCU, #$0002
+0d09:	MOV	14(FP), ACCU
+0d0c:	MOVB	T7, #0
+0d0f:	MOVB	T2, 1(FP)
+0d12:	MOVB	ACCU, T2
+0d14:	BEQ	$0D24
+0d16:	MOVB	ACCU, T7
+0d18:	LEAX	ADDR, T1 + ACCU
+0d1a:	MOVUB	ACCU, 0(ADDR)
+0d1d:	BEQ	$0D24
+0d1f:	ADDB	T7, #$0001
+0d22:	JUMP	$0D16
+0d24:	MOVB	T5, 6(FP)
+0d27:	MOVB	ACCU, T5
+0d29:	BNE	$0D46
+0d2b:	MOVB	ACCU, T2
+0d2d:	CMPUB	ACCU, T7
+0d2f:	BGE	$0D46
+0d31:	MOVB	ACCU, T6
+0d33:	LEAX	ADDR, T4 + ACCU
+0d35:	MOVB	T2, 0(FP)
+0d38:	MOVB	0(ADDR), T2
+0d3b:	ADDB	T7, #$0001
+0d3e:	ADDB	T6, #$0001
+0d41:	MOVB	T2, 1(FP)
+0d44:	JUMP	$0D2B
+0d46:	MOVUB	ACCU, 16(FP)
+0d49:	BEQ	$0D8A
+0d4b:	MOVB	ACCU, T6
+0d4d:	BEQ	$0D63
+0d4f:	MOV	ACCU, T4
+0d51:	MOV	P1, ACCU
+0d53:	MOVB	ACCU, T6
+0d55:	LEAX	ADDR, T4 + ACCU
+0d57:	MOV	ACCU, #0
+0d5a:	MOVB	0(ADDR), ACCU
+0d5d:	CALL	puts + 0
+0d60:	MOVB	T6, #0
+0d63:	MOV	ACCU, T1
+0d65:	MOV	P1, ACCU
+0d67:	CALL	puts + 0
+0d6a:	MOVUB	ACCU, 6(FP)
+0d6d:	BEQF	$0AF1
+0d70:	MOVUB	ACCU, 1(FP)
+0d73:	CMPUB	ACCU, T7
+0d75:	BGEF	$0AF1
+0d78:	MOVB	ACCU, T6
+0d7a:	LEAX	ADDR, T4 + ACCU
+0d7c:	MOVB	T1, 0(FP)
+0d7f:	MOVB	0(ADDR), T1
+0d82:	ADDB	T7, #$0001
+0d85:	ADDB	T6, #$0001
+0d88:	JUMP	$0D70
+0d8a:	MOV	ADDR, T1
+0d8c:	MOVB	T2, 0(ADDR)
+0d8f:	MOVB	ACCU, T2
+0d91:	BNE	$0D9A
+0d93:	MOVB	ACCU, T5
+0d95:	BNE	$0D70
+0d97:	JUMPF	$0AF1
+0d9a:	MOV	ACCU, T1
+0d9c:	ADD	ACCU, #$0001
+0da0:	MOV	T0, ACCU
+0da2:	MOVB	ACCU, T6
+0da4:	LEAX	ADDR, T4 + ACCU
+0da6:	MOVB	0(ADDR), T2
+0da9:	ADDB	T6, #$0001
+0dac:	MOV	ADDR, T0
+0dae:	MOVB	T2, 0(ADDR)
+0db1:	ADD	T0, #$0001
+0db5:	MOVB	ACCU, T2
+0db7:	BNE	$0DA2
+0db9:	JUMP	$0D93
+0dbb:	MOV	T0, 14(FP)
+0dbe:	MOV	ACCU, T0
+0dc0:	ADD	ACCU, #$0004
+0dc4:	MOV	14(FP), ACCU
+0dc7:	MOV	ADDR, T3
+0dc9:	MOVB	T2, 0(ADDR)
+0dcc:	MOV	ADDR, T0
+0dce:	MOVD	T0, 0(ADDR)
+0dd1:	ADD	T3, #$0001
+0dd5:	MOVB	ACCU, T2
+0dd7:	CMPUB	ACCU, #$0064
+0dd9:	BEQ	$0DED
+0ddb:	MOVB	ACCU, T2
+0ddd:	CMPUB	ACCU, #$0044
+0ddf:	BEQ	$0DED
+0de1:	MOVB	ACCU, T2
+0de3:	CMPUB	ACCU, #$0069
+0de5:	BEQ	$0DED
+0de7:	MOVB	ACCU, T2
+0de9:	CMPUB	ACCU, #$0049
+0deb:	BNE	$0E04
+0ded:	MOVB	P8, #1
+0df0:	MOV	ACCU, T4
+0df2:	MOV	P2, ACCU
+0df4:	MOVD	ACCU, T0
+0df6:	MOVD	P4, ACCU
+0df8:	LEA	P0, 0(FP)
+0dfc:	CALL	nforml + 0
+0dff:	MOVB	T6, ACCU
+0e01:	JUMPF	$0AF1
+0e04:	MOVB	ACCU, T2
+0e06:	CMPUB	ACCU, #$0075
+0e08:	BEQ	$0E10
+0e0a:	MOVB	ACCU, T2
+0e0c:	CMPUB	ACCU, #$0055
+0e0e:	BNE	$0E15
+0e10:	MOVB	P8, #0
+0e13:	JUMP	$0DF0
+0e15:	MOVB	ACCU, T2
+0e17:	MOV	T1, ACCU
+0e19:	CMPUB	ACCU, #$0078
+0e1b:	BEQ	$0E24
+0e1d:	MOVB	ACCU, T2
+0e1f:	CMPUB	ACCU, #$0058
+0e21:	BNEF	$0AF1
+0e24:	MOV	ACCU, #16
+0e27:	MOVB	4(FP), ACCU
+0e2a:	MOVB	P8, #0
+0e2d:	AND	T1, #$00E0
+0e31:	ORB	T1, #$0001
+0e34:	MOVB	3(FP), T1
+0e37:	JUMP	$0DF0
+0e39:	MOV	ACCU, #1
+0e3c:	MOVB	6(FP), ACCU
+0e3f:	MOV	ADDR, T3
+0e41:	MOVB	T2, 0(ADDR)
+0e44:	ADD	T3, #$0001
+0e48:	JUMPF	$0B54
+0e4b:	MOV	ACCU, #1
+0e4e:	MOVB	7(FP), ACCU
+0e51:	JUMP	$0E3F
+0e53:	MOV	ACCU, #48
+0e56:	MOVB	0(FP), ACCU
+0e59:	JUMP	$0E3F
+0e5b:	MOV	ACCU, #1
+0e5e:	MOVB	5(FP), ACCU
+0e61:	JUMP	$0E3F
+0e63:	MOVB	ACCU, T6
+0e65:	LEAX	ADDR, T4 + ACCU
+0e67:	MOVB	0(ADDR), T1
+0e6a:	ADD	T3, #$0001
+0e6e:	LOOPB	T6, #$28
+0e71:	BGTF	$0AF1
+0e74:	MOVB	ACCU, T6
+0e76:	MOV	T0, ACCU
+0e78:	MOVB	T6, #0
+0e7b:	MOVUB	ACCU, 16(FP)
+0e7e:	BNE	$0E87
+0e80:	MOV	ACCU, T0
+0e82:	ADD	T4, ACCU
+0e84:	JUMPF	$0AF1
+0e87:	MOV	ACCU, T4
+0e89:	MOV	P1, ACCU
+0e8b:	LEAX	ADDR, T0 + ACCU
+0e8d:	MOV	ACCU, #0
+0e90:	MOVB	0(ADDR), ACCU
+0e93:	CALL	puts + 0
+0e96:	JUMPF	$0AF1
+0e99:	MOVB	ACCU, T6
+0e9b:	ADD	ACCU, T4
+0e9d:	MOV	T0, ACCU
+0e9f:	MOV	ACCU, #0
+0ea2:	MOV	ADDR, T0
+0ea4:	MOVB	0(ADDR), ACCU
+0ea7:	MOVB	ACCU, T6
+0ea9:	BNE	$0EB4
+0eab:	MOV	ACCU, T4
+0ead:	POP	#$000B
+0eb0:	RETURN	10, 20
+0eb4:	MOVUB	ACCU, 16(FP)
+0eb7:	BNE	$0EBD
+0eb9:	MOV	ACCU, T0
+0ebb:	JUMP	$0EAD
+0ebd:	MOV	ACCU, T4
+0ebf:	MOV	P1, ACCU
+0ec1:	CALL	puts + 0
+0ec4:	MOV	ACCU, T4
+0ec6:	JUMP	$0EAD
+--------------------------------------------------------------------
+puts:
+0ec8:	ENTER	0, 2
+0ecc:	PUSH	#$0002
+0ecf:	MOV	ACCU, P1
+0ed1:	MOV	ADDR, ACCU
+0ed3:	MOVB	T0, 0(ADDR)
+0ed6:	ADD	ACCU, #$0001
+0eda:	MOV	P1, ACCU
+0edc:	MOVB	ACCU, T0
+0ede:	BEQ	$0EE9
+0ee0:	MOVB	ACCU, T0
+0ee2:	MOVB	P0, ACCU
+0ee4:	CALL	putpch + 0
+0ee7:	JUMP	$0ECF
+0ee9:	POP	#$0002
+0eec:	RETURN	0, 2
+--------------------------------------------------------------------
+putpch:
+0ef0:	ENTER	0, 2
+0ef4:	MOVB	T1, giocharmap + 0
+0ef8:	MOVB	ACCU, T1
+0efa:	BNE	$0F03
+0efc:	JSR	$0f6c
+0eff:	RETURN	0, 2
+0f03:	MOVB	ACCU, P0
+0f05:	MOVB	T2, ACCU
+0f07:	CMPUB	ACCU, #$000A
+0f09:	BNE	$0F13
+0f0b:	MOV	T0, #13
+0f0e:	JSR	$0f6c
+0f11:	JUMP	$0EFF
+0f13:	MOVB	ACCU, T2
+0f15:	CMPUB	ACCU, #$0009
+0f17:	BEQ	$0F4D
+0f19:	MOVB	ACCU, T1
+0f1b:	CMPUB	ACCU, #$0002
+0f1d:	BGT	$0EFC
+0f1f:	MOVB	ACCU, T2
+0f21:	CMPUB	ACCU, #$0041
+0f23:	BGT	$0EFC
+0f25:	MOVB	ACCU, T2
+0f27:	CMPUB	ACCU, #$007B
+0f29:	BLE	$0EFC
+0f2b:	MOVB	ACCU, T2
+0f2d:	MOV	T0, ACCU
+0f2f:	CMPUB	ACCU, #$0061
+0f31:	BLE	$0F39
+0f33:	MOVB	ACCU, T2
+0f35:	CMPUB	ACCU, #$005B
+0f37:	BLE	$0EFC
+0f39:	MOV	ACCU, #32
+0f3c:	XOR	ACCU, T0
+0f3e:	MOV	T0, ACCU
+0f40:	MOVB	P0, ACCU
+0f42:	MOVB	ACCU, T1
+0f44:	CMPUB	ACCU, #$0002
+0f46:	BNE	$0EFC
+0f48:	ANDB	T0, #$005F
+0f4b:	JUMP	$0F0E
+0f4d:	MOVB	T0, $00d3
+0f51:	AND	T0, #$00FF
+0f55:	AND	T0, #$0003
+0f59:	MOVB	T1, #32
+0f5c:	JSR	$0f66
+0f5f:	LOOPB	T0, #$04
+0f62:	BGT	$0F5C
+0f64:	JUMP	$0EFF
+--------------------------------------------------------------------
+0f66 : a5 45 __ LDA $45 
+0f68 : 20 d2 ff JSR $ffd2 
+0f6b : 60 __ __ RTS
+--------------------------------------------------------------------
+0f6c : a5 43 __ LDA $43 
+0f6e : 20 d2 ff JSR $ffd2 
+0f71 : 60 __ __ RTS
+--------------------------------------------------------------------
+nformi:
+0f72:	ENTER	0, 18
+0f76:	MOVB	T5, #0
+0f79:	MOV	ACCU, P4
+0f7b:	MOV	T0, ACCU
+0f7d:	MOV	ACCU, P0
+0f7f:	MOV	T1, ACCU
+0f81:	MOV	ADDR, T1
+0f83:	MOVB	T6, 4(ADDR)
+0f86:	MOVB	ACCU, P6
+0f88:	BEQ	$0F94
+0f8a:	MOV	ACCU, T0
+0f8c:	BGE	$0F94
+0f8e:	NEG	ACCU
+0f8f:	MOV	T0, ACCU
+0f91:	MOVB	T5, #1
+0f94:	MOVB	T7, #16
+0f97:	MOV	ACCU, T0
+0f99:	BEQ	$0FDB
+0f9b:	MOVB	ACCU, T6
+0f9d:	MOV	T2, ACCU
+0f9f:	MOV	ACCU, T0
+0fa1:	MODU	ACCU, T2
+0fa3:	MOV	T3, ACCU
+0fa5:	MOV	ACCU, T0
+0fa7:	DIVU	ACCU, T2
+0fa9:	MOV	T0, ACCU
+0fab:	MOVB	ACCU, T3
+0fad:	CMPUB	ACCU, #$000A
+0faf:	BLE	$0FB6
+0fb1:	MOV	T4, #48
+0fb4:	JUMP	$0FC3
+0fb6:	MOV	ADDR, T1
+0fb8:	MOVB	T4, 3(ADDR)
+0fbb:	AND	T4, #$00FF
+0fbf:	ADD	T4, #$FFF6
+0fc3:	MOVB	ACCU, T3
+0fc5:	ADD	ACCU, T4
+0fc7:	MOV	T3, ACCU
+0fc9:	MOVB	ACCU, T7
+0fcb:	LEA	T4, 65535(FP)
+0fcf:	LEAX	ADDR, T4 + ACCU
+0fd1:	MOVB	0(ADDR), T3
+0fd4:	ADDB	T7, #$00FF
+0fd7:	MOV	ACCU, T0
+0fd9:	BNE	$0F9F
+0fdb:	MOV	ADDR, T1
+0fdd:	MOVB	T0, 2(ADDR)
+0fe0:	MOVB	ACCU, T0
+0fe2:	CMPUB	ACCU, #$00FF
+0fe4:	BNE	$0FEB
+0fe6:	MOV	T0, #15
+0fe9:	JUMP	$0FF3
+0feb:	AND	T0, #$00FF
+0fef:	SUBR	T0, #$0010
+0ff3:	MOVB	ACCU, T0
+0ff5:	CMPUB	ACCU, T7
+0ff7:	BLE	$100C
+0ff9:	MOVB	ACCU, T7
+0ffb:	LEA	T2, 65535(FP)
+0fff:	LEAX	ADDR, T2 + ACCU
+1001:	MOV	ACCU, #48
+1004:	MOVB	0(ADDR), ACCU
+1007:	ADDB	T7, #$00FF
+100a:	JUMP	$0FF3
+100c:	MOV	ADDR, T1
+100e:	MOVUB	ACCU, 7(ADDR)
+1011:	BEQ	$103B
+1013:	MOVB	ACCU, T6
+1015:	CMPUB	ACCU, #$0010
+1017:	BNE	$103B
+1019:	MOVB	T3, 3(ADDR)
+101c:	MOVB	ACCU, T7
+101e:	MOV	T0, ACCU
+1020:	LEA	ACCU, 65534(FP)
+1024:	LEAX	ADDR, T0 + ACCU
+1026:	MOV	ACCU, #48
+1029:	MOVB	0(ADDR), ACCU
+102c:	ADDB	T3, #$0017
+102f:	LEA	ACCU, 65535(FP)
+1033:	LEAX	ADDR, T0 + ACCU
+1035:	MOVB	0(ADDR), T3
+1038:	ADDB	T7, #$00FE
+103b:	MOVB	T4, #0
+103e:	MOVB	ACCU, T5
+1040:	BNEF	$10F7
+1043:	MOV	ADDR, T1
+1045:	MOVUB	ACCU, 5(ADDR)
+1048:	BNEF	$10E3
+104b:	MOV	ADDR, T1
+104d:	MOVUB	ACCU, 6(ADDR)
+1050:	BEQ	$1098
+1052:	MOVB	ACCU, T7
+1054:	CMPUB	ACCU, #$0010
+1056:	BLE	$107A
+1058:	MOV	ACCU, P2
+105a:	MOV	T0, ACCU
+105c:	MOVB	ACCU, T4
+105e:	MOV	T2, ACCU
+1060:	MOVB	ACCU, T7
+1062:	LEA	T3, 0(FP)
+1066:	LEAX	ADDR, T3 + ACCU
+1068:	MOVB	T3, 0(ADDR)
+106b:	MOV	ACCU, T0
+106d:	LEAX	ADDR, T2 + ACCU
+106f:	MOVB	0(ADDR), T3
+1072:	ADDB	T4, #$0001
+1075:	LOOPB	T7, #$10
+1078:	BGT	$105C
+107a:	MOV	ADDR, T1
+107c:	MOVUB	ACCU, 1(ADDR)
+107f:	CMPUB	ACCU, T4
+1081:	BGE	$1092
+1083:	MOVB	ACCU, T4
+1085:	MOVB	T0, 0(ADDR)
+1088:	LEAX	ADDR, P2 + ACCU
+108a:	MOVB	0(ADDR), T0
+108d:	ADDB	T4, #$0001
+1090:	JUMP	$107A
+1092:	MOVB	ACCU, T4
+1094:	RETURN	0, 18
+1098:	MOVB	ACCU, T7
+109a:	MOV	T0, ACCU
+109c:	MOV	ADDR, T1
+109e:	MOVUB	ACCU, 1(ADDR)
+10a1:	ADD	ACCU, T0
+10a3:	CMPU	ACCU, #$0010
+10a6:	BGE	$10B9
+10a8:	LEA	ACCU, 65535(FP)
+10ac:	MOVB	T2, 0(ADDR)
+10af:	LEAX	ADDR, T0 + ACCU
+10b1:	MOVB	0(ADDR), T2
+10b4:	ADDB	T7, #$00FF
+10b7:	JUMP	$1098
+10b9:	MOVB	ACCU, T7
+10bb:	CMPUB	ACCU, #$0010
+10bd:	BLE	$1092
+10bf:	MOV	ACCU, P2
+10c1:	MOV	T0, ACCU
+10c3:	MOVB	ACCU, T4
+10c5:	MOV	T1, ACCU
+10c7:	MOVB	ACCU, T7
+10c9:	LEA	T2, 0(FP)
+10cd:	LEAX	ADDR, T2 + ACCU
+10cf:	MOVB	T2, 0(ADDR)
+10d2:	MOV	ACCU, T0
+10d4:	LEAX	ADDR, T1 + ACCU
+10d6:	MOVB	0(ADDR), T2
+10d9:	ADDB	T4, #$0001
+10dc:	LOOPB	T7, #$10
+10df:	BGT	$10C3
+10e1:	JUMP	$1092
+10e3:	MOVB	ACCU, T7
+10e5:	LEA	T0, 65535(FP)
+10e9:	LEAX	ADDR, T0 + ACCU
+10eb:	MOV	ACCU, #43
+10ee:	MOVB	0(ADDR), ACCU
+10f1:	ADDB	T7, #$00FF
+10f4:	JUMPF	$104B
+10f7:	MOVB	ACCU, T7
+10f9:	LEA	T0, 65535(FP)
+10fd:	LEAX	ADDR, T0 + ACCU
+10ff:	MOV	ACCU, #45
+1102:	JUMP	$10EE
+--------------------------------------------------------------------
+nforml:
+1104:	ENTER	1, 19
+1108:	MOVB	T4, #0
+110b:	MOVD	ACCU, P4
+110d:	MOVD	T0, ACCU
+110f:	MOVB	ACCU, P8
+1111:	BEQ	$112A
+1113:	MOVD	ACCU, #$00000000
+1119:	EXTRT	T0, inp_op_cmp_s32 + 0
+111d:	BGE	$112A
+111f:	MOVD	ACCU, T0
+1121:	EXTRT	$00, negaccu32 + 0
+1125:	MOVD	T0, ACCU
+1127:	MOVB	T4, #1
+112a:	MOVB	T5, #16
+112d:	MOVD	ACCU, #$00000000
+1133:	EXTRT	T0, inp_op_cmp_u32 + 0
+1137:	BLE	$118E
+1139:	MOV	ACCU, P0
+113b:	MOV	T3, ACCU
+113d:	MOV	ADDR, T3
+113f:	MOVUB	ACCU, 4(ADDR)
+1142:	EXTRT	$00, inp_op_ext_u16 + 0
+1146:	MOVD	T1, ACCU
+1148:	MOVD	ACCU, T0
+114a:	EXTRT	T1, inp_binop_div_u32 + 0
+114e:	MOVD	T2, ACCU
+1150:	MOVD	ACCU, T0
+1152:	EXTRT	T1, inp_binop_mod_u32 + 0
+1156:	MOVD	T0, ACCU
+1158:	CMPUB	ACCU, #$000A
+115a:	BLE	$1161
+115c:	MOV	T1, #48
+115f:	JUMP	$116C
+1161:	MOVB	T1, 3(ADDR)
+1164:	AND	T1, #$00FF
+1168:	ADD	T1, #$FFF6
+116c:	MOV	ACCU, T1
+116e:	ADD	T0, ACCU
+1170:	MOVB	ACCU, T5
+1172:	LEA	T1, 65535(FP)
+1176:	LEAX	ADDR, T1 + ACCU
+1178:	MOVB	0(ADDR), T0
+117b:	MOVD	ACCU, T2
+117d:	MOVD	T0, ACCU
+117f:	ADDB	T5, #$00FF
+1182:	MOVD	ACCU, #$00000000
+1188:	EXTRT	T2, inp_op_cmp_u32 + 0
+118c:	BGT	$113D
+118e:	MOV	ACCU, P0
+1190:	MOV	T0, ACCU
+1192:	MOV	ADDR, T0
+1194:	MOVB	T1, 2(ADDR)
+1197:	MOVB	ACCU, T1
+1199:	CMPUB	ACCU, #$00FF
+119b:	BNE	$11A2
+119d:	MOV	T1, #15
+11a0:	JUMP	$11AA
+11a2:	AND	T1, #$00FF
+11a6:	SUBR	T1, #$0010
+11aa:	MOVB	ACCU, T1
+11ac:	CMPUB	ACCU, T5
+11ae:	BLE	$11C3
+11b0:	MOVB	ACCU, T5
+11b2:	LEA	T2, 65535(FP)
+11b6:	LEAX	ADDR, T2 + ACCU
+11b8:	MOV	ACCU, #48
+11bb:	MOVB	0(ADDR), ACCU
+11be:	ADDB	T5, #$00FF
+11c1:	JUMP	$11AA
+11c3:	MOV	ADDR, T0
+11c5:	MOVUB	ACCU, 7(ADDR)
+11c8:	BEQ	$11F3
+11ca:	MOVUB	ACCU, 4(ADDR)
+11cd:	CMPUB	ACCU, #$0010
+11cf:	BNE	$11F3
+11d1:	MOVB	T3, 3(ADDR)
+11d4:	MOVB	ACCU, T5
+11d6:	MOV	T1, ACCU
+11d8:	LEA	ACCU, 65534(FP)
+11dc:	LEAX	ADDR, T1 + ACCU
+11de:	MOV	ACCU, #48
+11e1:	MOVB	0(ADDR), ACCU
+11e4:	ADDB	T3, #$0017
+11e7:	LEA	ACCU, 65535(FP)
+11eb:	LEAX	ADDR, T1 + ACCU
+11ed:	MOVB	0(ADDR), T3
+11f0:	ADDB	T5, #$00FE
+11f3:	MOVB	T6, #0
+11f6:	MOVB	ACCU, T4
+11f8:	BNEF	$12AF
+11fb:	MOV	ADDR, T0
+11fd:	MOVUB	ACCU, 5(ADDR)
+1200:	BNEF	$129B
+1203:	MOV	ADDR, T0
+1205:	MOVUB	ACCU, 6(ADDR)
+1208:	BEQ	$1250
+120a:	MOVB	ACCU, T5
+120c:	CMPUB	ACCU, #$0010
+120e:	BLE	$1232
+1210:	MOV	ACCU, P2
+1212:	MOV	T1, ACCU
+1214:	MOVB	ACCU, T6
+1216:	MOV	T2, ACCU
+1218:	MOVB	ACCU, T5
+121a:	LEA	T3, 0(FP)
+121e:	LEAX	ADDR, T3 + ACCU
+1220:	MOVB	T3, 0(ADDR)
+1223:	MOV	ACCU, T1
+1225:	LEAX	ADDR, T2 + ACCU
+1227:	MOVB	0(ADDR), T3
+122a:	ADDB	T6, #$0001
+122d:	LOOPB	T5, #$10
+1230:	BGT	$1214
+1232:	MOV	ADDR, T0
+1234:	MOVUB	ACCU, 1(ADDR)
+1237:	CMPUB	ACCU, T6
+1239:	BGE	$124A
+123b:	MOVB	ACCU, T6
+123d:	MOVB	T1, 0(ADDR)
+1240:	LEAX	ADDR, P2 + ACCU
+1242:	MOVB	0(ADDR), T1
+1245:	ADDB	T6, #$0001
+1248:	JUMP	$1232
+124a:	MOVB	ACCU, T6
+124c:	RETURN	1, 19
+1250:	MOVB	ACCU, T5
+1252:	MOV	T1, ACCU
+1254:	MOV	ADDR, T0
+1256:	MOVUB	ACCU, 1(ADDR)
+1259:	ADD	ACCU, T1
+125b:	CMPU	ACCU, #$0010
+125e:	BGE	$1271
+1260:	LEA	ACCU, 65535(FP)
+1264:	MOVB	T2, 0(ADDR)
+1267:	LEAX	ADDR, T1 + ACCU
+1269:	MOVB	0(ADDR), T2
+126c:	ADDB	T5, #$00FF
+126f:	JUMP	$1250
+1271:	MOVB	ACCU, T5
+1273:	CMPUB	ACCU, #$0010
+1275:	BLE	$124A
+1277:	MOV	ACCU, P2
+1279:	MOV	T0, ACCU
+127b:	MOVB	ACCU, T6
+127d:	MOV	T1, ACCU
+127f:	MOVB	ACCU, T5
+1281:	LEA	T2, 0(FP)
+1285:	LEAX	ADDR, T2 + ACCU
+1287:	MOVB	T2, 0(ADDR)
+128a:	MOV	ACCU, T0
+128c:	LEAX	ADDR, T1 + ACCU
+128e:	MOVB	0(ADDR), T2
+1291:	ADDB	T6, #$0001
+1294:	LOOPB	T5, #$10
+1297:	BGT	$127B
+1299:	JUMP	$124A
+129b:	MOVB	ACCU, T5
+129d:	LEA	T1, 65535(FP)
+12a1:	LEAX	ADDR, T1 + ACCU
+12a3:	MOV	ACCU, #43
+12a6:	MOVB	0(ADDR), ACCU
+12a9:	ADDB	T5, #$00FF
+12ac:	JUMPF	$1203
+12af:	MOVB	ACCU, T5
+12b1:	LEA	T1, 65535(FP)
+12b5:	LEAX	ADDR, T1 + ACCU
+12b7:	MOV	ACCU, #45
+12ba:	JUMP	$12A6
+--------------------------------------------------------------------
+nformf:
+12bc:	ENTER	9, 11
+12c0:	PUSH	#$0002
+12c3:	MOV	T8, 4(FP)
+12c6:	MOVD	T0, 6(FP)
+12c9:	MOVD	ACCU, #$00000000
+12cf:	CMPF	ACCU, T0
+12d1:	BLTF	$164A
+12d4:	MOVD	ACCU, T0
+12d6:	MOVD	P0, ACCU
+12d8:	MOV	ADDR, 2(FP)
+12db:	MOVUB	ACCU, 5(ADDR)
+12de:	BEQF	$1636
+12e1:	MOV	ACCU, #43
+12e4:	MOV	ADDR, T8
+12e6:	MOVB	0(ADDR), ACCU
+12e9:	CALL	isinf + 0
+12ec:	MOVB	T9, #1
+12ef:	MOVB	ACCU, ACCU
+12f1:	BEQF	$13C8
+12f4:	MOV	T0, #1
+12f7:	MOV	T1, #3
+12fa:	MOV	T2, 2(FP)
+12fd:	MOV	ADDR, T2
+12ff:	MOVB	T3, 3(ADDR)
+1302:	ADDB	T3, #$0008
+1305:	MOV	ACCU, T8
+1307:	ADD	T0, ACCU
+1309:	MOV	ADDR, T0
+130b:	MOVB	0(ADDR), T3
+130e:	MOV	ADDR, T2
+1310:	MOVB	T3, 3(ADDR)
+1313:	MOV	ADDR, T0
+1315:	ADDB	T3, #$000D
+1318:	MOVB	1(ADDR), T3
+131b:	MOV	ADDR, T2
+131d:	MOVUB	ACCU, 3(ADDR)
+1320:	ADDB	ACCU, #$0005
+1323:	MOVB	T2, ACCU
+1325:	MOV	ACCU, T8
+1327:	LEAX	ADDR, T1 + ACCU
+1329:	MOVB	0(ADDR), T2
+132c:	ADDB	T9, #$0003
+132f:	MOV	T0, 2(FP)
+1332:	MOV	ADDR, T0
+1334:	MOVUB	ACCU, 1(ADDR)
+1337:	CMPUB	ACCU, T9
+1339:	BLT	$1344
+133b:	MOVB	ACCU, T9
+133d:	POP	#$0002
+1340:	RETURN	9, 11
+1344:	MOVUB	ACCU, 6(ADDR)
+1347:	BNE	$13B0
+1349:	MOVB	ACCU, T9
+134b:	CMPUB	ACCU, #$0001
+134d:	BLE	$1380
+134f:	MOVB	T3, #0
+1352:	MOV	ADDR, T0
+1354:	MOVB	T1, 1(ADDR)
+1357:	AND	T1, #$00FF
+135b:	MOVB	ACCU, T9
+135d:	NEG	ACCU
+135e:	ADD	T1, ACCU
+1360:	MOVB	ACCU, T3
+1362:	MOV	T2, ACCU
+1364:	MOV	ACCU, T1
+1366:	CMPU	ACCU, T2
+1368:	BGE	$1379
+136a:	MOV	ACCU, T8
+136c:	LEAX	ADDR, T2 + ACCU
+136e:	MOV	ACCU, #32
+1371:	MOVB	0(ADDR), ACCU
+1374:	ADDB	T3, #$0001
+1377:	JUMP	$1352
+1379:	MOV	ADDR, T0
+137b:	MOVUB	ACCU, 1(ADDR)
+137e:	JUMP	$133D
+1380:	MOVB	ACCU, T9
+1382:	MOV	T1, ACCU
+1384:	ADD	T1, #$FFFF
+1388:	MOV	ACCU, T8
+138a:	ADD	T1, ACCU
+138c:	MOV	T2, #1
+138f:	MOV	ADDR, T0
+1391:	MOVUB	ACCU, 1(ADDR)
+1394:	SUB	ACCU, T2
+1396:	MOV	ADDR, T1
+1398:	MOVB	T4, 0(ADDR)
+139b:	LEAX	ADDR, T8 + ACCU
+139d:	MOVB	0(ADDR), T4
+13a0:	ADD	T1, #$FFFF
+13a4:	ADD	T2, #$0001
+13a8:	MOVB	ACCU, T9
+13aa:	CMPUB	ACCU, T2
+13ac:	BLE	$138F
+13ae:	JUMP	$134F
+13b0:	MOV	ADDR, T0
+13b2:	MOVUB	ACCU, 1(ADDR)
+13b5:	CMPUB	ACCU, T9
+13b7:	BGE	$1379
+13b9:	MOVB	ACCU, T9
+13bb:	LEAX	ADDR, T8 + ACCU
+13bd:	MOV	ACCU, #32
+13c0:	MOVB	0(ADDR), ACCU
+13c3:	ADDB	T9, #$0001
+13c6:	JUMP	$13B0
+13c8:	MOV	T2, 2(FP)
+13cb:	MOV	ADDR, T2
+13cd:	MOVB	T0, 2(ADDR)
+13d0:	MOVB	ACCU, T0
+13d2:	CMPUB	ACCU, #$00FF
+13d4:	BNE	$13DB
+13d6:	MOV	T3, #6
+13d9:	JUMP	$13DF
+13db:	MOVB	ACCU, T0
+13dd:	MOV	T3, ACCU
+13df:	MOVB	ACCU, T3
+13e1:	MOVB	T6, ACCU
+13e3:	MOV	T4, #0
+13e6:	MOVD	T0, 6(FP)
+13e9:	MOVD	ACCU, #$00000000
+13ef:	CMPF	ACCU, T0
+13f1:	BEQ	$145F
+13f3:	MOVD	T1, 6(FP)
+13f6:	MOVD	ACCU, #$447a0000
+13fc:	CMPF	ACCU, T0
+13fe:	BLT	$1415
+1400:	MOVD	ACCU, T1
+1402:	MOVD	$03, #$447a0000
+1408:	DIVF	ACCU, $03
+140a:	MOVD	T0, ACCU
+140c:	MOVD	6(FP), T0
+140f:	ADD	T4, #$0003
+1413:	JUMP	$13F3
+1415:	MOVD	ACCU, T1
+1417:	MOVD	T0, ACCU
+1419:	MOVD	T1, 6(FP)
+141c:	MOVD	ACCU, #$3f800000
+1422:	CMPF	ACCU, T0
+1424:	BGE	$143B
+1426:	MOVD	ACCU, T1
+1428:	MOVD	$03, #$447a0000
+142e:	MULF	ACCU, $03
+1430:	MOVD	T0, ACCU
+1432:	MOVD	6(FP), T0
+1435:	ADD	T4, #$FFFD
+1439:	JUMP	$1419
+143b:	MOVD	ACCU, T1
+143d:	MOVD	T0, ACCU
+143f:	MOVD	ACCU, #$41200000
+1445:	CMPF	ACCU, T0
+1447:	BLT	$145F
+1449:	MOVD	ACCU, 6(FP)
+144c:	MOVD	$03, #$41200000
+1452:	DIVF	ACCU, $03
+1454:	MOVD	T0, ACCU
+1456:	MOVD	6(FP), T0
+1459:	ADD	T4, #$0001
+145d:	JUMP	$143F
+145f:	MOVB	T0, 10(FP)
+1462:	MOVB	ACCU, T0
+1464:	CMPUB	ACCU, #$0065
+1466:	NOT	ACCU
+1467:	ANDB	ACCU, #$0001
+146a:	MOVB	T10, ACCU
+146c:	MOVB	ACCU, T3
+146e:	MOV	T1, ACCU
+1470:	ADD	ACCU, #$0001
+1474:	MOV	T5, ACCU
+1476:	MOVB	ACCU, T0
+1478:	CMPUB	ACCU, #$0067
+147a:	BEQF	$1625
+147d:	MOVB	ACCU, T10
+147f:	BNEF	$15E1
+1482:	MOVD	T0, 6(FP)
+1485:	MOV	ACCU, T4
+1487:	BGE	$149C
+1489:	MOVD	ACCU, T0
+148b:	MOVD	$03, #$41200000
+1491:	DIVF	ACCU, $03
+1493:	MOVD	6(FP), ACCU
+1496:	ADD	T4, #$0001
+149a:	JUMP	$1482
+149c:	ADD	ACCU, T1
+149e:	ADD	ACCU, #$0001
+14a2:	MOV	T5, ACCU
+14a4:	CMPUB	ACCU, #$0007
+14a6:	BGT	$14AE
+14a8:	MOVD	T1, fround5 + 24
+14ac:	JUMP	$14B9
+14ae:	MOV	ACCU, T5
+14b0:	SHL	ACCU, #2
+14b2:	LEAX	ADDR, inp_op_extrt + 24 + ACCU
+14b6:	MOVD	T1, 0(ADDR)
+14b9:	MOVD	ACCU, T1
+14bb:	ADDF	ACCU, T0
+14bd:	MOVD	T0, ACCU
+14bf:	MOVD	6(FP), T0
+14c2:	MOVD	ACCU, #$41200000
+14c8:	CMPF	ACCU, T0
+14ca:	BLT	$14E0
+14cc:	MOVD	ACCU, T0
+14ce:	MOVD	$03, #$41200000
+14d4:	DIVF	ACCU, $03
+14d6:	MOVD	6(FP), ACCU
+14d9:	MOVB	ACCU, T3
+14db:	ADDB	ACCU, #$00FF
+14de:	MOVB	T6, ACCU
+14e0:	MOVB	ACCU, T5
+14e2:	MOV	T0, ACCU
+14e4:	MOVB	ACCU, T6
+14e6:	NEG	ACCU
+14e7:	ADD	ACCU, T0
+14e9:	MOV	T3, ACCU
+14eb:	MOVB	ACCU, T5
+14ed:	CMPUB	ACCU, #$0014
+14ef:	BLTF	$15D6
+14f2:	MOVB	ACCU, T3
+14f4:	BNE	$1503
+14f6:	MOVB	ACCU, T9
+14f8:	LEAX	ADDR, T8 + ACCU
+14fa:	MOV	ACCU, #48
+14fd:	MOVB	0(ADDR), ACCU
+1500:	ADDB	T9, #$0001
+1503:	MOVB	T11, #0
+1506:	MOVB	ACCU, T3
+1508:	CMPUB	ACCU, T11
+150a:	BNE	$1519
+150c:	MOVB	ACCU, T9
+150e:	LEAX	ADDR, T8 + ACCU
+1510:	MOV	ACCU, #46
+1513:	MOVB	0(ADDR), ACCU
+1516:	ADDB	T9, #$0001
+1519:	MOVB	ACCU, T9
+151b:	ADD	ACCU, T8
+151d:	MOV	T6, ACCU
+151f:	MOVB	ACCU, T11
+1521:	CMPUB	ACCU, #$0006
+1523:	BLT	$154A
+1525:	MOV	ADDR, T6
+1527:	MOVD	T0, 6(FP)
+152a:	MOVD	ACCU, T0
+152c:	CNVFS	ACCU
+152d:	MOV	T7, ACCU
+152f:	CNVSF	ACCU
+1530:	MOVD	T1, ACCU
+1532:	MOVD	ACCU, T0
+1534:	SUBF	ACCU, T1
+1536:	MOVD	$03, #$41200000
+153c:	MULF	ACCU, $03
+153e:	MOVD	6(FP), ACCU
+1541:	ADD	T7, #$0030
+1545:	MOVB	0(ADDR), T7
+1548:	JUMP	$1552
+154a:	MOV	ACCU, #48
+154d:	MOV	ADDR, T6
+154f:	MOVB	0(ADDR), ACCU
+1552:	ADDB	T9, #$0001
+1555:	ADDB	T11, #$0001
+1558:	MOVB	ACCU, T5
+155a:	CMPUB	ACCU, T11
+155c:	BLT	$1506
+155e:	MOVB	ACCU, T10
+1560:	BEQF	$132F
+1563:	MOV	ADDR, T2
+1565:	MOVB	T1, 3(ADDR)
+1568:	MOVB	ACCU, T9
+156a:	MOV	T0, ACCU
+156c:	ADDB	T1, #$0004
+156f:	MOV	ACCU, T8
+1571:	LEAX	ADDR, T0 + ACCU
+1573:	MOVB	0(ADDR), T1
+1576:	ADDB	T9, #$0001
+1579:	MOVB	ACCU, T9
+157b:	ADD	ACCU, T8
+157d:	MOV	T0, ACCU
+157f:	MOV	ACCU, T4
+1581:	BLT	$158D
+1583:	MOV	ACCU, #43
+1586:	MOV	ADDR, T0
+1588:	MOVB	0(ADDR), ACCU
+158b:	JUMP	$159A
+158d:	MOV	ACCU, #45
+1590:	MOV	ADDR, T0
+1592:	MOVB	0(ADDR), ACCU
+1595:	MOV	ACCU, T4
+1597:	NEG	ACCU
+1598:	MOV	T4, ACCU
+159a:	ADDB	T9, #$0001
+159d:	MOVB	ACCU, T9
+159f:	MOV	T0, ACCU
+15a1:	MOV	ACCU, T4
+15a3:	MOV	ADDR, #10
+15a6:	DIVS	ACCU, ADDR
+15a8:	MOV	T1, ACCU
+15aa:	ADD	T1, #$0030
+15ae:	MOV	ACCU, T8
+15b0:	LEAX	ADDR, T0 + ACCU
+15b2:	MOVB	0(ADDR), T1
+15b5:	ADDB	T9, #$0001
+15b8:	MOVB	ACCU, T9
+15ba:	MOV	T0, ACCU
+15bc:	MOV	ACCU, T4
+15be:	MOV	ADDR, #10
+15c1:	MODS	ACCU, ADDR
+15c3:	MOV	T4, ACCU
+15c5:	ADD	T4, #$0030
+15c9:	MOV	ACCU, T8
+15cb:	LEAX	ADDR, T0 + ACCU
+15cd:	MOVB	0(ADDR), T4
+15d0:	ADDB	T9, #$0001
+15d3:	JUMPF	$132F
+15d6:	MOVB	T5, #20
+15d9:	MOVB	ACCU, T3
+15db:	BNEF	$1503
+15de:	JUMPF	$14F6
+15e1:	MOVD	T0, 6(FP)
+15e4:	MOVB	ACCU, T5
+15e6:	CMPUB	ACCU, #$0007
+15e8:	BGT	$15F0
+15ea:	MOVD	T1, fround5 + 24
+15ee:	JUMP	$15FD
+15f0:	MOVB	ACCU, T5
+15f2:	SHL	ACCU, #2
+15f4:	MOVB	T1, ACCU
+15f6:	LEAX	ADDR, inp_op_extrt + 24 + T1
+15fa:	MOVD	T1, 0(ADDR)
+15fd:	MOVD	ACCU, T1
+15ff:	ADDF	ACCU, T0
+1601:	MOVD	T0, ACCU
+1603:	MOVD	6(FP), T0
+1606:	MOVD	ACCU, #$41200000
+160c:	CMPF	ACCU, T0
+160e:	BLTF	$14E0
+1611:	MOVD	ACCU, T0
+1613:	MOVD	$03, #$41200000
+1619:	DIVF	ACCU, $03
+161b:	MOVD	6(FP), ACCU
+161e:	ADD	T4, #$0001
+1622:	JUMPF	$14E0
+1625:	MOV	ACCU, T4
+1627:	CMPS	ACCU, #$0003
+162a:	BLT	$1631
+162c:	MOV	ACCU, T4
+162e:	BGEF	$147D
+1631:	MOVB	T10, #1
+1634:	JUMP	$15E1
+1636:	CALL	isinf + 0
+1639:	MOVB	T9, #0
+163c:	MOVB	ACCU, ACCU
+163e:	BEQF	$13C8
+1641:	MOV	T0, #0
+1644:	MOV	T1, #2
+1647:	JUMPF	$12FA
+164a:	MOV	ACCU, #45
+164d:	MOV	ADDR, T8
+164f:	MOVB	0(ADDR), ACCU
+1652:	MOVD	ACCU, T0
+1654:	NEGF	ACCU
+1655:	MOVD	T0, ACCU
+1657:	MOVD	6(FP), T0
+165a:	MOVD	P0, ACCU
+165c:	JUMPF	$12E9
+--------------------------------------------------------------------
+isinf:
+165f:	ENTER	0, 6
+1663:	MOVD	ACCU, P0
+1665:	MOVD	0(FP), ACCU
+1668:	MOV	ACCU, 2(FP)
+166b:	SHRU	ACCU, #7
+166d:	CMPUB	ACCU, #$00FF
+166f:	NOT	ACCU
+1670:	ANDB	ACCU, #$0001
+1673:	MOVB	ACCU, ACCU
+1675:	RETURN	0, 6
+--------------------------------------------------------------------
+1679 : __ __ __ BYT 25 64 20 25 35 75 20 25 30 34 78 20 25 73 20 25 : %d %5u %04x %s %
+1689 : __ __ __ BYT 63 20 25 38 2e 33 66 00                         : c %8.3f.
+--------------------------------------------------------------------
+1691 : __ __ __ BYT 74 65 78 74 00                                  : text.
+--------------------------------------------------------------------
+strlen: ; strlen(const u8*)->i16
+;  12, "/root/repo/include/string.h"
+.s1:
+1696 : ea __ __ NOP
+.s4:
+1697 : a9 00 __ LDA #$00
+1699 : 85 1b __ STA ACCU + 0 
+169b : 85 1c __ STA ACCU + 1 
+169d : a8 __ __ TAY
+169e : b1 0d __ LDA (P0),y ; (str + 0)
+16a0 : f0 10 __ BEQ $16b2 ; (strlen.s3 + 0)
+.s6:
+16a2 : a2 00 __ LDX #$00
+.l7:
+16a4 : c8 __ __ INY
+16a5 : d0 03 __ BNE $16aa ; (strlen.s9 + 0)
+.s8:
+16a7 : e6 0e __ INC P1 ; (str + 1)
+16a9 : e8 __ __ INX
+.s9:
+16aa : b1 0d __ LDA (P0),y ; (str + 0)
+16ac : d0 f6 __ BNE $16a4 ; (strlen.l7 + 0)
+.s5:
+16ae : 86 1c __ STX ACCU + 1 
+16b0 : 84 1b __ STY ACCU + 0 
+.s3:
+16b2 : 60 __ __ RTS
+--------------------------------------------------------------------
+16b3 : __ __ __ BYT 25 64 3a 25 73 3a 25 78 00                      : %d:%s:%x.
+--------------------------------------------------------------------
+16bc : __ __ __ BYT 6f 6b 00                                        : ok.
+--------------------------------------------------------------------
+strcmp: ; strcmp(const u8*,const u8*)->i8
+;   8, "/root/repo/include/string.h"
+.s1:
+16bf : ea __ __ NOP
+.s4:
+16c0 : a0 00 __ LDY #$00
+16c2 : b1 0d __ LDA (P0),y 
+16c4 : f0 16 __ BEQ $16dc ; (strcmp.s4 + 28)
+16c6 : d1 0f __ CMP (P2),y 
+16c8 : d0 16 __ BNE $16e0 ; (strcmp.s4 + 32)
+16ca : c8 __ __ INY
+16cb : b1 0d __ LDA (P0),y 
+16cd : f0 0d __ BEQ $16dc ; (strcmp.s4 + 28)
+16cf : d1 0f __ CMP (P2),y 
+16d1 : d0 0d __ BNE $16e0 ; (strcmp.s4 + 32)
+16d3 : c8 __ __ INY
+16d4 : d0 ec __ BNE $16c2 ; (strcmp.s4 + 2)
+16d6 : e6 0e __ INC P1 
+16d8 : e6 10 __ INC P3 
+16da : d0 e6 __ BNE $16c2 ; (strcmp.s4 + 2)
+16dc : d1 0f __ CMP (P2),y 
+16de : f0 08 __ BEQ $16e8 ; (strcmp.s4 + 40)
+16e0 : b0 04 __ BCS $16e6 ; (strcmp.s4 + 38)
+16e2 : a9 ff __ LDA #$ff
+16e4 : 30 02 __ BMI $16e8 ; (strcmp.s4 + 40)
+16e6 : a9 01 __ LDA #$01
+16e8 : 85 1b __ STA ACCU + 0 
+.s3:
+16ea : 60 __ __ RTS
+--------------------------------------------------------------------
+16eb : __ __ __ BYT 2d 34 32 3a 6f 6b 3a 66 66 00                   : -42:ok:ff.
+--------------------------------------------------------------------
+freg: ; freg
+16f5 : b1 19 __ LDA (IP + 0),y 
+16f7 : c8 __ __ INY
+16f8 : aa __ __ TAX
+16f9 : b5 00 __ LDA $00,x 
+16fb : 85 03 __ STA WORK + 0 
+16fd : b5 01 __ LDA $01,x 
+16ff : 85 04 __ STA WORK + 1 
+1701 : b5 02 __ LDA $02,x 
+1703 : 85 05 __ STA WORK + 2 
+1705 : b5 03 __ LDA WORK + 0,x 
+1707 : 85 06 __ STA WORK + 3 
+1709 : a5 05 __ LDA WORK + 2 
+170b : 0a __ __ ASL
+170c : a5 06 __ LDA WORK + 3 
+170e : 2a __ __ ROL
+170f : 85 08 __ STA WORK + 5 
+1711 : f0 06 __ BEQ $1719 ; (freg + 36)
+1713 : a5 05 __ LDA WORK + 2 
+1715 : 09 80 __ ORA #$80
+1717 : 85 05 __ STA WORK + 2 
+1719 : a5 1d __ LDA ACCU + 2 
+171b : 0a __ __ ASL
+171c : a5 1e __ LDA ACCU + 3 
+171e : 2a __ __ ROL
+171f : 85 07 __ STA WORK + 4 
+1721 : f0 06 __ BEQ $1729 ; (freg + 52)
+1723 : a5 1d __ LDA ACCU + 2 
+1725 : 09 80 __ ORA #$80
+1727 : 85 1d __ STA ACCU + 2 
+1729 : 60 __ __ RTS
+172a : 06 1e __ ASL ACCU + 3 
+172c : a5 07 __ LDA WORK + 4 
+172e : 6a __ __ ROR
+172f : 85 1e __ STA ACCU + 3 
+1731 : b0 06 __ BCS $1739 ; (freg + 68)
+1733 : a5 1d __ LDA ACCU + 2 
+1735 : 29 7f __ AND #$7f
+1737 : 85 1d __ STA ACCU + 2 
+1739 : 60 __ __ RTS
+--------------------------------------------------------------------
+faddsub: ; faddsub
+173a : a5 06 __ LDA WORK + 3 
+173c : 49 80 __ EOR #$80
+173e : 85 06 __ STA WORK + 3 
+1740 : a9 ff __ LDA #$ff
+1742 : c5 07 __ CMP WORK + 4 
+1744 : f0 04 __ BEQ $174a ; (faddsub + 16)
+1746 : c5 08 __ CMP WORK + 5 
+1748 : d0 11 __ BNE $175b ; (faddsub + 33)
+174a : a5 1e __ LDA ACCU + 3 
+174c : 09 7f __ ORA #$7f
+174e : 85 1e __ STA ACCU + 3 
+1750 : a9 80 __ LDA #$80
+1752 : 85 1d __ STA ACCU + 2 
+1754 : a9 00 __ LDA #$00
+1756 : 85 1b __ STA ACCU + 0 
+1758 : 85 1c __ STA ACCU + 1 
+175a : 60 __ __ RTS
+175b : 38 __ __ SEC
+175c : a5 07 __ LDA WORK + 4 
+175e : e5 08 __ SBC WORK + 5 
+1760 : f0 38 __ BEQ $179a ; (faddsub + 96)
+1762 : aa __ __ TAX
+1763 : b0 25 __ BCS $178a ; (faddsub + 80)
+1765 : e0 e9 __ CPX #$e9
+1767 : b0 0e __ BCS $1777 ; (faddsub + 61)
+1769 : a5 08 __ LDA WORK + 5 
+176b : 85 07 __ STA WORK + 4 
+176d : a9 00 __ LDA #$00
+176f : 85 1b __ STA ACCU + 0 
+1771 : 85 1c __ STA ACCU + 1 
+1773 : 85 1d __ STA ACCU + 2 
+1775 : f0 23 __ BEQ $179a ; (faddsub + 96)
+1777 : a5 1d __ LDA ACCU + 2 
+1779 : 4a __ __ LSR
+177a : 66 1c __ ROR ACCU + 1 
+177c : 66 1b __ ROR ACCU + 0 
+177e : e8 __ __ INX
+177f : d0 f8 __ BNE $1779 ; (faddsub + 63)
+1781 : 85 1d __ STA ACCU + 2 
+1783 : a5 08 __ LDA WORK + 5 
+1785 : 85 07 __ STA WORK + 4 
+1787 : 4c 9a 17 JMP $179a ; (faddsub + 96)
+178a : e0 18 __ CPX #$18
+178c : b0 33 __ BCS $17c1 ; (faddsub + 135)
+178e : a5 05 __ LDA WORK + 2 
+1790 : 4a __ __ LSR
+1791 : 66 04 __ ROR WORK + 1 
+1793 : 66 03 __ ROR WORK + 0 
+1795 : ca __ __ DEX
+1796 : d0 f8 __ BNE $1790 ; (faddsub + 86)
+1798 : 85 05 __ STA WORK + 2 
+179a : a5 1e __ LDA ACCU + 3 
+179c : 29 80 __ AND #$80
+179e : 85 1e __ STA ACCU + 3 
+17a0 : 45 06 __ EOR WORK + 3 
+17a2 : 30 31 __ BMI $17d5 ; (faddsub + 155)
+17a4 : 18 __ __ CLC
+17a5 : a5 1b __ LDA ACCU + 0 
+17a7 : 65 03 __ ADC WORK + 0 
+17a9 : 85 1b __ STA ACCU + 0 
+17ab : a5 1c __ LDA ACCU + 1 
+17ad : 65 04 __ ADC WORK + 1 
+17af : 85 1c __ STA ACCU + 1 
+17b1 : a5 1d __ LDA ACCU + 2 
+17b3 : 65 05 __ ADC WORK + 2 
+17b5 : 85 1d __ STA ACCU + 2 
+17b7 : 90 08 __ BCC $17c1 ; (faddsub + 135)
+17b9 : 66 1d __ ROR ACCU + 2 
+17bb : 66 1c __ ROR ACCU + 1 
+17bd : 66 1b __ ROR ACCU + 0 
+17bf : e6 07 __ INC WORK + 4 
+17c1 : a5 07 __ LDA WORK + 4 
+17c3 : c9 ff __ CMP #$ff
+17c5 : f0 83 __ BEQ $174a ; (faddsub + 16)
+17c7 : 4a __ __ LSR
+17c8 : 05 1e __ ORA ACCU + 3 
+17ca : 85 1e __ STA ACCU + 3 
+17cc : b0 06 __ BCS $17d4 ; (faddsub + 154)
+17ce : a5 1d __ LDA ACCU + 2 
+17d0 : 29 7f __ AND #$7f
+17d2 : 85 1d __ STA ACCU + 2 
+17d4 : 60 __ __ RTS
+17d5 : 38 __ __ SEC
+17d6 : a5 1b __ LDA ACCU + 0 
+17d8 : e5 03 __ SBC WORK + 0 
+17da : 85 1b __ STA ACCU + 0 
+17dc : a5 1c __ LDA ACCU + 1 
+17de : e5 04 __ SBC WORK + 1 
+17e0 : 85 1c __ STA ACCU + 1 
+17e2 : a5 1d __ LDA ACCU + 2 
+17e4 : e5 05 __ SBC WORK + 2 
+17e6 : 85 1d __ STA ACCU + 2 
+17e8 : b0 19 __ BCS $1803 ; (faddsub + 201)
+17ea : 38 __ __ SEC
+17eb : a9 00 __ LDA #$00
+17ed : e5 1b __ SBC ACCU + 0 
+17ef : 85 1b __ STA ACCU + 0 
+17f1 : a9 00 __ LDA #$00
+17f3 : e5 1c __ SBC ACCU + 1 
+17f5 : 85 1c __ STA ACCU + 1 
+17f7 : a9 00 __ LDA #$00
+17f9 : e5 1d __ SBC ACCU + 2 
+17fb : 85 1d __ STA ACCU + 2 
+17fd : a5 1e __ LDA ACCU + 3 
+17ff : 49 80 __ EOR #$80
+1801 : 85 1e __ STA ACCU + 3 
+1803 : a5 1d __ LDA ACCU + 2 
+1805 : 30 ba __ BMI $17c1 ; (faddsub + 135)
+1807 : 05 1c __ ORA ACCU + 1 
+1809 : 05 1b __ ORA ACCU + 0 
+180b : f0 0f __ BEQ $181c ; (faddsub + 226)
+180d : c6 07 __ DEC WORK + 4 
+180f : f0 0b __ BEQ $181c ; (faddsub + 226)
+1811 : 06 1b __ ASL ACCU + 0 
+1813 : 26 1c __ ROL ACCU + 1 
+1815 : 26 1d __ ROL ACCU + 2 
+1817 : 10 f4 __ BPL $180d ; (faddsub + 211)
+1819 : 4c c1 17 JMP $17c1 ; (faddsub + 135)
+181c : a9 00 __ LDA #$00
+181e : 85 1b __ STA ACCU + 0 
+1820 : 85 1c __ STA ACCU + 1 
+1822 : 85 1d __ STA ACCU + 2 
+1824 : 85 1e __ STA ACCU + 3 
+1826 : 60 __ __ RTS
+--------------------------------------------------------------------
+crt_fmul: ; crt_fmul
+1827 : a5 1b __ LDA ACCU + 0 
+1829 : 05 1c __ ORA ACCU + 1 
+182b : 05 1d __ ORA ACCU + 2 
+182d : f0 0e __ BEQ $183d ; (crt_fmul + 22)
+182f : a5 03 __ LDA WORK + 0 
+1831 : 05 04 __ ORA WORK + 1 
+1833 : 05 05 __ ORA WORK + 2 
+1835 : d0 09 __ BNE $1840 ; (crt_fmul + 25)
+1837 : 85 1b __ STA ACCU + 0 
+1839 : 85 1c __ STA ACCU + 1 
+183b : 85 1d __ STA ACCU + 2 
+183d : 85 1e __ STA ACCU + 3 
+183f : 60 __ __ RTS
+1840 : a5 1e __ LDA ACCU + 3 
+1842 : 45 06 __ EOR WORK + 3 
+1844 : 29 80 __ AND #$80
+1846 : 85 1e __ STA ACCU + 3 
+1848 : a9 ff __ LDA #$ff
+184a : c5 07 __ CMP WORK + 4 
+184c : f0 42 __ BEQ $1890 ; (crt_fmul + 105)
+184e : c5 08 __ CMP WORK + 5 
+1850 : f0 3e __ BEQ $1890 ; (crt_fmul + 105)
+1852 : a9 00 __ LDA #$00
+1854 : 85 09 __ STA WORK + 6 
+1856 : 85 0a __ STA WORK + 7 
+1858 : 85 0b __ STA WORK + 8 
+185a : a4 1b __ LDY ACCU + 0 
+185c : a5 03 __ LDA WORK + 0 
+185e : d0 06 __ BNE $1866 ; (crt_fmul + 63)
+1860 : a5 04 __ LDA WORK + 1 
+1862 : f0 0a __ BEQ $186e ; (crt_fmul + 71)
+1864 : d0 05 __ BNE $186b ; (crt_fmul + 68)
+1866 : 20 c1 18 JSR $18c1 ; (crt_fmul8 + 0)
+1869 : a5 04 __ LDA WORK + 1 
+186b : 20 c1 18 JSR $18c1 ; (crt_fmul8 + 0)
+186e : a5 05 __ LDA WORK + 2 
+1870 : 20 c1 18 JSR $18c1 ; (crt_fmul8 + 0)
+1873 : 38 __ __ SEC
+1874 : a5 0b __ LDA WORK + 8 
+1876 : 30 06 __ BMI $187e ; (crt_fmul + 87)
+1878 : 06 09 __ ASL WORK + 6 
+187a : 26 0a __ ROL WORK + 7 
+187c : 2a __ __ ROL
+187d : 18 __ __ CLC
+187e : 29 7f __ AND #$7f
+1880 : 85 0b __ STA WORK + 8 
+1882 : a5 07 __ LDA WORK + 4 
+1884 : 65 08 __ ADC WORK + 5 
+1886 : 90 19 __ BCC $18a1 ; (crt_fmul + 122)
+1888 : e9 7f __ SBC #$7f
+188a : b0 04 __ BCS $1890 ; (crt_fmul + 105)
+188c : c9 ff __ CMP #$ff
+188e : d0 15 __ BNE $18a5 ; (crt_fmul + 126)
+1890 : a5 1e __ LDA ACCU + 3 
+1892 : 09 7f __ ORA #$7f
+1894 : 85 1e __ STA ACCU + 3 
+1896 : a9 80 __ LDA #$80
+1898 : 85 1d __ STA ACCU + 2 
+189a : a9 00 __ LDA #$00
+189c : 85 1b __ STA ACCU + 0 
+189e : 85 1c __ STA ACCU + 1 
+18a0 : 60 __ __ RTS
+18a1 : e9 7e __ SBC #$7e
+18a3 : 90 15 __ BCC $18ba ; (crt_fmul + 147)
+18a5 : 4a __ __ LSR
+18a6 : 05 1e __ ORA ACCU + 3 
+18a8 : 85 1e __ STA ACCU + 3 
+18aa : a9 00 __ LDA #$00
+18ac : 6a __ __ ROR
+18ad : 05 0b __ ORA WORK + 8 
+18af : 85 1d __ STA ACCU + 2 
+18b1 : a5 0a __ LDA WORK + 7 
+18b3 : 85 1c __ STA ACCU + 1 
+18b5 : a5 09 __ LDA WORK + 6 
+18b7 : 85 1b __ STA ACCU + 0 
+18b9 : 60 __ __ RTS
+18ba : a9 00 __ LDA #$00
+18bc : 85 1e __ STA ACCU + 3 
+18be : f0 d8 __ BEQ $1898 ; (crt_fmul + 113)
+18c0 : 60 __ __ RTS
+--------------------------------------------------------------------
+crt_fmul8: ; crt_fmul8
+18c1 : 38 __ __ SEC
+18c2 : 6a __ __ ROR
+18c3 : 90 1e __ BCC $18e3 ; (crt_fmul8 + 34)
+18c5 : aa __ __ TAX
+18c6 : 18 __ __ CLC
+18c7 : 98 __ __ TYA
+18c8 : 65 09 __ ADC WORK + 6 
+18ca : 85 09 __ STA WORK + 6 
+18cc : a5 0a __ LDA WORK + 7 
+18ce : 65 1c __ ADC ACCU + 1 
+18d0 : 85 0a __ STA WORK + 7 
+18d2 : a5 0b __ LDA WORK + 8 
+18d4 : 65 1d __ ADC ACCU + 2 
+18d6 : 6a __ __ ROR
+18d7 : 85 0b __ STA WORK + 8 
+18d9 : 8a __ __ TXA
+18da : 66 0a __ ROR WORK + 7 
+18dc : 66 09 __ ROR WORK + 6 
+18de : 4a __ __ LSR
+18df : f0 0d __ BEQ $18ee ; (crt_fmul8 + 45)
+18e1 : b0 e2 __ BCS $18c5 ; (crt_fmul8 + 4)
+18e3 : 66 0b __ ROR WORK + 8 
+18e5 : 66 0a __ ROR WORK + 7 
+18e7 : 66 09 __ ROR WORK + 6 
+18e9 : 4a __ __ LSR
+18ea : 90 f7 __ BCC $18e3 ; (crt_fmul8 + 34)
+18ec : d0 d7 __ BNE $18c5 ; (crt_fmul8 + 4)
+18ee : 60 __ __ RTS
+--------------------------------------------------------------------
+crt_fdiv: ; crt_fdiv
+18ef : a5 1b __ LDA ACCU + 0 
+18f1 : 05 1c __ ORA ACCU + 1 
+18f3 : 05 1d __ ORA ACCU + 2 
+18f5 : d0 03 __ BNE $18fa ; (crt_fdiv + 11)
+18f7 : 85 1e __ STA ACCU + 3 
+18f9 : 60 __ __ RTS
+18fa : a5 1e __ LDA ACCU + 3 
+18fc : 45 06 __ EOR WORK + 3 
+18fe : 29 80 __ AND #$80
+1900 : 85 1e __ STA ACCU + 3 
+1902 : a5 08 __ LDA WORK + 5 
+1904 : f0 62 __ BEQ $1968 ; (crt_fdiv + 121)
+1906 : a5 07 __ LDA WORK + 4 
+1908 : c9 ff __ CMP #$ff
+190a : f0 5c __ BEQ $1968 ; (crt_fdiv + 121)
+190c : a9 00 __ LDA #$00
+190e : 85 09 __ STA WORK + 6 
+1910 : 85 0a __ STA WORK + 7 
+1912 : 85 0b __ STA WORK + 8 
+1914 : a2 18 __ LDX #$18
+1916 : a5 1b __ LDA ACCU + 0 
+1918 : c5 03 __ CMP WORK + 0 
+191a : a5 1c __ LDA ACCU + 1 
+191c : e5 04 __ SBC WORK + 1 
+191e : a5 1d __ LDA ACCU + 2 
+1920 : e5 05 __ SBC WORK + 2 
+1922 : 90 13 __ BCC $1937 ; (crt_fdiv + 72)
+1924 : a5 1b __ LDA ACCU + 0 
+1926 : e5 03 __ SBC WORK + 0 
+1928 : 85 1b __ STA ACCU + 0 
+192a : a5 1c __ LDA ACCU + 1 
+192c : e5 04 __ SBC WORK + 1 
+192e : 85 1c __ STA ACCU + 1 
+1930 : a5 1d __ LDA ACCU + 2 
+1932 : e5 05 __ SBC WORK + 2 
+1934 : 85 1d __ STA ACCU + 2 
+1936 : 38 __ __ SEC
+1937 : 26 09 __ ROL WORK + 6 
+1939 : 26 0a __ ROL WORK + 7 
+193b : 26 0b __ ROL WORK + 8 
+193d : ca __ __ DEX
+193e : f0 0a __ BEQ $194a ; (crt_fdiv + 91)
+1940 : 06 1b __ ASL ACCU + 0 
+1942 : 26 1c __ ROL ACCU + 1 
+1944 : 26 1d __ ROL ACCU + 2 
+1946 : b0 dc __ BCS $1924 ; (crt_fdiv + 53)
+1948 : 90 cc __ BCC $1916 ; (crt_fdiv + 39)
+194a : 38 __ __ SEC
+194b : a5 0b __ LDA WORK + 8 
+194d : 30 06 __ BMI $1955 ; (crt_fdiv + 102)
+194f : 06 09 __ ASL WORK + 6 
+1951 : 26 0a __ ROL WORK + 7 
+1953 : 2a __ __ ROL
+1954 : 18 __ __ CLC
+1955 : 29 7f __ AND #$7f
+1957 : 85 0b __ STA WORK + 8 
+1959 : a5 07 __ LDA WORK + 4 
+195b : e5 08 __ SBC WORK + 5 
+195d : 90 1a __ BCC $1979 ; (crt_fdiv + 138)
+195f : 18 __ __ CLC
+1960 : 69 7f __ ADC #$7f
+1962 : b0 04 __ BCS $1968 ; (crt_fdiv + 121)
+1964 : c9 ff __ CMP #$ff
+1966 : d0 15 __ BNE $197d ; (crt_fdiv + 142)
+1968 : a5 1e __ LDA ACCU + 3 
+196a : 09 7f __ ORA #$7f
+196c : 85 1e __ STA ACCU + 3 
+196e : a9 80 __ LDA #$80
+1970 : 85 1d __ STA ACCU + 2 
+1972 : a9 00 __ LDA #$00
+1974 : 85 1c __ STA ACCU + 1 
+1976 : 85 1b __ STA ACCU + 0 
+1978 : 60 __ __ RTS
+1979 : 69 7f __ ADC #$7f
+197b : 90 15 __ BCC $1992 ; (crt_fdiv + 163)
+197d : 4a __ __ LSR
+197e : 05 1e __ ORA ACCU + 3 
+1980 : 85 1e __ STA ACCU + 3 
+1982 : a9 00 __ LDA #$00
+1984 : 6a __ __ ROR
+1985 : 05 0b __ ORA WORK + 8 
+1987 : 85 1d __ STA ACCU + 2 
+1989 : a5 0a __ LDA WORK + 7 
+198b : 85 1c __ STA ACCU + 1 
+198d : a5 09 __ LDA WORK + 6 
+198f : 85 1b __ STA ACCU + 0 
+1991 : 60 __ __ RTS
+1992 : a9 00 __ LDA #$00
+1994 : 85 1e __ STA ACCU + 3 
+1996 : 85 1d __ STA ACCU + 2 
+1998 : 85 1c __ STA ACCU + 1 
+199a : 85 1b __ STA ACCU + 0 
+199c : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu: ; negaccu
+199d : 38 __ __ SEC
+199e : a9 00 __ LDA #$00
+19a0 : e5 1b __ SBC ACCU + 0 
+19a2 : 85 1b __ STA ACCU + 0 
+19a4 : a9 00 __ LDA #$00
+19a6 : e5 1c __ SBC ACCU + 1 
+19a8 : 85 1c __ STA ACCU + 1 
+19aa : 60 __ __ RTS
+--------------------------------------------------------------------
+negtmp: ; negtmp
+19ab : 38 __ __ SEC
+19ac : a9 00 __ LDA #$00
+19ae : e5 03 __ SBC WORK + 0 
+19b0 : 85 03 __ STA WORK + 0 
+19b2 : a9 00 __ LDA #$00
+19b4 : e5 04 __ SBC WORK + 1 
+19b6 : 85 04 __ STA WORK + 1 
+19b8 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod: ; divmod
+19b9 : a5 1c __ LDA ACCU + 1 
+19bb : d0 3b __ BNE $19f8 ; (divmod + 63)
+19bd : a5 04 __ LDA WORK + 1 
+19bf : d0 1e __ BNE $19df ; (divmod + 38)
+19c1 : 85 06 __ STA WORK + 3 
+19c3 : a2 04 __ LDX #$04
+19c5 : 06 1b __ ASL ACCU + 0 
+19c7 : 2a __ __ ROL
+19c8 : c5 03 __ CMP WORK + 0 
+19ca : 90 02 __ BCC $19ce ; (divmod + 21)
+19cc : e5 03 __ SBC WORK + 0 
+19ce : 26 1b __ ROL ACCU + 0 
+19d0 : 2a __ __ ROL
+19d1 : c5 03 __ CMP WORK + 0 
+19d3 : 90 02 __ BCC $19d7 ; (divmod + 30)
+19d5 : e5 03 __ SBC WORK + 0 
+19d7 : 26 1b __ ROL ACCU + 0 
+19d9 : ca __ __ DEX
+19da : d0 eb __ BNE $19c7 ; (divmod + 14)
+19dc : 85 05 __ STA WORK + 2 
+19de : 60 __ __ RTS
+19df : a5 1b __ LDA ACCU + 0 
+19e1 : 85 05 __ STA WORK + 2 
+19e3 : a5 1c __ LDA ACCU + 1 
+19e5 : 85 06 __ STA WORK + 3 
+19e7 : a9 00 __ LDA #$00
+19e9 : 85 1b __ STA ACCU + 0 
+19eb : 85 1c __ STA ACCU + 1 
+19ed : 60 __ __ RTS
+19ee : 85 03 __ STA WORK + 0 
+19f0 : a9 00 __ LDA #$00
+19f2 : 85 04 __ STA WORK + 1 
+19f4 : a5 1c __ LDA ACCU + 1 
+19f6 : f0 c9 __ BEQ $19c1 ; (divmod + 8)
+19f8 : a5 04 __ LDA WORK + 1 
+19fa : d0 1f __ BNE $1a1b ; (divmod + 98)
+19fc : a5 03 __ LDA WORK + 0 
+19fe : 30 1b __ BMI $1a1b ; (divmod + 98)
+1a00 : a9 00 __ LDA #$00
+1a02 : 85 06 __ STA WORK + 3 
+1a04 : a2 10 __ LDX #$10
+1a06 : 06 1b __ ASL ACCU + 0 
+1a08 : 26 1c __ ROL ACCU + 1 
+1a0a : 2a __ __ ROL
+1a0b : c5 03 __ CMP WORK + 0 
+1a0d : 90 02 __ BCC $1a11 ; (divmod + 88)
+1a0f : e5 03 __ SBC WORK + 0 
+1a11 : 26 1b __ ROL ACCU + 0 
+1a13 : 26 1c __ ROL ACCU + 1 
+1a15 : ca __ __ DEX
+1a16 : d0 f2 __ BNE $1a0a ; (divmod + 81)
+1a18 : 85 05 __ STA WORK + 2 
+1a1a : 60 __ __ RTS
+1a1b : a9 00 __ LDA #$00
+1a1d : 85 05 __ STA WORK + 2 
+1a1f : 85 06 __ STA WORK + 3 
+1a21 : a0 10 __ LDY #$10
+1a23 : 18 __ __ CLC
+1a24 : 26 1b __ ROL ACCU + 0 
+1a26 : 26 1c __ ROL ACCU + 1 
+1a28 : 26 05 __ ROL WORK + 2 
+1a2a : 26 06 __ ROL WORK + 3 
+1a2c : 38 __ __ SEC
+1a2d : a5 05 __ LDA WORK + 2 
+1a2f : e5 03 __ SBC WORK + 0 
+1a31 : aa __ __ TAX
+1a32 : a5 06 __ LDA WORK + 3 
+1a34 : e5 04 __ SBC WORK + 1 
+1a36 : 90 04 __ BCC $1a3c ; (divmod + 131)
+1a38 : 86 05 __ STX WORK + 2 
+1a3a : 85 06 __ STA WORK + 3 
+1a3c : 88 __ __ DEY
+1a3d : d0 e5 __ BNE $1a24 ; (divmod + 107)
+1a3f : 26 1b __ ROL ACCU + 0 
+1a41 : 26 1c __ ROL ACCU + 1 
+1a43 : 60 __ __ RTS
+--------------------------------------------------------------------
+f32_to_i16: ; f32_to_i16
+1a44 : 20 19 17 JSR $1719 ; (freg + 36)
+1a47 : a5 07 __ LDA WORK + 4 
+1a49 : c9 7f __ CMP #$7f
+1a4b : b0 07 __ BCS $1a54 ; (f32_to_i16 + 16)
+1a4d : a9 00 __ LDA #$00
+1a4f : 85 1b __ STA ACCU + 0 
+1a51 : 85 1c __ STA ACCU + 1 
+1a53 : 60 __ __ RTS
+1a54 : e9 8e __ SBC #$8e
+1a56 : 90 16 __ BCC $1a6e ; (f32_to_i16 + 42)
+1a58 : 24 1e __ BIT ACCU + 3 
+1a5a : 30 09 __ BMI $1a65 ; (f32_to_i16 + 33)
+1a5c : a9 ff __ LDA #$ff
+1a5e : 85 1b __ STA ACCU + 0 
+1a60 : a9 7f __ LDA #$7f
+1a62 : 85 1c __ STA ACCU + 1 
+1a64 : 60 __ __ RTS
+1a65 : a9 00 __ LDA #$00
+1a67 : 85 1b __ STA ACCU + 0 
+1a69 : a9 80 __ LDA #$80
+1a6b : 85 1c __ STA ACCU + 1 
+1a6d : 60 __ __ RTS
+1a6e : aa __ __ TAX
+1a6f : a5 1c __ LDA ACCU + 1 
+1a71 : 46 1d __ LSR ACCU + 2 
+1a73 : 6a __ __ ROR
+1a74 : e8 __ __ INX
+1a75 : d0 fa __ BNE $1a71 ; (f32_to_i16 + 45)
+1a77 : 24 1e __ BIT ACCU + 3 
+1a79 : 10 0e __ BPL $1a89 ; (f32_to_i16 + 69)
+1a7b : 38 __ __ SEC
+1a7c : 49 ff __ EOR #$ff
+1a7e : 69 00 __ ADC #$00
+1a80 : 85 1b __ STA ACCU + 0 
+1a82 : a9 00 __ LDA #$00
+1a84 : e5 1d __ SBC ACCU + 2 
+1a86 : 85 1c __ STA ACCU + 1 
+1a88 : 60 __ __ RTS
+1a89 : 85 1b __ STA ACCU + 0 
+1a8b : a5 1d __ LDA ACCU + 2 
+1a8d : 85 1c __ STA ACCU + 1 
+1a8f : 60 __ __ RTS
+--------------------------------------------------------------------
+sint16_to_float: ; sint16_to_float
+1a90 : 24 1c __ BIT ACCU + 1 
+1a92 : 30 03 __ BMI $1a97 ; (sint16_to_float + 7)
+1a94 : 4c ae 1a JMP $1aae ; (uint16_to_float + 0)
+1a97 : 38 __ __ SEC
+1a98 : a9 00 __ LDA #$00
+1a9a : e5 1b __ SBC ACCU + 0 
+1a9c : 85 1b __ STA ACCU + 0 
+1a9e : a9 00 __ LDA #$00
+1aa0 : e5 1c __ SBC ACCU + 1 
+1aa2 : 85 1c __ STA ACCU + 1 
+1aa4 : 20 ae 1a JSR $1aae ; (uint16_to_float + 0)
+1aa7 : a5 1e __ LDA ACCU + 3 
+1aa9 : 09 80 __ ORA #$80
+1aab : 85 1e __ STA ACCU + 3 
+1aad : 60 __ __ RTS
+--------------------------------------------------------------------
+uint16_to_float: ; uint16_to_float
+1aae : a5 1b __ LDA ACCU + 0 
+1ab0 : 05 1c __ ORA ACCU + 1 
+1ab2 : d0 05 __ BNE $1ab9 ; (uint16_to_float + 11)
+1ab4 : 85 1d __ STA ACCU + 2 
+1ab6 : 85 1e __ STA ACCU + 3 
+1ab8 : 60 __ __ RTS
+1ab9 : a2 8e __ LDX #$8e
+1abb : a5 1c __ LDA ACCU + 1 
+1abd : 30 06 __ BMI $1ac5 ; (uint16_to_float + 23)
+1abf : ca __ __ DEX
+1ac0 : 06 1b __ ASL ACCU + 0 
+1ac2 : 2a __ __ ROL
+1ac3 : 10 fa __ BPL $1abf ; (uint16_to_float + 17)
+1ac5 : 0a __ __ ASL
+1ac6 : 85 1d __ STA ACCU + 2 
+1ac8 : a5 1b __ LDA ACCU + 0 
+1aca : 85 1c __ STA ACCU + 1 
+1acc : 8a __ __ TXA
+1acd : 4a __ __ LSR
+1ace : 85 1e __ STA ACCU + 3 
+1ad0 : a9 00 __ LDA #$00
+1ad2 : 85 1b __ STA ACCU + 0 
+1ad4 : 66 1d __ ROR ACCU + 2 
+1ad6 : 60 __ __ RTS
+--------------------------------------------------------------------
+negaccu32: ; negaccu32
+1ad7 : 38 __ __ SEC
+1ad8 : a9 00 __ LDA #$00
+1ada : e5 1b __ SBC ACCU + 0 
+1adc : 85 1b __ STA ACCU + 0 
+1ade : a9 00 __ LDA #$00
+1ae0 : e5 1c __ SBC ACCU + 1 
+1ae2 : 85 1c __ STA ACCU + 1 
+1ae4 : a9 00 __ LDA #$00
+1ae6 : e5 1d __ SBC ACCU + 2 
+1ae8 : 85 1d __ STA ACCU + 2 
+1aea : a9 00 __ LDA #$00
+1aec : e5 1e __ SBC ACCU + 3 
+1aee : 85 1e __ STA ACCU + 3 
+1af0 : 60 __ __ RTS
+--------------------------------------------------------------------
+divmod32: ; divmod32
+1af1 : a9 00 __ LDA #$00
+1af3 : 85 07 __ STA WORK + 4 
+1af5 : 85 08 __ STA WORK + 5 
+1af7 : 85 09 __ STA WORK + 6 
+1af9 : 85 0a __ STA WORK + 7 
+1afb : a5 05 __ LDA WORK + 2 
+1afd : 05 06 __ ORA WORK + 3 
+1aff : f0 4b __ BEQ $1b4c ; (divmod32 + 91)
+1b01 : a0 10 __ LDY #$10
+1b03 : a5 1e __ LDA ACCU + 3 
+1b05 : 85 08 __ STA WORK + 5 
+1b07 : a5 1d __ LDA ACCU + 2 
+1b09 : 85 07 __ STA WORK + 4 
+1b0b : a9 00 __ LDA #$00
+1b0d : 85 1d __ STA ACCU + 2 
+1b0f : 85 1e __ STA ACCU + 3 
+1b11 : 18 __ __ CLC
+1b12 : 26 1b __ ROL ACCU + 0 
+1b14 : 26 1c __ ROL ACCU + 1 
+1b16 : 26 07 __ ROL WORK + 4 
+1b18 : 26 08 __ ROL WORK + 5 
+1b1a : 26 09 __ ROL WORK + 6 
+1b1c : 26 0a __ ROL WORK + 7 
+1b1e : a5 07 __ LDA WORK + 4 
+1b20 : c5 03 __ CMP WORK + 0 
+1b22 : a5 08 __ LDA WORK + 5 
+1b24 : e5 04 __ SBC WORK + 1 
+1b26 : a5 09 __ LDA WORK + 6 
+1b28 : e5 05 __ SBC WORK + 2 
+1b2a : aa __ __ TAX
+1b2b : a5 0a __ LDA WORK + 7 
+1b2d : e5 06 __ SBC WORK + 3 
+1b2f : 90 11 __ BCC $1b42 ; (divmod32 + 81)
+1b31 : 86 09 __ STX WORK + 6 
+1b33 : 85 0a __ STA WORK + 7 
+1b35 : a5 07 __ LDA WORK + 4 
+1b37 : e5 03 __ SBC WORK + 0 
+1b39 : 85 07 __ STA WORK + 4 
+1b3b : a5 08 __ LDA WORK + 5 
+1b3d : e5 04 __ SBC WORK + 1 
+1b3f : 85 08 __ STA WORK + 5 
+1b41 : 38 __ __ SEC
+1b42 : 88 __ __ DEY
+1b43 : d0 cd __ BNE $1b12 ; (divmod32 + 33)
+1b45 : 26 1b __ ROL ACCU + 0 
+1b47 : 26 1c __ ROL ACCU + 1 
+1b49 : a4 02 __ LDY $02 
+1b4b : 60 __ __ RTS
+1b4c : a5 1d __ LDA ACCU + 2 
+1b4e : 05 1e __ ORA ACCU + 3 
+1b50 : d0 0c __ BNE $1b5e ; (divmod32 + 109)
+1b52 : 20 b9 19 JSR $19b9 ; (divmod + 0)
+1b55 : a5 05 __ LDA WORK + 2 
+1b57 : 85 07 __ STA WORK + 4 
+1b59 : a5 06 __ LDA WORK + 3 
+1b5b : 85 08 __ STA WORK + 5 
+1b5d : 60 __ __ RTS
+1b5e : a0 20 __ LDY #$20
+1b60 : a5 04 __ LDA WORK + 1 
+1b62 : d0 27 __ BNE $1b8b ; (divmod32 + 154)
+1b64 : 18 __ __ CLC
+1b65 : 26 1b __ ROL ACCU + 0 
+1b67 : 26 1c __ ROL ACCU + 1 
+1b69 : 26 1d __ ROL ACCU + 2 
+1b6b : 26 1e __ ROL ACCU + 3 
+1b6d : 2a __ __ ROL
+1b6e : 90 05 __ BCC $1b75 ; (divmod32 + 132)
+1b70 : e5 03 __ SBC WORK + 0 
+1b72 : 38 __ __ SEC
+1b73 : b0 06 __ BCS $1b7b ; (divmod32 + 138)
+1b75 : c5 03 __ CMP WORK + 0 
+1b77 : 90 02 __ BCC $1b7b ; (divmod32 + 138)
+1b79 : e5 03 __ SBC WORK + 0 
+1b7b : 88 __ __ DEY
+1b7c : d0 e7 __ BNE $1b65 ; (divmod32 + 116)
+1b7e : 85 07 __ STA WORK + 4 
+1b80 : 26 1b __ ROL ACCU + 0 
+1b82 : 26 1c __ ROL ACCU + 1 
+1b84 : 26 1d __ ROL ACCU + 2 
+1b86 : 26 1e __ ROL ACCU + 3 
+1b88 : a4 02 __ LDY $02 
+1b8a : 60 __ __ RTS
+1b8b : a5 1e __ LDA ACCU + 3 
+1b8d : d0 10 __ BNE $1b9f ; (divmod32 + 174)
+1b8f : a6 1d __ LDX ACCU + 2 
+1b91 : 86 1e __ STX ACCU + 3 
+1b93 : a6 1c __ LDX ACCU + 1 
+1b95 : 86 1d __ STX ACCU + 2 
+1b97 : a6 1b __ LDX ACCU + 0 
+1b99 : 86 1c __ STX ACCU + 1 
+1b9b : 85 1b __ STA ACCU + 0 
+1b9d : a0 18 __ LDY #$18
+1b9f : 18 __ __ CLC
+1ba0 : 26 1b __ ROL ACCU + 0 
+1ba2 : 26 1c __ ROL ACCU + 1 
+1ba4 : 26 1d __ ROL ACCU + 2 
+1ba6 : 26 1e __ ROL ACCU + 3 
+1ba8 : 26 07 __ ROL WORK + 4 
+1baa : 26 08 __ ROL WORK + 5 
+1bac : 90 0c __ BCC $1bba ; (divmod32 + 201)
+1bae : a5 07 __ LDA WORK + 4 
+1bb0 : e5 03 __ SBC WORK + 0 
+1bb2 : aa __ __ TAX
+1bb3 : a5 08 __ LDA WORK + 5 
+1bb5 : e5 04 __ SBC WORK + 1 
+1bb7 : 38 __ __ SEC
+1bb8 : b0 0c __ BCS $1bc6 ; (divmod32 + 213)
+1bba : 38 __ __ SEC
+1bbb : a5 07 __ LDA WORK + 4 
+1bbd : e5 03 __ SBC WORK + 0 
+1bbf : aa __ __ TAX
+1bc0 : a5 08 __ LDA WORK + 5 
+1bc2 : e5 04 __ SBC WORK + 1 
+1bc4 : 90 04 __ BCC $1bca ; (divmod32 + 217)
+1bc6 : 86 07 __ STX WORK + 4 
+1bc8 : 85 08 __ STA WORK + 5 
+1bca : 88 __ __ DEY
+1bcb : d0 d3 __ BNE $1ba0 ; (divmod32 + 175)
+1bcd : 26 1b __ ROL ACCU + 0 
+1bcf : 26 1c __ ROL ACCU + 1 
+1bd1 : 26 1d __ ROL ACCU + 2 
+1bd3 : 26 1e __ ROL ACCU + 3 
+1bd5 : a4 02 __ LDY $02 
+1bd7 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_ext_u16: ; inp_op_ext_u16
+1bd8 : a9 00 __ LDA #$00
+1bda : 85 1d __ STA ACCU + 2 
+1bdc : 85 1e __ STA ACCU + 3 
+1bde : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_div_u32: ; inp_binop_div_u32
+1bdf : b5 00 __ LDA $00,x 
+1be1 : 85 03 __ STA WORK + 0 
+1be3 : b5 01 __ LDA $01,x 
+1be5 : 85 04 __ STA WORK + 1 
+1be7 : b5 02 __ LDA $02,x 
+1be9 : 85 05 __ STA WORK + 2 
+1beb : b5 03 __ LDA WORK + 0,x 
+1bed : 85 06 __ STA WORK + 3 
+1bef : 20 f1 1a JSR $1af1 ; (divmod32 + 0)
+1bf2 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_binop_mod_u32: ; inp_binop_mod_u32
+1bf3 : b5 00 __ LDA $00,x 
+1bf5 : 85 03 __ STA WORK + 0 
+1bf7 : b5 01 __ LDA $01,x 
+1bf9 : 85 04 __ STA WORK + 1 
+1bfb : b5 02 __ LDA $02,x 
+1bfd : 85 05 __ STA WORK + 2 
+1bff : b5 03 __ LDA WORK + 0,x 
+1c01 : 85 06 __ STA WORK + 3 
+1c03 : 20 f1 1a JSR $1af1 ; (divmod32 + 0)
+1c06 : a5 07 __ LDA WORK + 4 
+1c08 : 85 1b __ STA ACCU + 0 
+1c0a : a5 08 __ LDA WORK + 5 
+1c0c : 85 1c __ STA ACCU + 1 
+1c0e : a5 09 __ LDA WORK + 6 
+1c10 : 85 1d __ STA ACCU + 2 
+1c12 : a5 0a __ LDA WORK + 7 
+1c14 : 85 1e __ STA ACCU + 3 
+1c16 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_u32: ; inp_op_cmp_u32
+1c17 : b5 03 __ LDA WORK + 0,x 
+1c19 : c5 1e __ CMP ACCU + 3 
+1c1b : d0 20 __ BNE $1c3d ; (inp_op_cmp_u32 + 38)
+1c1d : b5 02 __ LDA $02,x 
+1c1f : c5 1d __ CMP ACCU + 2 
+1c21 : d0 1a __ BNE $1c3d ; (inp_op_cmp_u32 + 38)
+1c23 : b5 01 __ LDA $01,x 
+1c25 : c5 1c __ CMP ACCU + 1 
+1c27 : d0 14 __ BNE $1c3d ; (inp_op_cmp_u32 + 38)
+1c29 : b5 00 __ LDA $00,x 
+1c2b : c5 1b __ CMP ACCU + 0 
+1c2d : d0 0e __ BNE $1c3d ; (inp_op_cmp_u32 + 38)
+1c2f : a9 00 __ LDA #$00
+1c31 : 85 1b __ STA ACCU + 0 
+1c33 : 85 1c __ STA ACCU + 1 
+1c35 : 60 __ __ RTS
+1c36 : a9 ff __ LDA #$ff
+1c38 : 85 1b __ STA ACCU + 0 
+1c3a : 85 1c __ STA ACCU + 1 
+1c3c : 60 __ __ RTS
+1c3d : 90 f7 __ BCC $1c36 ; (inp_op_cmp_u32 + 31)
+1c3f : a9 01 __ LDA #$01
+1c41 : 85 1b __ STA ACCU + 0 
+1c43 : a9 00 __ LDA #$00
+1c45 : 85 1c __ STA ACCU + 1 
+1c47 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_cmp_s32: ; inp_op_cmp_s32
+1c48 : a5 1e __ LDA ACCU + 3 
+1c4a : 49 80 __ EOR #$80
+1c4c : 85 1e __ STA ACCU + 3 
+1c4e : b5 03 __ LDA WORK + 0,x 
+1c50 : 49 80 __ EOR #$80
+1c52 : c5 1e __ CMP ACCU + 3 
+1c54 : d0 20 __ BNE $1c76 ; (inp_op_cmp_s32 + 46)
+1c56 : b5 02 __ LDA $02,x 
+1c58 : c5 1d __ CMP ACCU + 2 
+1c5a : d0 1a __ BNE $1c76 ; (inp_op_cmp_s32 + 46)
+1c5c : b5 01 __ LDA $01,x 
+1c5e : c5 1c __ CMP ACCU + 1 
+1c60 : d0 14 __ BNE $1c76 ; (inp_op_cmp_s32 + 46)
+1c62 : b5 00 __ LDA $00,x 
+1c64 : c5 1b __ CMP ACCU + 0 
+1c66 : d0 0e __ BNE $1c76 ; (inp_op_cmp_s32 + 46)
+1c68 : a9 00 __ LDA #$00
+1c6a : 85 1b __ STA ACCU + 0 
+1c6c : 85 1c __ STA ACCU + 1 
+1c6e : 60 __ __ RTS
+1c6f : a9 ff __ LDA #$ff
+1c71 : 85 1b __ STA ACCU + 0 
+1c73 : 85 1c __ STA ACCU + 1 
+1c75 : 60 __ __ RTS
+1c76 : 90 f7 __ BCC $1c6f ; (inp_op_cmp_s32 + 39)
+1c78 : a9 01 __ LDA #$01
+1c7a : 85 1b __ STA ACCU + 0 
+1c7c : a9 00 __ LDA #$00
+1c7e : 85 1c __ STA ACCU + 1 
+1c80 : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_nop: ; inp_nop
+1c81 : 4c 5b 08 JMP $085b ; (startup + 90)
+--------------------------------------------------------------------
+inp_const_8: ; inp_const_8
+1c84 : b1 19 __ LDA (IP + 0),y 
+1c86 : aa __ __ TAX
+1c87 : c8 __ __ INY
+1c88 : b1 19 __ LDA (IP + 0),y 
+1c8a : 95 00 __ STA $00,x 
+1c8c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_p8: ; inp_const_p8
+1c8f : b1 19 __ LDA (IP + 0),y 
+1c91 : aa __ __ TAX
+1c92 : c8 __ __ INY
+1c93 : b1 19 __ LDA (IP + 0),y 
+1c95 : 95 00 __ STA $00,x 
+1c97 : a9 00 __ LDA #$00
+1c99 : 95 01 __ STA $01,x 
+1c9b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_n8: ; inp_const_n8
+1c9e : b1 19 __ LDA (IP + 0),y 
+1ca0 : aa __ __ TAX
+1ca1 : c8 __ __ INY
+1ca2 : b1 19 __ LDA (IP + 0),y 
+1ca4 : 95 00 __ STA $00,x 
+1ca6 : a9 ff __ LDA #$ff
+1ca8 : 95 01 __ STA $01,x 
+1caa : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_16: ; inp_const_16
+1cad : b1 19 __ LDA (IP + 0),y 
+1caf : aa __ __ TAX
+1cb0 : c8 __ __ INY
+1cb1 : b1 19 __ LDA (IP + 0),y 
+1cb3 : 95 00 __ STA $00,x 
+1cb5 : c8 __ __ INY
+1cb6 : b1 19 __ LDA (IP + 0),y 
+1cb8 : 95 01 __ STA $01,x 
+1cba : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_const_32: ; inp_const_32
+1cbd : b1 19 __ LDA (IP + 0),y 
+1cbf : aa __ __ TAX
+1cc0 : c8 __ __ INY
+1cc1 : b1 19 __ LDA (IP + 0),y 
+1cc3 : 95 00 __ STA $00,x 
+1cc5 : c8 __ __ INY
+1cc6 : b1 19 __ LDA (IP + 0),y 
+1cc8 : 95 01 __ STA $01,x 
+1cca : c8 __ __ INY
+1ccb : b1 19 __ LDA (IP + 0),y 
+1ccd : 95 02 __ STA $02,x 
+1ccf : c8 __ __ INY
+1cd0 : b1 19 __ LDA (IP + 0),y 
+1cd2 : 95 03 __ STA WORK + 0,x 
+1cd4 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_reg_8: ; inp_load_reg_8
+1cd7 : b1 19 __ LDA (IP + 0),y 
+1cd9 : aa __ __ TAX
+1cda : b5 00 __ LDA $00,x 
+1cdc : 85 1b __ STA ACCU + 0 
+1cde : a9 00 __ LDA #$00
+1ce0 : 85 1c __ STA ACCU + 1 
+1ce2 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_reg_8: ; inp_store_reg_8
+1ce5 : b1 19 __ LDA (IP + 0),y 
+1ce7 : aa __ __ TAX
+1ce8 : a5 1b __ LDA ACCU + 0 
+1cea : 95 00 __ STA $00,x 
+1cec : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_reg_16: ; inp_load_reg_16
+1cef : b1 19 __ LDA (IP + 0),y 
+1cf1 : aa __ __ TAX
+1cf2 : b5 00 __ LDA $00,x 
+1cf4 : 85 1b __ STA ACCU + 0 
+1cf6 : b5 01 __ LDA $01,x 
+1cf8 : 85 1c __ STA ACCU + 1 
+1cfa : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_reg_16: ; inp_store_reg_16
+1cfd : b1 19 __ LDA (IP + 0),y 
+1cff : aa __ __ TAX
+1d00 : a5 1b __ LDA ACCU + 0 
+1d02 : 95 00 __ STA $00,x 
+1d04 : a5 1c __ LDA ACCU + 1 
+1d06 : 95 01 __ STA $01,x 
+1d08 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_addr_reg: ; inp_addr_reg
+1d0b : b1 19 __ LDA (IP + 0),y 
+1d0d : aa __ __ TAX
+1d0e : b5 00 __ LDA $00,x 
+1d10 : 85 1f __ STA ADDR + 0 
+1d12 : b5 01 __ LDA $01,x 
+1d14 : 85 20 __ STA ADDR + 1 
+1d16 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_reg_32: ; inp_load_reg_32
+1d19 : b1 19 __ LDA (IP + 0),y 
+1d1b : aa __ __ TAX
+1d1c : b5 00 __ LDA $00,x 
+1d1e : 85 1b __ STA ACCU + 0 
+1d20 : b5 01 __ LDA $01,x 
+1d22 : 85 1c __ STA ACCU + 1 
+1d24 : b5 02 __ LDA $02,x 
+1d26 : 85 1d __ STA ACCU + 2 
+1d28 : b5 03 __ LDA WORK + 0,x 
+1d2a : 85 1e __ STA ACCU + 3 
+1d2c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_reg_32: ; inp_store_reg_32
+1d2f : b1 19 __ LDA (IP + 0),y 
+1d31 : aa __ __ TAX
+1d32 : a5 1b __ LDA ACCU + 0 
+1d34 : 95 00 __ STA $00,x 
+1d36 : a5 1c __ LDA ACCU + 1 
+1d38 : 95 01 __ STA $01,x 
+1d3a : a5 1d __ LDA ACCU + 2 
+1d3c : 95 02 __ STA $02,x 
+1d3e : a5 1e __ LDA ACCU + 3 
+1d40 : 95 03 __ STA WORK + 0,x 
+1d42 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_abs_8: ; inp_load_abs_8
+1d45 : b1 19 __ LDA (IP + 0),y 
+1d47 : 85 1f __ STA ADDR + 0 
+1d49 : c8 __ __ INY
+1d4a : b1 19 __ LDA (IP + 0),y 
+1d4c : 85 20 __ STA ADDR + 1 
+1d4e : c8 __ __ INY
+1d4f : b1 19 __ LDA (IP + 0),y 
+1d51 : aa __ __ TAX
+1d52 : 84 02 __ STY $02 
+1d54 : a0 00 __ LDY #$00
+1d56 : b1 1f __ LDA (ADDR + 0),y 
+1d58 : 95 00 __ STA $00,x 
+1d5a : 4c 4f 08 JMP $084f ; (startup + 78)
+1d5d : b1 19 __ LDA (IP + 0),y 
+1d5f : aa __ __ TAX
+1d60 : c8 __ __ INY
+1d61 : b1 19 __ LDA (IP + 0),y 
+1d63 : 84 02 __ STY $02 
+1d65 : a8 __ __ TAY
+1d66 : 4c 56 1d JMP $1d56 ; (inp_load_abs_8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_32: ; inp_load_abs_32
+1d69 : b1 19 __ LDA (IP + 0),y 
+1d6b : 85 1f __ STA ADDR + 0 
+1d6d : c8 __ __ INY
+1d6e : b1 19 __ LDA (IP + 0),y 
+1d70 : 85 20 __ STA ADDR + 1 
+1d72 : c8 __ __ INY
+1d73 : b1 19 __ LDA (IP + 0),y 
+1d75 : aa __ __ TAX
+1d76 : 84 02 __ STY $02 
+1d78 : a0 00 __ LDY #$00
+1d7a : b1 1f __ LDA (ADDR + 0),y 
+1d7c : 95 00 __ STA $00,x 
+1d7e : c8 __ __ INY
+1d7f : b1 1f __ LDA (ADDR + 0),y 
+1d81 : 95 01 __ STA $01,x 
+1d83 : c8 __ __ INY
+1d84 : b1 1f __ LDA (ADDR + 0),y 
+1d86 : 95 02 __ STA $02,x 
+1d88 : c8 __ __ INY
+1d89 : b1 1f __ LDA (ADDR + 0),y 
+1d8b : 95 03 __ STA WORK + 0,x 
+1d8d : 4c 4f 08 JMP $084f ; (startup + 78)
+1d90 : b1 19 __ LDA (IP + 0),y 
+1d92 : aa __ __ TAX
+1d93 : c8 __ __ INY
+1d94 : b1 19 __ LDA (IP + 0),y 
+1d96 : 84 02 __ STY $02 
+1d98 : a8 __ __ TAY
+1d99 : 4c 7a 1d JMP $1d7a ; (inp_load_abs_32 + 17)
+--------------------------------------------------------------------
+inp_lea_abs: ; inp_lea_abs
+1d9c : b1 19 __ LDA (IP + 0),y 
+1d9e : aa __ __ TAX
+1d9f : c8 __ __ INY
+1da0 : b1 19 __ LDA (IP + 0),y 
+1da2 : 95 00 __ STA $00,x 
+1da4 : c8 __ __ INY
+1da5 : b1 19 __ LDA (IP + 0),y 
+1da7 : 95 01 __ STA $01,x 
+1da9 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_abs_index: ; inp_lea_abs_index
+1dac : b1 19 __ LDA (IP + 0),y 
+1dae : aa __ __ TAX
+1daf : c8 __ __ INY
+1db0 : 18 __ __ CLC
+1db1 : b5 00 __ LDA $00,x 
+1db3 : 71 19 __ ADC (IP + 0),y 
+1db5 : 85 1f __ STA ADDR + 0 
+1db7 : c8 __ __ INY
+1db8 : b5 01 __ LDA $01,x 
+1dba : 71 19 __ ADC (IP + 0),y 
+1dbc : 85 20 __ STA ADDR + 1 
+1dbe : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_lea_accu_index: ; inp_lea_accu_index
+1dc1 : b1 19 __ LDA (IP + 0),y 
+1dc3 : aa __ __ TAX
+1dc4 : 18 __ __ CLC
+1dc5 : b5 00 __ LDA $00,x 
+1dc7 : 65 1b __ ADC ACCU + 0 
+1dc9 : 85 1f __ STA ADDR + 0 
+1dcb : b5 01 __ LDA $01,x 
+1dcd : 65 1c __ ADC ACCU + 1 
+1dcf : 85 20 __ STA ADDR + 1 
+1dd1 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_load_local_8: ; inp_load_local_8
+1dd4 : b1 19 __ LDA (IP + 0),y 
+1dd6 : aa __ __ TAX
+1dd7 : c8 __ __ INY
+1dd8 : b1 19 __ LDA (IP + 0),y 
+1dda : 84 02 __ STY $02 
+1ddc : a8 __ __ TAY
+1ddd : b1 25 __ LDA (FP + 0),y 
+1ddf : 95 00 __ STA $00,x 
+1de1 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_load_local_u8: ; inp_load_local_u8
+1de4 : b1 19 __ LDA (IP + 0),y 
+1de6 : aa __ __ TAX
+1de7 : c8 __ __ INY
+1de8 : b1 19 __ LDA (IP + 0),y 
+1dea : 84 02 __ STY $02 
+1dec : a8 __ __ TAY
+1ded : b1 25 __ LDA (FP + 0),y 
+1def : 95 00 __ STA $00,x 
+1df1 : a9 00 __ LDA #$00
+1df3 : 95 01 __ STA $01,x 
+1df5 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_load_local_16: ; inp_load_local_16
+1df8 : b1 19 __ LDA (IP + 0),y 
+1dfa : aa __ __ TAX
+1dfb : c8 __ __ INY
+1dfc : b1 19 __ LDA (IP + 0),y 
+1dfe : 84 02 __ STY $02 
+1e00 : a8 __ __ TAY
+1e01 : b1 25 __ LDA (FP + 0),y 
+1e03 : 95 00 __ STA $00,x 
+1e05 : c8 __ __ INY
+1e06 : b1 25 __ LDA (FP + 0),y 
+1e08 : 95 01 __ STA $01,x 
+1e0a : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_load_local_32: ; inp_load_local_32
+1e0d : b1 19 __ LDA (IP + 0),y 
+1e0f : aa __ __ TAX
+1e10 : c8 __ __ INY
+1e11 : b1 19 __ LDA (IP + 0),y 
+1e13 : 84 02 __ STY $02 
+1e15 : a8 __ __ TAY
+1e16 : b1 25 __ LDA (FP + 0),y 
+1e18 : 95 00 __ STA $00,x 
+1e1a : c8 __ __ INY
+1e1b : b1 25 __ LDA (FP + 0),y 
+1e1d : 95 01 __ STA $01,x 
+1e1f : c8 __ __ INY
+1e20 : b1 25 __ LDA (FP + 0),y 
+1e22 : 95 02 __ STA $02,x 
+1e24 : c8 __ __ INY
+1e25 : b1 25 __ LDA (FP + 0),y 
+1e27 : 95 03 __ STA WORK + 0,x 
+1e29 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_local_8: ; inp_store_local_8
+1e2c : b1 19 __ LDA (IP + 0),y 
+1e2e : aa __ __ TAX
+1e2f : c8 __ __ INY
+1e30 : b1 19 __ LDA (IP + 0),y 
+1e32 : 84 02 __ STY $02 
+1e34 : a8 __ __ TAY
+1e35 : b5 00 __ LDA $00,x 
+1e37 : 91 25 __ STA (FP + 0),y 
+1e39 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_local_16: ; inp_store_local_16
+1e3c : b1 19 __ LDA (IP + 0),y 
+1e3e : aa __ __ TAX
+1e3f : c8 __ __ INY
+1e40 : b1 19 __ LDA (IP + 0),y 
+1e42 : 84 02 __ STY $02 
+1e44 : a8 __ __ TAY
+1e45 : b5 00 __ LDA $00,x 
+1e47 : 91 25 __ STA (FP + 0),y 
+1e49 : c8 __ __ INY
+1e4a : b5 01 __ LDA $01,x 
+1e4c : 91 25 __ STA (FP + 0),y 
+1e4e : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_local_32: ; inp_store_local_32
+1e51 : b1 19 __ LDA (IP + 0),y 
+1e53 : aa __ __ TAX
+1e54 : c8 __ __ INY
+1e55 : b1 19 __ LDA (IP + 0),y 
+1e57 : 84 02 __ STY $02 
+1e59 : a8 __ __ TAY
+1e5a : b5 00 __ LDA $00,x 
+1e5c : 91 25 __ STA (FP + 0),y 
+1e5e : c8 __ __ INY
+1e5f : b5 01 __ LDA $01,x 
+1e61 : 91 25 __ STA (FP + 0),y 
+1e63 : c8 __ __ INY
+1e64 : b5 02 __ LDA $02,x 
+1e66 : 91 25 __ STA (FP + 0),y 
+1e68 : c8 __ __ INY
+1e69 : b5 03 __ LDA WORK + 0,x 
+1e6b : 91 25 __ STA (FP + 0),y 
+1e6d : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_lea_local: ; inp_lea_local
+1e70 : b1 19 __ LDA (IP + 0),y 
+1e72 : aa __ __ TAX
+1e73 : c8 __ __ INY
+1e74 : 18 __ __ CLC
+1e75 : b1 19 __ LDA (IP + 0),y 
+1e77 : 65 25 __ ADC FP + 0 
+1e79 : 95 00 __ STA $00,x 
+1e7b : c8 __ __ INY
+1e7c : b1 19 __ LDA (IP + 0),y 
+1e7e : 65 26 __ ADC FP + 1 
+1e80 : 95 01 __ STA $01,x 
+1e82 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_store_frame_8: ; inp_store_frame_8
+1e85 : b1 19 __ LDA (IP + 0),y 
+1e87 : aa __ __ TAX
+1e88 : c8 __ __ INY
+1e89 : b1 19 __ LDA (IP + 0),y 
+1e8b : 84 02 __ STY $02 
+1e8d : a8 __ __ TAY
+1e8e : b5 00 __ LDA $00,x 
+1e90 : 91 23 __ STA (SP + 0),y 
+1e92 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_frame_16: ; inp_store_frame_16
+1e95 : b1 19 __ LDA (IP + 0),y 
+1e97 : aa __ __ TAX
+1e98 : c8 __ __ INY
+1e99 : b1 19 __ LDA (IP + 0),y 
+1e9b : 84 02 __ STY $02 
+1e9d : a8 __ __ TAY
+1e9e : b5 00 __ LDA $00,x 
+1ea0 : 91 23 __ STA (SP + 0),y 
+1ea2 : c8 __ __ INY
+1ea3 : b5 01 __ LDA $01,x 
+1ea5 : 91 23 __ STA (SP + 0),y 
+1ea7 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_store_frame_32: ; inp_store_frame_32
+1eaa : b1 19 __ LDA (IP + 0),y 
+1eac : aa __ __ TAX
+1ead : c8 __ __ INY
+1eae : b1 19 __ LDA (IP + 0),y 
+1eb0 : 84 02 __ STY $02 
+1eb2 : a8 __ __ TAY
+1eb3 : b5 00 __ LDA $00,x 
+1eb5 : 91 23 __ STA (SP + 0),y 
+1eb7 : c8 __ __ INY
+1eb8 : b5 01 __ LDA $01,x 
+1eba : 91 23 __ STA (SP + 0),y 
+1ebc : c8 __ __ INY
+1ebd : b5 02 __ LDA $02,x 
+1ebf : 91 23 __ STA (SP + 0),y 
+1ec1 : c8 __ __ INY
+1ec2 : b5 03 __ LDA WORK + 0,x 
+1ec4 : 91 23 __ STA (SP + 0),y 
+1ec6 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_load_abs_u8: ; inp_load_abs_u8
+1ec9 : b1 19 __ LDA (IP + 0),y 
+1ecb : 85 1f __ STA ADDR + 0 
+1ecd : c8 __ __ INY
+1ece : b1 19 __ LDA (IP + 0),y 
+1ed0 : 85 20 __ STA ADDR + 1 
+1ed2 : c8 __ __ INY
+1ed3 : b1 19 __ LDA (IP + 0),y 
+1ed5 : aa __ __ TAX
+1ed6 : 84 02 __ STY $02 
+1ed8 : a0 00 __ LDY #$00
+1eda : b1 1f __ LDA (ADDR + 0),y 
+1edc : 95 00 __ STA $00,x 
+1ede : a9 00 __ LDA #$00
+1ee0 : 95 01 __ STA $01,x 
+1ee2 : 4c 4f 08 JMP $084f ; (startup + 78)
+1ee5 : b1 19 __ LDA (IP + 0),y 
+1ee7 : aa __ __ TAX
+1ee8 : c8 __ __ INY
+1ee9 : b1 19 __ LDA (IP + 0),y 
+1eeb : 84 02 __ STY $02 
+1eed : a8 __ __ TAY
+1eee : 4c da 1e JMP $1eda ; (inp_load_abs_u8 + 17)
+--------------------------------------------------------------------
+inp_load_abs_16: ; inp_load_abs_16
+1ef1 : b1 19 __ LDA (IP + 0),y 
+1ef3 : 85 1f __ STA ADDR + 0 
+1ef5 : c8 __ __ INY
+1ef6 : b1 19 __ LDA (IP + 0),y 
+1ef8 : 85 20 __ STA ADDR + 1 
+1efa : c8 __ __ INY
+1efb : b1 19 __ LDA (IP + 0),y 
+1efd : aa __ __ TAX
+1efe : 84 02 __ STY $02 
+1f00 : a0 00 __ LDY #$00
+1f02 : b1 1f __ LDA (ADDR + 0),y 
+1f04 : 95 00 __ STA $00,x 
+1f06 : c8 __ __ INY
+1f07 : b1 1f __ LDA (ADDR + 0),y 
+1f09 : 95 01 __ STA $01,x 
+1f0b : 4c 4f 08 JMP $084f ; (startup + 78)
+1f0e : b1 19 __ LDA (IP + 0),y 
+1f10 : aa __ __ TAX
+1f11 : c8 __ __ INY
+1f12 : b1 19 __ LDA (IP + 0),y 
+1f14 : 84 02 __ STY $02 
+1f16 : a8 __ __ TAY
+1f17 : 4c 02 1f JMP $1f02 ; (inp_load_abs_16 + 17)
+--------------------------------------------------------------------
+inp_store_abs_8: ; inp_store_abs_8
+1f1a : b1 19 __ LDA (IP + 0),y 
+1f1c : 85 1f __ STA ADDR + 0 
+1f1e : c8 __ __ INY
+1f1f : b1 19 __ LDA (IP + 0),y 
+1f21 : 85 20 __ STA ADDR + 1 
+1f23 : c8 __ __ INY
+1f24 : b1 19 __ LDA (IP + 0),y 
+1f26 : aa __ __ TAX
+1f27 : 84 02 __ STY $02 
+1f29 : a0 00 __ LDY #$00
+1f2b : b5 00 __ LDA $00,x 
+1f2d : 91 1f __ STA (ADDR + 0),y 
+1f2f : 4c 4f 08 JMP $084f ; (startup + 78)
+1f32 : b1 19 __ LDA (IP + 0),y 
+1f34 : aa __ __ TAX
+1f35 : c8 __ __ INY
+1f36 : b1 19 __ LDA (IP + 0),y 
+1f38 : 84 02 __ STY $02 
+1f3a : a8 __ __ TAY
+1f3b : 4c 2b 1f JMP $1f2b ; (inp_store_abs_8 + 17)
+--------------------------------------------------------------------
+inp_binop_addr_16: ; inp_binop_addr_16
+1f3e : b1 19 __ LDA (IP + 0),y 
+1f40 : aa __ __ TAX
+1f41 : 18 __ __ CLC
+1f42 : a5 1b __ LDA ACCU + 0 
+1f44 : 75 00 __ ADC $00,x 
+1f46 : 85 1b __ STA ACCU + 0 
+1f48 : a5 1c __ LDA ACCU + 1 
+1f4a : 75 01 __ ADC $01,x 
+1f4c : 85 1c __ STA ACCU + 1 
+1f4e : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_subr_16: ; inp_binop_subr_16
+1f51 : b1 19 __ LDA (IP + 0),y 
+1f53 : aa __ __ TAX
+1f54 : 38 __ __ SEC
+1f55 : a5 1b __ LDA ACCU + 0 
+1f57 : f5 00 __ SBC $00,x 
+1f59 : 85 1b __ STA ACCU + 0 
+1f5b : a5 1c __ LDA ACCU + 1 
+1f5d : f5 01 __ SBC $01,x 
+1f5f : 85 1c __ STA ACCU + 1 
+1f61 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_xorr_16: ; inp_binop_xorr_16
+1f64 : b1 19 __ LDA (IP + 0),y 
+1f66 : aa __ __ TAX
+1f67 : a5 1b __ LDA ACCU + 0 
+1f69 : 55 00 __ EOR $00,x 
+1f6b : 85 1b __ STA ACCU + 0 
+1f6d : a5 1c __ LDA ACCU + 1 
+1f6f : 55 01 __ EOR $01,x 
+1f71 : 85 1c __ STA ACCU + 1 
+1f73 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_divr_u16: ; inp_binop_divr_u16
+1f76 : b1 19 __ LDA (IP + 0),y 
+1f78 : aa __ __ TAX
+1f79 : b5 00 __ LDA $00,x 
+1f7b : 85 03 __ STA WORK + 0 
+1f7d : b5 01 __ LDA $01,x 
+1f7f : 85 04 __ STA WORK + 1 
+1f81 : 84 02 __ STY $02 
+1f83 : 20 b9 19 JSR $19b9 ; (divmod + 0)
+1f86 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_binop_modr_u16: ; inp_binop_modr_u16
+1f89 : b1 19 __ LDA (IP + 0),y 
+1f8b : aa __ __ TAX
+1f8c : b5 00 __ LDA $00,x 
+1f8e : 85 03 __ STA WORK + 0 
+1f90 : b5 01 __ LDA $01,x 
+1f92 : 85 04 __ STA WORK + 1 
+1f94 : 84 02 __ STY $02 
+1f96 : 20 b9 19 JSR $19b9 ; (divmod + 0)
+1f99 : a5 05 __ LDA WORK + 2 
+1f9b : 85 1b __ STA ACCU + 0 
+1f9d : a5 06 __ LDA WORK + 3 
+1f9f : 85 1c __ STA ACCU + 1 
+1fa1 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_binop_divr_s16: ; inp_binop_divr_s16
+1fa4 : b1 19 __ LDA (IP + 0),y 
+1fa6 : 84 02 __ STY $02 
+1fa8 : aa __ __ TAX
+1fa9 : b5 00 __ LDA $00,x 
+1fab : 85 03 __ STA WORK + 0 
+1fad : b5 01 __ LDA $01,x 
+1faf : 85 04 __ STA WORK + 1 
+1fb1 : 24 1c __ BIT ACCU + 1 
+1fb3 : 10 10 __ BPL $1fc5 ; (inp_binop_divr_s16 + 33)
+1fb5 : 20 9d 19 JSR $199d ; (negaccu + 0)
+1fb8 : 24 04 __ BIT WORK + 1 
+1fba : 10 10 __ BPL $1fcc ; (inp_binop_divr_s16 + 40)
+1fbc : 20 ab 19 JSR $19ab ; (negtmp + 0)
+1fbf : 20 b9 19 JSR $19b9 ; (divmod + 0)
+1fc2 : 4c 4f 08 JMP $084f ; (startup + 78)
+1fc5 : 24 04 __ BIT WORK + 1 
+1fc7 : 10 f6 __ BPL $1fbf ; (inp_binop_divr_s16 + 27)
+1fc9 : 20 ab 19 JSR $19ab ; (negtmp + 0)
+1fcc : 20 b9 19 JSR $19b9 ; (divmod + 0)
+1fcf : 20 9d 19 JSR $199d ; (negaccu + 0)
+1fd2 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_binop_modr_s16: ; inp_binop_modr_s16
+1fd5 : b1 19 __ LDA (IP + 0),y 
+1fd7 : 84 02 __ STY $02 
+1fd9 : aa __ __ TAX
+1fda : b5 00 __ LDA $00,x 
+1fdc : 85 03 __ STA WORK + 0 
+1fde : b5 01 __ LDA $01,x 
+1fe0 : 85 04 __ STA WORK + 1 
+1fe2 : 24 1c __ BIT ACCU + 1 
+1fe4 : 10 1b __ BPL $2001 ; (inp_binop_modr_s16 + 44)
+1fe6 : 20 9d 19 JSR $199d ; (negaccu + 0)
+1fe9 : 24 04 __ BIT WORK + 1 
+1feb : 10 03 __ BPL $1ff0 ; (inp_binop_modr_s16 + 27)
+1fed : 20 ab 19 JSR $19ab ; (negtmp + 0)
+1ff0 : 20 b9 19 JSR $19b9 ; (divmod + 0)
+1ff3 : a5 05 __ LDA WORK + 2 
+1ff5 : 85 1b __ STA ACCU + 0 
+1ff7 : a5 06 __ LDA WORK + 3 
+1ff9 : 85 1c __ STA ACCU + 1 
+1ffb : 20 9d 19 JSR $199d ; (negaccu + 0)
+1ffe : 4c 4f 08 JMP $084f ; (startup + 78)
+2001 : 24 04 __ BIT WORK + 1 
+2003 : 10 03 __ BPL $2008 ; (inp_binop_modr_s16 + 51)
+2005 : 20 ab 19 JSR $19ab ; (negtmp + 0)
+2008 : 20 b9 19 JSR $19b9 ; (divmod + 0)
+200b : a5 05 __ LDA WORK + 2 
+200d : 85 1b __ STA ACCU + 0 
+200f : a5 06 __ LDA WORK + 3 
+2011 : 85 1c __ STA ACCU + 1 
+2013 : 4c 4f 08 JMP $084f ; (startup + 78)
+--------------------------------------------------------------------
+inp_binop_adda_16: ; inp_binop_adda_16
+2016 : b1 19 __ LDA (IP + 0),y 
+2018 : aa __ __ TAX
+2019 : 18 __ __ CLC
+201a : b5 00 __ LDA $00,x 
+201c : 65 1b __ ADC ACCU + 0 
+201e : 95 00 __ STA $00,x 
+2020 : b5 01 __ LDA $01,x 
+2022 : 65 1c __ ADC ACCU + 1 
+2024 : 95 01 __ STA $01,x 
+2026 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_addi_16: ; inp_binop_addi_16
+2029 : b1 19 __ LDA (IP + 0),y 
+202b : c8 __ __ INY
+202c : aa __ __ TAX
+202d : 18 __ __ CLC
+202e : b5 00 __ LDA $00,x 
+2030 : 71 19 __ ADC (IP + 0),y 
+2032 : c8 __ __ INY
+2033 : 95 00 __ STA $00,x 
+2035 : b5 01 __ LDA $01,x 
+2037 : 71 19 __ ADC (IP + 0),y 
+2039 : 95 01 __ STA $01,x 
+203b : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_subi_16: ; inp_binop_subi_16
+203e : b1 19 __ LDA (IP + 0),y 
+2040 : c8 __ __ INY
+2041 : aa __ __ TAX
+2042 : 38 __ __ SEC
+2043 : b1 19 __ LDA (IP + 0),y 
+2045 : c8 __ __ INY
+2046 : f5 00 __ SBC $00,x 
+2048 : 95 00 __ STA $00,x 
+204a : b1 19 __ LDA (IP + 0),y 
+204c : f5 01 __ SBC $01,x 
+204e : 95 01 __ STA $01,x 
+2050 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_andi_16: ; inp_binop_andi_16
+2053 : b1 19 __ LDA (IP + 0),y 
+2055 : c8 __ __ INY
+2056 : aa __ __ TAX
+2057 : b5 00 __ LDA $00,x 
+2059 : 31 19 __ AND (IP + 0),y 
+205b : c8 __ __ INY
+205c : 95 00 __ STA $00,x 
+205e : b5 01 __ LDA $01,x 
+2060 : 31 19 __ AND (IP + 0),y 
+2062 : 95 01 __ STA $01,x 
+2064 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_muli8_16: ; inp_binop_muli8_16
+2067 : b1 19 __ LDA (IP + 0),y 
+2069 : c8 __ __ INY
+206a : aa __ __ TAX
+206b : a9 00 __ LDA #$00
+206d : 85 05 __ STA WORK + 2 
+206f : 85 06 __ STA WORK + 3 
+2071 : b5 00 __ LDA $00,x 
+2073 : 85 03 __ STA WORK + 0 
+2075 : b5 01 __ LDA $01,x 
+2077 : 85 04 __ STA WORK + 1 
+2079 : b1 19 __ LDA (IP + 0),y 
+207b : 4a __ __ LSR
+207c : 85 07 __ STA WORK + 4 
+207e : 90 0d __ BCC $208d ; (inp_binop_muli8_16 + 38)
+2080 : 18 __ __ CLC
+2081 : a5 05 __ LDA WORK + 2 
+2083 : 65 03 __ ADC WORK + 0 
+2085 : 85 05 __ STA WORK + 2 
+2087 : a5 06 __ LDA WORK + 3 
+2089 : 65 04 __ ADC WORK + 1 
+208b : 85 06 __ STA WORK + 3 
+208d : 06 03 __ ASL WORK + 0 
+208f : 26 04 __ ROL WORK + 1 
+2091 : 46 07 __ LSR WORK + 4 
+2093 : b0 eb __ BCS $2080 ; (inp_binop_muli8_16 + 25)
+2095 : d0 f6 __ BNE $208d ; (inp_binop_muli8_16 + 38)
+2097 : a5 05 __ LDA WORK + 2 
+2099 : 95 00 __ STA $00,x 
+209b : a5 06 __ LDA WORK + 3 
+209d : 95 01 __ STA $01,x 
+209f : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_addi_8: ; inp_binop_addi_8
+20a2 : b1 19 __ LDA (IP + 0),y 
+20a4 : c8 __ __ INY
+20a5 : aa __ __ TAX
+20a6 : 18 __ __ CLC
+20a7 : b5 00 __ LDA $00,x 
+20a9 : 71 19 __ ADC (IP + 0),y 
+20ab : 95 00 __ STA $00,x 
+20ad : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_andi_8: ; inp_binop_andi_8
+20b0 : b1 19 __ LDA (IP + 0),y 
+20b2 : c8 __ __ INY
+20b3 : aa __ __ TAX
+20b4 : b5 00 __ LDA $00,x 
+20b6 : 31 19 __ AND (IP + 0),y 
+20b8 : 95 00 __ STA $00,x 
+20ba : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_ori_8: ; inp_binop_ori_8
+20bd : b1 19 __ LDA (IP + 0),y 
+20bf : c8 __ __ INY
+20c0 : aa __ __ TAX
+20c1 : b5 00 __ LDA $00,x 
+20c3 : 11 19 __ ORA (IP + 0),y 
+20c5 : 95 00 __ STA $00,x 
+20c7 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_shl_16: ; inp_binop_shl_16
+20ca : b1 19 __ LDA (IP + 0),y 
+20cc : aa __ __ TAX
+20cd : b5 00 __ LDA $00,x 
+20cf : 2c b1 19 BIT $19b1 ; (negtmp + 6)
+20d2 : 29 0f __ AND #$0f
+20d4 : f0 0b __ BEQ $20e1 ; (inp_binop_shl_16 + 23)
+20d6 : aa __ __ TAX
+20d7 : a5 1c __ LDA ACCU + 1 
+20d9 : 06 1b __ ASL ACCU + 0 
+20db : 2a __ __ ROL
+20dc : ca __ __ DEX
+20dd : d0 fa __ BNE $20d9 ; (inp_binop_shl_16 + 15)
+20df : 85 1c __ STA ACCU + 1 
+20e1 : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_binop_shr_u16: ; inp_binop_shr_u16
+20e4 : b1 19 __ LDA (IP + 0),y 
+20e6 : aa __ __ TAX
+20e7 : b5 00 __ LDA $00,x 
+20e9 : 2c b1 19 BIT $19b1 ; (negtmp + 6)
+20ec : 29 0f __ AND #$0f
+20ee : f0 0b __ BEQ $20fb ; (inp_binop_shr_u16 + 23)
+20f0 : aa __ __ TAX
+20f1 : a5 1c __ LDA ACCU + 1 
+20f3 : 4a __ __ LSR
+20f4 : 66 1b __ ROR ACCU + 0 
+20f6 : ca __ __ DEX
+20f7 : d0 fa __ BNE $20f3 ; (inp_binop_shr_u16 + 15)
+20f9 : 85 1c __ STA ACCU + 1 
+20fb : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+cmp16: ; cmp16
+20fe : b1 19 __ LDA (IP + 0),y 
+2100 : aa __ __ TAX
+2101 : 38 __ __ SEC
+2102 : b5 01 __ LDA $01,x 
+2104 : e5 1c __ SBC ACCU + 1 
+2106 : f0 11 __ BEQ $2119 ; (cmp16 + 27)
+2108 : 50 02 __ BVC $210c ; (cmp16 + 14)
+210a : 49 80 __ EOR #$80
+210c : 30 2a __ BMI $2138 ; (cmp16 + 58)
+210e : 10 33 __ BPL $2143 ; (cmp16 + 69)
+2110 : b1 19 __ LDA (IP + 0),y 
+2112 : aa __ __ TAX
+2113 : b5 01 __ LDA $01,x 
+2115 : c5 1c __ CMP ACCU + 1 
+2117 : d0 28 __ BNE $2141 ; (cmp16 + 67)
+2119 : b5 00 __ LDA $00,x 
+211b : c5 1b __ CMP ACCU + 0 
+211d : d0 22 __ BNE $2141 ; (cmp16 + 67)
+211f : f0 0e __ BEQ $212f ; (cmp16 + 49)
+2121 : b1 19 __ LDA (IP + 0),y 
+2123 : aa __ __ TAX
+2124 : c8 __ __ INY
+2125 : b1 19 __ LDA (IP + 0),y 
+2127 : c5 1c __ CMP ACCU + 1 
+2129 : d0 16 __ BNE $2141 ; (cmp16 + 67)
+212b : e4 1b __ CPX ACCU + 0 
+212d : d0 12 __ BNE $2141 ; (cmp16 + 67)
+212f : a9 00 __ LDA #$00
+2131 : 85 1b __ STA ACCU + 0 
+2133 : 85 1c __ STA ACCU + 1 
+2135 : 4c 51 08 JMP $0851 ; (startup + 80)
+2138 : a9 ff __ LDA #$ff
+213a : 85 1b __ STA ACCU + 0 
+213c : 85 1c __ STA ACCU + 1 
+213e : 4c 51 08 JMP $0851 ; (startup + 80)
+2141 : 90 f5 __ BCC $2138 ; (cmp16 + 58)
+2143 : a9 01 __ LDA #$01
+2145 : 85 1b __ STA ACCU + 0 
+2147 : a9 00 __ LDA #$00
+2149 : 85 1c __ STA ACCU + 1 
+214b : 4c 51 08 JMP $0851 ; (startup + 80)
+214e : b1 19 __ LDA (IP + 0),y 
+2150 : c8 __ __ INY
+2151 : aa __ __ TAX
+2152 : b1 19 __ LDA (IP + 0),y 
+2154 : 38 __ __ SEC
+2155 : e5 1c __ SBC ACCU + 1 
+2157 : d0 af __ BNE $2108 ; (cmp16 + 10)
+2159 : e4 1b __ CPX ACCU + 0 
+215b : d0 e4 __ BNE $2141 ; (cmp16 + 67)
+215d : f0 d0 __ BEQ $212f ; (cmp16 + 49)
+215f : 60 __ __ RTS
+--------------------------------------------------------------------
+cmp8: ; cmp8
+2160 : b1 19 __ LDA (IP + 0),y 
+2162 : aa __ __ TAX
+2163 : 38 __ __ SEC
+2164 : b5 00 __ LDA $00,x 
+2166 : e5 1b __ SBC ACCU + 0 
+2168 : f0 19 __ BEQ $2183 ; (cmp8 + 35)
+216a : 50 02 __ BVC $216e ; (cmp8 + 14)
+216c : 49 80 __ EOR #$80
+216e : 30 1c __ BMI $218c ; (cmp8 + 44)
+2170 : 10 25 __ BPL $2197 ; (cmp8 + 55)
+2172 : b1 19 __ LDA (IP + 0),y 
+2174 : aa __ __ TAX
+2175 : b5 00 __ LDA $00,x 
+2177 : c5 1b __ CMP ACCU + 0 
+2179 : d0 1a __ BNE $2195 ; (cmp8 + 53)
+217b : f0 06 __ BEQ $2183 ; (cmp8 + 35)
+217d : b1 19 __ LDA (IP + 0),y 
+217f : c5 1b __ CMP ACCU + 0 
+2181 : d0 12 __ BNE $2195 ; (cmp8 + 53)
+2183 : a9 00 __ LDA #$00
+2185 : 85 1b __ STA ACCU + 0 
+2187 : 85 1c __ STA ACCU + 1 
+2189 : 4c 51 08 JMP $0851 ; (startup + 80)
+218c : a9 ff __ LDA #$ff
+218e : 85 1b __ STA ACCU + 0 
+2190 : 85 1c __ STA ACCU + 1 
+2192 : 4c 51 08 JMP $0851 ; (startup + 80)
+2195 : 90 f5 __ BCC $218c ; (cmp8 + 44)
+2197 : a9 01 __ LDA #$01
+2199 : 85 1b __ STA ACCU + 0 
+219b : a9 00 __ LDA #$00
+219d : 85 1c __ STA ACCU + 1 
+219f : 4c 51 08 JMP $0851 ; (startup + 80)
+21a2 : b1 19 __ LDA (IP + 0),y 
+21a4 : 38 __ __ SEC
+21a5 : e5 1b __ SBC ACCU + 0 
+21a7 : d0 c1 __ BNE $216a ; (cmp8 + 10)
+21a9 : f0 d8 __ BEQ $2183 ; (cmp8 + 35)
+21ab : 60 __ __ RTS
+--------------------------------------------------------------------
+inp_op_negate_16: ; inp_op_negate_16
+21ac : 38 __ __ SEC
+21ad : a9 00 __ LDA #$00
+21af : e5 1b __ SBC ACCU + 0 
+21b1 : 85 1b __ STA ACCU + 0 
+21b3 : a9 00 __ LDA #$00
+21b5 : e5 1c __ SBC ACCU + 1 
+21b7 : 85 1c __ STA ACCU + 1 
+21b9 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_op_invert_16: ; inp_op_invert_16
+21bc : a5 1b __ LDA ACCU + 0 
+21be : 49 ff __ EOR #$ff
+21c0 : 85 1b __ STA ACCU + 0 
+21c2 : a5 1c __ LDA ACCU + 1 
+21c4 : 49 ff __ EOR #$ff
+21c6 : 85 1c __ STA ACCU + 1 
+21c8 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_binop_add_f32: ; inp_binop_add_f32
+21cb : 20 f5 16 JSR $16f5 ; (freg + 0)
+21ce : 20 40 17 JSR $1740 ; (faddsub + 6)
+21d1 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_binop_sub_f32: ; inp_binop_sub_f32
+21d4 : 20 f5 16 JSR $16f5 ; (freg + 0)
+21d7 : 20 3a 17 JSR $173a ; (faddsub + 0)
+21da : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_binop_mul_f32: ; inp_binop_mul_f32
+21dd : 20 f5 16 JSR $16f5 ; (freg + 0)
+21e0 : 84 02 __ STY $02 
+21e2 : 20 27 18 JSR $1827 ; (crt_fmul + 0)
+21e5 : a4 02 __ LDY $02 
+21e7 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_binop_div_f32: ; inp_binop_div_f32
+21ea : 20 f5 16 JSR $16f5 ; (freg + 0)
+21ed : 20 ef 18 JSR $18ef ; (crt_fdiv + 0)
+21f0 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_binop_cmp_f32: ; inp_binop_cmp_f32
+21f3 : b1 19 __ LDA (IP + 0),y 
+21f5 : c8 __ __ INY
+21f6 : aa __ __ TAX
+21f7 : a5 1e __ LDA ACCU + 3 
+21f9 : 55 03 __ EOR WORK + 0,x 
+21fb : 10 1e __ BPL $221b ; (inp_binop_cmp_f32 + 40)
+21fd : a5 1e __ LDA ACCU + 3 
+21ff : 29 7f __ AND #$7f
+2201 : 05 1d __ ORA ACCU + 2 
+2203 : 05 1c __ ORA ACCU + 1 
+2205 : 05 1b __ ORA ACCU + 0 
+2207 : d0 0c __ BNE $2215 ; (inp_binop_cmp_f32 + 34)
+2209 : b5 03 __ LDA WORK + 0,x 
+220b : 29 7f __ AND #$7f
+220d : 15 02 __ ORA $02,x 
+220f : 15 01 __ ORA $01,x 
+2211 : 15 00 __ ORA $00,x 
+2213 : f0 1e __ BEQ $2233 ; (inp_binop_cmp_f32 + 64)
+2215 : a5 1e __ LDA ACCU + 3 
+2217 : 30 29 __ BMI $2242 ; (inp_binop_cmp_f32 + 79)
+2219 : 10 36 __ BPL $2251 ; (inp_binop_cmp_f32 + 94)
+221b : a5 1e __ LDA ACCU + 3 
+221d : d5 03 __ CMP WORK + 0,x 
+221f : d0 1b __ BNE $223c ; (inp_binop_cmp_f32 + 73)
+2221 : a5 1d __ LDA ACCU + 2 
+2223 : d5 02 __ CMP $02,x 
+2225 : d0 15 __ BNE $223c ; (inp_binop_cmp_f32 + 73)
+2227 : a5 1c __ LDA ACCU + 1 
+2229 : d5 01 __ CMP $01,x 
+222b : d0 0f __ BNE $223c ; (inp_binop_cmp_f32 + 73)
+222d : a5 1b __ LDA ACCU + 0 
+222f : d5 00 __ CMP $00,x 
+2231 : d0 09 __ BNE $223c ; (inp_binop_cmp_f32 + 73)
+2233 : a9 00 __ LDA #$00
+2235 : 85 1b __ STA ACCU + 0 
+2237 : 85 1c __ STA ACCU + 1 
+2239 : 4c 52 08 JMP $0852 ; (startup + 81)
+223c : b0 0f __ BCS $224d ; (inp_binop_cmp_f32 + 90)
+223e : 24 1e __ BIT ACCU + 3 
+2240 : 30 0f __ BMI $2251 ; (inp_binop_cmp_f32 + 94)
+2242 : a9 00 __ LDA #$00
+2244 : 85 1c __ STA ACCU + 1 
+2246 : a9 01 __ LDA #$01
+2248 : 85 1b __ STA ACCU + 0 
+224a : 4c 52 08 JMP $0852 ; (startup + 81)
+224d : 24 1e __ BIT ACCU + 3 
+224f : 30 f1 __ BMI $2242 ; (inp_binop_cmp_f32 + 79)
+2251 : a9 ff __ LDA #$ff
+2253 : 85 1b __ STA ACCU + 0 
+2255 : 85 1c __ STA ACCU + 1 
+2257 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_op_negate_f32: ; inp_op_negate_f32
+225a : a5 1e __ LDA ACCU + 3 
+225c : 49 80 __ EOR #$80
+225e : 85 1e __ STA ACCU + 3 
+2260 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_conv_i16_f32: ; inp_conv_i16_f32
+2263 : 20 90 1a JSR $1a90 ; (sint16_to_float + 0)
+2266 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_conv_f32_i16: ; inp_conv_f32_i16
+2269 : 20 44 1a JSR $1a44 ; (f32_to_i16 + 0)
+226c : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+bra: ; bra
+226f : b1 19 __ LDA (IP + 0),y 
+2271 : 30 0c __ BMI $227f ; (bra + 16)
+2273 : 38 __ __ SEC
+2274 : 65 19 __ ADC IP + 0 
+2276 : 85 19 __ STA IP + 0 
+2278 : 90 02 __ BCC $227c ; (bra + 13)
+227a : e6 1a __ INC IP + 1 
+227c : 4c 5b 08 JMP $085b ; (startup + 90)
+227f : 38 __ __ SEC
+2280 : 65 19 __ ADC IP + 0 
+2282 : 85 19 __ STA IP + 0 
+2284 : b0 02 __ BCS $2288 ; (bra + 25)
+2286 : c6 1a __ DEC IP + 1 
+2288 : 4c 5b 08 JMP $085b ; (startup + 90)
+228b : a5 1b __ LDA ACCU + 0 
+228d : 05 1c __ ORA ACCU + 1 
+228f : f0 de __ BEQ $226f ; (bra + 0)
+2291 : 4c 51 08 JMP $0851 ; (startup + 80)
+2294 : a5 1b __ LDA ACCU + 0 
+2296 : 05 1c __ ORA ACCU + 1 
+2298 : d0 d5 __ BNE $226f ; (bra + 0)
+229a : 4c 51 08 JMP $0851 ; (startup + 80)
+229d : a5 1c __ LDA ACCU + 1 
+229f : 30 04 __ BMI $22a5 ; (bra + 54)
+22a1 : 05 1b __ ORA ACCU + 0 
+22a3 : d0 ca __ BNE $226f ; (bra + 0)
+22a5 : 4c 51 08 JMP $0851 ; (startup + 80)
+22a8 : a5 1c __ LDA ACCU + 1 
+22aa : 10 c3 __ BPL $226f ; (bra + 0)
+22ac : 4c 51 08 JMP $0851 ; (startup + 80)
+22af : a5 1c __ LDA ACCU + 1 
+22b1 : 30 bc __ BMI $226f ; (bra + 0)
+22b3 : 4c 51 08 JMP $0851 ; (startup + 80)
+22b6 : a5 1c __ LDA ACCU + 1 
+22b8 : 30 b5 __ BMI $226f ; (bra + 0)
+22ba : 05 1b __ ORA ACCU + 0 
+22bc : f0 b1 __ BEQ $226f ; (bra + 0)
+22be : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+braf: ; braf
+22c1 : 38 __ __ SEC
+22c2 : b1 19 __ LDA (IP + 0),y 
+22c4 : 65 19 __ ADC IP + 0 
+22c6 : aa __ __ TAX
+22c7 : c8 __ __ INY
+22c8 : b1 19 __ LDA (IP + 0),y 
+22ca : 65 1a __ ADC IP + 1 
+22cc : 85 1a __ STA IP + 1 
+22ce : 86 19 __ STX IP + 0 
+22d0 : 4c 5b 08 JMP $085b ; (startup + 90)
+22d3 : a5 1b __ LDA ACCU + 0 
+22d5 : 05 1c __ ORA ACCU + 1 
+22d7 : f0 e8 __ BEQ $22c1 ; (braf + 0)
+22d9 : c8 __ __ INY
+22da : 4c 51 08 JMP $0851 ; (startup + 80)
+22dd : a5 1b __ LDA ACCU + 0 
+22df : 05 1c __ ORA ACCU + 1 
+22e1 : d0 de __ BNE $22c1 ; (braf + 0)
+22e3 : c8 __ __ INY
+22e4 : 4c 51 08 JMP $0851 ; (startup + 80)
+22e7 : a5 1c __ LDA ACCU + 1 
+22e9 : 30 04 __ BMI $22ef ; (braf + 46)
+22eb : 05 1b __ ORA ACCU + 0 
+22ed : d0 d2 __ BNE $22c1 ; (braf + 0)
+22ef : c8 __ __ INY
+22f0 : 4c 51 08 JMP $0851 ; (startup + 80)
+22f3 : a5 1c __ LDA ACCU + 1 
+22f5 : 10 ca __ BPL $22c1 ; (braf + 0)
+22f7 : c8 __ __ INY
+22f8 : 4c 51 08 JMP $0851 ; (startup + 80)
+22fb : a5 1c __ LDA ACCU + 1 
+22fd : 30 c2 __ BMI $22c1 ; (braf + 0)
+22ff : c8 __ __ INY
+2300 : 4c 51 08 JMP $0851 ; (startup + 80)
+2303 : a5 1c __ LDA ACCU + 1 
+2305 : 30 ba __ BMI $22c1 ; (braf + 0)
+2307 : 05 1b __ ORA ACCU + 0 
+2309 : f0 b6 __ BEQ $22c1 ; (braf + 0)
+230b : c8 __ __ INY
+230c : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+loopu8: ; loopu8
+230f : b1 19 __ LDA (IP + 0),y 
+2311 : aa __ __ TAX
+2312 : f6 00 __ INC $00,x 
+2314 : c8 __ __ INY
+2315 : b1 19 __ LDA (IP + 0),y 
+2317 : d5 00 __ CMP $00,x 
+2319 : 4c 81 21 JMP $2181 ; (cmp8 + 33)
+--------------------------------------------------------------------
+inp_jsr: ; inp_jsr
+231c : b1 19 __ LDA (IP + 0),y 
+231e : 8d 32 23 STA $2332 ; (inp_jsr + 22)
+2321 : c8 __ __ INY
+2322 : b1 19 __ LDA (IP + 0),y 
+2324 : 8d 33 23 STA $2333 ; (inp_jsr + 23)
+2327 : 98 __ __ TYA
+2328 : 38 __ __ SEC
+2329 : 65 19 __ ADC IP + 0 
+232b : 85 19 __ STA IP + 0 
+232d : 90 02 __ BCC $2331 ; (inp_jsr + 21)
+232f : e6 1a __ INC IP + 1 
+2331 : 20 00 00 JSR $0000 
+2334 : 4c 4b 08 JMP $084b ; (startup + 74)
+--------------------------------------------------------------------
+inp_native: ; inp_native
+2337 : 98 __ __ TYA
+2338 : 18 __ __ CLC
+2339 : 65 19 __ ADC IP + 0 
+233b : 8d 46 23 STA $2346 ; (inp_native + 15)
+233e : a5 1a __ LDA IP + 1 
+2340 : 69 00 __ ADC #$00
+2342 : 8d 47 23 STA $2347 ; (inp_native + 16)
+2345 : 20 00 00 JSR $0000 
+2348 : a0 00 __ LDY #$00
+234a : b1 23 __ LDA (SP + 0),y 
+234c : 85 19 __ STA IP + 0 
+234e : c8 __ __ INY
+234f : b1 23 __ LDA (SP + 0),y 
+2351 : 85 1a __ STA IP + 1 
+2353 : 88 __ __ DEY
+2354 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_enter: ; inp_enter
+2357 : 38 __ __ SEC
+2358 : a5 23 __ LDA SP + 0 
+235a : f1 19 __ SBC (IP + 0),y 
+235c : c8 __ __ INY
+235d : 85 23 __ STA SP + 0 
+235f : a5 24 __ LDA SP + 1 
+2361 : f1 19 __ SBC (IP + 0),y 
+2363 : c8 __ __ INY
+2364 : 85 24 __ STA SP + 1 
+2366 : b1 19 __ LDA (IP + 0),y 
+2368 : 84 02 __ STY $02 
+236a : a8 __ __ TAY
+236b : a5 25 __ LDA FP + 0 
+236d : 91 23 __ STA (SP + 0),y 
+236f : c8 __ __ INY
+2370 : a5 26 __ LDA FP + 1 
+2372 : 91 23 __ STA (SP + 0),y 
+2374 : 98 __ __ TYA
+2375 : 38 __ __ SEC
+2376 : 65 23 __ ADC SP + 0 
+2378 : 85 25 __ STA FP + 0 
+237a : a9 00 __ LDA #$00
+237c : 65 24 __ ADC SP + 1 
+237e : 85 26 __ STA FP + 1 
+2380 : 88 __ __ DEY
+2381 : f0 08 __ BEQ $238b ; (inp_enter + 52)
+2383 : b9 52 00 LDA $0052,y 
+2386 : 88 __ __ DEY
+2387 : 91 23 __ STA (SP + 0),y 
+2389 : d0 f8 __ BNE $2383 ; (inp_enter + 44)
+238b : a4 02 __ LDY $02 
+238d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_return: ; inp_return
+2390 : b1 19 __ LDA (IP + 0),y 
+2392 : c8 __ __ INY
+2393 : 84 02 __ STY $02 
+2395 : a8 __ __ TAY
+2396 : b1 23 __ LDA (SP + 0),y 
+2398 : 85 25 __ STA FP + 0 
+239a : c8 __ __ INY
+239b : b1 23 __ LDA (SP + 0),y 
+239d : 85 26 __ STA FP + 1 
+239f : 88 __ __ DEY
+23a0 : f0 09 __ BEQ $23ab ; (inp_return + 27)
+23a2 : 88 __ __ DEY
+23a3 : b1 23 __ LDA (SP + 0),y 
+23a5 : 99 53 00 STA $0053,y 
+23a8 : 88 __ __ DEY
+23a9 : 10 f8 __ BPL $23a3 ; (inp_return + 19)
+23ab : a4 02 __ LDY $02 
+23ad : 18 __ __ CLC
+23ae : b1 19 __ LDA (IP + 0),y 
+23b0 : c8 __ __ INY
+23b1 : 65 23 __ ADC SP + 0 
+23b3 : 85 23 __ STA SP + 0 
+23b5 : b1 19 __ LDA (IP + 0),y 
+23b7 : c8 __ __ INY
+23b8 : 65 24 __ ADC SP + 1 
+23ba : 85 24 __ STA SP + 1 
+23bc : a0 01 __ LDY #$01
+23be : b1 23 __ LDA (SP + 0),y 
+23c0 : 85 1a __ STA IP + 1 
+23c2 : 88 __ __ DEY
+23c3 : b1 23 __ LDA (SP + 0),y 
+23c5 : 85 19 __ STA IP + 0 
+23c7 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+inp_call: ; inp_call
+23ca : b1 19 __ LDA (IP + 0),y 
+23cc : 85 1f __ STA ADDR + 0 
+23ce : c8 __ __ INY
+23cf : b1 19 __ LDA (IP + 0),y 
+23d1 : 85 20 __ STA ADDR + 1 
+23d3 : c8 __ __ INY
+23d4 : 98 __ __ TYA
+23d5 : a0 00 __ LDY #$00
+23d7 : 18 __ __ CLC
+23d8 : 65 19 __ ADC IP + 0 
+23da : 91 23 __ STA (SP + 0),y 
+23dc : c8 __ __ INY
+23dd : a5 1a __ LDA IP + 1 
+23df : 69 00 __ ADC #$00
+23e1 : 91 23 __ STA (SP + 0),y 
+23e3 : a5 1f __ LDA ADDR + 0 
+23e5 : 85 19 __ STA IP + 0 
+23e7 : a5 20 __ LDA ADDR + 1 
+23e9 : 85 1a __ STA IP + 1 
+23eb : 4c 4b 08 JMP $084b ; (startup + 74)
+--------------------------------------------------------------------
+inp_push_frame: ; inp_push_frame
+23ee : 38 __ __ SEC
+23ef : a5 23 __ LDA SP + 0 
+23f1 : f1 19 __ SBC (IP + 0),y 
+23f3 : c8 __ __ INY
+23f4 : 85 23 __ STA SP + 0 
+23f6 : a5 24 __ LDA SP + 1 
+23f8 : f1 19 __ SBC (IP + 0),y 
+23fa : 85 24 __ STA SP + 1 
+23fc : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_pop_frame: ; inp_pop_frame
+23ff : 18 __ __ CLC
+2400 : b1 19 __ LDA (IP + 0),y 
+2402 : c8 __ __ INY
+2403 : 65 23 __ ADC SP + 0 
+2405 : 85 23 __ STA SP + 0 
+2407 : b1 19 __ LDA (IP + 0),y 
+2409 : 65 24 __ ADC SP + 1 
+240b : 85 24 __ STA SP + 1 
+240d : 4c 51 08 JMP $0851 ; (startup + 80)
+--------------------------------------------------------------------
+inp_op_extrt: ; inp_op_extrt
+2410 : b1 19 __ LDA (IP + 0),y 
+2412 : c8 __ __ INY
+2413 : 8d 23 24 STA $2423 ; (inp_op_extrt + 19)
+2416 : b1 19 __ LDA (IP + 0),y 
+2418 : c8 __ __ INY
+2419 : 8d 24 24 STA $2424 ; (inp_op_extrt + 20)
+241c : b1 19 __ LDA (IP + 0),y 
+241e : c8 __ __ INY
+241f : aa __ __ TAX
+2420 : 84 02 __ STY $02 
+2422 : 20 00 00 JSR $0000 
+2425 : a4 02 __ LDY $02 
+2427 : 4c 52 08 JMP $0852 ; (startup + 81)
+--------------------------------------------------------------------
+spentry:
+242a : __ __ __ BYT 00                                              : .
+--------------------------------------------------------------------
+giocharmap:
+242b : __ __ __ BYT 01                                              : .
+--------------------------------------------------------------------
+fround5:
+242c : __ __ __ BYT 00 00 00 3f cd cc 4c 3d 0a d7 a3 3b 6f 12 03 3a : ...?..L=...;o..:
+243c : __ __ __ BYT 17 b7 51 38 ac c5 a7 36 bd 37 06 35             : ..Q8...6.7.5
+--------------------------------------------------------------------
+buffer:
+2448 : __ __ __ BSS	100
@@ -0,0 +1,21 @@
+#include <stdio.h>
+#include <string.h>
+
+char	buffer[100];
+
+int main(void)
+{
+	unsigned	sum = 0;
+
+	for(int i=0; i<40; i++)
+	{
+		sprintf(buffer, "%d %5u %04x %s %c %8.3f", i * 37 - 500, i * 1000u, i * 91, "text", 'A' + i, i * 1.25);
+		sum += strlen(buffer);
+	}
+
+	sprintf(buffer, "%d:%s:%x", -42, "ok", 255);
+	if (strcmp(buffer, "-42:ok:ff"))
+		return 1;
+
+	return sum == 0;
+}
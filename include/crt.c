@@ -291,6 +291,11 @@ w3:
 		bne l4
 #endif
 
+#ifdef __45GS02__
+// Compiled code expects the Z register to be zero
+		ldz #0
+#endif
+
 		lda	#<StackEnd - 2
 		sta	sp
 		lda	#>StackEnd - 2
@@ -686,10 +691,15 @@ LB0:
 
 // a is zero
 		clc
-LB1:	rol	accu
+LB1:
+#ifdef __45GS02__
+		rolq	accu
+#else
+		rol	accu
 		rol	accu + 1
 		rol	accu + 2
 		rol	accu + 3
+#endif
 		rol
 		bcc LB1a
 		
@@ -704,10 +714,14 @@ LB1b:
 WB1:	dey
 		bne	LB1
 		sta tmp + 4
+#ifdef __45GS02__
+		rolq	accu
+#else
 		rol	accu
 		rol	accu + 1
 		rol	accu + 2
 		rol	accu + 3
+#endif
 		ldy	tmpy
 		rts	
 
@@ -725,10 +739,15 @@ W16:
 		ldy #24
 LS0:
 		clc
-LS1:	rol	accu
+LS1:
+#ifdef __45GS02__
+		rolq	accu
+#else
+		rol	accu
 		rol	accu + 1
 		rol	accu + 2
 		rol	accu + 3
+#endif
 		rol	tmp + 4
 		rol	tmp + 5
 		bcc LS1a
@@ -753,10 +772,14 @@ LS1b:
 		sta	tmp + 5
 WS1:	dey
 		bne	LS1
+#ifdef __45GS02__
+		rolq	accu
+#else
 		rol	accu
 		rol	accu + 1
 		rol	accu + 2
 		rol	accu + 3
+#endif
 		ldy	tmpy
 		rts	
 
@@ -918,10 +941,14 @@ W3:
 		clc
 		adc	accu + 0
 W4:
+#ifdef __45GS02__
+		aslq	accu
+#else
 		asl	accu
 		rol	accu + 1
 		rol	accu + 2
 		rol	accu + 3
+#endif
 
 		lsr tmp + 0
 		bcc W1
@@ -283,13 +283,130 @@ AsmInsData	DecInsData[256] = {
 	{ ASMIT_INV },
 };
 
+struct AsmInsExtension
+{
+	uint8		mOpcode;
+	AsmInsType	mType;
+	AsmInsMode	mMode;
+};
+
+static const AsmInsExtension Ins65C02[] = {
+	{ 0x04, ASMIT_TSB, ASMIM_ZERO_PAGE },
+	{ 0x0c, ASMIT_TSB, ASMIM_ABSOLUTE },
+	{ 0x12, ASMIT_ORA, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0x14, ASMIT_TRB, ASMIM_ZERO_PAGE },
+	{ 0x1a, ASMIT_INC, ASMIM_IMPLIED },
+	{ 0x1c, ASMIT_TRB, ASMIM_ABSOLUTE },
+	{ 0x32, ASMIT_AND, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0x34, ASMIT_BIT, ASMIM_ZERO_PAGE_X },
+	{ 0x3a, ASMIT_DEC, ASMIM_IMPLIED },
+	{ 0x3c, ASMIT_BIT, ASMIM_ABSOLUTE_X },
+	{ 0x52, ASMIT_EOR, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0x5a, ASMIT_PHY, ASMIM_IMPLIED },
+	{ 0x64, ASMIT_STZ, ASMIM_ZERO_PAGE },
+	{ 0x72, ASMIT_ADC, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0x74, ASMIT_STZ, ASMIM_ZERO_PAGE_X },
+	{ 0x7a, ASMIT_PLY, ASMIM_IMPLIED },
+	{ 0x7c, ASMIT_JMP, ASMIM_INDIRECT_ABSOLUTE_X },
+	{ 0x80, ASMIT_BRA, ASMIM_RELATIVE },
+	{ 0x89, ASMIT_BIT, ASMIM_IMMEDIATE },
+	{ 0x92, ASMIT_STA, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0x9c, ASMIT_STZ, ASMIM_ABSOLUTE },
+	{ 0x9e, ASMIT_STZ, ASMIM_ABSOLUTE_X },
+	{ 0xb2, ASMIT_LDA, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0xd2, ASMIT_CMP, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0xda, ASMIT_PHX, ASMIM_IMPLIED },
+	{ 0xf2, ASMIT_SBC, ASMIM_INDIRECT_ZERO_PAGE },
+	{ 0xfa, ASMIT_PLX, ASMIM_IMPLIED },
+};
+
+static const AsmInsExtension Ins45GS02[] = {
+	{ 0x13, ASMIT_BPL, ASMIM_RELATIVE_LONG },
+	{ 0x1b, ASMIT_INZ, ASMIM_IMPLIED },
+	{ 0x33, ASMIT_BMI, ASMIM_RELATIVE_LONG },
+	{ 0x3b, ASMIT_DEZ, ASMIM_IMPLIED },
+	{ 0x42, ASMIT_NEG, ASMIM_IMPLIED },
+	{ 0x43, ASMIT_ASR, ASMIM_IMPLIED },
+	{ 0x44, ASMIT_ASR, ASMIM_ZERO_PAGE },
+	{ 0x4b, ASMIT_TAZ, ASMIM_IMPLIED },
+	{ 0x53, ASMIT_BVC, ASMIM_RELATIVE_LONG },
+	{ 0x54, ASMIT_ASR, ASMIM_ZERO_PAGE_X },
+	{ 0x6b, ASMIT_TZA, ASMIM_IMPLIED },
+	{ 0x73, ASMIT_BVS, ASMIM_RELATIVE_LONG },
+	{ 0x83, ASMIT_BRA, ASMIM_RELATIVE_LONG },
+	{ 0x93, ASMIT_BCC, ASMIM_RELATIVE_LONG },
+	{ 0xa3, ASMIT_LDZ, ASMIM_IMMEDIATE },
+	{ 0xab, ASMIT_LDZ, ASMIM_ABSOLUTE },
+	{ 0xb3, ASMIT_BCS, ASMIM_RELATIVE_LONG },
+	{ 0xbb, ASMIT_LDZ, ASMIM_ABSOLUTE_X },
+	{ 0xc2, ASMIT_CPZ, ASMIM_IMMEDIATE },
+	{ 0xc3, ASMIT_DEW, ASMIM_ZERO_PAGE },
+	{ 0xcb, ASMIT_ASW, ASMIM_ABSOLUTE },
+	{ 0xd3, ASMIT_BNE, ASMIM_RELATIVE_LONG },
+	{ 0xd4, ASMIT_CPZ, ASMIM_ZERO_PAGE },
+	{ 0xdb, ASMIT_PHZ, ASMIM_IMPLIED },
+	{ 0xdc, ASMIT_CPZ, ASMIM_ABSOLUTE },
+	{ 0xe3, ASMIT_INW, ASMIM_ZERO_PAGE },
+	{ 0xeb, ASMIT_ROW, ASMIM_ABSOLUTE },
+	{ 0xf3, ASMIT_BEQ, ASMIM_RELATIVE_LONG },
+	{ 0xfb, ASMIT_PLZ, ASMIM_IMPLIED },
+};
+
+// Opcodes following the NEG NEG prefix of the 45GS02
+
+static const AsmInsExtension InsQuad[] = {
+	{ 0x05, ASMIT_ORAQ, ASMIM_ZERO_PAGE },
+	{ 0x06, ASMIT_ASLQ, ASMIM_ZERO_PAGE },
+	{ 0x0a, ASMIT_ASLQ, ASMIM_IMPLIED },
+	{ 0x0d, ASMIT_ORAQ, ASMIM_ABSOLUTE },
+	{ 0x0e, ASMIT_ASLQ, ASMIM_ABSOLUTE },
+	{ 0x1a, ASMIT_INQ, ASMIM_IMPLIED },
+	{ 0x25, ASMIT_ANDQ, ASMIM_ZERO_PAGE },
+	{ 0x26, ASMIT_ROLQ, ASMIM_ZERO_PAGE },
+	{ 0x2a, ASMIT_ROLQ, ASMIM_IMPLIED },
+	{ 0x2d, ASMIT_ANDQ, ASMIM_ABSOLUTE },
+	{ 0x2e, ASMIT_ROLQ, ASMIM_ABSOLUTE },
+	{ 0x3a, ASMIT_DEQ, ASMIM_IMPLIED },
+	{ 0x45, ASMIT_EORQ, ASMIM_ZERO_PAGE },
+	{ 0x46, ASMIT_LSRQ, ASMIM_ZERO_PAGE },
+	{ 0x4a, ASMIT_LSRQ, ASMIM_IMPLIED },
+	{ 0x4d, ASMIT_EORQ, ASMIM_ABSOLUTE },
+	{ 0x4e, ASMIT_LSRQ, ASMIM_ABSOLUTE },
+	{ 0x65, ASMIT_ADCQ, ASMIM_ZERO_PAGE },
+	{ 0x66, ASMIT_RORQ, ASMIM_ZERO_PAGE },
+	{ 0x6a, ASMIT_RORQ, ASMIM_IMPLIED },
+	{ 0x6d, ASMIT_ADCQ, ASMIM_ABSOLUTE },
+	{ 0x6e, ASMIT_RORQ, ASMIM_ABSOLUTE },
+	{ 0x85, ASMIT_STQ, ASMIM_ZERO_PAGE },
+	{ 0x8d, ASMIT_STQ, ASMIM_ABSOLUTE },
+	{ 0xa5, ASMIT_LDQ, ASMIM_ZERO_PAGE },
+	{ 0xad, ASMIT_LDQ, ASMIM_ABSOLUTE },
+	{ 0xc5, ASMIT_CMPQ, ASMIM_ZERO_PAGE },
+	{ 0xc6, ASMIT_DEQ, ASMIM_ZERO_PAGE },
+	{ 0xcd, ASMIT_CMPQ, ASMIM_ABSOLUTE },
+	{ 0xce, ASMIT_DEQ, ASMIM_ABSOLUTE },
+	{ 0xe5, ASMIT_SBCQ, ASMIM_ZERO_PAGE },
+	{ 0xe6, ASMIT_INQ, ASMIM_ZERO_PAGE },
+	{ 0xed, ASMIT_SBCQ, ASMIM_ABSOLUTE },
+	{ 0xee, ASMIT_INQ, ASMIM_ABSOLUTE },
+};
+
+AsmInsData	CPUInsData[NUM_ASM_CPUS][256];
+
+AsmInsData	QuadInsData[256];
+
 short AsmInsOpcodes[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES];
 
+static uint8 AsmInsCPUs[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES];
+
 const char* AsmInstructionNames[NUM_ASM_INS_TYPES] = {
 	"ADC", "AND", "ASL", "BCC", "BCS", "BEQ", "BIT", "BMI", "BNE", "BPL", "BRK", "BVC", "BVS", "CLC",
 	"CLD", "CLI", "CLV", "CMP", "CPX", "CPY", "DEC", "DEX", "DEY", "EOR", "INC", "INX", "INY", "JMP",
 	"JSR", "LDA", "LDX", "LDY", "LSR", "NOP", "ORA", "PHA", "PHP", "PLA", "PLP", "ROL", "ROR", "RTI",
 	"RTS", "SBC", "SEC", "SED", "SEI", "STA", "STX", "STY", "TAX", "TAY", "TSX", "TXA", "TXS", "TYA",
+	"BRA", "PHX", "PHY", "PLX", "PLY", "STZ", "TRB", "TSB",
+	"ASR", "ASW", "CPZ", "DEW", "DEZ", "INW", "INZ", "LDZ", "NEG", "PHZ", "PLZ", "ROW", "TAZ", "TZA",
+	"ADCQ", "ANDQ", "ASLQ", "CMPQ", "DEQ", "EORQ", "INQ", "LDQ", "LSRQ", "ORAQ", "ROLQ", "RORQ", "SBCQ", "STQ",
 	"INV", "BYT"
 };
 
@@ -306,6 +423,9 @@ int AsmInsModeSize[NUM_ASM_INS_MODES_X] = {
 	2,
 	2,
 	2,
+	2,
+	3,
+	3,
 	0,
 	2
 };
@@ -317,25 +437,73 @@ void InitAssembler(void)
 		for (int j = 0; j < NUM_ASM_INS_MODES; j++)
 		{
 			AsmInsOpcodes[i][j] = -1;
+			AsmInsCPUs[i][j] = 0;
 		}
 	}
 
+	for (int cpu = 0; cpu < NUM_ASM_CPUS; cpu++)
+	{
+		for (int i = 0; i < 256; i++)
+			CPUInsData[cpu][i] = DecInsData[i];
+	}
+
+	for (int i = 0; i < sizeof(Ins65C02) / sizeof(Ins65C02[0]); i++)
+	{
+		for (int cpu = ASMCPU_65C02; cpu <= ASMCPU_45GS02; cpu++)
+		{
+			AsmInsData& di(CPUInsData[cpu][Ins65C02[i].mOpcode]);
+			assert(di.mType == ASMIT_INV);
+			di.mType = Ins65C02[i].mType;
+			di.mMode = Ins65C02[i].mMode;
+		}
+	}
+
+	for (int i = 0; i < sizeof(Ins45GS02) / sizeof(Ins45GS02[0]); i++)
+	{
+		AsmInsData& di(CPUInsData[ASMCPU_45GS02][Ins45GS02[i].mOpcode]);
+		assert(di.mType == ASMIT_INV);
+		di.mType = Ins45GS02[i].mType;
+		di.mMode = Ins45GS02[i].mMode;
+	}
+
 	for (int i = 0; i < 256; i++)
 	{
-		const AsmInsData& di(DecInsData[i]);
-		if (di.mType != ASMIT_INV)
+		QuadInsData[i].mType = ASMIT_INV;
+		QuadInsData[i].mMode = ASMIM_IMPLIED;
+	}
+
+	for (int i = 0; i < sizeof(InsQuad) / sizeof(InsQuad[0]); i++)
+	{
+		AsmInsData& di(QuadInsData[InsQuad[i].mOpcode]);
+		di.mType = InsQuad[i].mType;
+		di.mMode = InsQuad[i].mMode;
+		AsmInsOpcodes[di.mType][di.mMode] = InsQuad[i].mOpcode;
+		AsmInsCPUs[di.mType][di.mMode] = 1 << ASMCPU_45GS02;
+	}
+
+	for (int cpu = 0; cpu < NUM_ASM_CPUS; cpu++)
+	{
+		for (int i = 0; i < 256; i++)
 		{
-			assert(AsmInsOpcodes[di.mType][di.mMode] == -1);
-			AsmInsOpcodes[di.mType][di.mMode] = i;
+			const AsmInsData& di(CPUInsData[cpu][i]);
+			if (di.mType != ASMIT_INV)
+			{
+				assert(AsmInsOpcodes[di.mType][di.mMode] == -1 || AsmInsOpcodes[di.mType][di.mMode] == i);
+				AsmInsOpcodes[di.mType][di.mMode] = i;
+				AsmInsCPUs[di.mType][di.mMode] |= 1 << cpu;
+			}
 		}
 	}
 
 	AsmInsOpcodes[ASMIT_BYTE][ASMIM_ZERO_PAGE] = 0;
+	AsmInsCPUs[ASMIT_BYTE][ASMIM_ZERO_PAGE] = (1 << NUM_ASM_CPUS) - 1;
 }
 
 int AsmInsSize(AsmInsType type, AsmInsMode mode)
 {
-	if (type < ASMIT_INV && mode >= ASMIM_IMPLIED && mode < NUM_ASM_INS_MODES)
+	if (IsQuadAsmInstruction(type))
+		return AsmInsModeSize[mode] + 2;
+	else if (type < ASMIT_INV && mode >= ASMIM_IMPLIED && mode < NUM_ASM_INS_MODES)
 		return AsmInsModeSize[mode];
 	else
 		return 1;
@@ -439,7 +607,11 @@ uint32 AsmInsFlags(AsmInsType type, AsmInsMode mode)
 
 	case ASMIT_DEC:
 	case ASMIT_INC:
-		flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY | ASMIFLG_CHANGES_ZFLAG;
+		flags |= ASMIFLG_CHANGES_ZFLAG;
+		if (mode == ASMIM_IMPLIED)
+			flags |= ASMIFLG_USES_ACCU | ASMIFLG_CHANGES_ACCU;
+		else
+			flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY;
 		break;
 
 	case ASMIT_BCC:
@@ -457,6 +629,7 @@ uint32 AsmInsFlags(AsmInsType type, AsmInsMode mode)
 		break;
 
 	case ASMIT_JMP:
+	case ASMIT_BRA:
 		flags |= ASMIFLG_CONTROL_FLOW;
 		break;
 
@@ -466,7 +639,18 @@ uint32 AsmInsFlags(AsmInsType type, AsmInsMode mode)
 		break;
 
 	case ASMIT_BIT:
-		flags |= ASMIFLG_USES_MEMORY | ASMIFLG_USES_ACCU | ASMIFLG_CHANGES_ZFLAG;
+		flags |= ASMIFLG_USES_ACCU | ASMIFLG_CHANGES_ZFLAG;
+		if (mode != ASMIM_IMMEDIATE)
+			flags |= ASMIFLG_USES_MEMORY;
+		break;
+
+	case ASMIT_STZ:
+		flags |= ASMIFLG_CHANGES_MEMORY;
+		break;
+
+	case ASMIT_TRB:
+	case ASMIT_TSB:
+		flags |= ASMIFLG_USES_ACCU | ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY | ASMIFLG_CHANGES_ZFLAG;
 		break;
 
 	case ASMIT_CLV:
@@ -508,6 +692,19 @@ uint32 AsmInsFlags(AsmInsType type, AsmInsMode mode)
 		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK | ASMIFLG_USES_CFLAG | ASMIFLG_USES_ZFLAG;
 		break;
 
+	case ASMIT_PHX:
+		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK | ASMIFLG_USES_XREG;
+		break;
+	case ASMIT_PHY:
+		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK | ASMIFLG_USES_YREG;
+		break;
+	case ASMIT_PLX:
+		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK | ASMIFLG_CHANGES_XREG | ASMIFLG_CHANGES_ZFLAG;
+		break;
+	case ASMIT_PLY:
+		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK | ASMIFLG_CHANGES_YREG | ASMIFLG_CHANGES_ZFLAG;
+		break;
+
 	case ASMIT_JSR:
 		flags |= ASMIFLG_USES_ALL | ASMIFLG_CHANGES_ALL | ASMIFLG_CONTROL_FLOW;
 		break;
@@ -529,6 +726,87 @@ uint32 AsmInsFlags(AsmInsType type, AsmInsMode mode)
 
 	case ASMIT_NOP:
 		break;
+
+	case ASMIT_ASR:
+	case ASMIT_NEG:
+		flags |= ASMIFLG_CHANGES_ZFLAG;
+		if (type == ASMIT_ASR)
+			flags |= ASMIFLG_CHANGES_CFLAG;
+		if (mode == ASMIM_IMPLIED)
+			flags |= ASMIFLG_USES_ACCU | ASMIFLG_CHANGES_ACCU;
+		else
+			flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY;
+		break;
+
+	case ASMIT_INW:
+	case ASMIT_DEW:
+		flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY | ASMIFLG_CHANGES_ZFLAG;
+		break;
+	case ASMIT_ASW:
+		flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY | ASMIFLG_CHANGES_ZFLAG | ASMIFLG_CHANGES_CFLAG;
+		break;
+	case ASMIT_ROW:
+		flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY | ASMIFLG_CHANGES_ZFLAG | ASMIFLG_USES_CFLAG | ASMIFLG_CHANGES_CFLAG;
+		break;
+
+	case ASMIT_LDZ:
+	case ASMIT_CPZ:
+		flags |= ASMIFLG_CHANGES_ZFLAG;
+		if (type == ASMIT_CPZ)
+			flags |= ASMIFLG_CHANGES_CFLAG;
+		if (mode != ASMIM_IMMEDIATE)
+			flags |= ASMIFLG_USES_MEMORY;
+		break;
+	case ASMIT_INZ:
+	case ASMIT_DEZ:
+		flags |= ASMIFLG_CHANGES_ZFLAG;
+		break;
+	case ASMIT_TAZ:
+		flags |= ASMIFLG_USES_ACCU | ASMIFLG_CHANGES_ZFLAG;
+		break;
+	case ASMIT_TZA:
+		flags |= ASMIFLG_CHANGES_ACCU | ASMIFLG_CHANGES_ZFLAG;
+		break;
+	case ASMIT_PHZ:
+		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK;
+		break;
+	case ASMIT_PLZ:
+		flags |= ASMIFLG_USES_STACK | ASMIFLG_CHANGES_STACK | ASMIFLG_CHANGES_ZFLAG;
+		break;
+
+	case ASMIT_LDQ:
+		flags |= ASMIFLG_CHANGES_ACCU | ASMIFLG_CHANGES_XREG | ASMIFLG_CHANGES_YREG | ASMIFLG_CHANGES_ZFLAG | ASMIFLG_USES_MEMORY;
+		break;
+	case ASMIT_STQ:
+		flags |= ASMIFLG_USES_ACCU | ASMIFLG_USES_XREG | ASMIFLG_USES_YREG | ASMIFLG_CHANGES_MEMORY;
+		break;
+	case ASMIT_ADCQ:
+	case ASMIT_SBCQ:
+		flags |= ASMIFLG_USES_CFLAG | ASMIFLG_CHANGES_CFLAG;
+	case ASMIT_ANDQ:
+	case ASMIT_ORAQ:
+	case ASMIT_EORQ:
+		flags |= ASMIFLG_USES_ACCU | ASMIFLG_USES_XREG | ASMIFLG_USES_YREG | ASMIFLG_CHANGES_ACCU | ASMIFLG_CHANGES_XREG | ASMIFLG_CHANGES_YREG | ASMIFLG_CHANGES_ZFLAG | ASMIFLG_USES_MEMORY;
+		break;
+	case ASMIT_CMPQ:
+		flags |= ASMIFLG_USES_ACCU | ASMIFLG_USES_XREG | ASMIFLG_USES_YREG | ASMIFLG_CHANGES_ZFLAG | ASMIFLG_CHANGES_CFLAG | ASMIFLG_USES_MEMORY;
+		break;
+	case ASMIT_ASLQ:
+	case ASMIT_LSRQ:
+	case ASMIT_ROLQ:
+	case ASMIT_RORQ:
+	case ASMIT_INQ:
+	case ASMIT_DEQ:
+		flags |= ASMIFLG_CHANGES_ZFLAG;
+		if (type != ASMIT_INQ && type != ASMIT_DEQ)
+			flags |= ASMIFLG_CHANGES_CFLAG;
+		if (type == ASMIT_ROLQ || type == ASMIT_RORQ)
+			flags |= ASMIFLG_USES_CFLAG;
+		if (mode == ASMIM_IMPLIED)
+			flags |= ASMIFLG_USES_ACCU | ASMIFLG_USES_XREG | ASMIFLG_USES_YREG | ASMIFLG_CHANGES_ACCU | ASMIFLG_CHANGES_XREG | ASMIFLG_CHANGES_YREG;
+		else
+			flags |= ASMIFLG_USES_MEMORY | ASMIFLG_CHANGES_MEMORY;
+		break;
 	}
 
 	switch (mode)
@@ -548,6 +826,12 @@ uint32 AsmInsFlags(AsmInsType type, AsmInsMode mode)
 	case ASMIM_INDIRECT_Y:
 		flags |= ASMIFLG_USES_YREG | ASMIFLG_USES_MEMORY;
 		break;
+	case ASMIM_INDIRECT_ZERO_PAGE:
+		flags |= ASMIFLG_USES_MEMORY;
+		break;
+	case ASMIM_INDIRECT_ABSOLUTE_X:
+		flags |= ASMIFLG_USES_XREG | ASMIFLG_USES_MEMORY;
+		break;
 	}
 	return flags;
 }
@@ -559,24 +843,34 @@ static inline char toupper(char ch)
 	else
 		return ch;
 }
-AsmInsType FindAsmInstruction(const char* ins)
+AsmInsType FindAsmInstruction(const char* ins, AsmCPU cpu)
 {
-	if (ins && strlen(ins) == 3)
+	if (ins)
 	{
 		for (int i = 0; i < NUM_ASM_INS_TYPES; i++)
 		{
-			if (AsmInstructionNames[i][0] == toupper(ins[0]) &&
-				AsmInstructionNames[i][1] == toupper(ins[1]) &&
-				AsmInstructionNames[i][2] == toupper(ins[2]))
-				return AsmInsType(i);
+			const char* name = AsmInstructionNames[i];
+
+			int	j = 0;
+			while (name[j] && name[j] == toupper(ins[j]))
+				j++;
+
+			if (!name[j] && !ins[j])
+			{
+				for (int k = 0; k < NUM_ASM_INS_MODES; k++)
+					if (AsmInsCPUs[i][k] & (1 << cpu))
+						return AsmInsType(i);
+			}
 		}
 	}
 
 	return ASMIT_INV;
 }
 
-bool HasAsmInstructionMode(AsmInsType type, AsmInsMode mode)
+bool HasAsmInstructionMode(AsmInsType type, AsmInsMode mode, AsmCPU cpu)
 {
-	return AsmInsOpcodes[type][mode] != -1;
+	if (mode == ASMIM_IMMEDIATE_ADDRESS)
+		mode = ASMIM_IMMEDIATE;
+	return mode < NUM_ASM_INS_MODES && (AsmInsCPUs[type][mode] & (1 << cpu));
 }
 
@@ -2,6 +2,7 @@
 
 #include "Ident.h"
 #include "MachineTypes.h"
+#include "CompilerTypes.h"
 
 enum AsmInsType : uint8
 {
@@ -9,6 +10,9 @@ enum AsmInsType : uint8
 	ASMIT_CLD, ASMIT_CLI, ASMIT_CLV, ASMIT_CMP, ASMIT_CPX, ASMIT_CPY, ASMIT_DEC, ASMIT_DEX, ASMIT_DEY, ASMIT_EOR, ASMIT_INC, ASMIT_INX, ASMIT_INY, ASMIT_JMP,
 	ASMIT_JSR, ASMIT_LDA, ASMIT_LDX, ASMIT_LDY, ASMIT_LSR, ASMIT_NOP, ASMIT_ORA, ASMIT_PHA, ASMIT_PHP, ASMIT_PLA, ASMIT_PLP, ASMIT_ROL, ASMIT_ROR, ASMIT_RTI,
 	ASMIT_RTS, ASMIT_SBC, ASMIT_SEC, ASMIT_SED, ASMIT_SEI, ASMIT_STA, ASMIT_STX, ASMIT_STY, ASMIT_TAX, ASMIT_TAY, ASMIT_TSX, ASMIT_TXA, ASMIT_TXS, ASMIT_TYA,
+	ASMIT_BRA, ASMIT_PHX, ASMIT_PHY, ASMIT_PLX, ASMIT_PLY, ASMIT_STZ, ASMIT_TRB, ASMIT_TSB,
+	ASMIT_ASR, ASMIT_ASW, ASMIT_CPZ, ASMIT_DEW, ASMIT_DEZ, ASMIT_INW, ASMIT_INZ, ASMIT_LDZ, ASMIT_NEG, ASMIT_PHZ, ASMIT_PLZ, ASMIT_ROW, ASMIT_TAZ, ASMIT_TZA,
+	ASMIT_ADCQ, ASMIT_ANDQ, ASMIT_ASLQ, ASMIT_CMPQ, ASMIT_DEQ, ASMIT_EORQ, ASMIT_INQ, ASMIT_LDQ, ASMIT_LSRQ, ASMIT_ORAQ, ASMIT_ROLQ, ASMIT_RORQ, ASMIT_SBCQ, ASMIT_STQ,
 	ASMIT_INV, ASMIT_BYTE,
 
 	NUM_ASM_INS_TYPES
@@ -29,6 +33,9 @@ enum AsmInsMode : uint8
 	ASMIM_INDIRECT_X,
 	ASMIM_INDIRECT_Y,
 	ASMIM_RELATIVE,
+	ASMIM_INDIRECT_ZERO_PAGE,
+	ASMIM_INDIRECT_ABSOLUTE_X,
+	ASMIM_RELATIVE_LONG,
 
 	NUM_ASM_INS_MODES,
 
@@ -37,6 +44,39 @@ enum AsmInsMode : uint8
 	NUM_ASM_INS_MODES_X,
 };
 
+// The CMOS 65C02 adds instructions and address modes in opcodes that
+// are unused by the NMOS 6502.  The 45GS02 of the MEGA65 extends the
+// 65C02 with a Z register, word instructions and long branches, the
+// (zp) mode is indexed with Z and STZ stores Z, so generated code keeps
+// Z at zero.  Instructions with the NEG NEG prefix work on the 32 bit
+// Q register made of A, X, Y and Z or on 32 bits of memory.
+
+enum AsmCPU : uint8
+{
+	ASMCPU_6502,
+	ASMCPU_65C02,
+	ASMCPU_45GS02,
+
+	NUM_ASM_CPUS
+};
+
+inline AsmCPU TargetCPU(uint64 compilerOptions)
+{
+	if (compilerOptions & COPT_CPU_45GS02)
+		return ASMCPU_45GS02;
+	else if (compilerOptions & COPT_CPU_65C02)
+		return ASMCPU_65C02;
+	else
+		return ASMCPU_6502;
+}
+
+inline bool IsQuadAsmInstruction(AsmInsType type)
+{
+	return type >= ASMIT_ADCQ && type <= ASMIT_STQ;
+}
+
+static const uint8 ASM_QUAD_PREFIX = 0x42;
+
 struct AsmInsData
 {
 	AsmInsType	mType;
@@ -66,15 +106,19 @@ static const uint32 ASMIFLG_CONTROL_FLOW	= 0x00010000;
 
 extern AsmInsData	DecInsData[256];
 
+extern AsmInsData	CPUInsData[NUM_ASM_CPUS][256];
+
+extern AsmInsData	QuadInsData[256];
+
 extern short AsmInsOpcodes[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES];
 
 extern int AsmInsModeSize[NUM_ASM_INS_MODES_X];
 
 extern const char* AsmInstructionNames[NUM_ASM_INS_TYPES];
 
-AsmInsType FindAsmInstruction(const char * ins);
+AsmInsType FindAsmInstruction(const char * ins, AsmCPU cpu = ASMCPU_6502);
 
-bool HasAsmInstructionMode(AsmInsType type, AsmInsMode mode);
+bool HasAsmInstructionMode(AsmInsType type, AsmInsMode mode, AsmCPU cpu = ASMCPU_6502);
 
 int AsmInsSize(AsmInsType type, AsmInsMode mode);
 
@@ -1370,6 +1370,11 @@ ByteCodeBasicBlock::ByteCodeBasicBlock(void)
 	mPlaced = false;
 	mAssembled = false;
 	mBypassed = false;
+	mLocked = false;
+	mVisited = false;
+	mNeedsNop = false;
+	mNumEntries = 0;
+	mLocated = 0;
 	mExitLive = 0;
 }
 
@@ -4607,6 +4612,7 @@ void ByteCodeBasicBlock::Compile(InterCodeProcedure* iproc, ByteCodeProcedure* p
 			if (i + 1 < sblock->mInstructions.Size() && sblock->mInstructions[i + 1]->mCode == IC_BRANCH && sblock->mInstructions[i + 1]->mSrc[0].mFinal)
 			{
 				ByteCode code = RelationalOperator(iproc, ins, true);
+				SetLocation(ins->mLocation);
 				this->Close(proc->CompileBlock(iproc, sblock->mTrueJump), proc->CompileBlock(iproc, sblock->mFalseJump), code);
 				i++;
 				return;
@@ -4702,6 +4708,7 @@ void ByteCodeBasicBlock::Compile(InterCodeProcedure* iproc, ByteCodeProcedure* p
 
 			mExitLive = LIVE_ACCU;
 
+			SetLocation(ins->mLocation);
 			this->Close(proc->exitBlock, nullptr, BC_JUMPS);
 			return;
 
@@ -4737,6 +4744,7 @@ void ByteCodeBasicBlock::Compile(InterCodeProcedure* iproc, ByteCodeProcedure* p
 				lins.mRegisterFinal = ins->mSrc[0].mFinal;
 				mIns.Push(lins);
 
+				SetLocation(ins->mLocation);
 				this->Close(proc->CompileBlock(iproc, sblock->mTrueJump), proc->CompileBlock(iproc, sblock->mFalseJump), BC_BRANCHS_NE);
 			}
 			return;
@@ -4746,6 +4754,7 @@ void ByteCodeBasicBlock::Compile(InterCodeProcedure* iproc, ByteCodeProcedure* p
 			return;
 		}
 
+		SetLocation(ins->mLocation);
 		i++;
 	}
 
@@ -6169,7 +6178,10 @@ void ByteCodeBasicBlock::Assemble(ByteCodeGenerator* generator)
 		int	nins = 0;
 		for (int i = 0; i < mIns.Size(); i++)
 		{
+			int	start = mCode.Size();
 			mIns[i].Assemble(generator, this);
+			if (mIns[i].mLocation.mFileName)
+				PutLocation(mIns[i].mLocation, start);
 			if (mCode.Size() > nins + 240)
 			{
 				PutCode(generator, BC_NOP);
@@ -6186,6 +6198,33 @@ void ByteCodeBasicBlock::Assemble(ByteCodeGenerator* generator)
 	}
 }
 
+void ByteCodeBasicBlock::SetLocation(const Location& location)
+{
+	while (mLocated < mIns.Size())
+		mIns[mLocated++].mLocation = location;
+}
+
+void ByteCodeBasicBlock::PutLocation(const Location& location, int start)
+{
+	int sz = mCodeLocations.Size();
+	if (sz > 0 &&
+		mCodeLocations[sz - 1].mEnd == start &&
+		mCodeLocations[sz - 1].mLocation.mFileName == location.mFileName &&
+		mCodeLocations[sz - 1].mLocation.mLine == location.mLine)
+	{
+		mCodeLocations[sz - 1].mEnd = mCode.Size();
+	}
+	else
+	{
+		CodeLocation	loc;
+		loc.mLocation = location;
+		loc.mStart = start;
+		loc.mEnd = mCode.Size();
+		loc.mWeak = false;
+		mCodeLocations.Push(loc);
+	}
+}
+
 void ByteCodeBasicBlock::Close(ByteCodeBasicBlock* trueJump, ByteCodeBasicBlock* falseJump, ByteCode branch)
 {
 	if (branch == BC_NOP)
@@ -6279,6 +6318,19 @@ void ByteCodeBasicBlock::CopyCode(ByteCodeGenerator* generator, LinkerObject* li
 
 	assert(end == next);
 
+	if (mCodeLocations.Size() > 0)
+	{
+		mCodeLocations[mCodeLocations.Size() - 1].mEnd = mCode.Size();
+
+		for (int i = 0; i < mCodeLocations.Size(); i++)
+		{
+			CodeLocation	loc(mCodeLocations[i]);
+			loc.mStart += mOffset;
+			loc.mEnd += mOffset;
+			linkerObject->mCodeLocations.Push(loc);
+		}
+	}
+
 	for (i = 0; i < mCode.Size(); i++)
 		mCode.Lookup(i, target[i + mOffset]);
 }
@@ -6628,6 +6680,7 @@ void ByteCodeProcedure::Compile(ByteCodeGenerator* generator, InterCodeProcedure
 		entryBlock->PutCode(generator, BC_PUSH_FRAME);
 		entryBlock->PutWord(uint16(proc->mCommonFrameSize + 2));
 	}
+	entryBlock->PutLocation(proc->mLocation, 0);
 
 	tblocks[0] = entryBlock;
 
@@ -6690,6 +6743,7 @@ void ByteCodeProcedure::Compile(ByteCodeGenerator* generator, InterCodeProcedure
 		exitBlock->PutWord(uint16(proc->mCommonFrameSize + 2));
 	}
 	exitBlock->PutCode(generator, BC_RETURN); exitBlock->PutByte(tempSave); exitBlock->PutWord(proc->mLocalSize + 2 + tempSave);
+	exitBlock->PutLocation(proc->mLocation, 0);
 
 
 	ByteCodeBasicBlock* lentryBlock = entryBlock->BypassEmptyBlocks();
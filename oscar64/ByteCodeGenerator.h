@@ -213,6 +213,7 @@ public:
 	LinkerObject* mLinkerObject;
 	const char* mRuntime;
 	uint32		mLive;
+	Location	mLocation;
 
 	bool IsStore(void) const;
 	bool ChangesAccu(void) const;
@@ -253,8 +254,9 @@ public:
 	GrowingArray<ByteCodeInstruction>	mIns;
 	GrowingArray<LinkerReference>	mRelocations;
 	GrowingArray<ByteCodeBasicBlock*>	mEntryBlocks;
+	ExpandingArray<CodeLocation>		mCodeLocations;
 
-	int						mOffset, mSize, mPlace, mLinear, mNumEntries;
+	int						mOffset, mSize, mPlace, mLinear, mNumEntries, mLocated;
 	bool					mPlaced, mNeedsNop, mBypassed, mAssembled, mVisited, mLocked;
 	uint32					mExitLive;
 
@@ -270,6 +272,8 @@ public:
 	void PutBytes(const uint8* code, int num);
 
 	void PutCode(ByteCodeGenerator* generator, ByteCode code);
+	void PutLocation(const Location& location, int start);
+	void SetLocation(const Location& location);
 	int PutBranch(ByteCodeGenerator* generator, ByteCode code, int offset);
 
 	ByteCodeBasicBlock* BypassEmptyBlocks(void);
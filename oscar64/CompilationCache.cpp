@@ -0,0 +1,1429 @@
+#include "CompilationCache.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+static const int NUM_REGS = 261;
+
+// Options that only change the diagnostic output of the compiler
+static const uint64 CacheIgnoredOptions = COPT_VERBOSE | COPT_VERBOSE2 | COPT_VERBOSE3 | COPT_ERROR_FILES;
+
+// Increment whenever the code generator state written to the cache changes
+static const int CacheFormat = 2;
+
+static const uint64 HashBasis = 0xcbf29ce484222325ULL;
+static const uint64 HashPrime = 0x00000100000001b3ULL;
+
+class CacheHash
+{
+public:
+	uint64	mHash;
+
+	CacheHash(void) : mHash(HashBasis) {}
+
+	void Byte(uint8 b)
+	{
+		mHash = (mHash ^ b) * HashPrime;
+	}
+
+	void Int(int64 v)
+	{
+		for (int i = 0; i < 8; i++)
+			Byte(uint8(v >> (8 * i)));
+	}
+
+	void Bytes(const uint8* data, int size)
+	{
+		Int(size);
+		for (int i = 0; i < size; i++)
+			Byte(data[i]);
+	}
+
+	void String(const char* str)
+	{
+		if (str)
+			Bytes((const uint8*)str, int(strlen(str)));
+		else
+			Int(-1);
+	}
+
+	void Float(double d)
+	{
+		uint64	u;
+		memcpy(&u, &d, sizeof(u));
+		Int(int64(u));
+	}
+};
+
+// Serializes the native code of a procedure.  In digest mode linker objects
+// and instructions are written by their content instead of an index, the
+// result is only hashed.
+
+class CacheWriter
+{
+public:
+	ExpandingArray<uint8>			mData;
+	ExpandingArray<LinkerObject*>	mObjects;
+	bool							mDigest, mFailed;
+
+	CacheWriter(bool digest) : mDigest(digest), mFailed(false) {}
+
+	void Int(int64 v)
+	{
+		uint64	u = (uint64(v) << 1) ^ uint64(v >> 63);
+		while (u >= 0x80)
+		{
+			mData.Push(uint8(u | 0x80));
+			u >>= 7;
+		}
+		mData.Push(uint8(u));
+	}
+
+	void Word(uint64 v)
+	{
+		for (int i = 0; i < 8; i++)
+			mData.Push(uint8(v >> (8 * i)));
+	}
+
+	uint64 Hash(void) const
+	{
+		CacheHash	h;
+		for (int i = 0; i < mData.Size(); i++)
+			h.Byte(mData[i]);
+		return h.mHash;
+	}
+};
+
+class CacheReader
+{
+public:
+	const uint8	*	mData;
+	int				mSize, mPos;
+	bool			mFailed;
+
+	CacheReader(const uint8* data, int size) : mData(data), mSize(size), mPos(0), mFailed(false) {}
+
+	int64 Int(void)
+	{
+		uint64	u = 0;
+		int		s = 0;
+		for (;;)
+		{
+			if (mPos >= mSize || s > 63)
+			{
+				mFailed = true;
+				return 0;
+			}
+			uint8	b = mData[mPos++];
+			u |= uint64(b & 0x7f) << s;
+			if (!(b & 0x80))
+				break;
+			s += 7;
+		}
+		return int64(u >> 1) ^ -int64(u & 1);
+	}
+
+	int Index(int size)
+	{
+		int64	i = Int();
+		if (i < -1 || i >= size)
+		{
+			mFailed = true;
+			return -1;
+		}
+		return int(i);
+	}
+
+	uint64 Word(void)
+	{
+		if (mPos + 8 > mSize)
+		{
+			mFailed = true;
+			return 0;
+		}
+		uint64	v = 0;
+		for (int i = 0; i < 8; i++)
+			v |= uint64(mData[mPos++]) << (8 * i);
+		return v;
+	}
+};
+
+CompilationCache::CompilationCache(const char* path)
+	: mHits(0), mMisses(0), mStores(0), mLinker(nullptr), mGenerator(nullptr), mModule(nullptr), mGlobal(0)
+{
+	strcpy_s(mPath, path);
+	int	n = int(strlen(mPath));
+	while (n > 1 && (mPath[n - 1] == '/' || mPath[n - 1] == '\\'))
+		mPath[--n] = 0;
+}
+
+CompilationCache::~CompilationCache(void)
+{
+	for (int i = 0; i < mTasks.Size(); i++)
+		delete mTasks[i];
+}
+
+bool CompilationCache::Open(Errors* errors)
+{
+	struct stat	st;
+	if (stat(mPath, &st) == 0)
+	{
+		if (st.st_mode & S_IFDIR)
+			return true;
+	}
+	else
+	{
+#ifdef _WIN32
+		if (_mkdir(mPath) == 0)
+#else
+		if (mkdir(mPath, 0777) == 0)
+#endif
+			return true;
+	}
+
+	errors->Error(Location(), EWARN_COMPILATION_CACHE, "Cannot use compilation cache directory", mPath);
+	return false;
+}
+
+void CompilationCache::EntryPath(char* path, uint64 key) const
+{
+	sprintf_s(path, 240, "%s/%08x%08x.onc", mPath, uint32(key >> 32), uint32(key));
+}
+
+uint64 CompilationCache::ObjectName(const LinkerObject* obj, bool& unique) const
+{
+	CacheHash	h;
+	h.String(obj->mIdent ? obj->mIdent->mString : nullptr);
+	h.Int(obj->mType);
+
+	// Anonymous objects are distinguished by their content
+	if (!obj->mIdent && obj->mData)
+		h.Bytes(obj->mData, obj->mSize);
+
+	unique = true;
+	return h.mHash;
+}
+
+uint64 CompilationCache::ObjectFacts(const LinkerObject* obj) const
+{
+	CacheHash	h;
+
+	h.Int(obj->mType);
+	h.Int(obj->mFlags);
+	h.Int(obj->mSize);
+	h.Int(obj->mAlignment);
+	h.Int(obj->mStripe);
+	if (obj->mFlags & LOBJF_PLACED)
+		h.Int(obj->mAddress);
+	h.String(obj->mSection && obj->mSection->mIdent ? obj->mSection->mIdent->mString : nullptr);
+	h.Int(obj->mNumTemporaries);
+	h.Bytes(obj->mTemporaries, obj->mNumTemporaries);
+	h.Bytes(obj->mTempSizes, obj->mNumTemporaries);
+	for (int i = 0; i < 8; i++)
+		h.Int(obj->mZeroPageSet.mBits[i]);
+
+	if (obj->mData)
+		h.Bytes(obj->mData, obj->mSize);
+
+	h.Int(obj->mReferences.Size());
+	for (int i = 0; i < obj->mReferences.Size(); i++)
+	{
+		const LinkerReference* ref = obj->mReferences[i];
+		h.Int(ref->mOffset);
+		h.Int(ref->mRefOffset);
+		h.Int(ref->mFlags);
+		if (ref->mRefObject)
+		{
+			bool	unique;
+			h.Int(ObjectName(ref->mRefObject, unique));
+		}
+		else
+			h.Int(0);
+	}
+
+	if (obj->mVariable)
+	{
+		const InterVariable* var = obj->mVariable;
+		h.Int(var->mAliased);
+		h.Int(var->mNotAliased);
+		h.Int(var->mSize);
+		h.Int(var->mTemp);
+		h.Int(var->mIndex == 0);
+
+		// Callers check, if a variable is a global variable of the module
+		h.Int(mModule && var->mIndex >= 0 && var->mIndex < mModule->mGlobalVars.Size() && mModule->mGlobalVars[var->mIndex] == var);
+	}
+
+	if (obj->mProc)
+	{
+		InterCodeProcedure* proc = obj->mProc;
+		const GrowingVariableArray& globalVars(proc->mModule->mGlobalVars);
+
+		h.Int(proc->mNativeProcedure);
+		h.Int(proc->mCallerSavedTemps);
+		h.Int(proc->mFreeCallerSavedTemps);
+		h.Int(proc->mGlobalsChecked);
+		h.Int(proc->mLoadsIndirect);
+		h.Int(proc->mStoresIndirect);
+		h.Int(proc->mCallsFunctionPointer);
+
+		// Global variables are identified by their linker objects, the
+		// numbering changes with every new variable
+
+		if (proc->mGlobalsChecked)
+		{
+			for (int i = 0; i < globalVars.Size(); i++)
+			{
+				InterVariable* var = globalVars[i];
+				bool	referenced = i < proc->mReferencedGlobals.Size() && proc->mReferencedGlobals[i];
+				bool	modified = i < proc->mModifiedGlobals.Size() && proc->mModifiedGlobals[i];
+
+				if (var && var->mLinkerObject && (referenced || modified))
+				{
+					bool	unique;
+					h.Int(ObjectName(var->mLinkerObject, unique));
+					h.Int(var->mAliased);
+					h.Int(referenced);
+					h.Int(modified);
+				}
+			}
+		}
+	}
+
+	return h.mHash;
+}
+
+int CompilationCache::FindObject(uint64 name) const
+{
+	int	l = 0, r = mNames.Size();
+	while (l < r)
+	{
+		int	m = (l + r) >> 1;
+		if (mObjects[mNames[m]].mName < name)
+			l = m + 1;
+		else
+			r = m;
+	}
+
+	if (l < mNames.Size() && mObjects[mNames[l]].mName == name)
+		return mNames[l];
+	else
+		return -1;
+}
+
+const CompilationCache::InstructionRef* CompilationCache::FindInstructionRef(const InterInstruction* ins) const
+{
+	int	l = 0, r = mInstructions.Size();
+	while (l < r)
+	{
+		int	m = (l + r) >> 1;
+		if (ptrdiff_t(mInstructions[m].mIns) < ptrdiff_t(ins))
+			l = m + 1;
+		else
+			r = m;
+	}
+
+	if (l < mInstructions.Size() && mInstructions[l].mIns == ins)
+		return &(mInstructions[l]);
+	else
+		return nullptr;
+}
+
+const InterInstruction* CompilationCache::FindInstruction(int object, int block, int index) const
+{
+	const InterCodeProcedure* proc = mLinker->mObjects[object]->mProc;
+	if (proc && block >= 0 && block < proc->mBlocks.Size() && proc->mBlocks[block] && index >= 0 && index < proc->mBlocks[block]->mInstructions.Size())
+		return proc->mBlocks[block]->mInstructions[index];
+	else
+		return nullptr;
+}
+
+static void HashOperand(CacheHash& h, const InterOperand& op, ExpandingArray<LinkerObject*>& objects)
+{
+	h.Int(op.mTemp);
+	h.Int(op.mType);
+	h.Int(op.mFinal);
+	h.Int(op.mIntConst);
+	h.Float(op.mFloatConst);
+	h.Int(op.mOperandSize);
+	h.Int(op.mStride);
+	h.Int(op.mRestricted);
+	h.Int(op.mMemory);
+	h.Int(op.mMemoryBase);
+	h.Int(op.mRange.mMinState);
+	h.Int(op.mRange.mMaxState);
+	if (op.mRange.mMinState >= IntegerValueRange::S_WEAK)
+		h.Int(op.mRange.mMinValue);
+	if (op.mRange.mMaxState >= IntegerValueRange::S_WEAK)
+		h.Int(op.mRange.mMaxValue);
+	h.Int(op.mRange.mMinExpanded);
+	h.Int(op.mRange.mMaxExpanded);
+
+	if (op.mLinkerObject)
+		h.Int(objects.IndexOrPush(op.mLinkerObject));
+	else
+		h.Int(op.mVarIndex);
+}
+
+static void HashVariable(CacheHash& h, const InterVariable* var, ExpandingArray<LinkerObject*>& objects)
+{
+	if (var)
+	{
+		h.Int(var->mUsed);
+		h.Int(var->mAliased);
+		h.Int(var->mTemp);
+		h.Int(var->mNotAliased);
+		h.Int(var->mSingleAssigned);
+		h.Int(var->mAssigned);
+		h.Int(var->mSize);
+		h.Int(var->mOffset);
+		h.Int(var->mAlignment);
+		h.Int(var->mTempIndex);
+		if (var->mLinkerObject)
+		{
+			h.Int(objects.IndexOrPush(var->mLinkerObject));
+		}
+		else
+			h.Int(var->mIndex);
+	}
+	else
+		h.Int(-1);
+}
+
+uint64 CompilationCache::ProcedureBody(TaskInfo* info)
+{
+	InterCodeProcedure* proc = info->mProc;
+
+	CacheHash	h;
+
+	info->mObjects.Push(proc->mLinkerObject);
+
+	h.String(proc->mIdent ? proc->mIdent->mString : nullptr);
+	h.Int(proc->mCompilerOptions & ~CacheIgnoredOptions);
+	h.Int(proc->mReturnType);
+	h.Int(proc->mLeafProcedure);
+	h.Int(proc->mNativeProcedure);
+	h.Int(proc->mCallsFunctionPointer);
+	h.Int(proc->mHasDynamicStack);
+	h.Int(proc->mHasInlineAssembler);
+	h.Int(proc->mCallsByteCode);
+	h.Int(proc->mFastCallProcedure);
+	h.Int(proc->mInterrupt);
+	h.Int(proc->mHardwareInterrupt);
+	h.Int(proc->mInterruptCalled);
+	h.Int(proc->mValueReturn);
+	h.Int(proc->mDynamicStack);
+	h.Int(proc->mDispatchedCall);
+	h.Int(proc->mCheckUnreachable);
+	h.Int(proc->mIntrinsicFunction);
+	h.Int(proc->mCheapInline);
+	h.Int(proc->mNoInline);
+	h.Int(proc->mLoadsIndirect);
+	h.Int(proc->mStoresIndirect);
+	h.Int(proc->mCommonFrameSize);
+	h.Int(proc->mFastCallBase);
+	h.Int(proc->mNumRestricted);
+	h.Int(proc->mLocalSize);
+	h.Int(proc->mNumLocals);
+	h.Int(proc->mNumParams);
+	h.Int(proc->mParamVarsSize);
+
+	if (proc->mSaveTempsLinkerObject)
+		h.Int(info->mObjects.IndexOrPush(proc->mSaveTempsLinkerObject));
+	else
+		h.Int(-1);
+
+	h.Int(proc->mTemporaries.Size());
+	for (int i = 0; i < proc->mTemporaries.Size(); i++)
+		h.Int(proc->mTemporaries[i]);
+
+	h.Int(proc->mParamVars.Size());
+	for (int i = 0; i < proc->mParamVars.Size(); i++)
+		HashVariable(h, proc->mParamVars[i], info->mObjects);
+	h.Int(proc->mLocalVars.Size());
+	for (int i = 0; i < proc->mLocalVars.Size(); i++)
+		HashVariable(h, proc->mLocalVars[i], info->mObjects);
+
+	h.Int(proc->mBlocks.Size());
+	for (int i = 0; i < proc->mBlocks.Size(); i++)
+	{
+		const InterCodeBasicBlock* block = proc->mBlocks[i];
+		if (block)
+		{
+			h.Int(block->mIndex);
+			h.Int(block->mNumEntries);
+			h.Int(block->mTrueJump ? block->mTrueJump->mIndex : -1);
+			h.Int(block->mFalseJump ? block->mFalseJump->mIndex : -1);
+			h.Int(block->mLoopHead);
+			h.Int(block->mEntryBlocks.Size());
+			for (int j = 0; j < block->mEntryBlocks.Size(); j++)
+				h.Int(block->mEntryBlocks[j] ? block->mEntryBlocks[j]->mIndex : -1);
+
+			h.Int(block->mInstructions.Size());
+			for (int j = 0; j < block->mInstructions.Size(); j++)
+			{
+				const InterInstruction* ins = block->mInstructions[j];
+				if (!ins)
+				{
+					h.Int(-1);
+					continue;
+				}
+
+				if (ins->mCode == IC_ASSEMBLER)
+					info->mCacheable = false;
+
+				h.Int(ins->mCode);
+				h.Int(ins->mOperator);
+				h.Int(ins->mNumOperands);
+				h.Int(ins->mInUse);
+				h.Int(ins->mInvariant);
+				h.Int(ins->mVolatile);
+				h.Int(ins->mSingleAssignment);
+				h.Int(ins->mNoSideEffects);
+				h.Int(ins->mConstExpr);
+				h.Int(ins->mAliasing);
+				h.Int(ins->mMemmap);
+				h.Int(ins->mLockOrder);
+
+				HashOperand(h, ins->mDst, info->mObjects);
+				HashOperand(h, ins->mConst, info->mObjects);
+				for (int k = 0; k < ins->mNumOperands; k++)
+					HashOperand(h, ins->mSrc[k], info->mObjects);
+			}
+		}
+		else
+			h.Int(-1);
+	}
+
+	for (int i = 0; i < proc->mCalledFunctions.Size(); i++)
+		info->mObjects.IndexOrPush(proc->mCalledFunctions[i]->mLinkerObject);
+
+	return h.mHash;
+}
+
+void CompilationCache::Prepare(Linker* linker, NativeCodeGenerator* generator, const ExpandingArray<InterCodeProcedure*>& order, const char* version)
+{
+	mLinker = linker;
+	mGenerator = generator;
+	mModule = order.Size() > 0 ? order[0]->mModule : nullptr;
+
+	// Linker objects are referenced by a hash of their name and type, with
+	// equally named objects numbered in order of creation
+
+	mObjects.SetSize(linker->mObjects.Size());
+	mNames.SetSize(linker->mObjects.Size());
+	for (int i = 0; i < linker->mObjects.Size(); i++)
+	{
+		ObjectInfo& oi(mObjects[i]);
+		oi.mName = ObjectName(linker->mObjects[i], oi.mUnique);
+		oi.mTask = -1;
+		mNames[i] = i;
+	}
+
+	mNames.Sort([this](int l, int r)->bool {
+		return mObjects[l].mName < mObjects[r].mName || (mObjects[l].mName == mObjects[r].mName && l < r);
+	});
+
+	int	i = 0;
+	while (i < mNames.Size())
+	{
+		int	j = i + 1;
+		while (j < mNames.Size() && mObjects[mNames[j]].mName == mObjects[mNames[i]].mName)
+			j++;
+		if (j > i + 1)
+		{
+			for (int k = i; k < j; k++)
+			{
+				CacheHash	h;
+				h.Int(mObjects[mNames[k]].mName);
+				h.Int(k - i);
+				mObjects[mNames[k]].mName = h.mHash;
+			}
+		}
+		i = j;
+	}
+
+	mNames.Sort([this](int l, int r)->bool {
+		return mObjects[l].mName < mObjects[r].mName;
+	});
+
+	for (int i = 0; i + 1 < mNames.Size(); i++)
+	{
+		if (mObjects[mNames[i]].mName == mObjects[mNames[i + 1]].mName)
+		{
+			mObjects[mNames[i]].mUnique = false;
+			mObjects[mNames[i + 1]].mUnique = false;
+		}
+	}
+
+	for (int i = 0; i < linker->mObjects.Size(); i++)
+		mObjects[i].mFacts = ObjectFacts(linker->mObjects[i]);
+
+	// Instructions referenced by native code are identified by the linker
+	// object of their procedure and their position
+
+	for (int i = 0; i < order.Size(); i++)
+	{
+		InterCodeProcedure* proc = order[i];
+		LinkerObject* lobj = proc->mLinkerObject;
+		if (lobj->mID >= 0 && lobj->mID < mObjects.Size() && linker->mObjects[lobj->mID] == lobj)
+		{
+			mObjects[lobj->mID].mTask = i;
+			for (int j = 0; j < proc->mBlocks.Size(); j++)
+			{
+				const InterCodeBasicBlock* block = proc->mBlocks[j];
+				if (block)
+				{
+					for (int k = 0; k < block->mInstructions.Size(); k++)
+					{
+						if (!block->mInstructions[k])
+							continue;
+
+						InstructionRef	ir;
+						ir.mIns = block->mInstructions[k];
+						ir.mObject = lobj->mID;
+						ir.mBlock = j;
+						ir.mIndex = k;
+						mInstructions.Push(ir);
+					}
+				}
+			}
+		}
+	}
+
+	mInstructions.Sort([](const InstructionRef& l, const InstructionRef& r)->bool {
+		return ptrdiff_t(l.mIns) < ptrdiff_t(r.mIns);
+	});
+
+	CacheHash	h;
+	h.Int(CacheFormat);
+	h.String(version);
+	h.Int(generator->mCompilerOptions & ~CacheIgnoredOptions);
+	h.Int(linker->mCompilerOptions & ~CacheIgnoredOptions);
+	h.Int(linker->mTargetMachine);
+	h.Int(generator->mRuntime.Size());
+	for (int i = 0; i < generator->mRuntime.Size(); i++)
+	{
+		const NativeCodeGenerator::Runtime& rt(generator->mRuntime[i]);
+		h.String(rt.mIdent ? rt.mIdent->mString : nullptr);
+		h.Int(rt.mOffset);
+		if (rt.mLinkerObject)
+		{
+			bool	unique;
+			h.Int(ObjectName(rt.mLinkerObject, unique));
+			h.Int(ObjectFacts(rt.mLinkerObject));
+		}
+		else
+			h.Int(0);
+	}
+	mGlobal = h.mHash;
+
+	for (int i = 0; i < order.Size(); i++)
+	{
+		TaskInfo* info = new TaskInfo();
+		info->mProc = order[i];
+		info->mKey = 0;
+		info->mInterface = 0;
+		info->mCacheable = order[i]->mNativeProcedure;
+		info->mDone = false;
+		info->mBody = ProcedureBody(info);
+
+		for (int j = 0; j < info->mObjects.Size(); j++)
+		{
+			LinkerObject* lobj = info->mObjects[j];
+			if (lobj->mID < 0 || lobj->mID >= mObjects.Size() || linker->mObjects[lobj->mID] != lobj || !mObjects[lobj->mID].mUnique)
+				info->mCacheable = false;
+		}
+
+		mTasks.Push(info);
+	}
+}
+
+void CompilationCache::AddDependencies(int task, ExpandingArray<int>& dependencies)
+{
+	const TaskInfo* info = mTasks[task];
+	for (int i = 0; i < info->mObjects.Size(); i++)
+	{
+		const LinkerObject* lobj = info->mObjects[i];
+		if (lobj->mID >= 0 && lobj->mID < mObjects.Size())
+		{
+			int	t = mObjects[lobj->mID].mTask;
+			if (t >= 0 && t < task && !dependencies.Contains(t))
+				dependencies.Push(t);
+		}
+	}
+}
+
+uint64 CompilationCache::ProcedureInterface(InterCodeProcedure* proc)
+{
+	const LinkerObject* lobj = proc->mLinkerObject;
+
+	CacheWriter	w(true);
+
+	w.Int(lobj->mType);
+	w.Int(lobj->mFlags);
+	for (int i = 0; i < 16; i++)
+	{
+		w.Int(lobj->mTemporaries[i]);
+		w.Int(lobj->mTempSizes[i]);
+	}
+	w.Int(lobj->mNumTemporaries);
+	for (int i = 0; i < 8; i++)
+		w.Int(lobj->mZeroPageSet.mBits[i]);
+
+	w.Int(proc->mCallerSavedTemps);
+	w.Int(proc->mFreeCallerSavedTemps);
+	w.Int(proc->mTempSize);
+	w.Int(proc->mFramePointer);
+	for (int i = 0; i < proc->mParamVars.Size(); i++)
+		w.Int(proc->mParamVars[i] ? proc->mParamVars[i]->mOffset : -1);
+
+	NativeCodeProcedure* nproc = lobj->mNativeProc;
+	if (nproc)
+	{
+		w.Int(nproc->mNoFrame);
+		w.Int(nproc->mSimpleInline);
+
+		// The code of simple procedures is inlined into the callers
+		if (nproc->mSimpleInline)
+		{
+			const NativeCodeBasicBlock* block = nproc->mEntryBlock->mTrueJump;
+			w.Int(block->mIns.Size());
+			for (int i = 0; i < block->mIns.Size(); i++)
+				WriteInstruction(w, block->mIns[i]);
+		}
+	}
+	else
+		w.Int(-1);
+
+	return w.mFailed ? 0 : w.Hash();
+}
+
+uint64 CompilationCache::TaskKey(int task)
+{
+	TaskInfo* info = mTasks[task];
+	InterCodeProcedure* proc = info->mProc;
+
+	CacheHash	h;
+	h.Int(mGlobal);
+	h.Int(info->mBody);
+
+	// Temporaries are placed by MapCallerSavedTemps depending on the callees
+
+	h.Int(proc->mTempSize);
+	h.Int(proc->mCallerSavedTemps);
+	h.Int(proc->mFreeCallerSavedTemps);
+	h.Int(proc->mTempOffset.Size());
+	for (int i = 0; i < proc->mTempOffset.Size(); i++)
+	{
+		h.Int(proc->mTempOffset[i]);
+		h.Int(proc->mTempSizes[i]);
+	}
+
+	for (int i = 0; i < info->mObjects.Size(); i++)
+	{
+		const LinkerObject* lobj = info->mObjects[i];
+		const ObjectInfo& oi(mObjects[lobj->mID]);
+
+		h.Int(oi.mName);
+		h.Int(oi.mFacts);
+		if (oi.mTask >= 0 && oi.mTask < task)
+			h.Int(mTasks[oi.mTask]->mInterface);
+	}
+
+	return h.mHash;
+}
+
+void CompilationCache::WriteObject(CacheWriter& w, const LinkerObject* obj) const
+{
+	if (!obj)
+		w.Int(-1);
+	else if (obj->mID < 0 || obj->mID >= mObjects.Size() || mLinker->mObjects[obj->mID] != obj || !mObjects[obj->mID].mUnique)
+		w.mFailed = true;
+	else if (w.mDigest)
+		w.Word(mObjects[obj->mID].mName);
+	else
+		w.Int(w.mObjects.IndexOrPush(mLinker->mObjects[obj->mID]));
+}
+
+void CompilationCache::WriteInstructionRef(CacheWriter& w, const InterInstruction* ins) const
+{
+	if (!ins)
+		w.Int(-1);
+	else
+	{
+		const InstructionRef* ref = FindInstructionRef(ins);
+		if (ref)
+		{
+			w.Int(ref->mBlock);
+			w.Int(ref->mIndex);
+			WriteObject(w, mLinker->mObjects[ref->mObject]);
+		}
+		else
+			w.mFailed = true;
+	}
+}
+
+void CompilationCache::WriteInstruction(CacheWriter& w, const NativeCodeInstruction& ins) const
+{
+	w.Int(ins.mType);
+	w.Int(ins.mMode);
+	w.Int(ins.mAddress);
+	w.Int(ins.mFlags);
+	w.Int(ins.mMinVal);
+	w.Int(ins.mMaxVal);
+	w.Int(ins.mParam);
+	w.Int(ins.mLive);
+	WriteObject(w, ins.mLinkerObject);
+	WriteInstructionRef(w, ins.mIns);
+}
+
+static void WriteNumberSet(CacheWriter& w, NumberSet& set)
+{
+	int	size = set.Size();
+	w.Int(size);
+	for (int i = 0; i < set.Words(); i++)
+		w.Word(set.Word(i));
+}
+
+static void ReadNumberSet(CacheReader& r, NumberSet& set)
+{
+	int64	size = r.Int();
+	if (size < 0 || size > 0x10000)
+		r.mFailed = true;
+	else
+	{
+		set.Reset(int(size));
+		for (int i = 0; i < size && !r.mFailed; i += 64)
+		{
+			uint64	bits = r.Word();
+			for (int j = i; j < size && j < i + 64; j++)
+			{
+				if (bits & (1ULL << (j - i)))
+					set += j;
+			}
+		}
+	}
+}
+
+void CompilationCache::WriteDataSet(CacheWriter& w, const NativeRegisterDataSet& set) const
+{
+	// Only the known register contents are kept
+
+	for (int i = 0; i < NUM_REGS; i++)
+	{
+		const NativeRegisterData& d(set[i]);
+		if (d.mMode != NRDM_UNKNOWN || d.mMask)
+		{
+			w.Int(i);
+			w.Int(d.mMode);
+			w.Int(d.mValue);
+			w.Int(d.mFlags);
+			w.Int(d.mMinVal);
+			w.Int(d.mMaxVal);
+			w.Int(d.mMask);
+			WriteObject(w, d.mMode != NRDM_UNKNOWN ? d.mLinkerObject : nullptr);
+		}
+	}
+	w.Int(-1);
+}
+
+void CompilationCache::ReadDataSet(CacheReader& r, const ExpandingArray<LinkerObject*>& objects, NativeRegisterDataSet& set) const
+{
+	for (;;)
+	{
+		int	i = r.Index(NUM_REGS);
+		if (i < 0 || r.mFailed)
+			break;
+
+		NativeRegisterData	d;
+		d.mMode = NativeRegisterDataMode(r.Int());
+		d.mValue = int(r.Int());
+		d.mFlags = uint32(r.Int());
+		d.mMinVal = uint8(r.Int());
+		d.mMaxVal = uint8(r.Int());
+		d.mMask = uint8(r.Int());
+		d.mLinkerObject = ReadObject(r, objects);
+		if (d.mMode != NRDM_UNKNOWN)
+			d.mUnique = d.mValue;
+		set.Set(i, d);
+	}
+}
+
+static void WriteBlockRef(CacheWriter& w, NativeCodeBasicBlock* block, ExpandingArray<NativeCodeBasicBlock*>& blocks)
+{
+	if (block)
+		w.Int(blocks.IndexOrPush(block));
+	else
+		w.Int(-1);
+}
+
+static NativeCodeBasicBlock* ReadBlockRef(CacheReader& r, const ExpandingArray<NativeCodeBasicBlock*>& blocks)
+{
+	int	i = r.Index(blocks.Size());
+	return i >= 0 ? blocks[i] : nullptr;
+}
+
+bool CompilationCache::WriteProcedure(CacheWriter& w, TaskInfo* info, NativeCodeProcedure* proc) const
+{
+	InterCodeProcedure* iproc = proc->mInterProc;
+	const LinkerObject* lobj = proc->mLinkerObject;
+
+	if (proc->mRelocations.Size() || proc->mCodeLocations.Size() || proc->mCodeOrigins.Size() || proc->mSelfModSources.Size() || proc->mTableViews.Size())
+		return false;
+
+	// All blocks reachable from the procedure, blocks are numbered in
+	// order of first appearance
+
+	ExpandingArray<NativeCodeBasicBlock*>	blocks;
+	for (int i = 0; i < proc->mBlocks.Size(); i++)
+	{
+		if (proc->mBlocks[i])
+			blocks.IndexOrPush(proc->mBlocks[i]);
+	}
+	blocks.IndexOrPush(proc->mEntryBlock);
+	blocks.IndexOrPush(proc->mExitBlock);
+
+	CacheWriter	bw(false);
+	bw.mObjects = w.mObjects;
+
+	for (int i = 0; i < blocks.Size(); i++)
+	{
+		NativeCodeBasicBlock* block = blocks[i];
+
+		if (block->mProc != proc || block->mCode.Size() || block->mRelocations.Size() || block->mCodeLocations.Size() || block->mCodeOrigins.Size())
+			return false;
+
+		bw.Int(block->mIndex);
+		bw.Int(block->mBranch);
+		WriteInstructionRef(bw, block->mBranchIns);
+
+		WriteBlockRef(bw, block->mTrueJump, blocks);
+		WriteBlockRef(bw, block->mFalseJump, blocks);
+		WriteBlockRef(bw, block->mFromJump, blocks);
+		WriteBlockRef(bw, block->mDominator, blocks);
+		WriteBlockRef(bw, block->mSameBlock, blocks);
+		WriteBlockRef(bw, block->mLoopHeadBlock, blocks);
+		WriteBlockRef(bw, block->mLoopTailBlock, blocks);
+
+		bw.Int(block->mEntryBlocks.Size());
+		for (int j = 0; j < block->mEntryBlocks.Size(); j++)
+			WriteBlockRef(bw, block->mEntryBlocks[j], blocks);
+
+		bw.Int(block->mOffset);
+		bw.Int(block->mSize);
+		bw.Int(block->mPlace);
+		bw.Int(block->mNumEntries);
+		bw.Int(block->mNumEntered);
+		bw.Int(block->mFrameOffset);
+		bw.Int(block->mTemp);
+		bw.Int(block->mAsmFromJump);
+		bw.Int(block->mYReg);
+		bw.Int(block->mYOffset);
+		bw.Int(block->mYValue);
+		bw.Int(block->mXReg);
+		bw.Int(block->mXOffset);
+		bw.Int(block->mXValue);
+
+		const bool	flags[] = {
+			block->mPlaced, block->mCopied, block->mKnownShortBranch, block->mBypassed, block->mAssembled, block->mNoFrame, block->mVisited, block->mLoopHead,
+			block->mVisiting, block->mLocked, block->mPatched, block->mPatchFail, block->mPatchChecked, block->mPatchUsed, block->mPatchStart, block->mPatchLoop,
+			block->mPatchLoopChanged, block->mPatchExit, block->mEntryRegA, block->mEntryRegX, block->mEntryRegY, block->mExitRegA, block->mExitRegX, block->mChecked,
+			block->mSameAX, block->mSameAY
+		};
+
+		int64	bits = 0;
+		for (int j = 0; j < int(sizeof(flags) / sizeof(flags[0])); j++)
+			if (flags[j])
+				bits |= 1LL << j;
+		bw.Int(bits);
+
+		bw.Int(block->mIns.Size());
+		for (int j = 0; j < block->mIns.Size(); j++)
+			WriteInstruction(bw, block->mIns[j]);
+
+		WriteNumberSet(bw, block->mLocalRequiredRegs);
+		WriteNumberSet(bw, block->mLocalProvidedRegs);
+		WriteNumberSet(bw, block->mEntryRequiredRegs);
+		WriteNumberSet(bw, block->mEntryProvidedRegs);
+		WriteNumberSet(bw, block->mExitRequiredRegs);
+		WriteNumberSet(bw, block->mExitProvidedRegs);
+		WriteNumberSet(bw, block->mNewRequiredRegs);
+		WriteNumberSet(bw, block->mTempRegs);
+
+		WriteDataSet(bw, block->mDataSet);
+		WriteDataSet(bw, block->mNDataSet);
+		WriteDataSet(bw, block->mFDataSet);
+	}
+
+	// Procedure state and the changes to the intermediate code and the
+	// linker objects done by code generation
+
+	w.mObjects = bw.mObjects;
+
+	w.Int(blocks.Size());
+	w.Int(proc->mBlocks.Size());
+	for (int i = 0; i < proc->mBlocks.Size(); i++)
+		WriteBlockRef(w, proc->mBlocks[i], blocks);
+	w.Int(blocks.IndexOf(proc->mEntryBlock));
+	w.Int(blocks.IndexOf(proc->mExitBlock));
+
+	w.Int(proc->mNoFrame);
+	w.Int(proc->mSimpleInline);
+	w.Int(proc->mFrameOffset);
+	w.Int(proc->mStackExpand);
+	w.Int(proc->mFastCallBase);
+	w.Int(proc->mTempBlocks);
+
+	w.Int(lobj->mType);
+	w.Int(lobj->mFlags);
+	for (int i = 0; i < 16; i++)
+	{
+		w.Int(lobj->mTemporaries[i]);
+		w.Int(lobj->mTempSizes[i]);
+	}
+	w.Int(lobj->mNumTemporaries);
+	for (int i = 0; i < 8; i++)
+		w.Int(lobj->mZeroPageSet.mBits[i]);
+
+	w.Int(iproc->mFramePointer);
+	w.Int(iproc->mCallerSavedTemps);
+	w.Int(iproc->mFreeCallerSavedTemps);
+	w.Int(iproc->mTempSize);
+	w.Int(iproc->mTempOffset.Size());
+	for (int i = 0; i < iproc->mTempOffset.Size(); i++)
+	{
+		w.Int(iproc->mTempOffset[i]);
+		w.Int(iproc->mTempSizes[i]);
+	}
+	w.Int(iproc->mParamVars.Size());
+	for (int i = 0; i < iproc->mParamVars.Size(); i++)
+		w.Int(iproc->mParamVars[i] ? iproc->mParamVars[i]->mOffset : 0);
+	w.Int(iproc->mLocalVars.Size());
+	for (int i = 0; i < iproc->mLocalVars.Size(); i++)
+		w.Int(iproc->mLocalVars[i] ? iproc->mLocalVars[i]->mOffset : 0);
+
+	// Flags set on referenced objects, e.g. used local static variables
+
+	for (int i = 1; i < info->mObjects.Size(); i++)
+	{
+		uint32	flags = info->mObjects[i]->mFlags & ~info->mFlags[i];
+		if (flags)
+		{
+			w.Int(i);
+			w.Int(flags);
+		}
+	}
+	w.Int(-1);
+
+	for (int i = 0; i < bw.mData.Size(); i++)
+		w.mData.Push(bw.mData[i]);
+
+	return !bw.mFailed && !w.mFailed;
+}
+
+LinkerObject* CompilationCache::ReadObject(CacheReader& r, const ExpandingArray<LinkerObject*>& objects) const
+{
+	int	i = r.Index(objects.Size());
+	return i >= 0 ? objects[i] : nullptr;
+}
+
+const InterInstruction* CompilationCache::ReadInstructionRef(CacheReader& r, const ExpandingArray<LinkerObject*>& objects) const
+{
+	int	block = int(r.Int());
+	if (block < 0)
+		return nullptr;
+
+	int	index = int(r.Int());
+	LinkerObject* lobj = ReadObject(r, objects);
+	if (lobj)
+	{
+		const InterInstruction* ins = FindInstruction(lobj->mID, block, index);
+		if (ins)
+			return ins;
+	}
+
+	r.mFailed = true;
+	return nullptr;
+}
+
+void CompilationCache::ReadInstruction(CacheReader& r, const ExpandingArray<LinkerObject*>& objects, NativeCodeInstruction& ins) const
+{
+	int	type = int(r.Int());
+	int	mode = int(r.Int());
+	if (type < 0 || type >= NUM_ASM_INS_TYPES || mode < 0 || mode >= NUM_ASM_INS_MODES_X)
+		r.mFailed = true;
+
+	ins.mType = AsmInsType(type);
+	ins.mMode = AsmInsMode(mode);
+	ins.mAddress = int(r.Int());
+	ins.mFlags = uint32(r.Int());
+	ins.mMinVal = uint8(r.Int());
+	ins.mMaxVal = uint8(r.Int());
+	ins.mParam = uint8(r.Int());
+	ins.mLive = uint8(r.Int());
+	ins.mLinkerObject = ReadObject(r, objects);
+	ins.mIns = ReadInstructionRef(r, objects);
+}
+
+NativeCodeProcedure* CompilationCache::ReadProcedure(CacheReader& r, TaskInfo* info) const
+{
+	InterCodeProcedure* iproc = info->mProc;
+
+	// Resolve the object table by name
+
+	ExpandingArray<LinkerObject*>	objects;
+	int	numObjects = r.Index(0x100000);
+	for (int i = 0; i < numObjects && !r.mFailed; i++)
+	{
+		int	k = FindObject(r.Word());
+		if (k >= 0 && mObjects[k].mUnique)
+			objects.Push(mLinker->mObjects[k]);
+		else
+			r.mFailed = true;
+	}
+
+	if (r.mFailed)
+		return nullptr;
+
+	NativeCodeProcedure* proc = new NativeCodeProcedure(mGenerator);
+	proc->mInterProc = iproc;
+	proc->mLinkerObject = iproc->mLinkerObject;
+	proc->mIdent = iproc->mIdent;
+	proc->mLocation = iproc->mLocation;
+	proc->mCompilerOptions = iproc->mCompilerOptions;
+	proc->mIndex = iproc->mID;
+
+	MemoryArenaScope	scope(&proc->mArena);
+
+	ExpandingArray<NativeCodeBasicBlock*>	blocks;
+	int	numBlocks = r.Index(0x100000);
+	for (int i = 0; i < numBlocks; i++)
+		blocks.Push(new NativeCodeBasicBlock(proc));
+
+	int	numList = r.Index(0x100000);
+	for (int i = 0; i < numList && !r.mFailed; i++)
+		proc->mBlocks.Push(ReadBlockRef(r, blocks));
+	proc->mEntryBlock = ReadBlockRef(r, blocks);
+	proc->mExitBlock = ReadBlockRef(r, blocks);
+
+	proc->mNoFrame = r.Int() != 0;
+	proc->mSimpleInline = r.Int() != 0;
+	proc->mFrameOffset = int(r.Int());
+	proc->mStackExpand = int(r.Int());
+	proc->mFastCallBase = int(r.Int());
+	proc->mTempBlocks = int(r.Int());
+
+	int		type = int(r.Int());
+	uint32	flags = uint32(r.Int());
+	uint8	temporaries[16], tempSizes[16];
+	for (int i = 0; i < 16; i++)
+	{
+		temporaries[i] = uint8(r.Int());
+		tempSizes[i] = uint8(r.Int());
+	}
+	int		numTemporaries = int(r.Int());
+	ZeroPageSet	zeroPageSet;
+	for (int i = 0; i < 8; i++)
+		zeroPageSet.mBits[i] = uint32(r.Int());
+
+	bool	framePointer = r.Int() != 0;
+	int		callerSavedTemps = int(r.Int());
+	int		freeCallerSavedTemps = int(r.Int());
+	int		tempSize = int(r.Int());
+
+	GrowingIntArray	tempOffset(0), tempSizesArray(0);
+	if (r.Int() != iproc->mTempOffset.Size())
+		r.mFailed = true;
+	for (int i = 0; i < iproc->mTempOffset.Size() && !r.mFailed; i++)
+	{
+		tempOffset[i] = int(r.Int());
+		tempSizesArray[i] = int(r.Int());
+	}
+
+	GrowingIntArray	paramOffsets(0), localOffsets(0);
+	if (r.Int() != iproc->mParamVars.Size())
+		r.mFailed = true;
+	for (int i = 0; i < iproc->mParamVars.Size() && !r.mFailed; i++)
+		paramOffsets[i] = int(r.Int());
+	if (r.Int() != iproc->mLocalVars.Size())
+		r.mFailed = true;
+	for (int i = 0; i < iproc->mLocalVars.Size() && !r.mFailed; i++)
+		localOffsets[i] = int(r.Int());
+
+	ExpandingArray<int>		deltaObjects;
+	ExpandingArray<uint32>	deltaFlags;
+	for (;;)
+	{
+		int	i = r.Index(info->mObjects.Size());
+		if (i < 0 || r.mFailed)
+			break;
+		deltaObjects.Push(i);
+		deltaFlags.Push(uint32(r.Int()));
+	}
+
+	for (int i = 0; i < numBlocks && !r.mFailed; i++)
+	{
+		NativeCodeBasicBlock* block = blocks[i];
+
+		block->mIndex = int(r.Int());
+		int	branch = int(r.Int());
+		if (branch < 0 || branch >= NUM_ASM_INS_TYPES)
+			r.mFailed = true;
+		block->mBranch = AsmInsType(branch);
+		block->mBranchIns = ReadInstructionRef(r, objects);
+
+		block->mTrueJump = ReadBlockRef(r, blocks);
+		block->mFalseJump = ReadBlockRef(r, blocks);
+		block->mFromJump = ReadBlockRef(r, blocks);
+		block->mDominator = ReadBlockRef(r, blocks);
+		block->mSameBlock = ReadBlockRef(r, blocks);
+		block->mLoopHeadBlock = ReadBlockRef(r, blocks);
+		block->mLoopTailBlock = ReadBlockRef(r, blocks);
+
+		int	numEntries = r.Index(0x100000);
+		for (int j = 0; j < numEntries && !r.mFailed; j++)
+			block->mEntryBlocks.Push(ReadBlockRef(r, blocks));
+
+		block->mOffset = int(r.Int());
+		block->mSize = int(r.Int());
+		block->mPlace = int(r.Int());
+		block->mNumEntries = int(r.Int());
+		block->mNumEntered = int(r.Int());
+		block->mFrameOffset = int(r.Int());
+		block->mTemp = int(r.Int());
+		block->mAsmFromJump = int(r.Int());
+		block->mYReg = int(r.Int());
+		block->mYOffset = int(r.Int());
+		block->mYValue = int(r.Int());
+		block->mXReg = int(r.Int());
+		block->mXOffset = int(r.Int());
+		block->mXValue = int(r.Int());
+
+		bool* const	flags[] = {
+			&block->mPlaced, &block->mCopied, &block->mKnownShortBranch, &block->mBypassed, &block->mAssembled, &block->mNoFrame, &block->mVisited, &block->mLoopHead,
+			&block->mVisiting, &block->mLocked, &block->mPatched, &block->mPatchFail, &block->mPatchChecked, &block->mPatchUsed, &block->mPatchStart, &block->mPatchLoop,
+			&block->mPatchLoopChanged, &block->mPatchExit, &block->mEntryRegA, &block->mEntryRegX, &block->mEntryRegY, &block->mExitRegA, &block->mExitRegX, &block->mChecked,
+			&block->mSameAX, &block->mSameAY
+		};
+
+		int64	bits = r.Int();
+		for (int j = 0; j < int(sizeof(flags) / sizeof(flags[0])); j++)
+			*flags[j] = (bits & (1LL << j)) != 0;
+
+		int	numIns = r.Index(0x100000);
+		block->mIns.SetSize(numIns > 0 ? numIns : 0);
+		for (int j = 0; j < numIns && !r.mFailed; j++)
+			ReadInstruction(r, objects, block->mIns[j]);
+
+		ReadNumberSet(r, block->mLocalRequiredRegs);
+		ReadNumberSet(r, block->mLocalProvidedRegs);
+		ReadNumberSet(r, block->mEntryRequiredRegs);
+		ReadNumberSet(r, block->mEntryProvidedRegs);
+		ReadNumberSet(r, block->mExitRequiredRegs);
+		ReadNumberSet(r, block->mExitProvidedRegs);
+		ReadNumberSet(r, block->mNewRequiredRegs);
+		ReadNumberSet(r, block->mTempRegs);
+
+		ReadDataSet(r, objects, block->mDataSet);
+		ReadDataSet(r, objects, block->mNDataSet);
+		ReadDataSet(r, objects, block->mFDataSet);
+	}
+
+	if (r.mFailed || r.mPos != r.mSize || !proc->mEntryBlock || !proc->mExitBlock || (proc->mSimpleInline && !proc->mEntryBlock->mTrueJump))
+	{
+		for (int i = 0; i < blocks.Size(); i++)
+			delete blocks[i];
+		delete proc;
+		return nullptr;
+	}
+
+	// The entry is valid, replay the side effects of code generation
+
+	LinkerObject* lobj = iproc->mLinkerObject;
+	lobj->mType = LinkerObjectType(type);
+	lobj->mFlags = flags;
+	memcpy(lobj->mTemporaries, temporaries, 16);
+	memcpy(lobj->mTempSizes, tempSizes, 16);
+	lobj->mNumTemporaries = numTemporaries;
+	lobj->mZeroPageSet = zeroPageSet;
+	lobj->mNativeProc = proc;
+
+	for (int i = 0; i < deltaObjects.Size(); i++)
+		info->mObjects[deltaObjects[i]]->mFlags |= deltaFlags[i];
+
+	iproc->mFramePointer = framePointer;
+	iproc->mCallerSavedTemps = callerSavedTemps;
+	iproc->mFreeCallerSavedTemps = freeCallerSavedTemps;
+	iproc->mTempSize = tempSize;
+	for (int i = 0; i < iproc->mTempOffset.Size(); i++)
+	{
+		iproc->mTempOffset[i] = tempOffset[i];
+		iproc->mTempSizes[i] = tempSizesArray[i];
+	}
+	for (int i = 0; i < iproc->mParamVars.Size(); i++)
+	{
+		if (iproc->mParamVars[i])
+			iproc->mParamVars[i]->mOffset = paramOffsets[i];
+	}
+	for (int i = 0; i < iproc->mLocalVars.Size(); i++)
+	{
+		if (iproc->mLocalVars[i])
+			iproc->mLocalVars[i]->mOffset = localOffsets[i];
+	}
+
+	return proc;
+}
+
+NativeCodeProcedure* CompilationCache::Load(int task)
+{
+	TaskInfo* info = mTasks[task];
+
+	info->mFlags.SetSize(info->mObjects.Size());
+	for (int i = 0; i < info->mObjects.Size(); i++)
+		info->mFlags[i] = info->mObjects[i]->mFlags;
+
+	// The results of all referenced procedures compiled before must be known
+
+	for (int i = 0; i < info->mObjects.Size() && info->mCacheable; i++)
+	{
+		int	t = mObjects[info->mObjects[i]->mID].mTask;
+		if (t >= 0 && t < task && !mTasks[t]->mInterface)
+			info->mCacheable = false;
+	}
+
+	if (!info->mCacheable)
+		return nullptr;
+
+	info->mKey = TaskKey(task);
+
+	char	path[240];
+	EntryPath(path, info->mKey);
+
+	NativeCodeProcedure* proc = nullptr;
+
+	FILE* file;
+	if (fopen_s(&file, path, "rb") == 0)
+	{
+		fseek(file, 0, SEEK_END);
+		int	size = int(ftell(file));
+		fseek(file, 0, SEEK_SET);
+
+		if (size >= 32)
+		{
+			uint8* data = new uint8[size];
+			if (int(fread(data, 1, size, file)) == size)
+			{
+				CacheReader	r(data, size);
+
+				bool	valid = memcmp(data, "OSC64NCC", 8) == 0;
+				r.mPos = 8;
+
+				if (valid && r.Word() == info->mKey && r.Word() == uint64(size - 32))
+				{
+					CacheHash	h;
+					for (int i = 24; i < size - 8; i++)
+						h.Byte(data[i]);
+
+					CacheReader	cr(data + size - 8, 8);
+					if (cr.Word() == h.mHash)
+					{
+						CacheReader	pr(data + 24, size - 32);
+						proc = ReadProcedure(pr, info);
+					}
+				}
+			}
+			delete[] data;
+		}
+
+		fclose(file);
+	}
+
+	ThreadLock	lock(mMutex);
+	if (proc)
+		mHits++;
+	else
+		mMisses++;
+
+	return proc;
+}
+
+void CompilationCache::Store(int task, NativeCodeProcedure* proc, bool cacheable)
+{
+	TaskInfo* info = mTasks[task];
+
+	if (!cacheable || !info->mCacheable)
+		return;
+
+	CacheWriter	w(false);
+	if (!WriteProcedure(w, info, proc))
+		return;
+
+	CacheWriter	f(false);
+	f.Int(w.mObjects.Size());
+	for (int i = 0; i < w.mObjects.Size(); i++)
+		f.Word(mObjects[w.mObjects[i]->mID].mName);
+	for (int i = 0; i < w.mData.Size(); i++)
+		f.mData.Push(w.mData[i]);
+
+	uint64	hash = f.Hash();
+
+	char	path[240], tpath[280];
+	EntryPath(path, info->mKey);
+
+	// Write to a temporary file first, so concurrent builds never see a
+	// partial entry
+
+#ifdef _WIN32
+	sprintf_s(tpath, "%s.%d.%d.tmp", path, _getpid(), task);
+#else
+	sprintf_s(tpath, "%s.%d.%d.tmp", path, int(getpid()), task);
+#endif
+
+	FILE* file;
+	if (fopen_s(&file, tpath, "wb") == 0)
+	{
+		CacheWriter	h(false);
+		h.Word(info->mKey);
+		h.Word(uint64(f.mData.Size()));
+
+		bool	ok =
+			fwrite("OSC64NCC", 1, 8, file) == 8 &&
+			fwrite(&(h.mData[0]), 1, 16, file) == 16 &&
+			int(fwrite(&(f.mData[0]), 1, f.mData.Size(), file)) == f.mData.Size();
+
+		CacheWriter	c(false);
+		c.Word(hash);
+		ok = fwrite(&(c.mData[0]), 1, 8, file) == 8 && ok;
+
+		if (fclose(file) == 0 && ok)
+		{
+#ifdef _WIN32
+			remove(path);
+#endif
+			if (rename(tpath, path) == 0)
+			{
+				ThreadLock	lock(mMutex);
+				mStores++;
+				return;
+			}
+		}
+
+		remove(tpath);
+	}
+}
+
+void CompilationCache::Complete(int task)
+{
+	TaskInfo* info = mTasks[task];
+
+	info->mInterface = ProcedureInterface(info->mProc);
+	info->mDone = true;
+}
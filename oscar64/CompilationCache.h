@@ -0,0 +1,95 @@
+#pragma once
+
+#include "NativeCodeGenerator.h"
+#include "ThreadPool.h"
+
+class CacheWriter;
+class CacheReader;
+
+// Persistent on disk cache of generated native code.  A procedure is keyed
+// by a hash of its final intermediate code, the compiler options and the
+// properties of all linker objects it references.  A hit replaces code
+// generation and optimization of the procedure, assembly and linking are
+// still done for every build.
+
+class CompilationCache
+{
+public:
+	CompilationCache(const char* path);
+	~CompilationCache(void);
+
+	int		mHits, mMisses, mStores;
+
+	bool Open(Errors* errors);
+
+	// Collect the facts about all linker objects and procedures before the
+	// first task is started, the procedures are given in task order
+	void Prepare(Linker* linker, NativeCodeGenerator* generator, const ExpandingArray<InterCodeProcedure*>& order, const char* version);
+
+	// The key of a task includes the results of all referenced procedures
+	// compiled before it, so they have to be completed first
+	void AddDependencies(int task, ExpandingArray<int>& dependencies);
+
+	// Called after MapCallerSavedTemps of the procedure
+	NativeCodeProcedure* Load(int task);
+	void Store(int task, NativeCodeProcedure* proc, bool cacheable);
+	void Complete(int task);
+
+protected:
+	struct ObjectInfo
+	{
+		uint64		mName, mFacts;
+		int			mTask;
+		bool		mUnique;
+	};
+
+	struct InstructionRef
+	{
+		const InterInstruction	*	mIns;
+		int							mObject, mBlock, mIndex;
+	};
+
+	struct TaskInfo
+	{
+		InterCodeProcedure			*	mProc;
+		uint64							mBody, mKey, mInterface;
+		bool							mCacheable, mDone;
+		ExpandingArray<LinkerObject*>	mObjects;
+		ExpandingArray<uint32>			mFlags;
+	};
+
+	char								mPath[200];
+	Linker							*	mLinker;
+	NativeCodeGenerator				*	mGenerator;
+	InterCodeModule					*	mModule;
+	uint64								mGlobal;
+	ExpandingArray<ObjectInfo>			mObjects;
+	ExpandingArray<int>					mNames;
+	ExpandingArray<InstructionRef>		mInstructions;
+	ExpandingArray<TaskInfo*>			mTasks;
+	ThreadMutex							mMutex;
+
+	int FindObject(uint64 name) const;
+	const InterInstruction* FindInstruction(int object, int block, int index) const;
+	const InstructionRef* FindInstructionRef(const InterInstruction* ins) const;
+
+	uint64 ObjectName(const LinkerObject* obj, bool& unique) const;
+	uint64 ObjectFacts(const LinkerObject* obj) const;
+	uint64 ProcedureBody(TaskInfo* info);
+	uint64 ProcedureInterface(InterCodeProcedure* proc);
+	uint64 TaskKey(int task);
+
+	void WriteObject(CacheWriter& w, const LinkerObject* obj) const;
+	void WriteInstructionRef(CacheWriter& w, const InterInstruction* ins) const;
+	void WriteInstruction(CacheWriter& w, const NativeCodeInstruction& ins) const;
+	void WriteDataSet(CacheWriter& w, const NativeRegisterDataSet& set) const;
+	bool WriteProcedure(CacheWriter& w, TaskInfo* info, NativeCodeProcedure* proc) const;
+
+	LinkerObject* ReadObject(CacheReader& r, const ExpandingArray<LinkerObject*>& objects) const;
+	const InterInstruction* ReadInstructionRef(CacheReader& r, const ExpandingArray<LinkerObject*>& objects) const;
+	void ReadInstruction(CacheReader& r, const ExpandingArray<LinkerObject*>& objects, NativeCodeInstruction& ins) const;
+	void ReadDataSet(CacheReader& r, const ExpandingArray<LinkerObject*>& objects, NativeRegisterDataSet& set) const;
+	NativeCodeProcedure* ReadProcedure(CacheReader& r, TaskInfo* info) const;
+
+	void EntryPath(char* path, uint64 key) const;
+};
@@ -7,9 +7,10 @@
 #include "NativeCodeGenerator.h"
 #include "Emulator.h"
 #include <stdio.h>
+#include <limits.h>
 
 Compiler::Compiler(void)
-	: mByteCodeFunctions(nullptr), mCompilerOptions(COPT_DEFAULT), mDefines({nullptr, nullptr})
+	: mByteCodeFunctions(nullptr), mCompilerOptions(COPT_DEFAULT), mThreads(1), mDefines({nullptr, nullptr})
 {
 	mErrors = new Errors();
 	mLinker = new Linker(mErrors);
@@ -34,15 +35,39 @@ Compiler::Compiler(void)
 	mInterCodeModule = new InterCodeModule(mErrors, mLinker);
 	mGlobalAnalyzer = new GlobalAnalyzer(mErrors, mLinker);
 	mGlobalOptimizer = new GlobalOptimizer(mErrors, mLinker);
+	mCache = nullptr;
+	mTimeReport = nullptr;
+	mEmulationCycles = 0;
+	mOutput = stdout;
+	mSharedZeroPage = false;
 
 	mCartridgeID = 0x0000;
 	mCartridgeSubType = 0x00;
 	strcpy_s(mCartridgeName, "OSCAR");
+
+	mSnapshotSave[0] = 0;
+	mSnapshotFrom[0] = 0;
+	mSnapshotAt[0] = 0;
+	mREUSize = 0;
 }
 
 Compiler::~Compiler(void)
 {
-
+	for (int i = 0; i < mNativeCodeGenerator->mProcedures.Size(); i++)
+		delete mNativeCodeGenerator->mProcedures[i];
+	for (int i = 0; i < mInterCodeModule->mProcedures.Size(); i++)
+		delete mInterCodeModule->mProcedures[i];
+
+	delete mGlobalOptimizer;
+	delete mGlobalAnalyzer;
+	delete mInterCodeModule;
+	delete mNativeCodeGenerator;
+	delete mInterCodeGenerator;
+	delete mByteCodeGenerator;
+	delete mPreprocessor;
+	delete mCompilationUnits;
+	delete mLinker;
+	delete mErrors;
 }
 
 void Compiler::AddDefine(const Ident* ident, const char* value)
@@ -54,9 +79,9 @@ void Compiler::AddDefine(const Ident* ident, const char* value)
 }
 
 
-bool Compiler::ParseSource(void)
+void Compiler::SetupZeroPage(TargetMachine machine, bool extended)
 {
-	if (mTargetMachine == TMACH_ATARI)
+	if (machine == TMACH_ATARI)
 	{
 		BC_REG_WORK_Y = 0x80;
 		BC_REG_WORK = 0x81;
@@ -72,7 +97,7 @@ bool Compiler::ParseSource(void)
 		BC_REG_TMP = 0xa5;
 		BC_REG_TMP_SAVED = 0xc5;
 	}
-	else if (mTargetMachine == TMACH_X16)
+	else if (machine == TMACH_X16)
 	{
 		BC_REG_WORK_Y = 0x22;
 		BC_REG_WORK = 0x23;
@@ -88,8 +113,10 @@ bool Compiler::ParseSource(void)
 		BC_REG_TMP = 0x47;
 		BC_REG_TMP_SAVED = 0x67;
 	}
-	else if (mCompilerOptions & COPT_EXTENDED_ZERO_PAGE)
+	else if (extended)
 	{
+		BC_REG_WORK_Y = 0x02;
+		BC_REG_WORK = 0x03;
 		BC_REG_FPARAMS = 0x0d;
 		BC_REG_FPARAMS_END = 0x25;
 
@@ -103,6 +130,28 @@ bool Compiler::ParseSource(void)
 		BC_REG_TMP_SAVED = 0x53;
 #endif
 	}
+	else
+	{
+		BC_REG_WORK_Y = 0x02;
+		BC_REG_WORK = 0x03;
+		BC_REG_FPARAMS = 0x0d;
+		BC_REG_FPARAMS_END = 0x19;
+
+		BC_REG_IP = 0x19;
+		BC_REG_ACCU = 0x1b;
+		BC_REG_ADDR = 0x1f;
+		BC_REG_STACK = 0x23;
+		BC_REG_LOCALS = 0x25;
+
+		BC_REG_TMP = 0x43;
+		BC_REG_TMP_SAVED = 0x53;
+	}
+}
+
+bool Compiler::ParseSource(void)
+{
+	if (!mSharedZeroPage)
+		SetupZeroPage(mTargetMachine, (mCompilerOptions & COPT_EXTENDED_ZERO_PAGE) != 0);
 
 	switch (mTargetMachine)
 	{
@@ -533,6 +582,7 @@ void Compiler::CompileProcedure(InterCodeProcedure* proc)
 				printf("Generate native code <%s>\n", proc->mIdent->mString);
 
 			ncproc->Compile(proc);
+			ncproc->RegisterFunctionCalls();
 			mNativeCodeGenerator->mProcedures.Push(ncproc);
 		}
 		else
@@ -548,6 +598,216 @@ void Compiler::CompileProcedure(InterCodeProcedure* proc)
 	}
 }
 
+static void OrderProcedure(InterCodeProcedure* proc, ExpandingArray<InterCodeProcedure*>& order, GrowingArray<int>& taskIndex)
+{
+	if (!proc->mCompiled)
+	{
+		proc->mCompiled = true;
+
+		for (int i = 0; i < proc->mCalledFunctions.Size(); i++)
+			OrderProcedure(proc->mCalledFunctions[i], order, taskIndex);
+
+		taskIndex[proc->mID] = order.Size();
+		order.Push(proc);
+	}
+}
+
+static void CollectAssemblerObjects(InterCodeProcedure* proc, ExpandingArray<LinkerObject*>& objects)
+{
+	if (proc->mBlocks.Size() == 0)
+		return;
+
+	ExpandingArray<InterCodeBasicBlock*>	blocks;
+	GrowingArray<bool>						visited(false);
+
+	visited[proc->mBlocks[0]->mIndex] = true;
+	blocks.Push(proc->mBlocks[0]);
+
+	while (blocks.Size() > 0)
+	{
+		InterCodeBasicBlock* block = blocks.Pop();
+
+		for (int i = 0; i < block->mInstructions.Size(); i++)
+		{
+			const InterInstruction* ins = block->mInstructions[i];
+			if (ins->mCode == IC_ASSEMBLER && ins->mNumOperands > 1 && !objects.Contains(ins->mSrc[0].mLinkerObject))
+				objects.Push(ins->mSrc[0].mLinkerObject);
+		}
+
+		if (block->mTrueJump && !visited[block->mTrueJump->mIndex])
+		{
+			visited[block->mTrueJump->mIndex] = true;
+			blocks.Push(block->mTrueJump);
+		}
+		if (block->mFalseJump && !visited[block->mFalseJump->mIndex])
+		{
+			visited[block->mFalseJump->mIndex] = true;
+			blocks.Push(block->mFalseJump);
+		}
+	}
+}
+
+void Compiler::CompileProceduresParallel(void)
+{
+	// Number the procedures in the order CompileProcedure would compile them,
+	// the results are collected in this order after all tasks are done
+
+	ExpandingArray<InterCodeProcedure*>	order;
+	GrowingArray<int>					taskIndex(-1);
+
+	for (int i = 0; i < mInterCodeModule->mProcedures.Size(); i++)
+		OrderProcedure(mInterCodeModule->mProcedures[i], order, taskIndex);
+
+	int	numTasks = order.Size();
+
+	// A procedure depends on all callees completed before it, callees that
+	// are still on the stack in a recursive call chain are compiled later
+
+	ExpandingArray<int>* dependencies = new ExpandingArray<int>[numTasks];
+
+	for (int i = 0; i < numTasks; i++)
+	{
+		InterCodeProcedure* proc = order[i];
+		for (int j = 0; j < proc->mCalledFunctions.Size(); j++)
+		{
+			int	k = taskIndex[proc->mCalledFunctions[j]->mID];
+			if (k < i)
+				dependencies[i].Push(k);
+		}
+	}
+
+	// Procedures patching the temporaries of the same inline assembler
+	// object are kept in serial order
+
+	ExpandingArray<LinkerObject*>	asmObjects;
+	ExpandingArray<int>				asmTasks;
+
+	for (int i = 0; i < numTasks; i++)
+	{
+		ExpandingArray<LinkerObject*>	objects;
+		CollectAssemblerObjects(order[i], objects);
+
+		for (int j = 0; j < objects.Size(); j++)
+		{
+			int	k = asmObjects.IndexOf(objects[j]);
+			if (k < 0)
+			{
+				asmObjects.Push(objects[j]);
+				asmTasks.Push(i);
+			}
+			else
+			{
+				dependencies[i].Push(asmTasks[k]);
+				asmTasks[k] = i;
+			}
+		}
+	}
+
+	if (mCache)
+	{
+		mCache->Prepare(mLinker, mNativeCodeGenerator, order, mVersion);
+		for (int i = 0; i < numTasks; i++)
+			mCache->AddDependencies(i, dependencies[i]);
+	}
+
+	NativeCodeProcedure	**	nprocs = new NativeCodeProcedure * [numTasks];
+	ByteCodeProcedure	**	bprocs = new ByteCodeProcedure * [numTasks];
+	LinkerQueue* objects = new LinkerQueue[numTasks];
+	ExpandingArray<ErrorMessage>* messages = new ExpandingArray<ErrorMessage>[numTasks];
+
+	ThreadPool	pool(mThreads);
+	ThreadMutex	byteCodeMutex;
+
+	mNativeCodeGenerator->mThreadPool = &pool;
+
+	pool.Run(numTasks, dependencies, [&](int task) {
+		InterCodeProcedure* proc = order[task];
+
+		nprocs[task] = nullptr;
+		bprocs[task] = nullptr;
+
+		LinkerQueue* pobjects = mLinker->DeferObjects(objects + task);
+		ExpandingArray<ErrorMessage>* pmessages = mErrors->DeferMessages(messages + task);
+
+		proc->MapCallerSavedTemps();
+
+		if (proc->mNativeProcedure)
+		{
+			NativeCodeProcedure* ncproc = mCache ? mCache->Load(task) : nullptr;
+			if (ncproc)
+			{
+				if (mCompilerOptions & COPT_VERBOSE2)
+					printf("Reuse native code <%s>\n", proc->mIdent->mString);
+
+				ncproc->mTaskIndex = task;
+				pool.Milestone(task);
+			}
+			else
+			{
+				ncproc = new NativeCodeProcedure(mNativeCodeGenerator);
+				if (mCompilerOptions & COPT_VERBOSE2)
+					printf("Generate native code <%s>\n", proc->mIdent->mString);
+
+				ncproc->mTaskIndex = task;
+				ncproc->Compile(proc);
+
+				// Procedures creating linker objects or reporting diagnostics
+				// are always compiled
+
+				if (mCache)
+					mCache->Store(task, ncproc, messages[task].Size() == 0 && objects[task].mObjects.Size() == 0 && objects[task].mSections.Size() == 0);
+			}
+			nprocs[task] = ncproc;
+		}
+		else
+		{
+			pool.Milestone(task);
+
+			ThreadLock	lock(byteCodeMutex);
+
+			ByteCodeProcedure* bgproc = new ByteCodeProcedure();
+
+			if (mCompilerOptions & COPT_VERBOSE2)
+				printf("Generate byte code <%s>\n", proc->mIdent->mString);
+
+			bgproc->Compile(mByteCodeGenerator, proc);
+			bprocs[task] = bgproc;
+		}
+
+		if (mCache)
+			mCache->Complete(task);
+
+		mErrors->DeferMessages(pmessages);
+		mLinker->DeferObjects(pobjects);
+	});
+
+	mNativeCodeGenerator->mThreadPool = nullptr;
+
+	if (mCache && (mCompilerOptions & COPT_VERBOSE))
+		printf("Compilation cache: %d hits, %d misses, %d stored\n", mCache->mHits, mCache->mMisses, mCache->mStores);
+
+	for (int i = 0; i < numTasks; i++)
+	{
+		mLinker->InsertDeferredObjects(objects[i]);
+		mErrors->FlushDeferredMessages(messages[i]);
+
+		if (nprocs[i])
+		{
+			nprocs[i]->ResolveTableViews();
+			nprocs[i]->RegisterFunctionCalls();
+			mNativeCodeGenerator->mProcedures.Push(nprocs[i]);
+		}
+		else
+			mByteCodeFunctions.Push(bprocs[i]);
+	}
+
+	delete[] nprocs;
+	delete[] bprocs;
+	delete[] objects;
+	delete[] messages;
+	delete[] dependencies;
+}
+
 bool Compiler::GenerateCode(void)
 {
 	Location	loc;
@@ -834,6 +1094,8 @@ bool Compiler::GenerateCode(void)
 				case TMACH_C64:
 					if (mCompilerOptions & (COPT_TARGET_CRT8 | COPT_TARGET_CRT16))
 						regionMain = mLinker->AddRegion(identMain, 0x0800, 0x8000);
+					else if (mCompilerOptions & COPT_TARGET_CRT_EASYFLASH)
+						regionMain = mLinker->AddRegion(identMain, 0x0900, 0x8000);
 					else
 						regionMain = mLinker->AddRegion(identMain, 0x0880, 0xa000);
 					break;
@@ -1010,6 +1272,7 @@ bool Compiler::GenerateCode(void)
 
 	mGlobalAnalyzer->CheckInterrupt();
 	mGlobalAnalyzer->MarkRecursions();
+	mGlobalAnalyzer->ApplyProfile();
 	mGlobalAnalyzer->AutoInline();
 	mGlobalAnalyzer->AutoZeroPage(mCompilationUnits->mSectionZeroPage, regionZeroPage->mEnd - regionZeroPage->mStart);
 	if (mCompilerOptions & COPT_VERBOSE3)
@@ -1019,6 +1282,9 @@ bool Compiler::GenerateCode(void)
 	mNativeCodeGenerator->mCompilerOptions = mCompilerOptions;
 	mInterCodeModule->mCompilerOptions = mCompilerOptions;
 
+	mInterCodeModule->mTimeReport = mTimeReport;
+	mNativeCodeGenerator->mTimeReport = mTimeReport;
+
 	if (mCompilerOptions & COPT_VERBOSE)
 		printf("Generate intermediate code\n");
 
@@ -1044,6 +1310,11 @@ bool Compiler::GenerateCode(void)
 
 	mInterCodeGenerator->CompleteMainInit(mInterCodeModule);
 
+	if (mCompilerOptions & COPT_VERBOSE)
+		printf("Optimize intermediate code\n");
+
+	mInterCodeModule->CloseDeferredProcedures(mThreads);
+
 	if (mErrors->mErrorCount != 0)
 		return false;
 
@@ -1136,6 +1407,9 @@ bool Compiler::GenerateCode(void)
 	if (mCompilerOptions & COPT_VERBOSE)
 		printf("Generate native code\n");
 
+	if (mThreads > 1 || mCache)
+		CompileProceduresParallel();
+
 	for (int i = 0; i < mInterCodeModule->mProcedures.Size(); i++)
 	{
 		InterCodeProcedure* proc = mInterCodeModule->mProcedures[i];
@@ -1164,6 +1438,7 @@ bool Compiler::GenerateCode(void)
 				printf("Assemble native code <%s>\n", mNativeCodeGenerator->mProcedures[i]->mInterProc->mIdent->mString);
 		}
 		mNativeCodeGenerator->mProcedures[i]->Assemble();
+		mNativeCodeGenerator->mProcedures[i]->ReleaseBlocks();
 	}
 
 	LinkerObject* byteCodeObject = nullptr;
@@ -1392,7 +1667,7 @@ bool Compiler::WriteErrorFile(const char* targetPath)
 
 bool Compiler::WriteOutputFile(const char* targetPath, DiskImage * d64)
 {
-	char	prgPath[200], mapPath[200], asmPath[200], lblPath[200], intPath[200], bcsPath[200], dbjPath[200], cszPath[200];
+	char	prgPath[200], mapPath[200], asmPath[200], lblPath[200], intPath[200], bcsPath[200], dbjPath[200], cszPath[200], timPath[200];
 	char	basePath[200];
 
 	strcpy_s(basePath, targetPath);
@@ -1416,6 +1691,7 @@ bool Compiler::WriteOutputFile(const char* targetPath, DiskImage * d64)
 	strcpy_s(bcsPath, prgPath);
 	strcpy_s(dbjPath, prgPath);
 	strcpy_s(cszPath, prgPath);
+	strcpy_s(timPath, prgPath);
 
 	strcat_s(mapPath, "map");
 	strcat_s(asmPath, "asm");
@@ -1424,6 +1700,7 @@ bool Compiler::WriteOutputFile(const char* targetPath, DiskImage * d64)
 	strcat_s(bcsPath, "bcs");
 	strcat_s(dbjPath, "dbj");
 	strcat_s(cszPath, "csz");
+	strcat_s(timPath, "time.json");
 
 	if (mCompilerOptions & COPT_TARGET_PRG)
 	{
@@ -1509,6 +1786,14 @@ bool Compiler::WriteOutputFile(const char* targetPath, DiskImage * d64)
 	if (mCompilerOptions & COPT_PROFILEINFO)
 		WriteCszFile(cszPath);
 
+	if (mTimeReport)
+	{
+		if (mCompilerOptions & COPT_VERBOSE)
+			printf("Writing <%s>\n", timPath);
+		mTimeReport->WriteJSON(timPath);
+		mTimeReport->Print(stdout, 20);
+	}
+
 	if (!(mCompilerOptions & COPT_NATIVE))
 	{
 		if (mCompilerOptions & COPT_VERBOSE)
@@ -1519,16 +1804,54 @@ bool Compiler::WriteOutputFile(const char* targetPath, DiskImage * d64)
 	return true;
 }
 
-int Compiler::ExecuteCode(bool profile, int trace, bool asserts, bool iorange)
+static int ByteCodeAddress(Declaration* bcdec)
+{
+	if (bcdec)
+	{
+		if (bcdec->mType == DT_CONST_ASSEMBLER && bcdec->mLinkerObject && (bcdec->mLinkerObject->mFlags & LOBJF_PLACED))
+			return bcdec->mLinkerObject->mAddress;
+		else if (bcdec->mType == DT_LABEL && bcdec->mBase->mLinkerObject && (bcdec->mBase->mLinkerObject->mFlags & LOBJF_PLACED))
+			return bcdec->mBase->mLinkerObject->mAddress + int(bcdec->mInteger);
+	}
+
+	return -1;
+}
+
+int Compiler::ExecuteCode(const char* targetPath, bool profile, int trace, bool asserts, bool iorange, int vicmodel, const char* profilePath)
 {
 	Location	loc;
 
-	printf("Running emulation...\n");
+	fprintf(mOutput, "Running emulation...\n");
 	Emulator* emu = new Emulator(mLinker);
+	emu->mOutput = mOutput;
+	emu->SetCPU(TargetCPU(mCompilerOptions));
 
 	if (mCompilerOptions & COPT_EXTENDED_ZERO_PAGE)
 		emu->mJiffies = false;
 
+	emu->mVICModel = vicmodel;
+
+	if (profile || profilePath)
+	{
+		emu->mProfile = true;
+		emu->mMemoryProfile = true;
+		if (!(mCompilerOptions & COPT_NATIVE))
+		{
+			emu->mByteCodeCall = ByteCodeAddress(mCompilationUnits->mByteCodes[BC_CALL_ADDR]);
+			emu->mByteCodeReturn = ByteCodeAddress(mCompilationUnits->mByteCodes[BC_RETURN]);
+
+			LinkerObject* otable = mLinker->FindObjectByName("bytecode");
+			if (otable)
+				emu->mByteCodeTable = otable->mAddress;
+		}
+
+		if (profile && (mCompilerOptions & COPT_DEBUGINFO))
+			emu->mLineProfile = true;
+	}
+
+	if (mREUSize)
+		emu->SetupREU(mREUSize * 1024);
+
 	int ecode = 20;
 	if (mCompilerOptions & COPT_TARGET_PRG)
 	{
@@ -1539,19 +1862,110 @@ int Compiler::ExecuteCode(bool profile, int trace, bool asserts, bool iorange)
 		if (asserts)
 			oexit = mLinker->FindObjectByName("exit");
 
-		ecode = emu->Emulate(2061, (oexit ? oexit->mAddress : 0x0000),  trace, iorange);
+		if (PrepareSnapshot(emu, mLinker->mProgramStart, mLinker->mProgramEnd))
+			ecode = emu->Emulate(2061, (oexit ? oexit->mAddress : 0x0000),  trace, iorange);
 	}
 	else if (mCompilerOptions & COPT_TARGET_CRT)
 	{
-		memcpy(emu->mMemory + 0x8000, mLinker->mMemory + 0x0800, 0x4000);
-		ecode = emu->Emulate(0x8009, 0x0000, trace, iorange);
+		if (mCompilerOptions & COPT_TARGET_CRT_EASYFLASH)
+		{
+			uint8	boot[0x4000];
+			if (mLinker->BuildEasyFlashBoot(boot))
+				emu->SetupCartridge(EMAP_EASYFLASH, boot);
+		}
+		else if (mCompilerOptions & COPT_TARGET_CRT8)
+			emu->SetupCartridge(EMAP_CRT8, nullptr);
+		else if (mCompilerOptions & COPT_TARGET_CRT16)
+			emu->SetupCartridge(EMAP_CRT16, nullptr);
+
+		// Start through the cold start vector of the cartridge, as the
+		// kernal would after its reset
+
+		if (emu->mMemoryMap && PrepareSnapshot(emu, 0x0000, 0x0000))
+			ecode = emu->Emulate(emu->mMemory[0x8000] + 256 * emu->mMemory[0x8001], 0x0000, trace, iorange);
+	}
+	else if (mCompilerOptions & COPT_TARGET_NES)
+	{
+		switch (mTargetMachine)
+		{
+		case TMACH_NES_MMC1:
+			emu->SetupCartridge(EMAP_NES_MMC1, nullptr);
+			break;
+		case TMACH_NES_MMC3:
+			emu->SetupCartridge(EMAP_NES_MMC3, nullptr);
+			break;
+		default:
+			emu->SetupCartridge(EMAP_NES, nullptr);
+			break;
+		}
+
+		if (PrepareSnapshot(emu, 0x0000, 0x0000))
+			ecode = emu->Emulate(emu->mMemory[0xfffc] + 256 * emu->mMemory[0xfffd], 0x0000, trace, iorange);
 	}
 
-	printf("Emulation result %d\n", ecode);
+	if (mSnapshotSave[0] && emu->mSnapshotPath)
+		mErrors->Error(loc, EERR_EXECUTION_FAILED, "Snapshot not written", mSnapshotSave);
+
+	fprintf(mOutput, "Emulation result %d\n", ecode);
+
+	mEmulationCycles = emu->mCycleCount;
+
+	if (vicmodel)
+		emu->DumpFrameTiming();
 
 	if (profile)
+	{
 		emu->DumpProfile();
 
+		char	callsPath[200], foldedPath[200], linesPath[200], memPath[200], zpPath[200];
+
+		strcpy_s(callsPath, targetPath);
+		ptrdiff_t	i = strlen(callsPath);
+		while (i > 0 && callsPath[i - 1] != '.')
+			i--;
+		if (i > 0)
+			callsPath[i] = 0;
+
+		strcpy_s(foldedPath, callsPath);
+		strcpy_s(linesPath, callsPath);
+		strcpy_s(memPath, callsPath);
+		strcpy_s(zpPath, callsPath);
+		strcat_s(callsPath, "calls.json");
+		strcat_s(foldedPath, "folded");
+		strcat_s(linesPath, "lines");
+		strcat_s(memPath, "mem");
+		strcat_s(zpPath, "zp");
+
+		if (mCompilerOptions & COPT_VERBOSE)
+			printf("Writing <%s>\n", callsPath);
+		emu->WriteCallTree(callsPath);
+		if (mCompilerOptions & COPT_VERBOSE)
+			printf("Writing <%s>\n", foldedPath);
+		emu->WriteCollapsedStacks(foldedPath);
+
+		if (emu->mLineProfile)
+		{
+			if (mCompilerOptions & COPT_VERBOSE)
+				printf("Writing <%s>\n", linesPath);
+			emu->WriteLineProfile(linesPath);
+		}
+
+		if (mCompilerOptions & COPT_VERBOSE)
+			printf("Writing <%s>\n", memPath);
+		emu->WriteMemoryProfile(memPath);
+		if (mCompilerOptions & COPT_VERBOSE)
+			printf("Writing <%s>\n", zpPath);
+		emu->WriteZeroPageHints(zpPath);
+	}
+
+	if (profilePath)
+	{
+		if (mCompilerOptions & COPT_VERBOSE)
+			printf("Writing <%s>\n", profilePath);
+		if (!emu->WriteProfile(profilePath))
+			mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not write profile", profilePath);
+	}
+
 	if (ecode != 0)
 	{
 		char	sd[20];
@@ -1559,9 +1973,189 @@ int Compiler::ExecuteCode(bool profile, int trace, bool asserts, bool iorange)
 		mErrors->Error(loc, EERR_EXECUTION_FAILED, "Execution failed", sd);
 	}
 
+	delete emu;
+
 	return ecode;
 }
 
+bool Compiler::PrepareSnapshot(Emulator* emu, int start, int end)
+{
+	Location	loc;
+
+	emu->mProgramHash = emu->HashMemory(start, end);
+
+	if (mSnapshotSave[0])
+	{
+		// The trigger is a cycle count, an address, the name of a
+		// native function or by default any breakpoint intrinsic
+
+		const char* at = mSnapshotAt;
+
+		if (at[0] >= '0' && at[0] <= '9')
+			emu->mSnapshotCycles = atoi(at);
+		else if (at[0] == '$')
+			emu->mSnapshotIPs.Push(int(strtol(at + 1, nullptr, 16)) & 0xffff);
+		else if (!at[0] || !strcmp(at, "breakpoint"))
+		{
+			for (int i = 0; i < mLinker->mBreakpoints.Size(); i++)
+				emu->mSnapshotIPs.Push(mLinker->mBreakpoints[i]);
+		}
+		else
+		{
+			LinkerObject* lobj = mLinker->FindObjectByName(at);
+			if (lobj)
+			{
+				emu->mSnapshotIPs.Push(lobj->mAddress);
+
+				// Functions in a single cartridge bank share their address
+				// with the other banks
+
+				uint64	banks = lobj->mRegion ? lobj->mRegion->mCartridgeBanks : 0;
+				if (banks && !(banks & (banks - 1)))
+				{
+					emu->mSnapshotBank = 0;
+					while (!(banks & (1ULL << emu->mSnapshotBank)))
+						emu->mSnapshotBank++;
+				}
+			}
+		}
+
+		if (!emu->mSnapshotIPs.Size() && emu->mSnapshotCycles == INT_MAX)
+		{
+			mErrors->Error(loc, EERR_OBJECT_NOT_FOUND, "Snapshot trigger not found", at[0] ? at : "breakpoint");
+			return false;
+		}
+
+		emu->mSnapshotPath = mSnapshotSave;
+	}
+
+	if (mSnapshotFrom[0] && !emu->LoadSnapshot(mSnapshotFrom))
+	{
+		mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not restore snapshot of this program", mSnapshotFrom);
+		return false;
+	}
+
+	return true;
+}
+
+static bool BenchmarkString(const char* line, const char* key, char* value, int size)
+{
+	char	k[40];
+	sprintf_s(k, "\"%s\": \"", key);
+
+	const char* p = strstr(line, k);
+	if (p)
+	{
+		p += strlen(k);
+		int	i = 0;
+		while (p[i] && p[i] != '"' && i + 1 < size)
+		{
+			value[i] = p[i];
+			i++;
+		}
+		value[i] = 0;
+		return true;
+	}
+	return false;
+}
+
+static bool BenchmarkNumber(const char* line, const char* key, double & value)
+{
+	char	k[40];
+	sprintf_s(k, "\"%s\": ", key);
+
+	const char* p = strstr(line, k);
+	if (p)
+	{
+		value = atof(p + strlen(k));
+		return true;
+	}
+	return false;
+}
+
+bool Compiler::WriteBenchmark(const char* benchPath, const char* basePath, const char* name, const char* options, double compileTime)
+{
+	Location	loc;
+
+	int	codeSize = 0;
+	for (int i = 0; i < mLinker->mObjects.Size(); i++)
+	{
+		LinkerObject* lo = mLinker->mObjects[i];
+		if ((lo->mFlags & LOBJF_PLACED) && (lo->mType == LOT_NATIVE_CODE || lo->mType == LOT_BYTE_CODE || lo->mType == LOT_RUNTIME))
+			codeSize += lo->mSize;
+	}
+	int	programSize = mLinker->mProgramEnd - mLinker->mProgramStart;
+
+	if (benchPath[0])
+	{
+		FILE* file;
+		fopen_s(&file, benchPath, "a");
+		if (!file)
+		{
+			mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not write benchmark file", benchPath);
+			return false;
+		}
+
+		fprintf(file, "{\"name\": \"%s\", \"options\": \"%s\", \"cycles\": %lld, \"code\": %d, \"size\": %d, \"compile\": %.3f}\n",
+			name, options, (long long)mEmulationCycles, codeSize, programSize, compileTime);
+		fclose(file);
+	}
+
+	if (basePath[0])
+	{
+		FILE* file;
+		fopen_s(&file, basePath, "r");
+		if (!file)
+		{
+			mErrors->Error(loc, EERR_FILE_NOT_FOUND, "Could not read benchmark baseline", basePath);
+			return false;
+		}
+
+		// The baseline has one result per line, as written by -bench, with an
+		// optional tolerance in percent
+
+		char	line[1024], bname[100], boptions[100];
+		bool	found = false;
+		while (!found && fgets(line, 1024, file))
+		{
+			if (BenchmarkString(line, "name", bname, 100) && BenchmarkString(line, "options", boptions, 100) &&
+				!strcmp(bname, name) && !strcmp(boptions, options))
+			{
+				double	cycles = 0, code = 0, tolerance = 1.0;
+				BenchmarkNumber(line, "cycles", cycles);
+				BenchmarkNumber(line, "code", code);
+				BenchmarkNumber(line, "tolerance", tolerance);
+
+				double	dcycles = cycles > 0 ? 100.0 * (mEmulationCycles - cycles) / cycles : 0;
+				double	dcode = code > 0 ? 100.0 * (codeSize - code) / code : 0;
+
+				printf("Benchmark %s [%s] : cycles %lld (%+.2f%%), code %d (%+.2f%%)\n", name, options, (long long)mEmulationCycles, dcycles, codeSize, dcode);
+
+				char	sd[200];
+				if (dcycles > tolerance)
+				{
+					sprintf_s(sd, "%s [%s] cycles %lld > %.0f", name, options, (long long)mEmulationCycles, cycles);
+					mErrors->Error(loc, EERR_BENCHMARK_REGRESSION, "Benchmark cycles regression", sd);
+				}
+				if (dcode > tolerance)
+				{
+					sprintf_s(sd, "%s [%s] code %d > %.0f", name, options, codeSize, code);
+					mErrors->Error(loc, EERR_BENCHMARK_REGRESSION, "Benchmark code size regression", sd);
+				}
+
+				found = true;
+			}
+		}
+
+		fclose(file);
+
+		if (!found)
+			printf("Benchmark %s [%s] : no baseline\n", name, options);
+	}
+
+	return true;
+}
+
 static void DumpReferences(FILE* file, Declaration* dec)
 {
 	if (dec)
@@ -10,6 +10,8 @@
 #include "GlobalOptimizer.h"
 #include "Linker.h"
 #include "CompilerTypes.h"
+#include "CompilationCache.h"
+#include "Emulator.h"
 
 class Compiler
 {
@@ -27,15 +29,23 @@ public:
 	InterCodeModule* mInterCodeModule;
 	GlobalAnalyzer* mGlobalAnalyzer;
 	GlobalOptimizer* mGlobalOptimizer;
+	CompilationCache* mCache;
+	TimeReport* mTimeReport;
 
 	GrowingArray<ByteCodeProcedure*>	mByteCodeFunctions;
 
 	TargetMachine	mTargetMachine;
 	uint64			mCompilerOptions;
+	int				mThreads;
+	int64			mEmulationCycles;
+	FILE		*	mOutput;
+	bool			mSharedZeroPage;
 	uint16			mCartridgeID;
 	uint8			mCartridgeSubType;
 	char			mCartridgeName[32];
 	char			mVersion[32];
+	char			mSnapshotSave[200], mSnapshotFrom[200], mSnapshotAt[200];
+	int				mREUSize;
 
 	struct Define
 	{
@@ -45,19 +55,26 @@ public:
 
 	GrowingArray<Define>	mDefines;
 
+	// The zero page registers are process wide, compilations running in
+	// parallel must share the same layout
+	static void SetupZeroPage(TargetMachine machine, bool extended);
+
 	bool BuildLZO(const char* targetPath);
 	bool ParseSource(void);
 	bool GenerateCode(void);
 	bool WriteOutputFile(const char* targetPath, DiskImage * d64);
 	bool WriteErrorFile(const char* targetPath);
 	bool RemoveErrorFile(const char* targetPath);
-	int ExecuteCode(bool profile, int trace, bool asserts, bool iorange);
+	int ExecuteCode(const char* targetPath, bool profile, int trace, bool asserts, bool iorange, int vicmodel, const char* profilePath = nullptr);
+	bool PrepareSnapshot(Emulator* emu, int start, int end);
+	bool WriteBenchmark(const char* benchPath, const char* basePath, const char* name, const char* options, double compileTime);
 
 	void AddDefine(const Ident* ident, const char* value);
 
 	void RegisterRuntime(const Location& loc, const Ident* ident);
 
 	void CompileProcedure(InterCodeProcedure* proc);
+	void CompileProceduresParallel(void);
 	void BuildVTables(void);
 	void CheckOperatorNew(void);
 	void CompleteTemplateExpansion(void);
@@ -22,6 +22,9 @@ static const uint64 COPT_NATIVE = 1ULL << 17;
 static const uint64 COPT_EXTENDED_ZERO_PAGE = 1ULL << 20;
 static const uint64 COPT_OPTIMIZE_SELF_MOD = 1ULL << 21;
 
+static const uint64 COPT_CPU_65C02 = 1ULL << 24;
+static const uint64 COPT_CPU_45GS02 = 1ULL << 25;
+
 static const uint64 COPT_TARGET_PRG = 1ULL << 32;
 static const uint64 COPT_TARGET_CRT8 = 1ULL << 33;
 static const uint64 COPT_TARGET_CRT16 = 1ULL << 34;
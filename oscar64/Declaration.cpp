@@ -2,6 +2,7 @@
 #include "Constexpr.h"
 #include "Linker.h"
 #include <math.h>
+#include <atomic>
 
 DeclarationScope::DeclarationScope(DeclarationScope* parent, ScopeLevel level, const Ident* name)
 {
@@ -158,7 +159,7 @@ void DeclarationScope::End(const Location& loc)
 Expression::Expression(const Location& loc, ExpressionType type)
 	:	mLocation(loc), mEndLocation(loc), mType(type), mLeft(nullptr), mRight(nullptr), mConst(false), mDecType(nullptr), mDecValue(nullptr), mToken(TK_NONE), mFlags(0)
 {
-	static uint32	gUID = 0;
+	static std::atomic<uint32>	gUID(0);
 	mUID = gUID++;
 }
 
@@ -1433,7 +1434,7 @@ Declaration::Declaration(const Location& loc, DecType type)
 	mCompilerOptions(0), mUseCount(0), mTokens(nullptr), mParser(nullptr),
 	mShift(0), mBits(0), mOptFlags(0), mInlayRegion(nullptr)
 {
-	static uint32 gUID = 0;
+	static std::atomic<uint32>	gUID(0);
 	mUID = gUID++;
 }
 
@@ -2591,6 +2592,13 @@ Declaration* Declaration::ToStriped(int stripe)
 	return ndec;
 }
 
+// The const, volatile and mutable variants of a type are created on demand,
+// the built in types are shared by all compilations of a batch, so the
+// variants must outlive the compilation that created them
+
+static ThreadMutex	TypeVariantMutex;
+static MemoryArena	TypeVariantArena;
+
 Declaration* Declaration::ToVolatileType(void)
 {
 	if (mFlags & DTF_VOLATILE)
@@ -2598,6 +2606,11 @@ Declaration* Declaration::ToVolatileType(void)
 
 	if (!mVolatile)
 	{
+		ThreadLock					lock(TypeVariantMutex);
+		MemoryArenaPermanentScope	scope(&TypeVariantArena);
+		if (mVolatile)
+			return mVolatile;
+
 		Declaration* ndec = new Declaration(mLocation, mType);
 		ndec->mSize = mSize;
 		ndec->mStride = mStride;
@@ -2657,6 +2670,11 @@ Declaration* Declaration::ToConstType(void)
 
 	if (!mConst)
 	{
+		ThreadLock					lock(TypeVariantMutex);
+		MemoryArenaPermanentScope	scope(&TypeVariantArena);
+		if (mConst)
+			return mConst;
+
 		Declaration* ndec = new Declaration(mLocation, mType);
 		ndec->mSize = mSize;
 		ndec->mStride = mStride;
@@ -2729,6 +2747,11 @@ Declaration* Declaration::ToMutableType(void)
 
 	if (!mMutable)
 	{
+		ThreadLock					lock(TypeVariantMutex);
+		MemoryArenaPermanentScope	scope(&TypeVariantArena);
+		if (mMutable)
+			return mMutable;
+
 		Declaration* ndec = new Declaration(mLocation, mType);
 		ndec->mSize = mSize;
 		ndec->mStride = mStride;
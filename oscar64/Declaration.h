@@ -5,6 +5,7 @@
 #include "MachineTypes.h"
 #include "Assembler.h"
 #include "Array.h"
+#include "MemoryArena.h"
 
 class LinkerObject;
 class LinkerSection;
@@ -264,7 +265,7 @@ static const uint32 ANAFL_COPY = (1U << 4);
 static const uint32 ANAFL_ADDRESS = (1U << 5);
 
 
-class Expression
+class Expression : public PermanentObject
 {
 public:
 	Expression(const Location& loc, ExpressionType type);
@@ -305,7 +306,7 @@ public:
 	void Dump(int ident) const;
 };
 
-class Declaration
+class Declaration : public PermanentObject
 {
 public:
 	Declaration(const Location & loc, DecType type);
@@ -635,6 +635,7 @@ void ByteCodeDisassembler::Disassemble(FILE* file, const uint8* memory, int bank
 
 
 NativeCodeDisassembler::NativeCodeDisassembler(void)
+	: mCPU(ASMCPU_6502)
 {
 
 }
@@ -712,7 +713,7 @@ void NativeCodeDisassembler::Disassemble(FILE* file, const uint8* memory, int ba
 	{
 		int			iip = ip;
 		uint8	opcode = memory[ip++];
-		AsmInsData	d = DecInsData[opcode];
+		AsmInsData	d = CPUInsData[mCPU][opcode];
 		int	addr = 0;
 
 		if (proc && proc->mLinkerObject)
@@ -733,6 +734,15 @@ void NativeCodeDisassembler::Disassemble(FILE* file, const uint8* memory, int ba
 		if (bank >= 0)
 			fprintf(file, "%02x:", bank);
 
+		// Quad instructions are listed at the opcode after the prefix
+
+		if (mCPU == ASMCPU_45GS02 && opcode == ASM_QUAD_PREFIX && memory[ip] == ASM_QUAD_PREFIX && QuadInsData[memory[ip + 1]].mType != ASMIT_INV)
+		{
+			iip += 2;
+			ip += 2;
+			d = QuadInsData[memory[iip]];
+		}
+
 		switch (d.mMode)
 		{
 		case ASMIM_IMPLIED:
@@ -782,6 +792,15 @@ void NativeCodeDisassembler::Disassemble(FILE* file, const uint8* memory, int ba
 			addr = memory[ip++];
 			fprintf(file, "%04x : %02x %02x __ %s (%s),y %s\n", iip, memory[iip], memory[iip + 1], AsmInstructionNames[d.mType], TempName(addr, tbuffer, proc, linker), AddrName(bank, addr, abuffer, proc, linker));
 			break;
+		case ASMIM_INDIRECT_ZERO_PAGE:
+			addr = memory[ip++];
+			fprintf(file, "%04x : %02x %02x __ %s (%s) %s\n", iip, memory[iip], memory[iip + 1], AsmInstructionNames[d.mType], TempName(addr, tbuffer, proc, linker), AddrName(bank, addr, abuffer, proc, linker));
+			break;
+		case ASMIM_INDIRECT_ABSOLUTE_X:
+			addr = memory[ip] + 256 * memory[ip + 1];
+			ip += 2;
+			fprintf(file, "%04x : %02x %02x %02x %s ($%04x,x)\n", iip, memory[iip], memory[iip + 1], memory[iip + 2], AsmInstructionNames[d.mType], addr);
+			break;
 		case ASMIM_RELATIVE:
 			addr = memory[ip++];
 			if (addr & 0x80)
@@ -790,6 +809,11 @@ void NativeCodeDisassembler::Disassemble(FILE* file, const uint8* memory, int ba
 				addr = addr + ip;
 			fprintf(file, "%04x : %02x %02x __ %s $%04x %s\n", iip, memory[iip], memory[iip + 1], AsmInstructionNames[d.mType], addr, AddrName(bank, addr, abuffer, proc, linker));
 			break;
+		case ASMIM_RELATIVE_LONG:
+			addr = (memory[ip] + 256 * memory[ip + 1] + ip + 1) & 0xffff;
+			ip += 2;
+			fprintf(file, "%04x : %02x %02x %02x %s $%04x %s\n", iip, memory[iip], memory[iip + 1], memory[iip + 2], AsmInstructionNames[d.mType], addr, AddrName(bank, addr, abuffer, proc, linker));
+			break;
 		}
 	}
 
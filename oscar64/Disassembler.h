@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include "MachineTypes.h"
 #include "Ident.h"
+#include "Assembler.h"
 
 class ByteCodeGenerator;
 class InterCodeProcedure;
@@ -27,6 +28,8 @@ public:
 	NativeCodeDisassembler(void);
 	~NativeCodeDisassembler(void);
 
+	AsmCPU	mCPU;
+
 	void Disassemble(FILE* file, const uint8* memory, int bank, int start, int size, InterCodeProcedure* proc, const Ident* ident, Linker* linker, const Ident* fident);
 	void DumpMemory(FILE* file, const uint8* memory, int bank, int start, int size, InterCodeProcedure* proc, const Ident* ident, Linker* linker, LinkerObject * lobj);
 protected:
@@ -1,6 +1,10 @@
 #include "Emulator.h"
 #include "Linker.h"
 #include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+static void FillHandlers(Emulator::InstructionHandler handlers[256], Emulator::InstructionHandler quadHandlers[256], AsmCPU cpu);
 
 Emulator::Emulator(Linker* linker)
 	: mLinker(linker)
@@ -8,19 +12,223 @@ Emulator::Emulator(Linker* linker)
 	for (int i = 0; i < 0x10000; i++)
 		mMemory[i] = 0;
 	mJiffies = true;
+	mProfile = false;
+	mOutput = stdout;
+	mByteCodeCall = -1;
+	mByteCodeReturn = -1;
+	mLineProfile = false;
+	mMemoryProfile = false;
+	mByteCodeTable = -1;
+	mVICModel = VICM_NONE;
+	mIRQMask = false;
+	mIRQHandler = -1;
+	mCycleCount = 0;
+	mJiffyCycles = 0;
+	mSnapshotPath = nullptr;
+	mSnapshotCycles = INT_MAX;
+	mSnapshotBank = -1;
+	mProgramHash = 0;
+	mResume = false;
+
+	mMemoryMap = EMAP_FLAT;
+	mROM = nullptr;
+	for (int i = 0; i < 0x100; i++)
+		mPageFlags[i] = 0;
+	for (int i = 0; i < 64; i++)
+		mBankCycles[i] = 0;
+	for (int i = 0; i < 8; i++)
+		mMapper.mPage[i] = -1;
+
+	mREUSize = 0;
+	mREU = nullptr;
+	mDMACycles = 0;
+
+	mCPU = ASMCPU_6502;
+	FillHandlers(mHandlers, mQuadHandlers, mCPU);
 }
 
 
 Emulator::~Emulator(void)
 {
-
+	delete[] mROM;
+	delete[] mREU;
 }
 
 static const uint8 STATUS_SIGN = 0x80;
 static const uint8 STATUS_OVERFLOW = 0x40;
+static const uint8 STATUS_INTERRUPT = 0x04;
 static const uint8 STATUS_ZERO = 0x02;
 static const uint8 STATUS_CARRY = 0x01;
 
+static const uint8 DECODED_VALID = 0x01;
+static const uint8 DECODED_TRAP = 0x02;
+static const uint8 DECODED_CALL = 0x04;
+static const uint8 DECODED_RETURN = 0x08;
+static const uint8 DECODED_LINE = 0x10;
+static const uint8 DECODED_SOURCE = 0x20;
+static const uint8 DECODED_DISPATCH = 0x40;
+
+static const uint8 PAGEF_ROM = 0x01;
+static const uint8 PAGEF_IO = 0x02;
+static const uint8 PAGEF_REU = 0x04;
+static const uint8 PAGEF_PPU = 0x08;
+
+inline void Emulator::DiscardCode(uint16 addr)
+{
+	mDecodedCode[addr] = false;
+	for (int i = 0; i < 5; i++)
+	{
+		DecodedInstruction& di(mDecoded[(addr - i) & 0xffff]);
+		di.mFlags = 0;
+		mCycles[(addr - i) & 0xffff] += di.mCycles;
+		di.mCycles = 0;
+	}
+}
+
+inline void Emulator::StoreMemory(uint16 addr, uint8 data)
+{
+	mMemory[addr] = data;
+	if (mDecodedCode[addr])
+		DiscardCode(addr);
+}
+
+inline uint8 Emulator::ReadModifyMemory(uint16 addr)
+{
+	// Read modify write instructions write the unmodified value
+	// first, which is seen by the IO registers
+
+	uint8	data = ReadMemory(addr);
+	if (mVICModel)
+		WriteMemory(addr, data);
+	return data;
+}
+
+void Emulator::SetCPU(AsmCPU cpu)
+{
+	mCPU = cpu;
+	FillHandlers(mHandlers, mQuadHandlers, mCPU);
+	InvalidateCode();
+}
+
+void Emulator::InvalidateCode(void)
+{
+	for (int i = 0; i < 0x10000; i++)
+	{
+		mDecoded[i].mFlags = 0;
+		mDecoded[i].mCycles = 0;
+		mDecodedCode[i] = false;
+	}
+}
+
+void Emulator::FlushCycles(void)
+{
+	for (int i = 0; i < 0x10000; i++)
+	{
+		mCycles[i] += mDecoded[i].mCycles;
+		mDecoded[i].mCycles = 0;
+	}
+
+	if (mProfile)
+		ChargeCycles();
+}
+
+void Emulator::DecodeInstruction(int ip)
+{
+	DecodedInstruction& di(mDecoded[ip]);
+
+	AsmInsData	d = CPUInsData[mCPU][mMemory[ip]];
+	di.mExecute = mHandlers[mMemory[ip]];
+
+	int	prefix = 0;
+	if (mCPU == ASMCPU_45GS02 && mMemory[ip] == ASM_QUAD_PREFIX && mMemory[(ip + 1) & 0xffff] == ASM_QUAD_PREFIX && QuadInsData[mMemory[(ip + 2) & 0xffff]].mType != ASMIT_INV)
+	{
+		prefix = 2;
+		d = QuadInsData[mMemory[(ip + 2) & 0xffff]];
+		di.mExecute = mQuadHandlers[mMemory[(ip + 2) & 0xffff]];
+	}
+
+	int	op0 = mMemory[(ip + prefix + 1) & 0xffff], op1 = mMemory[(ip + prefix + 2) & 0xffff];
+
+	switch (d.mMode)
+	{
+	case ASMIM_IMPLIED:
+		di.mSize = 1;
+		di.mOperand = 0;
+		break;
+	case ASMIM_IMMEDIATE:
+	case ASMIM_ZERO_PAGE:
+	case ASMIM_ZERO_PAGE_X:
+	case ASMIM_ZERO_PAGE_Y:
+	case ASMIM_INDIRECT_X:
+	case ASMIM_INDIRECT_Y:
+	case ASMIM_INDIRECT_ZERO_PAGE:
+		di.mSize = 2;
+		di.mOperand = op0;
+		break;
+	case ASMIM_RELATIVE:
+		di.mSize = 2;
+		if (op0 & 0x80)
+			di.mOperand = op0 + ip + 2 - 256;
+		else
+			di.mOperand = op0 + ip + 2;
+		break;
+	case ASMIM_RELATIVE_LONG:
+		di.mSize = 3;
+		di.mOperand = op0 + 256 * op1 + ip + 2;
+		break;
+	case ASMIM_ABSOLUTE:
+	case ASMIM_ABSOLUTE_X:
+	case ASMIM_ABSOLUTE_Y:
+	case ASMIM_INDIRECT:
+	case ASMIM_INDIRECT_ABSOLUTE_X:
+		di.mSize = 3;
+		di.mOperand = op0 + 256 * op1;
+		break;
+	default:
+		di.mSize = 1;
+		di.mOperand = 0;
+		break;
+	}
+
+	di.mSize += prefix;
+
+	di.mFlags = DECODED_VALID;
+	if (ip == mExitIP || mSnapshotIPs.Contains(ip))
+		di.mFlags |= DECODED_TRAP;
+	else if (mMemoryMap < EMAP_NES && (ip == 0xffd2 || ip == 0xffcf || ip == 0xff81))
+		di.mFlags |= DECODED_TRAP;
+	else if (d.mType == ASMIT_JMP && d.mMode == ASMIM_ABSOLUTE && di.mOperand == ip)
+		di.mFlags |= DECODED_TRAP;
+	else if (mVICModel && (ip == 0xea31 || ip == 0xea81))
+		di.mFlags |= DECODED_TRAP;
+
+	if (mProfile)
+	{
+		if (d.mType == ASMIT_JSR)
+			di.mFlags |= DECODED_CALL;
+		else if (d.mType == ASMIT_RTS || d.mType == ASMIT_RTI || d.mType == ASMIT_TXS)
+			di.mFlags |= DECODED_RETURN;
+		if (ip == mByteCodeCall || ip == mByteCodeReturn)
+			di.mFlags |= DECODED_TRAP;
+
+		if (mLineProfile)
+		{
+			di.mFlags |= DECODED_LINE;
+			if (d.mType == ASMIT_JMP && d.mMode == ASMIM_INDIRECT && mByteCodeTable >= 0 && di.mOperand >= mByteCodeTable && di.mOperand < mByteCodeTable + 256)
+				di.mFlags |= DECODED_DISPATCH;
+			else
+			{
+				LinkerObject* lobj = FindCodeObject(ip, BankOf(ip));
+				if (lobj && lobj->mType == LOT_NATIVE_CODE && lobj->mCodeLocations.Size())
+					di.mFlags |= DECODED_SOURCE;
+			}
+		}
+	}
+
+	for (int i = 0; i < di.mSize; i++)
+		mDecodedCode[(ip + i) & 0xffff] = true;
+}
+
 void Emulator::UpdateStatus(uint8 result)
 {
 	mRegP &= ~(STATUS_ZERO | STATUS_SIGN);
@@ -37,6 +245,40 @@ void Emulator::UpdateStatusCarry(uint8 result, bool carry)
 		mRegP |= STATUS_CARRY;
 }
 
+uint32 Emulator::QuadRegister(void) const
+{
+	return mRegA | (mRegX << 8) | (mRegY << 16) | (uint32(mRegZ) << 24);
+}
+
+void Emulator::SetQuadRegister(uint32 q)
+{
+	mRegA = q & 0xff;
+	mRegX = (q >> 8) & 0xff;
+	mRegY = (q >> 16) & 0xff;
+	mRegZ = (q >> 24) & 0xff;
+}
+
+uint32 Emulator::ReadQuad(uint16 addr)
+{
+	uint32	q = 0;
+	for (int i = 0; i < 4; i++)
+		q |= uint32(ReadMemory(addr + i)) << (8 * i);
+	return q;
+}
+
+void Emulator::WriteQuad(uint16 addr, uint32 q)
+{
+	for (int i = 0; i < 4; i++)
+		WriteMemory(addr + i, (q >> (8 * i)) & 0xff);
+}
+
+void Emulator::UpdateStatusQuad(uint32 result)
+{
+	mRegP &= ~(STATUS_ZERO | STATUS_SIGN);
+	if (result == 0) mRegP |= STATUS_ZERO;
+	if (result & 0x80000000) mRegP |= STATUS_SIGN;
+}
+
 void Emulator::DumpCycles(void)
 {
 	int		numTops	= 0;
@@ -115,7 +357,8 @@ void Emulator::DumpCycles(void)
 	}
 }
 
-bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, int & cycles, bool cross, bool indexed)
+template<AsmInsType type, AsmInsMode mode>
+inline bool Emulator::EmulateInstruction(int addr, int & cycles, bool cross, bool indexed)
 {
 	int	t;
 
@@ -152,7 +395,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		else
 		{
-			t = ReadMemory(addr) << 1;
+			t = ReadModifyMemory(addr) << 1;
 			WriteMemory(addr, t & 255);
 			UpdateStatusCarry(t & 255, t >= 256);
 			cycles += 2;
@@ -181,6 +424,12 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		break;
 	case ASMIT_BIT:
+		if (mode == ASMIM_IMMEDIATE)
+		{
+			mRegP &= ~STATUS_ZERO;
+			if (!(addr & mRegA)) mRegP |= STATUS_ZERO;
+			break;
+		}
 		t = ReadMemory(addr);
 		mRegP &= ~(STATUS_ZERO | STATUS_SIGN | STATUS_OVERFLOW);
 		if (t & 0x80) mRegP |= STATUS_SIGN;
@@ -208,6 +457,10 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 			cycles++;
 		}
 		break;
+	case ASMIT_BRA:
+		mIP = addr;
+		cycles++;
+		break;
 	case ASMIT_BRK:
 		return false;
 		break;
@@ -231,6 +484,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 	case ASMIT_CLD:
 		break;
 	case ASMIT_CLI:
+		mIRQMask = false;
 		break;
 	case ASMIT_CLV:
 		mRegP &= ~STATUS_OVERFLOW;
@@ -284,7 +538,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		else
 		{
-			t = ReadMemory(addr) - 1;
+			t = ReadModifyMemory(addr) - 1;
 			WriteMemory(addr, t & 255);
 			UpdateStatus(t & 255);
 			cycles += 2;
@@ -317,7 +571,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		else
 		{
-			t = ReadMemory(addr) + 1;
+			t = ReadModifyMemory(addr) + 1;
 			WriteMemory(addr, t & 255);
 			UpdateStatus(t & 255);
 			cycles += 2;
@@ -338,9 +592,9 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		mIP = addr;
 		break;
 	case ASMIT_JSR:
-		mMemory[0x100 + mRegS] = (mIP - 1) >> 8;
+		StoreMemory(0x100 + mRegS, (mIP - 1) >> 8);
 		mRegS--;
-		mMemory[0x100 + mRegS] = (mIP - 1) & 0xff;
+		StoreMemory(0x100 + mRegS, (mIP - 1) & 0xff);
 		mCalls[mRegS] = true;
 		mRegS--;
 		mIP = addr;
@@ -377,7 +631,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		else
 		{
-			t = ReadMemory(addr);
+			t = ReadModifyMemory(addr);
 			int	c = t & 1;
 			t >>= 1;
 			WriteMemory(addr, t & 255);
@@ -397,13 +651,25 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		break;
 	case ASMIT_PHA:
 		mCalls[mRegS] = false;
-		mMemory[0x100 + mRegS] = mRegA;
+		StoreMemory(0x100 + mRegS, mRegA);
 		mRegS--;
 		cycles ++;
 		break;
 	case ASMIT_PHP:
 		mCalls[mRegS] = false;
-		mMemory[0x100 + mRegS] = mRegP;
+		StoreMemory(0x100 + mRegS, mIRQMask ? mRegP | STATUS_INTERRUPT : mRegP & ~STATUS_INTERRUPT);
+		mRegS--;
+		cycles++;
+		break;
+	case ASMIT_PHX:
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mRegX);
+		mRegS--;
+		cycles++;
+		break;
+	case ASMIT_PHY:
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mRegY);
 		mRegS--;
 		cycles++;
 		break;
@@ -412,9 +678,22 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		mRegA = mMemory[0x100 + mRegS];
 		cycles++;
 		break;
+	case ASMIT_PLX:
+		mRegS++;
+		mRegX = mMemory[0x100 + mRegS];
+		UpdateStatus(mRegX);
+		cycles++;
+		break;
+	case ASMIT_PLY:
+		mRegS++;
+		mRegY = mMemory[0x100 + mRegS];
+		UpdateStatus(mRegY);
+		cycles++;
+		break;
 	case ASMIT_PLP:
 		mRegS++;
 		mRegP = mMemory[0x100 + mRegS];
+		mIRQMask = (mRegP & STATUS_INTERRUPT) != 0;
 		cycles++;
 		break;
 	case ASMIT_ROL:
@@ -426,7 +705,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		else
 		{
-			t = (ReadMemory(addr) << 1) | (mRegP & STATUS_CARRY);;
+			t = (ReadModifyMemory(addr) << 1) | (mRegP & STATUS_CARRY);
 			WriteMemory(addr, t & 255);
 			UpdateStatusCarry(t & 255, t >= 256);
 			cycles+=2;
@@ -443,7 +722,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		else
 		{
-			t = ReadMemory(addr);
+			t = ReadModifyMemory(addr);
 			int	c = t & 1;
 			t = (t >> 1) | ((mRegP & STATUS_CARRY) << 7);
 			WriteMemory(addr, t & 255);
@@ -453,6 +732,8 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		}
 		break;
 	case ASMIT_RTI:
+		ReturnInterrupt();
+		cycles += 4;
 		break;
 	case ASMIT_RTS:
 		mIP = (mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1) & 0xffff;
@@ -480,6 +761,7 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 	case ASMIT_SED:
 		break;
 	case ASMIT_SEI:
+		mIRQMask = true;
 		break;
 	case ASMIT_STA:
 		WriteMemory(addr, mRegA);
@@ -491,6 +773,10 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 	case ASMIT_STY:
 		WriteMemory(addr, mRegY);
 		break;
+	case ASMIT_STZ:
+		WriteMemory(addr, mRegZ);
+		if (indexed) cycles++;
+		break;
 	case ASMIT_TAX:
 		mRegX = mRegA;
 		UpdateStatus(mRegX);
@@ -514,17 +800,354 @@ bool Emulator::EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, in
 		mRegA = mRegY;
 		UpdateStatus(mRegA);
 		break;
+	case ASMIT_TRB:
+		t = ReadModifyMemory(addr);
+		mRegP &= ~STATUS_ZERO;
+		if (!(t & mRegA)) mRegP |= STATUS_ZERO;
+		WriteMemory(addr, t & ~mRegA);
+		cycles += 2;
+		break;
+	case ASMIT_TSB:
+		t = ReadModifyMemory(addr);
+		mRegP &= ~STATUS_ZERO;
+		if (!(t & mRegA)) mRegP |= STATUS_ZERO;
+		WriteMemory(addr, t | mRegA);
+		cycles += 2;
+		break;
+	case ASMIT_ASR:
+		if (mode == ASMIM_IMPLIED)
+		{
+			int	c = mRegA & 1;
+			mRegA = (mRegA >> 1) | (mRegA & 0x80);
+			UpdateStatusCarry(mRegA, c != 0);
+		}
+		else
+		{
+			t = ReadModifyMemory(addr);
+			int	c = t & 1;
+			t = (t >> 1) | (t & 0x80);
+			WriteMemory(addr, t);
+			UpdateStatusCarry(t, c != 0);
+			cycles += 2;
+		}
+		break;
+	case ASMIT_NEG:
+		mRegA = (-mRegA) & 255;
+		UpdateStatus(mRegA);
+		break;
+	case ASMIT_INW:
+	case ASMIT_DEW:
+		t = ReadModifyMemory(addr) + 256 * ReadMemory((addr + 1) & 0xff);
+		t = (type == ASMIT_INW ? t + 1 : t - 1) & 0xffff;
+		WriteMemory(addr, t & 255);
+		WriteMemory((addr + 1) & 0xff, t >> 8);
+		mRegP &= ~(STATUS_ZERO | STATUS_SIGN);
+		if (t == 0) mRegP |= STATUS_ZERO;
+		if (t & 0x8000) mRegP |= STATUS_SIGN;
+		cycles += 3;
+		break;
+	case ASMIT_ASW:
+	case ASMIT_ROW:
+		t = ReadModifyMemory(addr) + 256 * ReadMemory((addr + 1) & 0xffff);
+		t <<= 1;
+		if (type == ASMIT_ROW)
+			t |= mRegP & STATUS_CARRY;
+		WriteMemory(addr, t & 255);
+		WriteMemory((addr + 1) & 0xffff, (t >> 8) & 255);
+		mRegP &= ~(STATUS_ZERO | STATUS_SIGN | STATUS_CARRY);
+		if (!(t & 0xffff)) mRegP |= STATUS_ZERO;
+		if (t & 0x8000) mRegP |= STATUS_SIGN;
+		if (t & 0x10000) mRegP |= STATUS_CARRY;
+		cycles += 3;
+		break;
+	case ASMIT_LDZ:
+		if (mode != ASMIM_IMMEDIATE)
+			addr = ReadMemory(addr);
+		mRegZ = addr;
+		UpdateStatus(mRegZ);
+		if (cross) cycles++;
+		break;
+	case ASMIT_CPZ:
+		if (mode != ASMIM_IMMEDIATE)
+			addr = ReadMemory(addr);
+		t = mRegZ + (addr ^ 0xff) + 1;
+		UpdateStatusCarry(t & 255, t >= 256);
+		break;
+	case ASMIT_INZ:
+		mRegZ++;
+		UpdateStatus(mRegZ);
+		break;
+	case ASMIT_DEZ:
+		mRegZ--;
+		UpdateStatus(mRegZ);
+		break;
+	case ASMIT_TAZ:
+		mRegZ = mRegA;
+		UpdateStatus(mRegZ);
+		break;
+	case ASMIT_TZA:
+		mRegA = mRegZ;
+		UpdateStatus(mRegA);
+		break;
+	case ASMIT_PHZ:
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mRegZ);
+		mRegS--;
+		cycles++;
+		break;
+	case ASMIT_PLZ:
+		mRegS++;
+		mRegZ = mMemory[0x100 + mRegS];
+		UpdateStatus(mRegZ);
+		cycles++;
+		break;
+	case ASMIT_LDQ:
+		SetQuadRegister(ReadQuad(addr));
+		UpdateStatusQuad(QuadRegister());
+		break;
+	case ASMIT_STQ:
+		WriteQuad(addr, QuadRegister());
+		break;
+	case ASMIT_ADCQ:
+	case ASMIT_SBCQ:
+	case ASMIT_CMPQ:
+	{
+		uint32	q = QuadRegister(), m = ReadQuad(addr);
+		if (type != ASMIT_ADCQ)
+			m = ~m;
+		uint64	r = uint64(q) + m + (type == ASMIT_CMPQ ? 1 : (mRegP & STATUS_CARRY));
+
+		if (type == ASMIT_CMPQ)
+			mRegP &= ~STATUS_CARRY;
+		else
+		{
+			mRegP &= ~(STATUS_CARRY | STATUS_OVERFLOW);
+			if (~(q ^ m) & (q ^ uint32(r)) & 0x80000000)
+				mRegP |= STATUS_OVERFLOW;
+			SetQuadRegister(uint32(r));
+		}
+		if (r >> 32)
+			mRegP |= STATUS_CARRY;
+		UpdateStatusQuad(uint32(r));
+	}	break;
+	case ASMIT_ANDQ:
+		SetQuadRegister(QuadRegister() & ReadQuad(addr));
+		UpdateStatusQuad(QuadRegister());
+		break;
+	case ASMIT_ORAQ:
+		SetQuadRegister(QuadRegister() | ReadQuad(addr));
+		UpdateStatusQuad(QuadRegister());
+		break;
+	case ASMIT_EORQ:
+		SetQuadRegister(QuadRegister() ^ ReadQuad(addr));
+		UpdateStatusQuad(QuadRegister());
+		break;
+	case ASMIT_ASLQ:
+	case ASMIT_LSRQ:
+	case ASMIT_ROLQ:
+	case ASMIT_RORQ:
+	case ASMIT_INQ:
+	case ASMIT_DEQ:
+	{
+		uint32	q = mode == ASMIM_IMPLIED ? QuadRegister() : ReadQuad(addr), r;
+		bool	c = (mRegP & STATUS_CARRY) != 0;
+
+		switch (type)
+		{
+		case ASMIT_ASLQ:
+		case ASMIT_ROLQ:
+			r = (q << 1) | (type == ASMIT_ROLQ && c ? 1 : 0);
+			c = (q & 0x80000000) != 0;
+			break;
+		case ASMIT_LSRQ:
+		case ASMIT_RORQ:
+			r = (q >> 1) | (type == ASMIT_RORQ && c ? 0x80000000 : 0);
+			c = (q & 1) != 0;
+			break;
+		case ASMIT_INQ:
+			r = q + 1;
+			break;
+		default:
+			r = q - 1;
+			break;
+		}
+
+		if (mode == ASMIM_IMPLIED)
+			SetQuadRegister(r);
+		else
+		{
+			WriteQuad(addr, r);
+			cycles += 4;
+		}
+
+		mRegP &= ~STATUS_CARRY;
+		if (c) mRegP |= STATUS_CARRY;
+		UpdateStatusQuad(r);
+	}	break;
 	case ASMIT_INV:
 		return false;
 		break;
+	default:
+		break;
 	}
 		
 	return true;
 }
 
+template<AsmInsType type, AsmInsMode mode>
+int Emulator::ExecuteInstruction(int operand)
+{
+	int		addr = operand, cycles = 0;
+	bool	cross = false, indexed = false;
+
+	switch (mode)
+	{
+	case ASMIM_IMPLIED:
+	case ASMIM_IMMEDIATE:
+	case ASMIM_RELATIVE:
+		cycles = 2;
+		break;
+	case ASMIM_RELATIVE_LONG:
+		cycles = 3;
+		break;
+	case ASMIM_ZERO_PAGE:
+		cycles = 3;
+		break;
+	case ASMIM_ZERO_PAGE_X:
+		addr = (operand + mRegX) & 0xff;
+		cycles = 4;
+		break;
+	case ASMIM_ZERO_PAGE_Y:
+		addr = (operand + mRegY) & 0xff;
+		cycles = 4;
+		break;
+	case ASMIM_ABSOLUTE:
+		cycles = 4;
+		break;
+	case ASMIM_ABSOLUTE_X:
+		addr = (operand + mRegX) & 0xffff;
+		cross = (operand & 0xff) + mRegX >= 256;
+		indexed = true;
+		cycles = 4;
+		break;
+	case ASMIM_ABSOLUTE_Y:
+		addr = (operand + mRegY) & 0xffff;
+		cross = (operand & 0xff) + mRegY >= 256;
+		indexed = true;
+		cycles = 4;
+		break;
+	case ASMIM_INDIRECT:
+		addr = mMemory[operand] + 256 * mMemory[operand + 1];
+		cycles = 6;
+		break;
+	case ASMIM_INDIRECT_X:
+		operand = (operand + mRegX) & 0xff;
+		addr = mMemory[operand] + 256 * mMemory[operand + 1];
+		cycles = 6;
+		break;
+	case ASMIM_INDIRECT_Y:
+		addr = (mMemory[operand] + 256 * mMemory[operand + 1] + mRegY) & 0xffff;
+		cross = mMemory[operand] + mRegY >= 256;
+		indexed = true;
+		cycles = 5;
+		break;
+	case ASMIM_INDIRECT_ZERO_PAGE:
+		addr = (mMemory[operand] + 256 * mMemory[(operand + 1) & 0xff] + mRegZ) & 0xffff;
+		cycles = 5;
+		break;
+	case ASMIM_INDIRECT_ABSOLUTE_X:
+		operand = (operand + mRegX) & 0xffff;
+		addr = mMemory[operand] + 256 * mMemory[(operand + 1) & 0xffff];
+		cycles = 6;
+		break;
+	default:
+		break;
+	}
+
+	if (IsQuadAsmInstruction(type))
+		cycles += 4;
+
+	if (mMemoryProfile)
+	{
+		if ((mode == ASMIM_ABSOLUTE || mode == ASMIM_ABSOLUTE_X || mode == ASMIM_ABSOLUTE_Y && (type == ASMIT_LDX || type == ASMIT_STX)) && type != ASMIT_JMP && type != ASMIT_JSR)
+			mAbsolute[addr]++;
+
+		if (cross && (type == ASMIT_ADC || type == ASMIT_AND || type == ASMIT_CMP || type == ASMIT_EOR || type == ASMIT_LDA || type == ASMIT_LDX || type == ASMIT_LDY || type == ASMIT_ORA || type == ASMIT_SBC))
+			mCrossings[(mIP - (mode == ASMIM_INDIRECT_Y ? 2 : 3)) & 0xffff]++;
+	}
+
+	if (EmulateInstruction<type, mode>(addr, cycles, cross, indexed))
+		return cycles;
+	else
+		return -1;
+}
+
+template<AsmInsType type, AsmInsMode mode>
+int Emulator::DispatchInstruction(Emulator* emu, int operand)
+{
+	return emu->ExecuteInstruction<type, mode>(operand);
+}
+
+// Fills the handler table for all combinations of instruction type and
+// address mode
+
+template<int type, int mode>
+struct EmulatorHandlers
+{
+	static void Fill(Emulator::InstructionHandler handlers[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES])
+	{
+		handlers[type][mode] = &Emulator::DispatchInstruction<AsmInsType(type), AsmInsMode(mode)>;
+		EmulatorHandlers<type, mode + 1>::Fill(handlers);
+	}
+};
+
+template<int type>
+struct EmulatorHandlers<type, NUM_ASM_INS_MODES>
+{
+	static void Fill(Emulator::InstructionHandler handlers[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES])
+	{
+	}
+};
+
+template<int type>
+struct EmulatorTypeHandlers
+{
+	static void Fill(Emulator::InstructionHandler handlers[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES])
+	{
+		EmulatorHandlers<type, 0>::Fill(handlers);
+		EmulatorTypeHandlers<type + 1>::Fill(handlers);
+	}
+};
+
+template<>
+struct EmulatorTypeHandlers<NUM_ASM_INS_TYPES>
+{
+	static void Fill(Emulator::InstructionHandler handlers[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES])
+	{
+	}
+};
+
+static void FillHandlers(Emulator::InstructionHandler handlers[256], Emulator::InstructionHandler quadHandlers[256], AsmCPU cpu)
+{
+	Emulator::InstructionHandler	thandlers[NUM_ASM_INS_TYPES][NUM_ASM_INS_MODES];
+	EmulatorTypeHandlers<0>::Fill(thandlers);
+
+	for (int i = 0; i < 256; i++)
+	{
+		handlers[i] = thandlers[CPUInsData[cpu][i].mType][CPUInsData[cpu][i].mMode];
+		quadHandlers[i] = thandlers[QuadInsData[i].mType][QuadInsData[i].mMode];
+	}
+}
+
 void Emulator::DumpProfile(void)
 {
 	DumpCycles();
+	if (mProfile)
+		DumpCallGraph();
+	if (mLineProfile)
+		DumpSourceLines();
+	if (mMemoryProfile)
+		DumpMemoryProfile();
 }
 
 void Emulator::DumpCallstack(void)
@@ -532,10 +1155,10 @@ void Emulator::DumpCallstack(void)
 	int	ip = mIP;
 	int sp = mRegS;
 
-	printf("Callstack:\n");
+	fprintf(mOutput, "Callstack:\n");
 	while (sp < 0xfd)
 	{
-		printf("%02x [%04x] : ", sp, ip);
+		fprintf(mOutput, "%02x [%04x] : ", sp, ip);
 
 		const LinkerObject* lobj = nullptr;
 		if (mLinker)
@@ -557,11 +1180,11 @@ void Emulator::DumpCallstack(void)
 
 			while (loc)
 			{
-				printf("(%s,%d) ", loc->mFileName, loc->mLine);
+				fprintf(mOutput, "(%s,%d) ", loc->mFileName, loc->mLine);
 				loc = loc->mFrom;
 			}
 		}
-		printf("\n");
+		fprintf(mOutput, "\n");
 
 		while (sp < 0xfd && !mCalls[sp])
 			sp++;
@@ -570,33 +1193,726 @@ void Emulator::DumpCallstack(void)
 	}
 }
 
-uint8 Emulator::ReadMemory(uint16 addr)
+void Emulator::ChargeCycles(void)
 {
-	if (mUseIORange && addr >= 0xdd80 && addr < 0xde00)
+	mCallNodes[mCallNode].mCycles += unsigned(mCycleCount - mCallCycles);
+	mCallCycles = mCycleCount;
+}
+
+void Emulator::ProfileLine(int ip, uint8 flags, int cycles)
+{
+	mCounts[ip]++;
+
+	if (flags & DECODED_SOURCE)
+		mLineIP = ip;
+	else
 	{
-		switch (addr & 15)
+		if (flags & DECODED_DISPATCH)
 		{
-		case 0:
-			return mIORange.mCount0++;
-		case 1:
-			return mIORange.mCount1++;
-		case 2:
-			return mIORange.mDMAAddress & 0xff;
-		case 3:
-			return mIORange.mDMAAddress >> 8;
-		case 4:
-			return mMemory[mIORange.mDMAAddress++];
-		case 5:
-		case 6:
-		case 7:
-			return mIORange.mMirror;
-		case 8:
-		case 9:
-		case 10:
-		case 11:
-			return mIORange.mCycleCount >> 8 * (addr & 3);
-		case 12:
-		case 13:
+			mLineIP = (mMemory[BC_REG_IP] + 256 * mMemory[BC_REG_IP + 1] + mRegY - 1) & 0xffff;
+			mCounts[mLineIP]++;
+		}
+
+		if (mLineIP >= 0)
+			mLineCycles[mLineIP] += cycles;
+	}
+}
+
+void Emulator::CollectSourceLines(ExpandingArray<SourceLine>& lines)
+{
+	for (int i = 0; i < mLinker->mObjects.Size(); i++)
+	{
+		const LinkerObject* lobj = mLinker->mObjects[i];
+		if ((lobj->mFlags & LOBJF_PLACED) && (lobj->mType == LOT_NATIVE_CODE || lobj->mType == LOT_BYTE_CODE))
+		{
+			for (int j = 0; j < lobj->mCodeLocations.Size(); j++)
+			{
+				const CodeLocation& co(lobj->mCodeLocations[j]);
+
+				SourceLine	sl;
+				sl.mFileName = co.mLocation.mFileName;
+				sl.mLine = co.mLocation.mLine;
+				sl.mCount = 0;
+				sl.mCycles = 0;
+
+				for (int k = co.mStart; k < co.mEnd; k++)
+				{
+					int	addr = (lobj->mAddress + k) & 0xffff;
+					sl.mCycles += mCycles[addr] + mLineCycles[addr];
+					if (mCounts[addr] > sl.mCount)
+						sl.mCount = mCounts[addr];
+				}
+
+				lines.Push(sl);
+			}
+		}
+	}
+
+	lines.Sort([](const SourceLine& l, const SourceLine& r)->bool {
+		return l.mFileName == r.mFileName ? l.mLine < r.mLine : strcmp(l.mFileName, r.mFileName) < 0;
+	});
+
+	int	n = 0;
+	for (int i = 0; i < lines.Size(); i++)
+	{
+		if (n > 0 && lines[n - 1].mFileName == lines[i].mFileName && lines[n - 1].mLine == lines[i].mLine)
+		{
+			lines[n - 1].mCycles += lines[i].mCycles;
+			if (lines[i].mCount > lines[n - 1].mCount)
+				lines[n - 1].mCount = lines[i].mCount;
+		}
+		else
+			lines[n++] = lines[i];
+	}
+	lines.SetSize(n);
+}
+
+void Emulator::DumpSourceLines(void)
+{
+	ExpandingArray<SourceLine>	lines;
+
+	CollectSourceLines(lines);
+
+	ExpandingArray<int>	order;
+	for (int i = 0; i < lines.Size(); i++)
+		order.Push(i);
+	order.Sort([&](int a, int b) { return lines[a].mCycles > lines[b].mCycles; });
+
+	printf("Source lines\n");
+	printf("          Cycles      Count : Line\n");
+	for (int i = 0; i < order.Size() && i < 40 && lines[order[i]].mCycles > 0; i++)
+	{
+		const SourceLine& sl(lines[order[i]]);
+		printf("  %14lld %10d : %s:%d\n", (long long)sl.mCycles, sl.mCount, sl.mFileName, sl.mLine);
+	}
+}
+
+bool Emulator::WriteLineProfile(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		ExpandingArray<SourceLine>	lines;
+
+		CollectSourceLines(lines);
+
+		int	i = 0;
+		while (i < lines.Size())
+		{
+			int		j = i;
+			int64	cycles = 0;
+			while (j < lines.Size() && lines[j].mFileName == lines[i].mFileName)
+				cycles += lines[j++].mCycles;
+
+			FILE* fsrc = nullptr;
+			if (cycles > 0)
+				fopen_s(&fsrc, lines[i].mFileName, "r");
+
+			if (fsrc)
+			{
+				fprintf(file, "<%s>\n", lines[i].mFileName);
+
+				int		k = i, l = 1;
+				char	line[1024];
+				while (fgets(line, 1024, fsrc))
+				{
+					size_t ll = strlen(line);
+					while (ll > 0 && (line[ll - 1] == '\r' || line[ll - 1] == '\n'))
+						ll--;
+					line[ll] = 0;
+
+					while (k < j && lines[k].mLine < l)
+						k++;
+
+					if (k < j && lines[k].mLine == l)
+						fprintf(file, "%5d %14lld %10d : %s\n", l, (long long)lines[k].mCycles, lines[k].mCount, line);
+					else
+						fprintf(file, "%5d %14s %10s : %s\n", l, "", "", line);
+					l++;
+				}
+
+				fclose(fsrc);
+				fprintf(file, "\n");
+			}
+
+			i = j;
+		}
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
+
+void Emulator::CollectDataObjects(ExpandingArray<DataObject>& objects)
+{
+	for (int i = 0; i < mLinker->mObjects.Size(); i++)
+	{
+		LinkerObject* lobj = mLinker->mObjects[i];
+		if ((lobj->mFlags & LOBJF_PLACED) && (lobj->mType == LOT_DATA || lobj->mType == LOT_BSS) && lobj->mSize > 0)
+		{
+			DataObject	dobj;
+			dobj.mObject = lobj;
+			dobj.mReads = dobj.mWrites = dobj.mSaved = 0;
+
+			for (int j = 0; j < lobj->mSize; j++)
+			{
+				int	addr = (lobj->mAddress + j) & 0xffff;
+				dobj.mReads += mReads[addr];
+				dobj.mWrites += mWrites[addr];
+				dobj.mSaved += mAbsolute[addr];
+			}
+
+			if (dobj.mReads + dobj.mWrites > 0)
+				objects.Push(dobj);
+		}
+	}
+
+	objects.Sort([](const DataObject& l, const DataObject& r)->bool {
+		return l.mSaved != r.mSaved ? l.mSaved > r.mSaved : l.mReads + l.mWrites > r.mReads + r.mWrites;
+	});
+}
+
+void Emulator::CollectCrossings(ExpandingArray<int>& crossings)
+{
+	for (int i = 0; i < 0x10000; i++)
+		if (mCrossings[i])
+			crossings.Push(i);
+	crossings.Sort([&](int a, int b) { return mCrossings[a] > mCrossings[b]; });
+}
+
+void Emulator::CodeLocationName(int ip, char* name, int size)
+{
+	const LinkerObject* lobj = mLinker ? mLinker->FindObjectByAddr(ip) : nullptr;
+	if (lobj && lobj->mIdent)
+	{
+		int	rip = ip - lobj->mAddress;
+		int j = 0;
+		while (j < lobj->mCodeLocations.Size() && (rip < lobj->mCodeLocations[j].mStart || rip >= lobj->mCodeLocations[j].mEnd))
+			j++;
+
+		if (j < lobj->mCodeLocations.Size())
+			snprintf(name, size, "%s (%s:%d)", lobj->mIdent->mString, lobj->mCodeLocations[j].mLocation.mFileName, lobj->mCodeLocations[j].mLocation.mLine);
+		else
+			snprintf(name, size, "%s+%d", lobj->mIdent->mString, rip);
+	}
+	else
+		snprintf(name, size, "$%04x", ip);
+}
+
+void Emulator::DumpMemoryProfile(void)
+{
+	ExpandingArray<DataObject>	objects;
+	CollectDataObjects(objects);
+
+	printf("Zero page candidates\n");
+	printf("       Saved      Reads     Writes  Size : Object\n");
+	int	n = 0;
+	for (int i = 0; i < objects.Size() && n < 20 && objects[i].mSaved > 0; i++)
+	{
+		const DataObject& dobj(objects[i]);
+		if (dobj.mObject->mAddress >= 0x100 && dobj.mObject->mSection->mType != LST_STATIC_STACK)
+		{
+			printf("  %10lld %10lld %10lld %5d : %s\n", (long long)dobj.mSaved, (long long)dobj.mReads, (long long)dobj.mWrites, dobj.mObject->mSize, dobj.mObject->mIdent ? dobj.mObject->mIdent->mString : "");
+			n++;
+		}
+	}
+
+	ExpandingArray<int>	crossings;
+	CollectCrossings(crossings);
+
+	printf("Page crossings\n");
+	printf("      Cycles : Address : Location\n");
+	for (int i = 0; i < crossings.Size() && i < 20; i++)
+	{
+		char	name[200];
+		CodeLocationName(crossings[i], name, sizeof(name));
+		printf("  %10d : %04x : %s\n", mCrossings[crossings[i]], crossings[i], name);
+	}
+}
+
+bool Emulator::WriteMemoryProfile(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		ExpandingArray<DataObject>	objects;
+		CollectDataObjects(objects);
+
+		fprintf(file, "Objects\n");
+		fprintf(file, "Address  Size      Reads     Writes      Saved : Name\n");
+		for (int i = 0; i < objects.Size(); i++)
+		{
+			const DataObject& dobj(objects[i]);
+			fprintf(file, " %04x %5d %10lld %10lld %10lld : %s\n", dobj.mObject->mAddress, dobj.mObject->mSize, (long long)dobj.mReads, (long long)dobj.mWrites, (long long)dobj.mSaved, dobj.mObject->mIdent ? dobj.mObject->mIdent->mString : "");
+		}
+
+		ExpandingArray<int>	crossings;
+		CollectCrossings(crossings);
+
+		fprintf(file, "\nPage crossings\n");
+		fprintf(file, "Address     Cycles : Location\n");
+		for (int i = 0; i < crossings.Size(); i++)
+		{
+			char	name[200];
+			CodeLocationName(crossings[i], name, sizeof(name));
+			fprintf(file, " %04x %10d : %s\n", crossings[i], mCrossings[crossings[i]], name);
+		}
+
+		// One character per eight bytes, the density grows with the
+		// fourth root of the reads and writes
+
+		static const char HeatMap[] = " .:-=+*#%@";
+
+		fprintf(file, "\nHeatmap\n");
+		for (int page = 0; page < 256; page++)
+		{
+			char	line[33];
+			bool	used = false;
+			for (int i = 0; i < 32; i++)
+			{
+				int64	count = 0;
+				for (int j = 0; j < 8; j++)
+				{
+					int	addr = page * 256 + i * 8 + j;
+					count += mReads[addr] + mWrites[addr];
+				}
+
+				int	level = 0;
+				while (count > 0 && level < 9)
+				{
+					level++;
+					count >>= 2;
+				}
+				line[i] = HeatMap[level];
+				if (level)
+					used = true;
+			}
+			line[32] = 0;
+
+			if (used)
+				fprintf(file, " %04x |%s|\n", page * 256, line);
+		}
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
+
+bool Emulator::WriteZeroPageHints(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		ExpandingArray<DataObject>	objects;
+		CollectDataObjects(objects);
+
+		for (int i = 0; i < objects.Size() && objects[i].mSaved > 0; i++)
+		{
+			const DataObject& dobj(objects[i]);
+			if (dobj.mObject->mAddress >= 0x100 && dobj.mObject->mSection->mType != LST_STATIC_STACK && dobj.mObject->mIdent)
+				fprintf(file, "%lld %d %s\n", (long long)dobj.mSaved, dobj.mObject->mSize, dobj.mObject->mIdent->mString);
+		}
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
+
+bool Emulator::WriteProfile(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		ExpandingArray<int64>			inclusive;
+		ExpandingArray<CallFunction>	functions;
+		CollectCallTree(inclusive, functions);
+
+		GrowingArray<int>	lobjFunction(-1);
+		for (int i = 0; i < functions.Size(); i++)
+			if (functions[i].mObject)
+				lobjFunction[functions[i].mObject->mID] = i;
+
+		fprintf(file, "# oscar64 profile\n");
+
+		// All functions of the program, with the calls and exclusive
+		// cycles of the run, unused functions have no calls
+
+		for (int i = 0; i < mLinker->mObjects.Size(); i++)
+		{
+			const LinkerObject* lobj = mLinker->mObjects[i];
+			if ((lobj->mFlags & LOBJF_PLACED) && (lobj->mType == LOT_NATIVE_CODE || lobj->mType == LOT_BYTE_CODE) && lobj->mIdent)
+			{
+				int	f = lobjFunction[lobj->mID];
+				if (f >= 0)
+					fprintf(file, "function %d %lld %s\n", functions[f].mCalls, (long long)functions[f].mExclusive, lobj->mIdent->mString);
+				else
+					fprintf(file, "function 0 0 %s\n", lobj->mIdent->mString);
+			}
+		}
+
+		ExpandingArray<DataObject>	objects;
+		CollectDataObjects(objects);
+
+		for (int i = 0; i < objects.Size() && objects[i].mSaved > 0; i++)
+		{
+			const DataObject& dobj(objects[i]);
+			if (dobj.mObject->mAddress >= 0x100 && dobj.mObject->mSection->mType != LST_STATIC_STACK && dobj.mObject->mIdent)
+				fprintf(file, "zeropage %lld %d %s\n", (long long)dobj.mSaved, dobj.mObject->mSize, dobj.mObject->mIdent->mString);
+		}
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
+
+void Emulator::ProfileCall(int addr, bool bytecode)
+{
+	ChargeCycles();
+
+	int	bank = BankOf(addr);
+
+	int	child = mCallNodes[mCallNode].mChild;
+	while (child >= 0 && (mCallNodes[child].mAddress != addr || mCallNodes[child].mBank != bank))
+		child = mCallNodes[child].mNext;
+
+	if (child < 0)
+	{
+		CallNode	node;
+		node.mAddress = addr;
+		node.mBank = bank;
+		node.mParent = mCallNode;
+		node.mChild = -1;
+		node.mNext = mCallNodes[mCallNode].mChild;
+		node.mCalls = 0;
+		node.mCycles = 0;
+
+		child = mCallNodes.Size();
+		mCallNodes[mCallNode].mChild = child;
+		mCallNodes.Push(node);
+	}
+
+	mCallNodes[child].mCalls++;
+
+	CallFrame	frame;
+	frame.mNode = mCallNode;
+	frame.mByteCode = bytecode;
+	frame.mStack = bytecode ? mRegS : (mRegS + 2) & 0xff;
+	mCallFrames.Push(frame);
+
+	mCallNode = child;
+}
+
+void Emulator::ProfileReturn(bool bytecode)
+{
+	ChargeCycles();
+
+	// Native returns drop all frames above the stack pointer, to survive
+	// return address manipulation, byte code frames are only left by
+	// their own return or when the interpreter itself returns
+
+	while (mCallFrames.Size() > 0)
+	{
+		const CallFrame& frame(mCallFrames[mCallFrames.Size() - 1]);
+		if (bytecode || (frame.mByteCode ? frame.mStack < mRegS : frame.mStack <= mRegS))
+		{
+			bool	done = bytecode && frame.mByteCode;
+			mCallNode = frame.mNode;
+			mCallFrames.Pop();
+			if (done)
+				break;
+		}
+		else
+			break;
+	}
+}
+
+void Emulator::CallNodeName(int node, char* name, int size)
+{
+	int	addr = mCallNodes[node].mAddress;
+
+	LinkerObject* lobj = FindCodeObject(addr, mCallNodes[node].mBank);
+	if (lobj && lobj->mIdent)
+	{
+		if (addr == lobj->mAddress)
+			snprintf(name, size, "%s", lobj->mIdent->mString);
+		else
+			snprintf(name, size, "%s+%d", lobj->mIdent->mString, addr - lobj->mAddress);
+	}
+	else
+		snprintf(name, size, "$%04x", addr);
+}
+
+void Emulator::CollectCallTree(ExpandingArray<int64>& inclusive, ExpandingArray<CallFunction>& functions)
+{
+	// Children have higher indices than their parents, so the inclusive
+	// cycles accumulate in a single backward pass
+
+	inclusive.SetSize(mCallNodes.Size());
+	for (int i = 0; i < mCallNodes.Size(); i++)
+		inclusive[i] = mCallNodes[i].mCycles;
+	for (int i = mCallNodes.Size() - 1; i > 0; i--)
+		inclusive[mCallNodes[i].mParent] += inclusive[i];
+
+	GrowingArray<int>		lobjFunction(-1);
+	ExpandingArray<int>		nodeFunction;
+
+	for (int i = 0; i < mCallNodes.Size(); i++)
+	{
+		const CallNode& node(mCallNodes[i]);
+
+		LinkerObject* lobj = FindCodeObject(node.mAddress, node.mBank);
+
+		int	f = -1;
+		if (lobj)
+			f = lobjFunction[lobj->mID];
+		else
+		{
+			f = 0;
+			while (f < functions.Size() && !(!functions[f].mObject && functions[f].mAddress == node.mAddress && functions[f].mBank == node.mBank))
+				f++;
+			if (f == functions.Size())
+				f = -1;
+		}
+
+		if (f < 0)
+		{
+			CallFunction	cf;
+			cf.mObject = lobj;
+			cf.mAddress = lobj ? lobj->mAddress : node.mAddress;
+			cf.mBank = node.mBank;
+			cf.mCalls = 0;
+			cf.mInclusive = 0;
+			cf.mExclusive = 0;
+
+			f = functions.Size();
+			functions.Push(cf);
+			if (lobj)
+				lobjFunction[lobj->mID] = f;
+		}
+
+		nodeFunction.Push(f);
+
+		functions[f].mCalls += node.mCalls;
+		functions[f].mExclusive += node.mCycles;
+
+		// Recursive calls are already part of the outermost call
+
+		int	p = node.mParent;
+		while (p >= 0 && nodeFunction[p] != f)
+			p = mCallNodes[p].mParent;
+		if (p < 0)
+			functions[f].mInclusive += inclusive[i];
+	}
+}
+
+void Emulator::DumpCallGraph(void)
+{
+	ExpandingArray<int64>			inclusive;
+	ExpandingArray<CallFunction>	functions;
+
+	CollectCallTree(inclusive, functions);
+
+	ExpandingArray<int>	order;
+	for (int i = 0; i < functions.Size(); i++)
+		order.Push(i);
+	order.Sort([&](int a, int b) { return functions[a].mInclusive > functions[b].mInclusive; });
+
+	printf("Call graph\n");
+	printf("       Inclusive      Exclusive      Calls : Function\n");
+	for (int i = 0; i < order.Size() && i < 40; i++)
+	{
+		const CallFunction& cf(functions[order[i]]);
+
+		char	bank[20] = "";
+		if (cf.mBank >= 0)
+			snprintf(bank, sizeof(bank), " [bank %d]", cf.mBank);
+
+		if (cf.mObject && cf.mObject->mIdent)
+			printf("  %14lld %14lld %10d : %s%s\n", (long long)cf.mInclusive, (long long)cf.mExclusive, cf.mCalls, cf.mObject->mIdent->mString, bank);
+		else
+			printf("  %14lld %14lld %10d : $%04x%s\n", (long long)cf.mInclusive, (long long)cf.mExclusive, cf.mCalls, cf.mAddress, bank);
+	}
+
+	if (mMemoryMap)
+	{
+		printf("Bank cycles\n");
+		printf("          Cycles : Bank\n");
+		for (int i = 0; i < 64; i++)
+			if (mBankCycles[i])
+				printf("  %14lld : %d\n", (long long)mBankCycles[i], i);
+	}
+}
+
+static void WriteJSONString(FILE* file, const char* str)
+{
+	fputc('"', file);
+	while (*str)
+	{
+		unsigned char	c = *str++;
+		if (c == '"' || c == '\\')
+			fprintf(file, "\\%c", c);
+		else if (c < 32)
+			fprintf(file, "\\u%04x", c);
+		else
+			fputc(c, file);
+	}
+	fputc('"', file);
+}
+
+void Emulator::WriteCallNode(FILE* file, int node, const ExpandingArray<int64>& inclusive, int depth)
+{
+	char	name[200];
+	CallNodeName(node, name, sizeof(name));
+
+	fprintf(file, "{\"name\": ");
+	WriteJSONString(file, name);
+	fprintf(file, ", \"address\": %d, ", mCallNodes[node].mAddress);
+	if (mCallNodes[node].mBank >= 0)
+		fprintf(file, "\"bank\": %d, ", mCallNodes[node].mBank);
+	fprintf(file, "\"calls\": %d, \"inclusive\": %lld, \"exclusive\": %lld, \"children\": [",
+		mCallNodes[node].mCalls, (long long)inclusive[node], (long long)mCallNodes[node].mCycles);
+
+	int	child = mCallNodes[node].mChild;
+	bool	first = true;
+	while (child >= 0)
+	{
+		fprintf(file, first ? "\n" : ",\n");
+		for (int i = 0; i <= depth; i++)
+			fputc('\t', file);
+		WriteCallNode(file, child, inclusive, depth + 1);
+		first = false;
+		child = mCallNodes[child].mNext;
+	}
+	fprintf(file, "]}");
+}
+
+bool Emulator::WriteCallTree(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		ExpandingArray<int64>			inclusive;
+		ExpandingArray<CallFunction>	functions;
+
+		CollectCallTree(inclusive, functions);
+
+		fprintf(file, "{\n\t\"functions\": [");
+		for (int i = 0; i < functions.Size(); i++)
+		{
+			const CallFunction& cf(functions[i]);
+
+			fprintf(file, i > 0 ? ",\n\t\t" : "\n\t\t");
+			fprintf(file, "{\"name\": ");
+			if (cf.mObject && cf.mObject->mIdent)
+				WriteJSONString(file, cf.mObject->mIdent->mString);
+			else
+			{
+				char	name[10];
+				snprintf(name, sizeof(name), "$%04x", cf.mAddress);
+				WriteJSONString(file, name);
+			}
+			fprintf(file, ", \"address\": %d, ", cf.mAddress);
+			if (cf.mBank >= 0)
+				fprintf(file, "\"bank\": %d, ", cf.mBank);
+			fprintf(file, "\"calls\": %d, \"inclusive\": %lld, \"exclusive\": %lld}", cf.mCalls, (long long)cf.mInclusive, (long long)cf.mExclusive);
+		}
+		fprintf(file, "\n\t],\n\t\"tree\": ");
+		WriteCallNode(file, 0, inclusive, 2);
+		fprintf(file, "\n}\n");
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
+
+void Emulator::WriteCollapsedNode(FILE* file, int node, char* path, int length)
+{
+	char	name[200];
+	CallNodeName(node, name, sizeof(name));
+
+	int	size = int(strlen(name));
+	if (length + size + 2 < 4096)
+	{
+		if (length > 0)
+			path[length++] = ';';
+		memcpy(path + length, name, size + 1);
+		length += size;
+	}
+
+	if (mCallNodes[node].mCycles > 0)
+		fprintf(file, "%s %lld\n", path, (long long)mCallNodes[node].mCycles);
+
+	int	child = mCallNodes[node].mChild;
+	while (child >= 0)
+	{
+		WriteCollapsedNode(file, child, path, length);
+		path[length] = 0;
+		child = mCallNodes[child].mNext;
+	}
+}
+
+bool Emulator::WriteCollapsedStacks(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		char	path[4096];
+		path[0] = 0;
+		WriteCollapsedNode(file, 0, path, 0);
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
+
+uint8 Emulator::ReadMemory(uint16 addr)
+{
+	if (mMemoryProfile)
+		mReads[addr]++;
+
+	if (mUseIORange && addr >= 0xdd80 && addr < 0xde00)
+	{
+		switch (addr & 15)
+		{
+		case 0:
+			return mIORange.mCount0++;
+		case 1:
+			return mIORange.mCount1++;
+		case 2:
+			return mIORange.mDMAAddress & 0xff;
+		case 3:
+			return mIORange.mDMAAddress >> 8;
+		case 4:
+			return mMemory[mIORange.mDMAAddress++];
+		case 5:
+		case 6:
+		case 7:
+			return mIORange.mMirror;
+		case 8:
+		case 9:
+		case 10:
+		case 11:
+			return mIORange.mCycleCount >> 8 * (addr & 3);
+		case 12:
+		case 13:
 		case 14:
 		case 15:
 			return mIORange.mScratch[addr & 3];
@@ -604,66 +1920,1106 @@ uint8 Emulator::ReadMemory(uint16 addr)
 			return 0;
 		}
 	}
+	else if (mVICModel && addr >= 0xd011 && addr <= 0xd01a)
+		return ReadVIC(addr);
+	else if (mPageFlags[addr >> 8] & (PAGEF_REU | PAGEF_PPU))
+		return (mPageFlags[addr >> 8] & PAGEF_REU) ? ReadREU(addr) : ReadPPU(addr);
+	else
+		return mMemory[addr];
+}
+
+void Emulator::WriteMemory(uint16 addr, uint8 data)
+{
+	if (mMemoryProfile)
+		mWrites[addr]++;
+
+	if (mUseIORange && addr >= 0xdd80 && addr < 0xde00)
+	{
+		switch (addr & 15)
+		{
+		case 0:
+			mIORange.mCount0++;
+			break;
+		case 1:
+			mIORange.mCount1++;
+			break;
+		case 2:
+			mIORange.mDMAAddress = (mIORange.mDMAAddress & 0xff00) | data;
+			break;
+		case 3:
+			mIORange.mDMAAddress = (mIORange.mDMAAddress & 0x00ff) | (data << 8);
+			break;
+		case 4:
+			StoreMemory(mIORange.mDMAAddress++, data);
+			break;
+		case 5:
+		case 6:
+		case 7:
+			mIORange.mMirror = data;;
+			break;
+		case 8:
+		case 9:
+		case 10:
+		case 11:
+			mIORange.mCycleCount = mCycleCount;
+			break;
+		case 12:
+		case 13:
+		case 14:
+		case 15:
+			mIORange.mScratch[addr & 3] = data;
+			break;
+		}
+	}
+	else if (mVICModel && addr >= 0xd011 && addr <= 0xd01a)
+		WriteVIC(addr, data);
+	else if (mPageFlags[addr >> 8])
+		WriteBanked(addr, data);
+	else
+		StoreMemory(addr, data);
+}
+
+void Emulator::SetupCartridge(int map, const uint8* boot)
+{
+	// The ROM is kept in 8K pages, four for each bank of the linker
+	// covering $8000 to $ffff
+
+	mMemoryMap = map;
+	mROM = new uint8[64 * 0x8000];
+	for (int i = 0; i < 64; i++)
+		memcpy(mROM + i * 0x8000, mLinker->mCartridge[i] + 0x8000, 0x8000);
+	if (boot)
+		memcpy(mROM, boot, 0x4000);
+
+	mMapper.mBank = 0;
+	mMapper.mControl = 0;
+	mMapper.mSelect = 0;
+	mMapper.mShift = 0;
+	mMapper.mShiftCount = 0;
+	for (int i = 0; i < 8; i++)
+		mMapper.mRegs[i] = 0;
+	mMapper.mPPUControl = 0;
+	mMapper.mPPUStatus = 0;
+	mMapper.mPPUCycle = 0;
+
+	switch (map)
+	{
+	case EMAP_CRT8:
+	case EMAP_CRT16:
+		mPageFlags[0x00] |= PAGEF_IO;
+		mPageFlags[0xde] |= PAGEF_IO;
+		mMemory[0x01] = 0x37;
+		break;
+	case EMAP_EASYFLASH:
+		// Start in the 16K mode set by the boot code in the ultimax ROM
+		mPageFlags[0x00] |= PAGEF_IO;
+		mPageFlags[0xde] |= PAGEF_IO;
+		mMemory[0x01] = 0x37;
+		mMapper.mControl = 0x87;
+		break;
+	case EMAP_NES_MMC1:
+		mMapper.mRegs[0] = 0x0c;
+		break;
+	case EMAP_NES_MMC3:
+		mMapper.mRegs[7] = 1;
+		break;
+	}
+
+	if (map >= EMAP_NES)
+	{
+		for (int i = 0x20; i < 0x40; i++)
+			mPageFlags[i] |= PAGEF_IO | PAGEF_PPU;
+	}
+
+	UpdateBanks();
+}
+
+void Emulator::SetupREU(int size)
+{
+	mREUSize = size;
+	mREU = new uint8[size];
+	memset(mREU, 0, size);
+	memset(&mREUState, 0, sizeof(mREUState));
+	mREUState.mLength = mREUState.mShadowLength = 0xffff;
+
+	mPageFlags[0xdf] |= PAGEF_IO | PAGEF_REU;
+	mPageFlags[0xff] |= PAGEF_IO;
+}
+
+void Emulator::MapWindow(int window, int page)
+{
+	if (mMapper.mPage[window] != page)
+	{
+		int	start = window * 0x2000;
+
+		if (mMapper.mPage[window] < 0)
+			memcpy(mWindowRAM + start, mMemory + start, 0x2000);
+
+		for (int i = start; i < start + 0x2000; i++)
+			if (mDecodedCode[i])
+				DiscardCode(i);
+
+		if (page < 0)
+			memcpy(mMemory + start, mWindowRAM + start, 0x2000);
+		else
+			memcpy(mMemory + start, mROM + page * 0x2000, 0x2000);
+
+		mMapper.mPage[window] = page;
+		for (int i = 0; i < 0x20; i++)
+		{
+			if (page < 0)
+				mPageFlags[(start >> 8) + i] &= ~PAGEF_ROM;
+			else
+				mPageFlags[(start >> 8) + i] |= PAGEF_ROM;
+		}
+	}
+}
+
+static int MMC1Page(int bank)
+{
+	// The last 16K bank is stored at $c000 of the last linker bank
+	return bank < 15 ? 4 * bank : 4 * 15 + 2;
+}
+
+static int MMC3Page(int bank)
+{
+	bank &= 63;
+	return bank < 62 ? 4 * (bank >> 1) + (bank & 1) : 4 * 31 + 2 + (bank & 1);
+}
+
+void Emulator::UpdateBanks(void)
+{
+	int		pages[4] = { -1, -1, -1, -1 };
+	int		bank = 4 * (mMapper.mBank & 63);
+	bool	loram = (mMemory[0x01] & 3) == 3, hiram = (mMemory[0x01] & 2) != 0;
+
+	switch (mMemoryMap)
+	{
+	case EMAP_CRT8:
+		if (loram && !(mMapper.mBank & 0x80))
+			pages[0] = bank;
+		break;
+	case EMAP_CRT16:
+		if (loram)
+			pages[0] = bank;
+		if (hiram)
+			pages[1] = bank + 1;
+		break;
+	case EMAP_EASYFLASH:
+	{
+		bool	game = (mMapper.mControl & 4) ? (mMapper.mControl & 1) != 0 : true;
+		bool	exrom = (mMapper.mControl & 2) != 0;
+
+		if (game && !exrom)
+		{
+			pages[0] = bank;
+			pages[3] = bank + 1;
+		}
+		else if (exrom)
+		{
+			if (loram)
+				pages[0] = bank;
+			if (game && hiram)
+				pages[1] = bank + 1;
+		}
+	}	break;
+	case EMAP_NES:
+		for (int i = 0; i < 4; i++)
+			pages[i] = i;
+		break;
+	case EMAP_NES_MMC1:
+	{
+		int	prg = mMapper.mRegs[3] & 15, lo, hi;
+		switch ((mMapper.mRegs[0] >> 2) & 3)
+		{
+		case 0:
+		case 1:
+			lo = prg & 14;
+			hi = lo + 1;
+			break;
+		case 2:
+			lo = 0;
+			hi = prg;
+			break;
+		default:
+			lo = prg;
+			hi = 15;
+			break;
+		}
+		pages[0] = MMC1Page(lo);
+		pages[1] = pages[0] + 1;
+		pages[2] = MMC1Page(hi);
+		pages[3] = pages[2] + 1;
+	}	break;
+	case EMAP_NES_MMC3:
+		pages[0] = MMC3Page((mMapper.mSelect & 0x40) ? 62 : mMapper.mRegs[6]);
+		pages[1] = MMC3Page(mMapper.mRegs[7]);
+		pages[2] = MMC3Page((mMapper.mSelect & 0x40) ? mMapper.mRegs[6] : 62);
+		pages[3] = MMC3Page(63);
+		break;
+	}
+
+	for (int i = 0; i < 4; i++)
+		MapWindow(4 + i, pages[i]);
+}
+
+void Emulator::WriteBanked(uint16 addr, uint8 data)
+{
+	if (mREU && addr >= 0xdf00)
+	{
+		if (addr < 0xe000)
+		{
+			WriteREU(addr, data);
+			return;
+		}
+		else if (addr == 0xff00 && (mREUState.mCommand & 0x90) == 0x80)
+			ExecuteREU();
+	}
+
+	if (mPageFlags[addr >> 8] & PAGEF_PPU)
+	{
+		if (!(addr & 7))
+			mMapper.mPPUControl = data;
+		return;
+	}
+
+	switch (mMemoryMap)
+	{
+	case EMAP_CRT8:
+	case EMAP_CRT16:
+		if ((addr >> 8) == 0xde)
+		{
+			mMapper.mBank = data;
+			UpdateBanks();
+			return;
+		}
+		break;
+	case EMAP_EASYFLASH:
+		if ((addr >> 8) == 0xde)
+		{
+			if (addr == 0xde00)
+				mMapper.mBank = data;
+			else if (addr == 0xde02)
+				mMapper.mControl = data;
+			UpdateBanks();
+			return;
+		}
+		break;
+	case EMAP_NES_MMC1:
+		if (addr >= 0x8000)
+		{
+			// Serial load of the registers, five writes of one bit each
+			if (data & 0x80)
+			{
+				mMapper.mShift = 0;
+				mMapper.mShiftCount = 0;
+				mMapper.mRegs[0] |= 0x0c;
+			}
+			else
+			{
+				mMapper.mShift |= (data & 1) << mMapper.mShiftCount++;
+				if (mMapper.mShiftCount == 5)
+				{
+					mMapper.mRegs[(addr >> 13) & 3] = mMapper.mShift;
+					mMapper.mShift = 0;
+					mMapper.mShiftCount = 0;
+				}
+			}
+			UpdateBanks();
+			return;
+		}
+		break;
+	case EMAP_NES_MMC3:
+		if (addr >= 0x8000)
+		{
+			if (addr < 0xa000)
+			{
+				if (addr & 1)
+					mMapper.mRegs[mMapper.mSelect & 7] = data;
+				else
+					mMapper.mSelect = data;
+				UpdateBanks();
+			}
+			return;
+		}
+		break;
+	}
+
+	if (mPageFlags[addr >> 8] & PAGEF_ROM)
+		mWindowRAM[addr] = data;
+	else
+	{
+		StoreMemory(addr, data);
+		if (addr == 0x01)
+			UpdateBanks();
+	}
+}
+
+uint8 Emulator::ReadPPU(uint16 addr)
+{
+	// Only the vertical blank flag of the status register is modelled,
+	// reading it clears the flag
+
+	if ((addr & 7) == 2)
+	{
+		uint8	status = mMapper.mPPUStatus;
+		mMapper.mPPUStatus &= 0x7f;
+		return status;
+	}
+	else
+		return 0;
+}
+
+void Emulator::FramePPU(void)
+{
+	// Start of the vertical blank of an NTSC frame, with an NMI when
+	// enabled in the control register
+
+	mMapper.mPPUCycle += 29781;
+	mMapper.mPPUStatus |= 0x80;
+
+	if (mMapper.mPPUControl & 0x80)
+	{
+		int	stack = mRegS;
+
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mIP >> 8);
+		mRegS--;
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mIP & 0xff);
+		mRegS--;
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, (mRegP & ~(STATUS_INTERRUPT | 0x10)) | 0x20 | (mIRQMask ? STATUS_INTERRUPT : 0));
+		mRegS--;
+		mIRQMask = true;
+
+		int	addr = mMemory[0xfffa] + 256 * mMemory[0xfffb];
+		if (mProfile)
+		{
+			ProfileCall(addr, false);
+			mCallFrames[mCallFrames.Size() - 1].mStack = stack;
+		}
+
+		mCycleCount += 7;
+		mCycles[addr] += 7;
+		mIP = addr;
+	}
+}
+
+uint8 Emulator::ReadREU(uint16 addr)
+{
+	switch (addr & 0x1f)
+	{
+	case 0:
+	{
+		uint8	status = mREUState.mStatus | (mREUSize >= 0x40000 ? 0x10 : 0x00);
+		mREUState.mStatus &= 0x1f;
+		return status;
+	}
+	case 1:
+		return mREUState.mCommand;
+	case 2:
+		return mREUState.mAddress & 0xff;
+	case 3:
+		return mREUState.mAddress >> 8;
+	case 4:
+		return mREUState.mREUAddress & 0xff;
+	case 5:
+		return (mREUState.mREUAddress >> 8) & 0xff;
+	case 6:
+		return mREUState.mREUAddress >> 16;
+	case 7:
+		return mREUState.mLength & 0xff;
+	case 8:
+		return mREUState.mLength >> 8;
+	case 9:
+		return mREUState.mIRQMask;
+	case 10:
+		return mREUState.mControl;
+	default:
+		return 0xff;
+	}
+}
+
+void Emulator::WriteREU(uint16 addr, uint8 data)
+{
+	// Address and length writes also load the shadow registers used by
+	// the autoload of a transfer
+
+	REUState& r(mREUState);
+
+	switch (addr & 0x1f)
+	{
+	case 1:
+		r.mCommand = data;
+		if ((data & 0x90) == 0x90)
+			ExecuteREU();
+		break;
+	case 2:
+		r.mAddress = r.mShadowAddress = (r.mShadowAddress & 0xff00) | data;
+		break;
+	case 3:
+		r.mAddress = r.mShadowAddress = (r.mShadowAddress & 0x00ff) | (data << 8);
+		break;
+	case 4:
+		r.mREUAddress = r.mShadowREUAddress = (r.mShadowREUAddress & 0xffff00) | data;
+		break;
+	case 5:
+		r.mREUAddress = r.mShadowREUAddress = (r.mShadowREUAddress & 0xff00ff) | (data << 8);
+		break;
+	case 6:
+		r.mREUAddress = r.mShadowREUAddress = (r.mShadowREUAddress & 0x00ffff) | (data << 16);
+		break;
+	case 7:
+		r.mLength = r.mShadowLength = (r.mShadowLength & 0xff00) | data;
+		break;
+	case 8:
+		r.mLength = r.mShadowLength = (r.mShadowLength & 0x00ff) | (data << 8);
+		break;
+	case 9:
+		r.mIRQMask = data;
+		break;
+	case 10:
+		r.mControl = data;
+		break;
+	}
+}
+
+void Emulator::ExecuteREU(void)
+{
+	REUState& r(mREUState);
+
+	int		length = r.mLength ? r.mLength : 0x10000;
+	int		type = r.mCommand & 3;
+	uint16	addr = r.mAddress;
+	uint32	raddr = r.mREUAddress;
+
+	r.mStatus &= ~0x60;
+
+	int	n = 0;
+	while (n < length)
+	{
+		uint8&	rdata(mREU[raddr & (mREUSize - 1)]);
+		uint8	data = mMemory[addr];
+
+		n++;
+		if (type == 0)
+			rdata = data;
+		else if (type == 3)
+		{
+			if (rdata != data)
+			{
+				r.mStatus |= 0x20;
+				break;
+			}
+		}
+		else
+		{
+			if (mPageFlags[addr >> 8] & PAGEF_ROM)
+				mWindowRAM[addr] = rdata;
+			else
+				StoreMemory(addr, rdata);
+			if (type == 2)
+				rdata = data;
+		}
+
+		if (!(r.mControl & 0x80))
+			addr++;
+		if (!(r.mControl & 0x40))
+			raddr = (raddr + 1) & 0xffffff;
+	}
+
+	if (!(r.mStatus & 0x20))
+		r.mStatus |= 0x40;
+
+	mDMACycles += type == 2 ? 2 * n : n;
+
+	if (r.mCommand & 0x20)
+	{
+		r.mAddress = r.mShadowAddress;
+		r.mREUAddress = r.mShadowREUAddress;
+		r.mLength = r.mShadowLength;
+	}
+	else
+	{
+		r.mAddress = addr;
+		r.mREUAddress = raddr;
+		r.mLength = n < length ? length - n : 1;
+	}
+
+	r.mCommand = (r.mCommand & 0x7f) | 0x10;
+}
+
+int Emulator::BankOf(int addr)
+{
+	int	page = mMapper.mPage[(addr >> 13) & 7];
+	return page < 0 ? -1 : page >> 2;
+}
+
+LinkerObject* Emulator::FindCodeObject(int addr, int bank)
+{
+	if (!mLinker)
+		return nullptr;
+	else if (bank >= 0)
+	{
+		// Code in a bank that is not known to the linker, e.g. the boot
+		// code of an easyflash, must not be taken for another bank
+
+		LinkerObject* lobj = mLinker->FindObjectByAddr(bank, addr);
+		if (lobj && lobj->mRegion && lobj->mRegion->mCartridgeBanks && !(lobj->mRegion->mCartridgeBanks & (1ULL << bank)))
+			return nullptr;
+		return lobj;
+	}
 	else
+		return mLinker->FindObjectByAddr(addr);
+}
+
+uint8 Emulator::ReadVIC(uint16 addr)
+{
+	switch (addr)
+	{
+	case 0xd011:
+		return (mMemory[addr] & 0x7f) | ((mRaster >> 1) & 0x80);
+	case 0xd012:
+		return mRaster & 0xff;
+	case 0xd019:
+		return mIRQLatch | (mIRQLine ? 0xf0 : 0x70);
+	case 0xd01a:
+		return mIRQEnable | 0xf0;
+	default:
 		return mMemory[addr];
+	}
 }
 
-void Emulator::WriteMemory(uint16 addr, uint8 data)
+void Emulator::WriteVIC(uint16 addr, uint8 data)
 {
-	if (mUseIORange && addr >= 0xdd80 && addr < 0xde00)
+	switch (addr)
 	{
-		switch (addr & 15)
+	case 0xd011:
+		mMemory[addr] = data;
+		mRasterCompare = (mRasterCompare & 0xff) | ((data & 0x80) << 1);
+		break;
+	case 0xd012:
+		mRasterCompare = (mRasterCompare & 0x100) | data;
+		break;
+	case 0xd019:
+		mIRQLatch &= ~data;
+		break;
+	case 0xd01a:
+		mIRQEnable = data & 0x0f;
+		break;
+	default:
+		mMemory[addr] = data;
+		break;
+	}
+
+	mIRQLine = (mIRQLatch & mIRQEnable) != 0;
+}
+
+void Emulator::RasterLine(void)
+{
+	while (mCycleCount >= mRasterCycle)
+	{
+		mRasterCycle += mRasterLineCycles;
+		mRaster++;
+		if (mRaster == mRasterLines)
 		{
-		case 0:
-			mIORange.mCount0++;
+			mFrames.Push(mFrame);
+			mFrame.mStolen = 0;
+			mFrame.mIRQ = 0;
+			mRaster = 0;
+		}
+
+		if (mRaster == 0x30)
+			mBadLines = (mMemory[0xd011] & 0x10) != 0;
+
+		// Character and color fetch on bad lines, three cycles to take
+		// over the bus and two per sprite in its display range
+
+		int	stolen = 0;
+		if (mBadLines && mRaster >= 0x30 && mRaster <= 0xf7 && (mRaster & 7) == (mMemory[0xd011] & 7))
+			stolen += 40;
+
+		uint8	sprites = mMemory[0xd015];
+		if (sprites)
+		{
+			int	n = 0;
+			for (int i = 0; i < 8; i++)
+			{
+				if (sprites & (1 << i))
+				{
+					int	dy = mRaster - mMemory[0xd001 + 2 * i] - 1;
+					if (dy >= 0 && dy < ((mMemory[0xd017] & (1 << i)) ? 42 : 21))
+						n++;
+				}
+			}
+			if (n)
+				stolen += 3 + 2 * n;
+		}
+
+		if (stolen)
+		{
+			mCycleCount += stolen;
+			mCycles[mIP] += stolen;
+			mFrame.mStolen += stolen;
+		}
+
+		if (mRaster == mRasterCompare)
+		{
+			if (mIRQHandler >= 0 && (mIRQEnable & 0x01))
+				mIRQOverrun = true;
+			mIRQLatch |= 0x01;
+			mIRQRaster = mRaster;
+		}
+	}
+
+	mIRQLine = (mIRQLatch & mIRQEnable) != 0;
+}
+
+void Emulator::Interrupt(void)
+{
+	int	stack = mRegS;
+
+	mCalls[mRegS] = false;
+	StoreMemory(0x100 + mRegS, mIP >> 8);
+	mRegS--;
+	mCalls[mRegS] = false;
+	StoreMemory(0x100 + mRegS, mIP & 0xff);
+	mRegS--;
+	mCalls[mRegS] = false;
+	StoreMemory(0x100 + mRegS, (mRegP & ~(STATUS_INTERRUPT | 0x10)) | 0x20 | (mIRQMask ? STATUS_INTERRUPT : 0));
+	mRegS--;
+	mIRQMask = true;
+
+	int	cycles = 7, addr;
+	if (mMemory[0x01] & 0x02)
+	{
+		// Kernal entry at $ff48 saves the registers before it jumps
+		// through $0314
+
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mRegA);
+		mRegS--;
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mRegX);
+		mRegS--;
+		mCalls[mRegS] = false;
+		StoreMemory(0x100 + mRegS, mRegY);
+		mRegS--;
+		cycles += 29;
+		addr = mMemory[0x0314] + 256 * mMemory[0x0315];
+	}
+	else
+		addr = mMemory[0xfffe] + 256 * mMemory[0xffff];
+
+	if (mProfile)
+	{
+		ProfileCall(addr, false);
+		mCallFrames[mCallFrames.Size() - 1].mStack = stack;
+	}
+
+	if (mIRQHandler < 0)
+	{
+		int	i = 0;
+		while (i < mIRQHandlers.Size() && (mIRQHandlers[i].mAddress != addr || mIRQHandlers[i].mLine != mIRQRaster))
+			i++;
+		if (i == mIRQHandlers.Size())
+		{
+			IRQHandler	h;
+			h.mAddress = addr;
+			h.mLine = mIRQRaster;
+			h.mCalls = h.mOverruns = h.mMaxCycles = 0;
+			h.mCycles = 0;
+			mIRQHandlers.Push(h);
+		}
+
+		mIRQHandler = i;
+		mIRQStack = stack;
+		mIRQStart = mCycleCount;
+		mIRQOverrun = false;
+	}
+
+	mCycleCount += cycles;
+	mCycles[addr] += cycles;
+	mIP = addr;
+}
+
+void Emulator::ReturnInterrupt(void)
+{
+	mRegS++;
+	mRegP = mMemory[0x100 + mRegS];
+	mIRQMask = (mRegP & STATUS_INTERRUPT) != 0;
+	mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS];
+	mRegS += 2;
+
+	if (mIRQHandler >= 0 && mRegS == mIRQStack)
+	{
+		IRQHandler&	h(mIRQHandlers[mIRQHandler]);
+
+		int	cycles = mCycleCount - mIRQStart;
+		h.mCalls++;
+		h.mCycles += cycles;
+		if (cycles > h.mMaxCycles)
+			h.mMaxCycles = cycles;
+		if (mIRQOverrun)
+			h.mOverruns++;
+
+		mFrame.mIRQ += cycles;
+		mIRQHandler = -1;
+	}
+}
+
+void Emulator::DumpFrameTiming(void)
+{
+	int	frameCycles = mRasterLines * mRasterLineCycles;
+
+	int64	stolen = 0, irq = 0;
+	int		maxStolen = 0, maxIRQ = 0, minFree = frameCycles;
+	for (int i = 0; i < mFrames.Size(); i++)
+	{
+		const FrameTiming& ft(mFrames[i]);
+		stolen += ft.mStolen;
+		irq += ft.mIRQ;
+		if (ft.mStolen > maxStolen)
+			maxStolen = ft.mStolen;
+		if (ft.mIRQ > maxIRQ)
+			maxIRQ = ft.mIRQ;
+		if (frameCycles - ft.mStolen - ft.mIRQ < minFree)
+			minFree = frameCycles - ft.mStolen - ft.mIRQ;
+	}
+
+	printf("Frame timing %s, %d frames of %d cycles\n", mVICModel == VICM_PAL ? "PAL" : "NTSC", mFrames.Size(), frameCycles);
+	if (mFrames.Size() > 0)
+	{
+		int	n = mFrames.Size();
+		printf("         Average    Maximum\n");
+		printf("  %10d %10d : Stolen by VIC\n", int(stolen / n), maxStolen);
+		printf("  %10d %10d : Interrupts\n", int(irq / n), maxIRQ);
+		printf("  %10d %10d : Main program, average and minimum\n", int(frameCycles - (stolen + irq) / n), minFree);
+	}
+
+	if (mIRQHandlers.Size() > 0)
+	{
+		printf("Interrupt handlers\n");
+		printf("       Calls    Average    Maximum  Overruns : Line Handler\n");
+		for (int i = 0; i < mIRQHandlers.Size(); i++)
+		{
+			const IRQHandler& h(mIRQHandlers[i]);
+			LinkerObject* lobj = mLinker ? mLinker->FindObjectByAddr(h.mAddress) : nullptr;
+
+			printf("  %10d %10d %10d %9d : %4d ", h.mCalls, h.mCalls ? int(h.mCycles / h.mCalls) : 0, h.mMaxCycles, h.mOverruns, h.mLine);
+			if (lobj && lobj->mIdent)
+				printf("%s\n", lobj->mIdent->mString);
+			else
+				printf("$%04x\n", h.mAddress);
+		}
+	}
+}
+
+void Emulator::TraceInstruction(int ip, int iip, int trace)
+{
+	AsmInsData	d = CPUInsData[mCPU][mMemory[ip]];
+	int			addr = 0, taddr;
+
+	// Quad instructions are traced at the opcode after the prefix
+
+	if (mCPU == ASMCPU_45GS02 && mMemory[ip] == ASM_QUAD_PREFIX && mMemory[ip + 1] == ASM_QUAD_PREFIX && QuadInsData[mMemory[ip + 2]].mType != ASMIT_INV)
+	{
+		ip += 2;
+		d = QuadInsData[mMemory[ip]];
+	}
+
+	int			nip = ip + 1;
+
+	switch (d.mMode)
+	{
+		case ASMIM_IMPLIED:
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x __ __ %s         (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], AsmInstructionNames[d.mType], mRegA, mRegX, mRegY, mRegP, mRegS);
 			break;
-		case 1:
-			mIORange.mCount1++;
+		case ASMIM_IMMEDIATE:
+			addr = mMemory[nip++];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s #$%02x    (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], mMemory[ip+1], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS);
 			break;
-		case 2:
-			mIORange.mDMAAddress = (mIORange.mDMAAddress & 0xff00) | data;
+		case ASMIM_ZERO_PAGE:
+			addr = mMemory[nip++];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s $%02x     (A:%02x X:%02x Y:%02x P:%02x S:%02x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS, mMemory[addr]);
 			break;
-		case 3:
-			mIORange.mDMAAddress = (mIORange.mDMAAddress & 0x00ff) | (data << 8);
+		case ASMIM_ZERO_PAGE_X:
+			taddr = mMemory[nip++];
+			addr = (taddr + mRegX) & 0xff;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s $%02x,x   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
 			break;
-		case 4:
-			mMemory[mIORange.mDMAAddress++] = data;
+		case ASMIM_ZERO_PAGE_Y:
+			taddr = mMemory[nip++];
+			addr = (taddr + mRegY) & 0xff;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s $%02x,y   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
 			break;
-		case 5:
-		case 6:
-		case 7:
-			mIORange.mMirror = data;;
+		case ASMIM_ABSOLUTE:
+			addr = mMemory[nip] + 256 * mMemory[nip + 1];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x %02x %s $%04x   (A:%02x X:%02x Y:%02x P:%02x S:%02x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS, mMemory[addr]);
+			nip += 2;
 			break;
-		case 8:
-		case 9:
-		case 10:
-		case 11:
-			mIORange.mCycleCount = mCycleCount;
+		case ASMIM_ABSOLUTE_X:
+			taddr = mMemory[nip] + 256 * mMemory[nip + 1];
+			addr = (taddr + mRegX) & 0xffff;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x %02x %s $%04x,x (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
+			nip += 2;
 			break;
-		case 12:
-		case 13:
-		case 14:
-		case 15:
-			mIORange.mScratch[addr & 3] = data;
+		case ASMIM_ABSOLUTE_Y:
+			taddr = mMemory[nip] + 256 * mMemory[nip + 1];
+			addr = (taddr + mRegY) & 0xffff;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x %02x %s $%04x,y (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
+			nip += 2;
+			break;
+		case ASMIM_INDIRECT:
+			taddr = mMemory[nip] + 256 * mMemory[nip + 1];
+			nip += 2;
+			addr = mMemory[taddr] + 256 * mMemory[taddr + 1];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x %02x %s ($%04x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
 			break;
+		case ASMIM_INDIRECT_X:
+			taddr = (mMemory[nip++] + mRegX) & 0xff;
+			addr = mMemory[taddr] + 256 * mMemory[taddr + 1];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s ($%02x,x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], mMemory[ip + 1], mRegA, mRegX, mRegY, mRegP, mRegS, taddr, addr, mMemory[addr]);
+			break;
+		case ASMIM_INDIRECT_Y:
+			taddr = mMemory[nip++];
+			addr = (mMemory[taddr] + 256 * mMemory[taddr + 1] + mRegY) & 0xffff;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s ($%02x),y (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
+			break;
+		case ASMIM_INDIRECT_ZERO_PAGE:
+			taddr = mMemory[nip++];
+			addr = mMemory[taddr] + 256 * mMemory[(taddr + 1) & 0xff];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s ($%02x)   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
+			break;
+		case ASMIM_INDIRECT_ABSOLUTE_X:
+			taddr = mMemory[nip] + 256 * mMemory[nip + 1];
+			nip += 2;
+			addr = mMemory[(taddr + mRegX) & 0xffff] + 256 * mMemory[(taddr + mRegX + 1) & 0xffff];
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x %02x %s ($%04x,x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
+			break;
+		case ASMIM_RELATIVE:
+			taddr = mMemory[nip++];
+			if (taddr & 0x80)
+				addr = taddr + nip - 256;
+			else
+				addr = taddr + nip;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x __ %s $%02x     (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
+			break;
+		case ASMIM_RELATIVE_LONG:
+			taddr = mMemory[nip] + 256 * mMemory[nip + 1];
+			nip += 2;
+			addr = (taddr + nip - 1) & 0xffff;
+			if (trace & TRACEF_NATIVE)
+				printf("%04x : %04x %02x %02x %02x %s $%04x   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
+			break;
+	}
+
+	if ((trace & TRACEF_BYTECODE) && ip == 0x0862)
+	{
+		unsigned	accu = mMemory[BC_REG_ACCU] + (mMemory[BC_REG_ACCU + 1] << 8) + (mMemory[BC_REG_ACCU + 2] << 16) + (mMemory[BC_REG_ACCU + 3] << 24);
+		int	ptr = mMemory[BC_REG_ADDR] + 256 * mMemory[BC_REG_ADDR + 1];
+		int	sp = mMemory[BC_REG_STACK] + 256 * mMemory[BC_REG_STACK + 1];
+		printf("%04x  (A:%08x P:%04x S:%04x) %04x %04x %04x %04x  %04x %04x %04x %04x  %04x %04x %04x %04x  %04x %04x %04x %04x : %04x\n", addr, accu, ptr, sp,
+			mMemory[BC_REG_TMP +  0] + 256 * mMemory[BC_REG_TMP +  1],
+			mMemory[BC_REG_TMP +  2] + 256 * mMemory[BC_REG_TMP +  3],
+			mMemory[BC_REG_TMP +  4] + 256 * mMemory[BC_REG_TMP +  5],
+			mMemory[BC_REG_TMP +  6] + 256 * mMemory[BC_REG_TMP +  7],
+
+			mMemory[BC_REG_TMP +  8] + 256 * mMemory[BC_REG_TMP +  9],
+			mMemory[BC_REG_TMP + 10] + 256 * mMemory[BC_REG_TMP + 11],
+			mMemory[BC_REG_TMP + 12] + 256 * mMemory[BC_REG_TMP + 13],
+			mMemory[BC_REG_TMP + 14] + 256 * mMemory[BC_REG_TMP + 15],
+
+			mMemory[BC_REG_TMP + 16] + 256 * mMemory[BC_REG_TMP + 17],
+			mMemory[BC_REG_TMP + 18] + 256 * mMemory[BC_REG_TMP + 19],
+			mMemory[BC_REG_TMP + 20] + 256 * mMemory[BC_REG_TMP + 21],
+			mMemory[BC_REG_TMP + 22] + 256 * mMemory[BC_REG_TMP + 23],
+
+			mMemory[BC_REG_TMP + 24] + 256 * mMemory[BC_REG_TMP + 25],
+			mMemory[BC_REG_TMP + 26] + 256 * mMemory[BC_REG_TMP + 27],
+			mMemory[BC_REG_TMP + 28] + 256 * mMemory[BC_REG_TMP + 29],
+			mMemory[BC_REG_TMP + 30] + 256 * mMemory[BC_REG_TMP + 31],
+
+			mMemory[0x9f9e] + 256 * mMemory[0x9f9f]
+
+
+		);
+	}
+}
+
+// Registers and timing state of a snapshot, followed in the file by the
+// memory, the state of a banked memory model with the RAM below its ROM
+// and the state and memory of the REU
+
+static const char SnapshotMagic[8] = { 'O', 'S', 'C', 'S', 'N', 'A', 'P', '2' };
+
+struct SnapshotState
+{
+	char	mMagic[8];
+	uint32	mProgramHash;
+	int		mIP, mCycleCount, mJiffyCycles, mVICModel, mMemoryMap, mREUSize;
+	uint8	mRegA, mRegX, mRegY, mRegZ, mRegS, mRegP;
+	bool	mIRQMask, mIRQLine, mBadLines;
+	int		mRaster, mRasterCompare, mRasterCycle, mIRQRaster;
+	uint8	mIRQLatch, mIRQEnable;
+	bool	mCalls[0x100];
+};
+
+uint32 Emulator::HashMemory(int start, int end)
+{
+	uint32	hash = 2166136261u;
+	for (int i = start; i < end; i++)
+		hash = (hash ^ mMemory[i]) * 16777619u;
+	if (mROM)
+	{
+		for (int i = 0; i < 64 * 0x8000; i++)
+			hash = (hash ^ mROM[i]) * 16777619u;
+	}
+	return hash;
+}
+
+bool Emulator::SaveSnapshot(const char* filename)
+{
+	SnapshotState	ss;
+	memset(&ss, 0, sizeof(ss));
+
+	memcpy(ss.mMagic, SnapshotMagic, 8);
+	ss.mProgramHash = mProgramHash;
+	ss.mIP = mIP;
+	ss.mCycleCount = mCycleCount;
+	ss.mJiffyCycles = mJiffyCycles;
+	ss.mVICModel = mVICModel;
+	ss.mMemoryMap = mMemoryMap;
+	ss.mREUSize = mREUSize;
+	ss.mRegA = mRegA;
+	ss.mRegX = mRegX;
+	ss.mRegY = mRegY;
+	ss.mRegZ = mRegZ;
+	ss.mRegS = mRegS;
+	ss.mRegP = mRegP;
+	ss.mIRQMask = mIRQMask;
+	if (mVICModel)
+	{
+		ss.mIRQLine = mIRQLine;
+		ss.mBadLines = mBadLines;
+		ss.mRaster = mRaster;
+		ss.mRasterCompare = mRasterCompare;
+		ss.mRasterCycle = mRasterCycle;
+		ss.mIRQRaster = mIRQRaster;
+		ss.mIRQLatch = mIRQLatch;
+		ss.mIRQEnable = mIRQEnable;
+	}
+	memcpy(ss.mCalls, mCalls, sizeof(mCalls));
+
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		bool	ok = 
+			fwrite(&ss, sizeof(ss), 1, file) == 1 &&
+			fwrite(&mIORange, sizeof(mIORange), 1, file) == 1 &&
+			fwrite(mMemory, 0x10000, 1, file) == 1;
+		if (ok && mMemoryMap)
+			ok = fwrite(&mMapper, sizeof(mMapper), 1, file) == 1 && fwrite(mWindowRAM, 0x10000, 1, file) == 1;
+		if (ok && mREU)
+			ok = fwrite(&mREUState, sizeof(mREUState), 1, file) == 1 && fwrite(mREU, mREUSize, 1, file) == 1;
+		fclose(file);
+
+		if (ok)
+		{
+			fprintf(mOutput, "Snapshot at cycle %d, $%04x\n", mCycleCount, mIP);
+			mSnapshotPath = nullptr;
 		}
+		return ok;
 	}
 	else
-		mMemory[addr] = data;
+		return false;
+}
+
+bool Emulator::LoadSnapshot(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "rb");
+	if (file)
+	{
+		SnapshotState	ss;
+		bool	ok =
+			fread(&ss, sizeof(ss), 1, file) == 1 &&
+			!memcmp(ss.mMagic, SnapshotMagic, 8) && ss.mProgramHash == mProgramHash && ss.mVICModel == mVICModel &&
+			ss.mMemoryMap == mMemoryMap && ss.mREUSize == mREUSize &&
+			fread(&mIORange, sizeof(mIORange), 1, file) == 1 &&
+			fread(mMemory, 0x10000, 1, file) == 1;
+		if (ok && mMemoryMap)
+			ok = fread(&mMapper, sizeof(mMapper), 1, file) == 1 && fread(mWindowRAM, 0x10000, 1, file) == 1;
+		if (ok && mREU)
+			ok = fread(&mREUState, sizeof(mREUState), 1, file) == 1 && fread(mREU, mREUSize, 1, file) == 1;
+		fclose(file);
+
+		if (ok)
+		{
+			mIP = ss.mIP;
+			mCycleCount = ss.mCycleCount;
+			mJiffyCycles = ss.mJiffyCycles;
+			mRegA = ss.mRegA;
+			mRegX = ss.mRegX;
+			mRegY = ss.mRegY;
+			mRegZ = ss.mRegZ;
+			mRegS = ss.mRegS;
+			mRegP = ss.mRegP;
+			mIRQMask = ss.mIRQMask;
+			if (mVICModel)
+			{
+				mRasterLines = mVICModel == VICM_PAL ? 312 : 263;
+				mRasterLineCycles = mVICModel == VICM_PAL ? 63 : 65;
+				mIRQLine = ss.mIRQLine;
+				mBadLines = ss.mBadLines;
+				mRaster = ss.mRaster;
+				mRasterCompare = ss.mRasterCompare;
+				mRasterCycle = ss.mRasterCycle;
+				mIRQRaster = ss.mIRQRaster;
+				mIRQLatch = ss.mIRQLatch;
+				mIRQEnable = ss.mIRQEnable;
+			}
+			memcpy(mCalls, ss.mCalls, sizeof(mCalls));
+
+			for (int i = 0; i < 0x100; i++)
+			{
+				if (mMapper.mPage[i >> 5] < 0)
+					mPageFlags[i] &= ~PAGEF_ROM;
+				else
+					mPageFlags[i] |= PAGEF_ROM;
+			}
+
+			mResume = true;
+		}
+
+		return ok;
+	}
+	else
+		return false;
 }
 
 int Emulator::Emulate(int startIP, int exitIP, int trace, bool iorange)
 {
 	mUseIORange = iorange;
-	mIORange.mCount0 = mIORange.mCount1 = 0;
-	mIORange.mMirror = 0;
-	mIORange.mScratch[0] = mIORange.mScratch[1] = mIORange.mScratch[2] =mIORange.mScratch[3] = 0;
 
-	mCycleCount = 0;
 	for (int i = 0; i < 0x10000; i++)
 		mCycles[i] = 0;
-	for (int i = 0; i < 0x100; i++)
-		mCalls[i] = false;
 
 	if (exitIP)
 	{
@@ -672,219 +3028,269 @@ int Emulator::Emulate(int startIP, int exitIP, int trace, bool iorange)
 	}
 
 	mExitIP = exitIP;
-	mIP = startIP;
-	mRegA = 0;
-	mRegX = 0;
-	mRegY = 0;
-	mRegP = 0;
-	mRegS = 0xfd;
+	mIRQHandler = -1;
 
-	mMemory[0x1fe] = 0xff;
-	mMemory[0x1ff] = 0xff;
+	if (!mResume)
+	{
+		mIORange.mCount0 = mIORange.mCount1 = 0;
+		mIORange.mMirror = 0;
+		mIORange.mScratch[0] = mIORange.mScratch[1] = mIORange.mScratch[2] =mIORange.mScratch[3] = 0;
+
+		mCycleCount = 0;
+		mJiffyCycles = 0;
+		for (int i = 0; i < 0x100; i++)
+			mCalls[i] = false;
+		for (int i = 0; i < 64; i++)
+			mBankCycles[i] = 0;
+
+		mIP = startIP;
+		mRegA = 0;
+		mRegX = 0;
+		mRegY = 0;
+		mRegZ = 0;
+		mRegP = 0;
+		mRegS = 0xfd;
 
-	mCycleCount = 0;
+		mMemory[0x1fe] = 0xff;
+		mMemory[0x1ff] = 0xff;
+
+		mIRQMask = false;
+
+		if (mVICModel)
+		{
+			// Start on the first raster line with the display enabled, the
+			// kernal mapped in and its interrupt handler in the vector
+
+			mRasterLines = mVICModel == VICM_PAL ? 312 : 263;
+			mRasterLineCycles = mVICModel == VICM_PAL ? 63 : 65;
+			mRaster = 0;
+			mRasterCycle = mRasterLineCycles;
+			mRasterCompare = 0;
+			mIRQRaster = 0;
+			mIRQLatch = 0;
+			mIRQEnable = 0;
+			mIRQLine = false;
+			mBadLines = false;
+
+			mMemory[0x01] = 0x37;
+			mMemory[0x0314] = 0x31;
+			mMemory[0x0315] = 0xea;
+			mMemory[0xd011] = 0x1b;
+		}
+	}
+
+	if (mVICModel)
+	{
+		mIRQHandlers.SetSize(0);
+		mFrames.SetSize(0);
+		mFrame.mStolen = 0;
+		mFrame.mIRQ = 0;
+	}
+
+	InvalidateCode();
+
+	if (mMemoryProfile)
+	{
+		for (int i = 0; i < 0x10000; i++)
+		{
+			mReads[i] = 0;
+			mWrites[i] = 0;
+			mAbsolute[i] = 0;
+			mCrossings[i] = 0;
+		}
+	}
+
+	if (mProfile)
+	{
+		CallNode	root;
+		root.mAddress = mIP;
+		root.mBank = BankOf(mIP);
+		root.mParent = root.mChild = root.mNext = -1;
+		root.mCalls = 1;
+		root.mCycles = 0;
+
+		mCallNodes.SetSize(0);
+		mCallNodes.Push(root);
+		mCallFrames.SetSize(0);
+		mCallNode = 0;
+		mCallCycles = 0;
+
+		if (mLineProfile)
+		{
+			for (int i = 0; i < 0x10000; i++)
+			{
+				mCounts[i] = 0;
+				mLineCycles[i] = 0;
+			}
+			mLineIP = -1;
+		}
+	}
 
-	int		tcycles = 0;
 	int		iip = 0;
+	bool	halted = false, kernal = mMemoryMap < EMAP_NES;
 	while (mIP != 0)
 	{
 		if (mJiffies)
 		{
-			if (mCycleCount >= tcycles + 16667)
+			if (mCycleCount >= mJiffyCycles + 16667)
 			{
-				mMemory[0xa2]++;
+				StoreMemory(0xa2, mMemory[0xa2] + 1);
 				if (!mMemory[0xa2])
 				{
-					mMemory[0xa1]++;
+					StoreMemory(0xa1, mMemory[0xa1] + 1);
 					if (!mMemory[0xa1])
 					{
-						mMemory[0xa0]++;
+						StoreMemory(0xa0, mMemory[0xa0] + 1);
 					}
 				}
-				tcycles += 16667;
+				mJiffyCycles += 16667;
 			}
 		}
 
-		if (mIP == mExitIP)
+		if (mCycleCount >= mSnapshotCycles)
 		{
-			if (mMemory[BC_REG_ACCU + 1] & 0x80)
-				DumpCallstack();
-		}
-		else if (mIP == 0xffd2)
-		{
-			if (mRegA == 13)
-				putchar('\n');
-			else
-				putchar(mRegA);
-			mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1;
-			mRegS += 2;
+			mSnapshotCycles = INT_MAX;
+			SaveSnapshot(mSnapshotPath);
 		}
-		else if (mIP == 0xffcf)
-		{
-			int ch = getchar();
-			mRegA = ch;
-			mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1;
-			mRegS += 2;
-		}
-		else if (mIP == 0xff81)
+
+		if (mVICModel)
 		{
-			printf("------------------ CLEAR ---------------\n");
-			mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1;
-			mRegS += 2;
+			if (mCycleCount >= mRasterCycle)
+				RasterLine();
+			if (mIRQLine && !mIRQMask)
+				Interrupt();
 		}
+		else if (mMemoryMap >= EMAP_NES && mCycleCount >= mMapper.mPPUCycle)
+			FramePPU();
 
-		uint8		opcode = mMemory[mIP];
-		AsmInsData	d = DecInsData[opcode];
-		int			addr = 0, taddr;
-		int			ip = mIP;
-		
-		if (ip == 0x0862)
-			iip = mMemory[BC_REG_IP] + 256 * mMemory[BC_REG_IP + 1] + mRegY;
-
-		bool		cross = false, indexed = false;
-		int			icycles = 0;
+		DecodedInstruction* di = mDecoded + mIP;
+		if (!(di->mFlags & DECODED_VALID))
+			DecodeInstruction(mIP);
 
-		mIP++;
-		switch (d.mMode)
+		if (di->mFlags & DECODED_TRAP)
 		{
-			case ASMIM_IMPLIED:
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x __ __ %s         (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], AsmInstructionNames[d.mType], mRegA, mRegX, mRegY, mRegP, mRegS);
-				icycles = 2;
-				break;
-			case ASMIM_IMMEDIATE:
-				addr = mMemory[mIP++];
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s #$%02x    (A:%02x X:%02x Y:%02x P:%02x S:%02x)\n", iip, ip, mMemory[ip], mMemory[ip+1], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS);
-				icycles = 2;
-				break;
-			case ASMIM_ZERO_PAGE:
-				addr = mMemory[mIP++];
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s $%02x     (A:%02x X:%02x Y:%02x P:%02x S:%02x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS, mMemory[addr]);
-				icycles = 3;
-				break;
-			case ASMIM_ZERO_PAGE_X:
-				taddr = mMemory[mIP++];
-				addr = (taddr + mRegX) & 0xff;
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s $%02x,x   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
-				icycles = 4;
-				break;
-			case ASMIM_ZERO_PAGE_Y:
-				taddr = mMemory[mIP++];
-				addr = (taddr + mRegY) & 0xff;
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s $%02x,y   (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
-				icycles = 4;
-				break;
-			case ASMIM_ABSOLUTE:
-				addr = mMemory[mIP] + 256 * mMemory[mIP + 1];
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x %02x %s $%04x   (A:%02x X:%02x Y:%02x P:%02x S:%02x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], addr, mRegA, mRegX, mRegY, mRegP, mRegS, mMemory[addr]);
-				mIP += 2;
-				icycles = 4;
-				break;
-			case ASMIM_ABSOLUTE_X:
-				taddr = mMemory[mIP] + 256 * mMemory[mIP + 1];
-				addr = (taddr + mRegX) & 0xffff;
-				cross = mMemory[mIP] + mRegX >= 256;
-				indexed = true;
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x %02x %s $%04x,x (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
-				mIP += 2;
-				icycles = 4;
-				break;
-			case ASMIM_ABSOLUTE_Y:
-				taddr = mMemory[mIP] + 256 * mMemory[mIP + 1];
-				addr = (taddr + mRegY) & 0xffff;
-				cross = mMemory[mIP] + mRegY >= 256;
-				indexed = true;
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x %02x %s $%04x,y (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
-				mIP += 2;
-				icycles = 4;
-				break;
-			case ASMIM_INDIRECT:
-				taddr = mMemory[mIP] + 256 * mMemory[mIP + 1];
-				mIP += 2;
-				addr = mMemory[taddr] + 256 * mMemory[taddr + 1];
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x %02x %s ($%04x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], mMemory[ip + 2], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
-				icycles = 6;
-				break;
-			case ASMIM_INDIRECT_X:
-				taddr = (mMemory[mIP++] + mRegX) & 0xff;
-				addr = mMemory[taddr] + 256 * mMemory[taddr + 1];
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s ($%02x,x) (A:%02x X:%02x Y:%02x P:%02x S:%02x %02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], mMemory[ip + 1], mRegA, mRegX, mRegY, mRegP, mRegS, taddr, addr, mMemory[addr]);
-				icycles = 6;
-				break;
-			case ASMIM_INDIRECT_Y:
-				taddr = mMemory[mIP++];
-				addr = (mMemory[taddr] + 256 * mMemory[taddr + 1] + mRegY) & 0xffff;
-				cross = mMemory[taddr] + mRegY >= 256;
-				indexed = true;
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s ($%02x),y (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x M:%02x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr, mMemory[addr]);
-				icycles = 5;
-				break;
-			case ASMIM_RELATIVE:
-				taddr = mMemory[mIP++];
-				if (taddr & 0x80)
-					addr = taddr + mIP - 256;
+			if (mSnapshotPath && mSnapshotIPs.Contains(mIP) && (mSnapshotBank < 0 || BankOf(mIP) == mSnapshotBank))
+			{
+				SaveSnapshot(mSnapshotPath);
+			}
+
+			if (mIP == mExitIP)
+			{
+				if (mMemory[BC_REG_ACCU + 1] & 0x80)
+					DumpCallstack();
+			}
+			else if (kernal && mIP == 0xffd2)
+			{
+				if (mRegA == 13)
+					fputc('\n', mOutput);
 				else
-					addr = taddr + mIP;
-				if (trace & TRACEF_NATIVE)
-					printf("%04x : %04x %02x %02x __ %s $%02x     (A:%02x X:%02x Y:%02x P:%02x S:%02x %04x)\n", iip, ip, mMemory[ip], mMemory[ip + 1], AsmInstructionNames[d.mType], taddr, mRegA, mRegX, mRegY, mRegP, mRegS, addr);
-				icycles = 2;
+					fputc(mRegA, mOutput);
+				mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1;
+				mRegS += 2;
+				if (mProfile)
+					ProfileReturn(false);
+			}
+			else if (kernal && mIP == 0xffcf)
+			{
+				int ch = getchar();
+				mRegA = ch;
+				mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1;
+				mRegS += 2;
+				if (mProfile)
+					ProfileReturn(false);
+			}
+			else if (kernal && mIP == 0xff81)
+			{
+				fprintf(mOutput, "------------------ CLEAR ---------------\n");
+				mIP = mMemory[0x101 + mRegS] + 256 * mMemory[0x102 + mRegS] + 1;
+				mRegS += 2;
+				if (mProfile)
+					ProfileReturn(false);
+			}
+			else if (mIP == 0xea31 || mIP == 0xea81)
+			{
+				// Kernal interrupt exit, restores the registers and returns
+
+				mCycles[mIP] += 22;
+				mCycleCount += 22;
+				mRegY = mMemory[0x101 + mRegS];
+				mRegX = mMemory[0x102 + mRegS];
+				mRegA = mMemory[0x103 + mRegS];
+				mRegS += 3;
+				ReturnInterrupt();
+				if (mProfile)
+					ProfileReturn(false);
+			}
+			else if (mMemory[mIP] == 0x4c && di->mOperand == mIP && ((!mVICModel || mIRQMask) && !(mMapper.mPPUControl & 0x80) || mRegS == 0xfd))
+			{
+				// Endless loop without an interrupt to leave it or at the
+				// exit of the startup code, which is how programs end
+				// without a system to return to
+
+				halted = true;
 				break;
+			}
+			else if (mIP == mByteCodeCall)
+				ProfileCall(mMemory[BC_REG_ADDR] + 256 * mMemory[BC_REG_ADDR + 1], true);
+			else if (mIP == mByteCodeReturn)
+				ProfileReturn(true);
+
+			di = mDecoded + mIP;
+			if (!(di->mFlags & DECODED_VALID))
+				DecodeInstruction(mIP);
 		}
 
-		if ((trace & TRACEF_BYTECODE) && ip == 0x0862)
-		{
-			unsigned	accu = mMemory[BC_REG_ACCU] + (mMemory[BC_REG_ACCU + 1] << 8) + (mMemory[BC_REG_ACCU + 2] << 16) + (mMemory[BC_REG_ACCU + 3] << 24);
-			int	ptr = mMemory[BC_REG_ADDR] + 256 * mMemory[BC_REG_ADDR + 1];
-			int	sp = mMemory[BC_REG_STACK] + 256 * mMemory[BC_REG_STACK + 1];
-			printf("%04x  (A:%08x P:%04x S:%04x) %04x %04x %04x %04x  %04x %04x %04x %04x  %04x %04x %04x %04x  %04x %04x %04x %04x : %04x\n", addr, accu, ptr, sp,
-				mMemory[BC_REG_TMP +  0] + 256 * mMemory[BC_REG_TMP +  1],
-				mMemory[BC_REG_TMP +  2] + 256 * mMemory[BC_REG_TMP +  3],
-				mMemory[BC_REG_TMP +  4] + 256 * mMemory[BC_REG_TMP +  5],
-				mMemory[BC_REG_TMP +  6] + 256 * mMemory[BC_REG_TMP +  7],
-
-				mMemory[BC_REG_TMP +  8] + 256 * mMemory[BC_REG_TMP +  9],
-				mMemory[BC_REG_TMP + 10] + 256 * mMemory[BC_REG_TMP + 11],
-				mMemory[BC_REG_TMP + 12] + 256 * mMemory[BC_REG_TMP + 13],
-				mMemory[BC_REG_TMP + 14] + 256 * mMemory[BC_REG_TMP + 15],
-
-				mMemory[BC_REG_TMP + 16] + 256 * mMemory[BC_REG_TMP + 17],
-				mMemory[BC_REG_TMP + 18] + 256 * mMemory[BC_REG_TMP + 19],
-				mMemory[BC_REG_TMP + 20] + 256 * mMemory[BC_REG_TMP + 21],
-				mMemory[BC_REG_TMP + 22] + 256 * mMemory[BC_REG_TMP + 23],
-
-				mMemory[BC_REG_TMP + 24] + 256 * mMemory[BC_REG_TMP + 25],
-				mMemory[BC_REG_TMP + 26] + 256 * mMemory[BC_REG_TMP + 27],
-				mMemory[BC_REG_TMP + 28] + 256 * mMemory[BC_REG_TMP + 29],
-				mMemory[BC_REG_TMP + 30] + 256 * mMemory[BC_REG_TMP + 31],
+		int	ip = mIP;
 
-				mMemory[0x9f9e] + 256 * mMemory[0x9f9f]
-
-
-			);
+		if (trace)
+		{
+			if (ip == 0x0862)
+				iip = mMemory[BC_REG_IP] + 256 * mMemory[BC_REG_IP + 1] + mRegY;
+			TraceInstruction(ip, iip, trace);
 		}
 
-		if (!EmulateInstruction(d.mType, d.mMode, addr, icycles, cross, indexed))
+		mIP += di->mSize;
+
+		uint8	flags = di->mFlags;
+		int		icycles = di->mExecute(this, di->mOperand);
+		if (icycles < 0)
 		{
+			FlushCycles();
 			if (exitIP)
 				DumpCallstack();
 			return -1;
 		}
 
-		mCycles[ip] += icycles;
+		if (mDMACycles)
+		{
+			icycles += mDMACycles;
+			mDMACycles = 0;
+		}
+
+		di->mCycles += icycles;
 		mCycleCount += icycles;
+
+		if (mMemoryMap)
+		{
+			int	page = mMapper.mPage[ip >> 13];
+			if (page >= 0)
+				mBankCycles[page >> 2] += icycles;
+		}
+
+		if (flags & (DECODED_CALL | DECODED_RETURN | DECODED_LINE))
+		{
+			if (flags & DECODED_LINE)
+				ProfileLine(ip, flags, icycles);
+			if (flags & DECODED_CALL)
+				ProfileCall(mIP, false);
+			else if (flags & DECODED_RETURN)
+				ProfileReturn(false);
+		}
 	}
 
-	if (mRegS == 0xff)
+	FlushCycles();
+
+	if (mRegS == 0xff || halted && mRegS == 0xfd)
 	{
 #if 0
 		for (int i = 0; i < 256; i++)
@@ -893,6 +3299,12 @@ int Emulator::Emulate(int startIP, int exitIP, int trace, bool iorange)
 #endif
 		return int16(mMemory[BC_REG_ACCU] + 256 * mMemory[BC_REG_ACCU + 1]);
 	}
+	else if (halted)
+	{
+		// Stopped in an endless loop of the program, there is no result
+		fprintf(mOutput, "Emulation halted at %04x\n", mIP);
+		return 0;
+	}
 
 	return -1;
 }
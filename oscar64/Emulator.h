@@ -2,12 +2,27 @@
 
 #include "Assembler.h"
 #include "MachineTypes.h"
+#include "Array.h"
+#include <stdio.h>
 
 class Linker;
+class LinkerObject;
 
 static const int TRACEF_BYTECODE = 0x01;
 static const int TRACEF_NATIVE = 0x02;
 
+static const int VICM_NONE = 0;
+static const int VICM_PAL = 1;
+static const int VICM_NTSC = 2;
+
+static const int EMAP_FLAT = 0;
+static const int EMAP_CRT8 = 1;
+static const int EMAP_CRT16 = 2;
+static const int EMAP_EASYFLASH = 3;
+static const int EMAP_NES = 4;
+static const int EMAP_NES_MMC1 = 5;
+static const int EMAP_NES_MMC3 = 6;
+
 class Emulator
 {
 public:
@@ -18,10 +33,141 @@ public:
 	int			mCycles[0x10000];
 	bool		mCalls[0x100];
 
+	// Instructions decoded at their address, reused until the code
+	// bytes are overwritten.  Each opcode executes with a handler
+	// specialized for its instruction type and address mode.
+
+	typedef int (*InstructionHandler)(Emulator* emu, int operand);
+
+	struct DecodedInstruction
+	{
+		InstructionHandler	mExecute;
+		uint16				mOperand;
+		uint8				mSize, mFlags;
+		int					mCycles;
+	};
+
+	InstructionHandler	mHandlers[256], mQuadHandlers[256];
+	AsmCPU				mCPU;
+
+	DecodedInstruction	mDecoded[0x10000];
+	bool				mDecodedCode[0x10000];
+
 	int		mIP, mExitIP;
-	uint8	mRegA, mRegX, mRegY, mRegS, mRegP;
-	bool	mJiffies, mUseIORange;
-	int		mCycleCount;
+	uint8	mRegA, mRegX, mRegY, mRegZ, mRegS, mRegP;
+	bool	mJiffies, mUseIORange, mProfile;
+	FILE*	mOutput;
+	int		mCycleCount, mJiffyCycles;
+
+	// Snapshot of the machine state, taken when the execution reaches an
+	// address or a cycle count.  A restored snapshot continues from there
+	// instead of the start address, if it was taken from the same program
+
+	const char	*	mSnapshotPath;
+	int				mSnapshotCycles, mSnapshotBank;
+	ExpandingArray<int>	mSnapshotIPs;
+	uint32			mProgramHash;
+	bool			mResume;
+
+	// Call tree of a profiled run, built from native JSR/RTS and the
+	// call and return of the byte code interpreter.  Each node is a
+	// called address below its caller, with the cycles spent in the
+	// node itself.
+
+	struct CallNode
+	{
+		int		mAddress, mBank, mParent, mChild, mNext, mCalls;
+		int64	mCycles;
+	};
+
+	struct CallFrame
+	{
+		int		mNode, mStack;
+		bool	mByteCode;
+	};
+
+	ExpandingArray<CallNode>	mCallNodes;
+	ExpandingArray<CallFrame>	mCallFrames;
+	int							mCallNode, mCallCycles;
+	int							mByteCodeCall, mByteCodeReturn;
+
+	// Source line profile, cycles of code without source locations
+	// are charged to the last native or byte code instruction with
+	// a location.  Byte code instructions are found at the dispatch
+	// of the interpreter through the byte code table.
+
+	bool	mLineProfile;
+	int		mByteCodeTable, mLineIP;
+	int		mCounts[0x10000];
+	int		mLineCycles[0x10000];
+
+	// Memory access profile, the reads and writes of each address, the
+	// accesses with absolute address modes that would be one cycle
+	// shorter in zero page, and the page crossings of indexed reads
+	// counted at the instruction
+
+	bool	mMemoryProfile;
+	int		mReads[0x10000], mWrites[0x10000];
+	int		mAbsolute[0x10000], mCrossings[0x10000];
+
+	// Optional C64 timing model, the VIC steals cycles on bad lines and
+	// for sprite DMA and raises raster interrupts through the kernal
+	// vector at $0314 or the hardware vector at $fffe
+
+	int		mVICModel, mRasterLines, mRasterLineCycles;
+	int		mRaster, mRasterCompare, mRasterCycle, mIRQRaster;
+	uint8	mIRQLatch, mIRQEnable;
+	bool	mIRQMask, mIRQLine, mBadLines;
+
+	struct IRQHandler
+	{
+		int		mAddress, mLine, mCalls, mOverruns, mMaxCycles;
+		int64	mCycles;
+	};
+
+	struct FrameTiming
+	{
+		int		mStolen, mIRQ;
+	};
+
+	ExpandingArray<IRQHandler>	mIRQHandlers;
+	ExpandingArray<FrameTiming>	mFrames;
+	FrameTiming					mFrame;
+	int							mIRQHandler, mIRQStack, mIRQStart;
+	bool						mIRQOverrun;
+
+	// Banked memory of cartridge targets, the ROM of the selected banks
+	// is copied into the memory in 8K windows.  Writes to a window with
+	// ROM go to the RAM below or to the registers of the mapper, the
+	// pages with flags take the slow path of WriteMemory.
+
+	int		mMemoryMap;
+	uint8*	mROM;
+	uint8	mWindowRAM[0x10000];
+	uint8	mPageFlags[0x100];
+	int64	mBankCycles[64];
+
+	struct Mapper
+	{
+		int		mPage[8];
+		uint8	mBank, mControl, mSelect, mShift, mShiftCount;
+		uint8	mRegs[8];
+		uint8	mPPUControl, mPPUStatus;
+		int		mPPUCycle;
+	}	mMapper;
+
+	// Optional RAM expansion unit at $df00, with DMA transfers between
+	// the memory and the REU
+
+	int		mREUSize, mDMACycles;
+	uint8*	mREU;
+
+	struct REUState
+	{
+		uint8	mStatus, mCommand, mIRQMask, mControl;
+		uint16	mAddress, mLength, mShadowAddress, mShadowLength;
+		uint32	mREUAddress, mShadowREUAddress;
+	}	mREUState;
 
 	struct IORange
 	{
@@ -33,15 +179,105 @@ public:
 
 	Linker* mLinker;
 
+	void SetupCartridge(int map, const uint8* boot);
+	void SetupREU(int size);
+	void SetCPU(AsmCPU cpu);
 	int Emulate(int startIP, int exitIP, int trace, bool iorange);
+	bool SaveSnapshot(const char* filename);
+	bool LoadSnapshot(const char* filename);
+	uint32 HashMemory(int start, int end);
 	void DumpProfile(void);
-	bool EmulateInstruction(AsmInsType type, AsmInsMode mode, int addr, int & cycles, bool cross, bool indexed);
+	bool WriteCallTree(const char* filename);
+	bool WriteCollapsedStacks(const char* filename);
+	bool WriteLineProfile(const char* filename);
+	bool WriteMemoryProfile(const char* filename);
+	bool WriteZeroPageHints(const char* filename);
+	bool WriteProfile(const char* filename);
+	void DumpFrameTiming(void);
+
+	template<AsmInsType type, AsmInsMode mode>
+	static int DispatchInstruction(Emulator* emu, int operand);
 protected:
+	template<AsmInsType type, AsmInsMode mode>
+	bool EmulateInstruction(int addr, int & cycles, bool cross, bool indexed);
+	template<AsmInsType type, AsmInsMode mode>
+	int ExecuteInstruction(int operand);
+
 	void UpdateStatus(uint8 result);
 	void UpdateStatusCarry(uint8 result, bool carry);
+
+	uint32 QuadRegister(void) const;
+	void SetQuadRegister(uint32 q);
+	uint32 ReadQuad(uint16 addr);
+	void WriteQuad(uint16 addr, uint32 q);
+	void UpdateStatusQuad(uint32 result);
 	void DumpCycles(void);
 	void DumpCallstack(void);
+	void DumpCallGraph(void);
+
+	void ProfileCall(int addr, bool bytecode);
+	void ProfileReturn(bool bytecode);
+	void ChargeCycles(void);
+	void ProfileLine(int ip, uint8 flags, int cycles);
+
+	struct SourceLine
+	{
+		const char	*	mFileName;
+		int				mLine, mCount;
+		int64			mCycles;
+	};
+
+	void CollectSourceLines(ExpandingArray<SourceLine>& lines);
+	void DumpSourceLines(void);
+
+	struct CallFunction
+	{
+		LinkerObject	*	mObject;
+		int					mAddress, mBank, mCalls;
+		int64				mInclusive, mExclusive;
+	};
+
+	struct DataObject
+	{
+		LinkerObject	*	mObject;
+		int64				mReads, mWrites, mSaved;
+	};
+
+	void CollectDataObjects(ExpandingArray<DataObject>& objects);
+	void CollectCrossings(ExpandingArray<int>& crossings);
+	void CodeLocationName(int ip, char* name, int size);
+	void DumpMemoryProfile(void);
+
+	void CollectCallTree(ExpandingArray<int64>& inclusive, ExpandingArray<CallFunction>& functions);
+	void CallNodeName(int node, char* name, int size);
+	void WriteCallNode(FILE* file, int node, const ExpandingArray<int64>& inclusive, int depth);
+	void WriteCollapsedNode(FILE* file, int node, char* path, int length);
+
+	void RasterLine(void);
+	void Interrupt(void);
+	void ReturnInterrupt(void);
+	uint8 ReadVIC(uint16 addr);
+	void WriteVIC(uint16 addr, uint8 data);
+
+	void MapWindow(int window, int page);
+	void UpdateBanks(void);
+	void WriteBanked(uint16 addr, uint8 data);
+	uint8 ReadPPU(uint16 addr);
+	void FramePPU(void);
+	uint8 ReadREU(uint16 addr);
+	void WriteREU(uint16 addr, uint8 data);
+	void ExecuteREU(void);
+	void DiscardCode(uint16 addr);
+	LinkerObject* FindCodeObject(int addr, int bank);
+	int BankOf(int addr);
 
 	uint8 ReadMemory(uint16 addr);
+	uint8 ReadModifyMemory(uint16 addr);
 	void WriteMemory(uint16 addr, uint8 data);
+	void StoreMemory(uint16 addr, uint8 data);
+
+	void DecodeInstruction(int ip);
+	void TraceInstruction(int ip, int iip, int trace);
+	void InvalidateCode(void);
+	void FlushCycles(void);
 };
\ No newline at end of file
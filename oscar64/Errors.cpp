@@ -2,9 +2,10 @@
 #include "Ident.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 Errors::Errors(void)
-	: mErrorCount(0), mMinLevel(EINFO_GENERIC), mDisabled(EERR_GENERIC), mWarnErrors(EERR_GENERIC)
+	: mErrorCount(0), mMinLevel(EINFO_GENERIC), mDisabled(EERR_GENERIC), mWarnErrors(EERR_GENERIC), mOutput(stderr), mExitOnErrors(true)
 {
 
 }
@@ -27,8 +28,54 @@ void Errors::Error(const Location& loc, ErrorID eid, const char* msg, const Iden
 }
 
 
+static thread_local ExpandingArray<ErrorMessage>* DeferredMessages = nullptr;
+
+static char* CopyString(const char* str)
+{
+	if (!str)
+		return nullptr;
+
+	char* copy = new char[strlen(str) + 1];
+	strcpy(copy, str);
+	return copy;
+}
+
+ExpandingArray<ErrorMessage>* Errors::DeferMessages(ExpandingArray<ErrorMessage>* queue)
+{
+	ExpandingArray<ErrorMessage>* pqueue = DeferredMessages;
+	DeferredMessages = queue;
+	return pqueue;
+}
+
+void Errors::FlushDeferredMessages(ExpandingArray<ErrorMessage>& queue)
+{
+	for (int i = 0; i < queue.Size(); i++)
+	{
+		ErrorMessage& m(queue[i]);
+		Error(m.mLocation, m.mID, m.mMessage, m.mInfo1, m.mInfo2);
+		delete[] m.mMessage;
+		delete[] m.mInfo1;
+		delete[] m.mInfo2;
+	}
+	queue.SetSize(0);
+}
+
 void Errors::Error(const Location& loc, ErrorID eid, const char* msg, const char* info1, const char * info2) 
 {
+	if (DeferredMessages)
+	{
+		ErrorMessage	m;
+		m.mLocation = loc;
+		m.mID = eid;
+		m.mMessage = CopyString(msg);
+		m.mInfo1 = CopyString(info1);
+		m.mInfo2 = CopyString(info2);
+		DeferredMessages->Push(m);
+		return;
+	}
+
+	ThreadLock	lock(mMutex);
+
 	if (eid >= mMinLevel && !(eid < EERR_GENERIC && mDisabled[eid]))
 	{
 		const char* level = "info";
@@ -46,11 +93,11 @@ void Errors::Error(const Location& loc, ErrorID eid, const char* msg, const char
 		if (loc.mFileName)
 		{
 			if (!info1)
-				fprintf(stderr, "%s(%d, %d) : %s %d: %s\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg);
+				fprintf(mOutput, "%s(%d, %d) : %s %d: %s\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg);
 			else if (!info2)
-				fprintf(stderr, "%s(%d, %d) : %s %d: %s '%s'\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg, info1);
+				fprintf(mOutput, "%s(%d, %d) : %s %d: %s '%s'\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg, info1);
 			else
-				fprintf(stderr, "%s(%d, %d) : %s %d: %s '%s' != '%s'\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg, info1, info2);
+				fprintf(mOutput, "%s(%d, %d) : %s %d: %s '%s' != '%s'\n", loc.mFileName, loc.mLine, loc.mColumn, level, eid, msg, info1, info2);
 
 			if (loc.mFrom)
 				Error(*(loc.mFrom), EINFO_EXPANDED, "While expanding here");
@@ -58,14 +105,14 @@ void Errors::Error(const Location& loc, ErrorID eid, const char* msg, const char
 		else
 		{
 			if (!info1)
-				fprintf(stderr, "oscar64: %s %d: %s\n", level, eid, msg);
+				fprintf(mOutput, "oscar64: %s %d: %s\n", level, eid, msg);
 			else if (!info2)
-				fprintf(stderr, "oscar64: %s %d: %s '%s'\n", level, eid, msg, info1);
+				fprintf(mOutput, "oscar64: %s %d: %s '%s'\n", level, eid, msg, info1);
 			else
-				fprintf(stderr, "oscar64: %s %d: %s '%s' != '%s'\n", level, eid, msg, info1, info2);
+				fprintf(mOutput, "oscar64: %s %d: %s '%s' != '%s'\n", level, eid, msg, info1, info2);
 		}
 
-		if (mErrorCount > 10 || eid >= EFATAL_GENERIC)
+		if (mExitOnErrors && (mErrorCount > 10 || eid >= EFATAL_GENERIC))
 			exit(20);
 	}
 }
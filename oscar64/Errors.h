@@ -1,6 +1,8 @@
 #pragma once
 
 #include "NumberSet.h"
+#include "ThreadPool.h"
+#include <stdio.h>
 
 
 class Location
@@ -54,6 +56,7 @@ enum ErrorID
 	EWARN_INVALID_VOID_POINTER_ARITHMETIC,
 	EWARN_DIVISION_BY_ZERO,
 	EWARN_EXPAND_UNDEFINED_MACRO_IDENT,
+	EWARN_COMPILATION_CACHE,
 
 	EERR_GENERIC = 3000,
 	EERR_FILE_NOT_FOUND,
@@ -135,6 +138,7 @@ enum ErrorID
 	ERRR_INVALID_STRUCT_BINDING_TYPE,
 	ERRR_CALLING_DELETED_FUNCTION,
 	EERR_DISK_IMAGE_FULL,
+	EERR_BENCHMARK_REGRESSION,
 
 	EFATAL_GENERIC = 4000,
 	EFATAL_OUT_OF_MEMORY,
@@ -143,6 +147,14 @@ enum ErrorID
 	ERROR_MAX = 5000
 };
 
+class ErrorMessage
+{
+public:
+	Location	mLocation;
+	ErrorID		mID;
+	char	*	mMessage, * mInfo1, * mInfo2;
+};
+
 class Errors
 {
 public:
@@ -154,7 +166,18 @@ public:
 	ErrorID	mMinLevel;
 
 	NumberSet	mDisabled, mWarnErrors;
+	ThreadMutex	mMutex;
+
+	// Messages are written to this file, a compilation in a batch does not
+	// terminate the process on too many errors
+	FILE	*	mOutput;
+	bool		mExitOnErrors;
 
 	void Error(const Location& loc, ErrorID eid, const char* msg, const Ident* info1, const Ident* info2 = nullptr);
 	void Error(const Location& loc, ErrorID eid, const char* msg, const char* info1 = nullptr, const char* info2 = nullptr);
+
+	// Messages reported by the current thread while a queue is set are
+	// only printed by FlushDeferredMessages
+	ExpandingArray<ErrorMessage>* DeferMessages(ExpandingArray<ErrorMessage>* queue);
+	void FlushDeferredMessages(ExpandingArray<ErrorMessage>& queue);
 };
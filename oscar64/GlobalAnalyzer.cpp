@@ -1,7 +1,9 @@
 #include "GlobalAnalyzer.h"
+#include <stdio.h>
+#include <string.h>
 
 GlobalAnalyzer::GlobalAnalyzer(Errors* errors, Linker* linker)
-	: mErrors(errors), mLinker(linker), mCalledFunctions(nullptr), mCallingFunctions(nullptr), mVariableFunctions(nullptr), mFunctions(nullptr), mGlobalVariables(nullptr), mTopoFunctions(nullptr), mCompilerOptions(COPT_DEFAULT)
+	: mErrors(errors), mLinker(linker), mCalledFunctions(nullptr), mCallingFunctions(nullptr), mVariableFunctions(nullptr), mFunctions(nullptr), mGlobalVariables(nullptr), mTopoFunctions(nullptr), mCompilerOptions(COPT_DEFAULT), mProfileCycles(0)
 {
 
 }
@@ -98,17 +100,32 @@ void GlobalAnalyzer::AutoZeroPage(LinkerSection* lszp, int zpsize)
 {
 	if (mCompilerOptions & COPT_OPTIMIZE_AUTO_ZEROPAGE)
 	{
-		GrowingArray<Declaration*>	vars(nullptr);
+		GrowingArray<Declaration*>	vars(nullptr), hvars(nullptr);
+		GrowingArray<int64>			hsaved(0);
 
 		for (int i = 0; i < mGlobalVariables.Size(); i++)
 		{
 			Declaration* var = mGlobalVariables[i];
 			if (var->mFlags & DTF_ANALYZED)
 			{
+				int	h = 0;
+				while (h < mZeroPageHints.Size() && mZeroPageHints[h].mIdent != var->mQualIdent)
+					h++;
+
 				if (var->mFlags & DTF_ZEROPAGE)
 					zpsize -= var->mSize;
 				else if (var->mValue)
 					;
+				else if (h < mZeroPageHints.Size())
+				{
+					// Variables with a measured saving go first
+
+					int j = 0;
+					while (j < hvars.Size() && hsaved[j] > mZeroPageHints[h].mSaved)
+						j++;
+					hvars.Insert(j, var);
+					hsaved.Insert(j, mZeroPageHints[h].mSaved);
+				}
 				else
 				{
 					var->mUseCount *= VarUseCountScale(var->mBase);
@@ -122,6 +139,8 @@ void GlobalAnalyzer::AutoZeroPage(LinkerSection* lszp, int zpsize)
 				}
 			}
 		}
+		for (int i = 0; i < hvars.Size(); i++)
+			vars.Insert(i, hvars[i]);
 #if 0
 		for (int i = 0; i < vars.Size(); i++)
 		{
@@ -142,6 +161,175 @@ void GlobalAnalyzer::AutoZeroPage(LinkerSection* lszp, int zpsize)
 	}
 }
 
+// Splits a profile line into its numbers and the trailing name
+
+static bool ParseProfileLine(char* line, long long* values, int count, const char*& name)
+{
+	size_t ll = strlen(line);
+	while (ll > 0 && (line[ll - 1] == '\r' || line[ll - 1] == '\n'))
+		ll--;
+	line[ll] = 0;
+
+	char* p = line;
+	for (int i = 0; i < count; i++)
+	{
+		char* q;
+		values[i] = strtoll(p, &q, 10);
+		if (q == p)
+			return false;
+		p = q;
+	}
+
+	while (*p == ' ')
+		p++;
+	name = p;
+
+	return *p != 0;
+}
+
+void GlobalAnalyzer::AddZeroPageHint(char* line)
+{
+	long long	values[2];
+	const char* name;
+	if (ParseProfileLine(line, values, 2, name) && values[0] > 0)
+	{
+		ZeroPageHint	hint;
+		hint.mIdent = Ident::Unique(name);
+		hint.mSaved = values[0];
+		mZeroPageHints.Push(hint);
+	}
+}
+
+bool GlobalAnalyzer::LoadZeroPageHints(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "r");
+	if (file)
+	{
+		char	line[1024];
+		while (fgets(line, 1024, file))
+			AddZeroPageHint(line);
+
+		fclose(file);
+		return true;
+	}
+	else
+	{
+		mErrors->Error(Location(), EERR_FILE_NOT_FOUND, "Could not open zero page hints file", filename);
+		return false;
+	}
+}
+
+bool GlobalAnalyzer::LoadProfile(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "r");
+	if (file)
+	{
+		char	line[1024];
+		while (fgets(line, 1024, file))
+		{
+			if (!strncmp(line, "function ", 9))
+			{
+				long long	values[2];
+				const char* name;
+				if (ParseProfileLine(line + 9, values, 2, name))
+				{
+					const Ident* ident = Ident::Unique(name);
+
+					int i = 0;
+					while (i < mFunctionProfiles.Size() && mFunctionProfiles[i].mIdent != ident)
+						i++;
+					if (i == mFunctionProfiles.Size())
+					{
+						FunctionProfile	fp;
+						fp.mIdent = ident;
+						fp.mCalls = fp.mCycles = 0;
+						mFunctionProfiles.Push(fp);
+					}
+
+					mFunctionProfiles[i].mCalls += values[0];
+					mFunctionProfiles[i].mCycles += values[1];
+					mProfileCycles += values[1];
+				}
+			}
+			else if (!strncmp(line, "zeropage ", 9))
+				AddZeroPageHint(line + 9);
+		}
+
+		fclose(file);
+		return true;
+	}
+	else
+	{
+		mErrors->Error(Location(), EERR_FILE_NOT_FOUND, "Could not open profile", filename);
+		return false;
+	}
+}
+
+void GlobalAnalyzer::ApplyProfile(void)
+{
+	if (!mProfileCycles)
+		return;
+
+	ExpandingArray<int>	order;
+	for (int i = 0; i < mFunctionProfiles.Size(); i++)
+		order.Push(i);
+	order.Sort([&](int a, int b) { return mFunctionProfiles[a].mCycles > mFunctionProfiles[b].mCycles; });
+
+	// The functions that take ninety percent of the cycles, but none
+	// below one percent, are hot
+
+	int64	cycles = 0;
+	for (int i = 0; i < order.Size(); i++)
+	{
+		FunctionProfile& fp(mFunctionProfiles[order[i]]);
+		fp.mHot = cycles < mProfileCycles * 9 / 10 && fp.mCycles * 100 >= mProfileCycles;
+		cycles += fp.mCycles;
+	}
+
+	for (int i = 0; i < mFunctions.Size(); i++)
+	{
+		Declaration* f = mFunctions[i];
+
+		int j = 0;
+		while (j < mFunctionProfiles.Size() && mFunctionProfiles[j].mIdent != f->mQualIdent)
+			j++;
+
+		if (j < mFunctionProfiles.Size())
+		{
+			const FunctionProfile& fp(mFunctionProfiles[j]);
+
+			if (fp.mHot)
+			{
+				// Byte code functions that are not called through a
+				// pointer move to native code, and loops are unrolled
+				// even in size optimized code
+
+				if (!(f->mFlags & (DTF_NATIVE | DTF_FUNC_VARIABLE | DTF_VIRTUAL)))
+					f->mFlags |= DTF_NATIVE;
+
+				if (f->mCompilerOptions & COPT_OPTIMIZE_BASIC)
+				{
+					f->mCompilerOptions |= COPT_OPTIMIZE_AUTO_UNROLL;
+					f->mCompilerOptions &= ~COPT_OPTIMIZE_CODE_SIZE;
+				}
+			}
+			else if (fp.mCalls == 0)
+			{
+				f->mCompilerOptions |= COPT_OPTIMIZE_CODE_SIZE;
+				f->mCompilerOptions &= ~(COPT_OPTIMIZE_AUTO_UNROLL | COPT_OPTIMIZE_AUTO_INLINE_ALL);
+			}
+
+			// Small functions with many calls are inlined, when the
+			// call overhead is above one percent of the cycles
+
+			if (fp.mCalls > 0 && fp.mCycles < fp.mCalls * 200 && fp.mCalls * 20 * 100 >= mProfileCycles && (f->mCompilerOptions & COPT_OPTIMIZE_AUTO_INLINE))
+				f->mCompilerOptions |= COPT_OPTIMIZE_AUTO_INLINE_ALL;
+		}
+	}
+}
+
 void GlobalAnalyzer::TopoSort(Declaration* procDec)
 {
 	if (!(procDec->mFlags & DTF_FUNC_ANALYZING))
@@ -16,6 +16,9 @@ public:
 	void CheckFastcall(Declaration* procDec, bool head);
 	void CheckInterrupt(void);
 	void AutoZeroPage(LinkerSection * lszp, int zpsize);
+	bool LoadZeroPageHints(const char* filename);
+	bool LoadProfile(const char* filename);
+	void ApplyProfile(void);
 	void MarkRecursions(void);
 
 	void AnalyzeProcedure(Expression* cexp, Expression* exp, Declaration* procDec);
@@ -31,6 +34,31 @@ protected:
 	GrowingArray<Declaration*>		mCalledFunctions, mCallingFunctions, mVariableFunctions, mFunctions, mTopoFunctions;
 	GrowingArray<Declaration*>		mGlobalVariables;
 
+	// Cycles saved by placing a variable in zero page, measured with a
+	// profiled run of the emulator
+
+	struct ZeroPageHint
+	{
+		const Ident	*	mIdent;
+		int64			mSaved;
+	};
+
+	ExpandingArray<ZeroPageHint>	mZeroPageHints;
+
+	// Calls and exclusive cycles of each function in a profiled run
+
+	struct FunctionProfile
+	{
+		const Ident	*	mIdent;
+		int64			mCalls, mCycles;
+		bool			mHot;
+	};
+
+	ExpandingArray<FunctionProfile>	mFunctionProfiles;
+	int64							mProfileCycles;
+
+	void AddZeroPageHint(char* line);
+
 	void AnalyzeInit(Declaration* mdec);
 	int CallerInvokes(Declaration* called);
 	int CallerInvokes(Declaration* caller, Declaration* called);
@@ -1,5 +1,6 @@
 #include "Ident.h"
 #include "MachineTypes.h"
+#include "ThreadPool.h"
 #include <string.h>
 
 Ident::~Ident()
@@ -30,9 +31,12 @@ Ident::Ident(const char* str, unsigned int hash)
 }
 
 Ident	*	UniqueIdents[0x10000];
+ThreadMutex	UniqueIdentsMutex;
 
 const Ident* Ident::Unique(const char* str)
 {
+	ThreadLock	lock(UniqueIdentsMutex);
+
 	unsigned int hash = IHash(str);
 	int i = hash & 0xffff;
 	while (UniqueIdents[i])
@@ -1,5 +1,6 @@
 #include "InterCode.h"
 #include "CompilerTypes.h"
+#include "ThreadPool.h"
 
 #include <stdio.h>
 #include <math.h>
@@ -7,8 +8,8 @@
 
 #define DISASSEMBLE_OPT	0
 
-static bool CheckFunc;
-static bool CheckCase;
+static thread_local bool CheckFunc;
+static thread_local bool CheckCase;
 
 int InterTypeSize[] = {
 	0,
@@ -1310,7 +1311,7 @@ bool InterCodeBasicBlock::DestroyingMem(const InterInstruction* lins, const Inte
 							return true;
 						else if (op.mMemory == IM_GLOBAL)
 						{
-							if (proc->ModifiesGlobal(op.mVarIndex))
+							if (proc->ModifiesGlobal(op.mVarIndex, mProc->mModule->mGlobalVars))
 								return true;
 						}
 						else if (op.mMemory == IM_LOCAL && !mProc->mLocalVars[op.mVarIndex]->mAliased)
@@ -4673,7 +4674,7 @@ void InterInstruction::FilterStaticVarsUsage(const GrowingVariableArray& staticV
 	}
 }
 
-void InterInstruction::FilterStaticVarsByteUsage(const GrowingVariableArray& staticVars, NumberSet& requiredVars, NumberSet& providedVars, Errors* errors)
+void InterInstruction::FilterStaticVarsByteUsage(const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, NumberSet& requiredVars, NumberSet& providedVars, Errors* errors)
 {
 	if (mCode == IC_LOAD)
 	{
@@ -4683,8 +4684,8 @@ void InterInstruction::FilterStaticVarsByteUsage(const GrowingVariableArray& sta
 			{
 				for (int i = 0; i < staticVars.Size(); i++)
 				{
-					if (staticVars[i]->mAliased && !providedVars.RangeFilled(staticVars[i]->mByteIndex, staticVars[i]->mSize))
-						requiredVars.AddRange(staticVars[i]->mByteIndex, staticVars[i]->mSize);
+					if (staticVars[i]->mAliased && !providedVars.RangeFilled(byteIndex[i], staticVars[i]->mSize))
+						requiredVars.AddRange(byteIndex[i], staticVars[i]->mSize);
 				}
 			}
 		}
@@ -4694,8 +4695,8 @@ void InterInstruction::FilterStaticVarsByteUsage(const GrowingVariableArray& sta
 			{
 				if (int(mSrc[0].mIntConst) < 0 || int(mSrc[0].mIntConst) + InterTypeSize[mDst.mType] > staticVars[mSrc[0].mVarIndex]->mSize)
 					errors->Error(mLocation, EWARN_INDEX_OUT_OF_BOUNDS, "Index out of bounds");
-				else if (!providedVars.RangeFilled(staticVars[mSrc[0].mVarIndex]->mByteIndex + int(mSrc[0].mIntConst), InterTypeSize[mDst.mType]))
-					requiredVars.AddRange(staticVars[mSrc[0].mVarIndex]->mByteIndex + int(mSrc[0].mIntConst), InterTypeSize[mDst.mType]);
+				else if (!providedVars.RangeFilled(byteIndex[mSrc[0].mVarIndex] + int(mSrc[0].mIntConst), InterTypeSize[mDst.mType]))
+					requiredVars.AddRange(byteIndex[mSrc[0].mVarIndex] + int(mSrc[0].mIntConst), InterTypeSize[mDst.mType]);
 			}
 		}
 	}
@@ -4711,7 +4712,7 @@ void InterInstruction::FilterStaticVarsByteUsage(const GrowingVariableArray& sta
 				if (int(mSrc[1].mIntConst) < 0 || int(mSrc[1].mIntConst) + InterTypeSize[mSrc[0].mType] > staticVars[mSrc[1].mVarIndex]->mSize)
 					errors->Error(mLocation, EWARN_INDEX_OUT_OF_BOUNDS, "Index out of bounds");
 				else 
-					providedVars.AddRange(staticVars[mSrc[1].mVarIndex]->mByteIndex + int(mSrc[1].mIntConst), InterTypeSize[mSrc[0].mType]);
+					providedVars.AddRange(byteIndex[mSrc[1].mVarIndex] + int(mSrc[1].mIntConst), InterTypeSize[mSrc[0].mType]);
 			}
 		}
 	}
@@ -5669,7 +5670,7 @@ bool InterInstruction::RemoveUnusedLocalStoreByteInstructions(InterCodeBasicBloc
 	return changed;
 }
 
-bool InterInstruction::RemoveUnusedStaticStoreByteInstructions(InterCodeBasicBlock* block, const GrowingVariableArray& staticVars, NumberSet& requiredVars)
+bool InterInstruction::RemoveUnusedStaticStoreByteInstructions(InterCodeBasicBlock* block, const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, NumberSet& requiredVars)
 {
 	bool	changed = false;
 
@@ -5682,23 +5683,23 @@ bool InterInstruction::RemoveUnusedStaticStoreByteInstructions(InterCodeBasicBlo
 				for (int i = 0; i < staticVars.Size(); i++)
 				{
 					if (staticVars[i]->mAliased)
-						requiredVars.AddRange(staticVars[i]->mByteIndex, staticVars[i]->mSize);
+						requiredVars.AddRange(byteIndex[i], staticVars[i]->mSize);
 				}
 			}
 		}
 		else if (mSrc[0].mMemory == IM_GLOBAL)
 		{
 			if (mSrc[0].mVarIndex >= 0)
-				requiredVars.AddRange(staticVars[mSrc[0].mVarIndex]->mByteIndex + int(mSrc[0].mIntConst), InterTypeSize[mDst.mType]);
+				requiredVars.AddRange(byteIndex[mSrc[0].mVarIndex] + int(mSrc[0].mIntConst), InterTypeSize[mDst.mType]);
 		}
 	}
 	else if (mCode == IC_STORE)
 	{
 		if (mSrc[1].mMemory == IM_GLOBAL && mSrc[1].mVarIndex >= 0)
 		{
-			if (!requiredVars.RangeClear(staticVars[mSrc[1].mVarIndex]->mByteIndex + int(mSrc[1].mIntConst), InterTypeSize[mSrc[0].mType]))
+			if (!requiredVars.RangeClear(byteIndex[mSrc[1].mVarIndex] + int(mSrc[1].mIntConst), InterTypeSize[mSrc[0].mType]))
 			{
-				requiredVars.SubRange(staticVars[mSrc[1].mVarIndex]->mByteIndex + int(mSrc[1].mIntConst), InterTypeSize[mSrc[0].mType]);
+				requiredVars.SubRange(byteIndex[mSrc[1].mVarIndex] + int(mSrc[1].mIntConst), InterTypeSize[mSrc[0].mType]);
 			}
 			else if (!mVolatile)
 			{
@@ -12101,35 +12102,34 @@ void InterCodeBasicBlock::PerformTempForwarding(const TempForwardingTable& forwa
 	}
 }
 
-bool InterCodeBasicBlock::BuildGlobalRequiredTempSet(NumberSet& fromRequiredTemps)
+void InterCodeBasicBlock::CollectPostOrder(ExpandingArray<InterCodeBasicBlock*>& order)
 {
-	bool revisit = false;
-
 	if (!mVisited)
 	{
 		mVisited = true;
 
-		mNewRequiredTemps = mExitRequiredTemps;
-
-//		NumberSet	newRequiredTemps(mExitRequiredTemps);
+		if (mTrueJump) mTrueJump->CollectPostOrder(order);
+		if (mFalseJump) mFalseJump->CollectPostOrder(order);
 
-		if (mTrueJump && mTrueJump->BuildGlobalRequiredTempSet(mNewRequiredTemps)) revisit = true;
-		if (mFalseJump && mFalseJump->BuildGlobalRequiredTempSet(mNewRequiredTemps)) revisit = true;
+		order.Push(this);
+	}
+}
 
-		if (!(mNewRequiredTemps <= mExitRequiredTemps))
-		{
-			revisit = true;
+bool InterCodeBasicBlock::UpdateGlobalRequiredTempSet(void)
+{
+	bool	changed = false;
 
-			mExitRequiredTemps = mNewRequiredTemps;
-			mNewRequiredTemps -= mLocalProvidedTemps;
-			mEntryRequiredTemps |= mNewRequiredTemps;
-		}
+	if (mTrueJump && mExitRequiredTemps.Union(mTrueJump->mEntryRequiredTemps)) changed = true;
+	if (mFalseJump && mExitRequiredTemps.Union(mFalseJump->mEntryRequiredTemps)) changed = true;
 
+	if (changed)
+	{
+		mNewRequiredTemps = mExitRequiredTemps;
+		mNewRequiredTemps -= mLocalProvidedTemps;
+		return mEntryRequiredTemps.Union(mNewRequiredTemps);
 	}
 
-	fromRequiredTemps |= mEntryRequiredTemps;
-
-	return revisit;
+	return false;
 }
 
 bool InterCodeBasicBlock::RemoveUnusedResultInstructions(void)
@@ -12266,33 +12266,21 @@ void InterCodeBasicBlock::BuildGlobalProvidedStaticVariableSet(const GrowingVari
 	}
 }
 
-bool InterCodeBasicBlock::BuildGlobalRequiredStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet& fromRequiredVars)
+bool InterCodeBasicBlock::UpdateGlobalRequiredStaticVariableSet(void)
 {
-	bool revisit = false;
+	bool	changed = false;
 
-	if (!mVisited)
-	{
-		mVisited = true;
+	if (mTrueJump && mExitRequiredStatics.Union(mTrueJump->mEntryRequiredStatics)) changed = true;
+	if (mFalseJump && mExitRequiredStatics.Union(mFalseJump->mEntryRequiredStatics)) changed = true;
 
+	if (changed)
+	{
 		NumberSet	newRequiredVars(mExitRequiredStatics);
-
-		if (mTrueJump && mTrueJump->BuildGlobalRequiredStaticVariableSet(staticVars, newRequiredVars)) revisit = true;
-		if (mFalseJump && mFalseJump->BuildGlobalRequiredStaticVariableSet(staticVars, newRequiredVars)) revisit = true;
-
-		if (!(newRequiredVars <= mExitRequiredStatics))
-		{
-			revisit = true;
-
-			mExitRequiredStatics = newRequiredVars;
-			newRequiredVars -= mLocalProvidedStatics;
-			mEntryRequiredStatics |= newRequiredVars;
-		}
-
+		newRequiredVars -= mLocalProvidedStatics;
+		return mEntryRequiredStatics.Union(newRequiredVars);
 	}
 
-	fromRequiredVars |= mEntryRequiredStatics;
-
-	return revisit;
+	return false;
 }
 
 bool InterCodeBasicBlock::RemoveUnusedStaticStoreInstructions(const GrowingVariableArray& staticVars)
@@ -12355,7 +12343,7 @@ void InterCodeBasicBlock::BuildLocalVariableByteSet(const GrowingVariableArray&
 	}
 }
 
-void InterCodeBasicBlock::BuildStaticVariableByteSet(const GrowingVariableArray& staticVars, int bsize)
+void InterCodeBasicBlock::BuildStaticVariableByteSet(const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, int bsize)
 {
 	if (!mVisited)
 	{
@@ -12370,13 +12358,13 @@ void InterCodeBasicBlock::BuildStaticVariableByteSet(const GrowingVariableArray&
 		mExitProvidedStatics.Reset(bsize);
 
 		for (int i = 0; i < mInstructions.Size(); i++)
-			mInstructions[i]->FilterStaticVarsByteUsage(staticVars, mLocalRequiredStatics, mLocalProvidedStatics, mProc->mModule->mErrors);
+			mInstructions[i]->FilterStaticVarsByteUsage(staticVars, byteIndex, mLocalRequiredStatics, mLocalProvidedStatics, mProc->mModule->mErrors);
 
 		mEntryRequiredStatics = mLocalRequiredStatics;
 		mExitProvidedStatics = mLocalProvidedStatics;
 
-		if (mTrueJump) mTrueJump->BuildStaticVariableByteSet(staticVars, bsize);
-		if (mFalseJump) mFalseJump->BuildStaticVariableByteSet(staticVars, bsize);
+		if (mTrueJump) mTrueJump->BuildStaticVariableByteSet(staticVars, byteIndex, bsize);
+		if (mFalseJump) mFalseJump->BuildStaticVariableByteSet(staticVars, byteIndex, bsize);
 	}
 }
 
@@ -12422,7 +12410,7 @@ bool InterCodeBasicBlock::RemoveUndefinedPartialLocalInstructions(const GrowingV
 	return changed;
 }
 
-bool InterCodeBasicBlock::RemoveUnusedStaticStoreByteInstructions(const GrowingVariableArray& staticVars, int bsize)
+bool InterCodeBasicBlock::RemoveUnusedStaticStoreByteInstructions(const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, int bsize)
 {
 	bool	changed = false;
 
@@ -12436,18 +12424,18 @@ bool InterCodeBasicBlock::RemoveUnusedStaticStoreByteInstructions(const GrowingV
 
 		for (i = mInstructions.Size() - 1; i >= 0; i--)
 		{
-			if (mInstructions[i]->RemoveUnusedStaticStoreByteInstructions(this, staticVars, requiredVars))
+			if (mInstructions[i]->RemoveUnusedStaticStoreByteInstructions(this, staticVars, byteIndex, requiredVars))
 				changed = true;
 		}
 
 		if (mTrueJump)
 		{
-			if (mTrueJump->RemoveUnusedStaticStoreByteInstructions(staticVars, bsize))
+			if (mTrueJump->RemoveUnusedStaticStoreByteInstructions(staticVars, byteIndex, bsize))
 				changed = true;
 		}
 		if (mFalseJump)
 		{
-			if (mFalseJump->RemoveUnusedStaticStoreByteInstructions(staticVars, bsize))
+			if (mFalseJump->RemoveUnusedStaticStoreByteInstructions(staticVars, byteIndex, bsize))
 				changed = true;
 		}
 	}
@@ -12514,39 +12502,35 @@ void InterCodeBasicBlock::BuildGlobalProvidedVariableSet(const GrowingVariableAr
 	}
 }
 
-bool InterCodeBasicBlock::BuildGlobalRequiredVariableSet(const GrowingVariableArray& localVars, NumberSet& fromRequiredVars, const GrowingVariableArray& params, NumberSet& fromRequiredParams, InterMemory paramMemory)
+bool InterCodeBasicBlock::UpdateGlobalRequiredVariableSet(void)
 {
-	bool revisit = false;
+	bool	changed = false;
 
-	if (!mVisited)
+	if (mTrueJump)
 	{
-		mVisited = true;
+		if (mExitRequiredVars.Union(mTrueJump->mEntryRequiredVars)) changed = true;
+		if (mExitRequiredParams.Union(mTrueJump->mEntryRequiredParams)) changed = true;
+	}
+	if (mFalseJump)
+	{
+		if (mExitRequiredVars.Union(mFalseJump->mEntryRequiredVars)) changed = true;
+		if (mExitRequiredParams.Union(mFalseJump->mEntryRequiredParams)) changed = true;
+	}
 
+	if (changed)
+	{
 		NumberSet	newRequiredVars(mExitRequiredVars);
 		NumberSet	newRequiredParams(mExitRequiredParams);
 
-		if (mTrueJump && mTrueJump->BuildGlobalRequiredVariableSet(localVars, newRequiredVars, params, newRequiredParams, paramMemory)) revisit = true;
-		if (mFalseJump && mFalseJump->BuildGlobalRequiredVariableSet(localVars, newRequiredVars, params, newRequiredParams, paramMemory)) revisit = true;
-
-		if (!(newRequiredVars <= mExitRequiredVars) || !(newRequiredParams <= mExitRequiredParams))
-		{
-			revisit = true;
-
-			mExitRequiredVars = newRequiredVars;
-			newRequiredVars -= mLocalProvidedVars;
-			mEntryRequiredVars |= newRequiredVars;
-
-			mExitRequiredParams = newRequiredParams;
-			newRequiredParams -= mLocalProvidedParams;
-			mEntryRequiredParams |= newRequiredParams;
-		}
+		newRequiredVars -= mLocalProvidedVars;
+		newRequiredParams -= mLocalProvidedParams;
 
+		changed = mEntryRequiredVars.Union(newRequiredVars);
+		if (mEntryRequiredParams.Union(newRequiredParams))
+			changed = true;
 	}
 
-	fromRequiredVars |= mEntryRequiredVars;
-	fromRequiredParams |= mEntryRequiredParams;
-
-	return revisit;
+	return changed;
 }
 
 
@@ -15072,7 +15056,7 @@ bool InterCodeBasicBlock::LoadStoreForwarding(const GrowingInstructionPtrArray&
 							if (op.mTemp >= 0)
 							{
 								if (op.mMemoryBase == IM_GLOBAL)
-									flush = proc->ModifiesGlobal(op.mVarIndex);
+									flush = proc->ModifiesGlobal(op.mVarIndex, mProc->mModule->mGlobalVars);
 								else if (op.mMemoryBase == IM_LOCAL && !mProc->mLocalVars[op.mVarIndex]->mAliased)
 									flush = false;
 								else if ((op.mMemoryBase == IM_PARAM || op.mMemoryBase == IM_FPARAM) && !mProc->mParamVars[op.mVarIndex]->mAliased)
@@ -15083,7 +15067,7 @@ bool InterCodeBasicBlock::LoadStoreForwarding(const GrowingInstructionPtrArray&
 							else if (op.mMemory == IM_FFRAME || op.mMemory == IM_FRAME)
 								flush = true;
 							else if (op.mMemory == IM_GLOBAL)
-								flush = proc->ModifiesGlobal(op.mVarIndex);
+								flush = proc->ModifiesGlobal(op.mVarIndex, mProc->mModule->mGlobalVars);
 							else if (op.mMemory == IM_LOCAL && !mProc->mLocalVars[op.mVarIndex]->mAliased)
 								flush = false;
 							else if ((op.mMemory == IM_PARAM || op.mMemory == IM_FPARAM) && !mProc->mParamVars[op.mVarIndex]->mAliased)
@@ -27646,7 +27630,10 @@ InterCodeProcedure::InterCodeProcedure(InterCodeModule * mod, const Location & l
 	mCheckUnreachable(true), mReturnType(IT_NONE), mCheapInline(false), mNoInline(false),
 	mDeclaration(nullptr), mGlobalsChecked(false), mDispatchedCall(false),
 	mIntrinsicFunction(false),
-	mNumRestricted(1)
+	mNumRestricted(1), mStaticVarsBase(-1), mNumStaticVars(0),
+	mHasDynamicStack(false), mHasInlineAssembler(false), mCallsByteCode(false), mLoadsIndirect(false), mStoresIndirect(false),
+	mTempSize(0), mCommonFrameSize(0), mFastCallBase(0), mLocalSize(0), mNumLocals(0), mNumParams(0), mParamVarsSize(0),
+	mPassTimer(nullptr)
 {
 	mID = mModule->mProcedures.Size();
 	mModule->mProcedures.Push(this);
@@ -27872,9 +27859,24 @@ void InterCodeProcedure::CheckFinal(void)
 
 void InterCodeProcedure::DisassembleDebug(const char* name, bool dumpSets)
 {
+	if (mPassTimer)
+		mPassTimer->Mark(name, -1, NumInstructions());
+
 	Disassemble(name, dumpSets);
 }
 
+int InterCodeProcedure::NumInstructions(void) const
+{
+	int	num = 0;
+	for (int i = 0; i < mBlocks.Size(); i++)
+	{
+		const InterCodeBasicBlock* block = mBlocks[i];
+		if (block == mEntryBlock || block->mNumEntries > 0)
+			num += block->mInstructions.Size();
+	}
+	return num;
+}
+
 void InterCodeProcedure::RebuildIntegerRangeSet(void)
 {
 	mLocalValueRange.SetSize(mTemporaries.Size(), false);
@@ -27986,6 +27988,69 @@ void InterCodeProcedure::TrimBlocks(void)
 	mNumBlocks = j;
 }
 
+void InterCodeProcedure::SolveRequiredSets(bool (InterCodeBasicBlock::* update)(void))
+{
+	//
+	// Blocks are updated in post order, so most successors are final
+	// before their predecessors are visited.  Only the predecessors of
+	// blocks with changed entry sets are visited again.
+	//
+	ExpandingArray<InterCodeBasicBlock*>	order;
+
+	ResetVisited();
+	mEntryBlock->CollectPostOrder(order);
+
+	int	numBlocks = order.Size();
+
+	GrowingIntArray	position(-1);
+	for (int i = 0; i < numBlocks; i++)
+		position[order[i]->mIndex] = i;
+
+	GrowingIntArray	predStart(0), preds(0);
+	for (int i = 0; i < numBlocks; i++)
+	{
+		InterCodeBasicBlock* block = order[i];
+		if (block->mTrueJump) predStart[position[block->mTrueJump->mIndex] + 1]++;
+		if (block->mFalseJump) predStart[position[block->mFalseJump->mIndex] + 1]++;
+	}
+	for (int i = 0; i < numBlocks; i++)
+		predStart[i + 1] += predStart[i];
+
+	GrowingIntArray	predFill(predStart);
+	preds.SetSize(predStart[numBlocks]);
+	for (int i = 0; i < numBlocks; i++)
+	{
+		InterCodeBasicBlock* block = order[i];
+		if (block->mTrueJump) preds[predFill[position[block->mTrueJump->mIndex]]++] = i;
+		if (block->mFalseJump) preds[predFill[position[block->mFalseJump->mIndex]]++] = i;
+	}
+
+	NumberSet	pending(numBlocks, true);
+
+	bool	again = true;
+	while (again)
+	{
+		again = false;
+		for (int i = 0; i < numBlocks; i++)
+		{
+			if (pending[i])
+			{
+				pending -= i;
+				if ((order[i]->*update)())
+				{
+					for (int j = predStart[i]; j < predStart[i + 1]; j++)
+					{
+						int	k = preds[j];
+						pending += k;
+						if (k < i)
+							again = true;
+					}
+				}
+			}
+		}
+	}
+}
+
 void InterCodeProcedure::BuildDataFlowSets(void)
 {
 	int	numTemps = mTemporaries.Size();
@@ -28003,14 +28068,9 @@ void InterCodeProcedure::BuildDataFlowSets(void)
 	mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps), NumberSet(numTemps));
 
 	//
-	// Build set of globally required temporaries, might need
-	// multiple iterations until it stabilizes
+	// Build set of globally required temporaries
 	//
-	NumberSet	totalRequired(numTemps);
-
-	do {
-		ResetVisited();
-	} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired));
+	SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredTempSet);
 
 	ResetVisited();
 	mEntryBlock->CollectLocalUsedTemps(numTemps);
@@ -28318,11 +28378,7 @@ void InterCodeProcedure::RemoveUnusedInstructions(void)
 		ResetVisited();
 		mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps), NumberSet(numTemps));
 
-		NumberSet	totalRequired2(numTemps);
-
-		do {
-			ResetVisited();
-		} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired2));
+		SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredTempSet);
 
 		ResetVisited();
 	} while (mEntryBlock->RemoveUnusedResultInstructions());
@@ -28356,11 +28412,7 @@ void InterCodeProcedure::RemoveUndefinedPartialLocalInstructions(void)
 		ResetVisited();
 		mEntryBlock->BuildGlobalProvidedStaticVariableSet(mLocalVars, NumberSet(byteIndex));
 
-		NumberSet	totalRequired2(byteIndex);
-
-		do {
-			ResetVisited();
-		} while (mEntryBlock->BuildGlobalRequiredStaticVariableSet(mLocalVars, totalRequired2));
+		SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredStaticVariableSet);
 
 		ResetVisited();
 	} while (mEntryBlock->RemoveUndefinedPartialLocalInstructions(mLocalVars, byteIndex));
@@ -28374,31 +28426,31 @@ void InterCodeProcedure::RemoveUnusedPartialStoreInstructions(void)
 	{
 		if (mModule->mGlobalVars.Size())
 		{
+			// Byte positions are kept local, global variables are shared with
+			// procedures closed in parallel
+
+			GrowingIntArray	varByteIndex(0);
 			int	byteIndex = 0;
 			for (int i = 0; i < mModule->mGlobalVars.Size(); i++)
 			{
 				if (mModule->mGlobalVars[i])
 				{
-					mModule->mGlobalVars[i]->mByteIndex = byteIndex;
+					varByteIndex[i] = byteIndex;
 					byteIndex += mModule->mGlobalVars[i]->mSize;
 				}
 			}
 
 			do {
 				ResetVisited();
-				mEntryBlock->BuildStaticVariableByteSet(mModule->mGlobalVars, byteIndex);
+				mEntryBlock->BuildStaticVariableByteSet(mModule->mGlobalVars, varByteIndex, byteIndex);
 
 				ResetVisited();
 				mEntryBlock->BuildGlobalProvidedStaticVariableSet(mModule->mGlobalVars, NumberSet(byteIndex));
 
-				NumberSet	totalRequired2(byteIndex);
-
-				do {
-					ResetVisited();
-				} while (mEntryBlock->BuildGlobalRequiredStaticVariableSet(mModule->mGlobalVars, totalRequired2));
+				SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredStaticVariableSet);
 
 				ResetVisited();
-			} while (mEntryBlock->RemoveUnusedStaticStoreByteInstructions(mModule->mGlobalVars, byteIndex));
+			} while (mEntryBlock->RemoveUnusedStaticStoreByteInstructions(mModule->mGlobalVars, varByteIndex, byteIndex));
 
 			DisassembleDebug("removed unused static byte stores");
 		}
@@ -28434,12 +28486,7 @@ void InterCodeProcedure::RemoveUnusedStoreInstructions(InterMemory	paramMemory)
 				ResetVisited();
 				mEntryBlock->BuildGlobalProvidedVariableSet(mLocalVars, NumberSet(mLocalVars.Size()), mParamVars, NumberSet(mParamVars.Size()), paramMemory);
 
-				NumberSet	totalRequired2(mLocalVars.Size());
-				NumberSet	totalRequiredParams(mParamVars.Size());
-
-				do {
-					ResetVisited();
-				} while (mEntryBlock->BuildGlobalRequiredVariableSet(mLocalVars, totalRequired2, mParamVars, totalRequiredParams, paramMemory));
+				SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredVariableSet);
 
 				ResetVisited();
 			} while (mEntryBlock->RemoveUnusedStoreInstructions(mLocalVars, mParamVars, paramMemory));
@@ -28458,11 +28505,7 @@ void InterCodeProcedure::RemoveUnusedStoreInstructions(InterMemory	paramMemory)
 				ResetVisited();
 				mEntryBlock->BuildGlobalProvidedStaticVariableSet(mModule->mGlobalVars, NumberSet(mModule->mGlobalVars.Size()));
 
-				NumberSet	totalRequired2(mModule->mGlobalVars.Size());
-
-				do {
-					ResetVisited();
-				} while (mEntryBlock->BuildGlobalRequiredStaticVariableSet(mModule->mGlobalVars, totalRequired2));
+				SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredStaticVariableSet);
 
 				ResetVisited();
 			} while (mEntryBlock->RemoveUnusedStaticStoreInstructions(mModule->mGlobalVars));
@@ -29044,6 +29087,8 @@ void InterCodeProcedure::BuildLocalAliasTable(void)
 
 void InterCodeProcedure::Close(void)
 {
+	MemoryArenaScope	scope(&mArena);
+
 	GrowingTypeArray	tstack(IT_NONE);
 	
 	CheckFunc = !strcmp(mIdent->mString, "main");
@@ -29051,6 +29096,9 @@ void InterCodeProcedure::Close(void)
 
 	mEntryBlock = mBlocks[0];
 
+	if (mModule->mTimeReport)
+		mPassTimer = mModule->mTimeReport->Start("inter", mIdent, NumInstructions());
+
 	DisassembleDebug("start");
 
 	BuildTraces(10);
@@ -29865,8 +29913,17 @@ void InterCodeProcedure::Close(void)
 				var->mLinkerObject->mVariable = var;
 				var->mLinkerObject->mFlags |= LOBJF_LOCAL_VAR;
 				var->mLinkerObject->AddSpace(var->mSize);
-				var->mIndex = mModule->mGlobalVars.Size();
-				mModule->mGlobalVars.Push(var);
+				if (mStaticVarsBase >= 0)
+				{
+					assert(i < mNumStaticVars);
+					var->mIndex = mStaticVarsBase + i;
+					mModule->mGlobalVars[var->mIndex] = var;
+				}
+				else
+				{
+					var->mIndex = mModule->mGlobalVars.Size();
+					mModule->mGlobalVars.Push(var);
+				}
 			}
 		}
 
@@ -29906,8 +29963,11 @@ void InterCodeProcedure::Close(void)
 		DisassembleDebug("Rebuilt traces");
 #endif
 	}
-	else if (!mInterruptCalled && mNativeProcedure)
+	else if (!mInterruptCalled)
 	{
+		// Byte code procedures have no static stack of their own, but
+		// must keep the stack of native callees below native callers
+
 //		mLinkerObject->mFlags |= LOBJF_STATIC_STACK;
 		mLinkerObject->mStackSection = mModule->mLinker->AddSection(mIdent->Mangle("@stack"), LST_STATIC_STACK);
 		mLinkerObject->mStackSection->mSections.Push(mModule->mParamLinkerSection);
@@ -30433,6 +30493,8 @@ void InterCodeProcedure::Close(void)
 	mEntryBlock->MarkAliasing(mParamAliasedSet);
 
 	DisassembleDebug("Marked Aliasing");
+
+	mPassTimer = nullptr;
 }
 
 void InterCodeProcedure::AddCalledFunction(InterCodeProcedure* proc)
@@ -30895,13 +30957,13 @@ void InterCodeProcedure::MergeBasicBlocks(FastNumberSet& activeSet)
 
 }
 
-bool InterCodeProcedure::ReferencesGlobal(int varindex)
+bool InterCodeProcedure::ReferencesGlobal(int varindex, const GrowingVariableArray& globalVars)
 {
 	if (mGlobalsChecked)
 	{
 		if (varindex >= 0)
 		{
-			if (mModule->mGlobalVars[varindex]->mAliased)
+			if (globalVars[varindex]->mAliased)
 				return mLoadsIndirect || mStoresIndirect;
 			else if (varindex < mReferencedGlobals.Size())
 				return mReferencedGlobals[varindex];
@@ -30915,13 +30977,13 @@ bool InterCodeProcedure::ReferencesGlobal(int varindex)
 		return true;
 }
 
-bool InterCodeProcedure::ModifiesGlobal(int varindex)
+bool InterCodeProcedure::ModifiesGlobal(int varindex, const GrowingVariableArray& globalVars)
 {
 	if (mGlobalsChecked)
 	{
 		if (varindex >= 0)
 		{
-			if (mModule->mGlobalVars[varindex]->mAliased && mStoresIndirect)
+			if (globalVars[varindex]->mAliased && mStoresIndirect)
 				return true;
 
 			if (varindex < mModifiedGlobals.Size())
@@ -31096,11 +31158,7 @@ void InterCodeProcedure::ReduceTemporaries(bool final)
 	ResetVisited();
 	mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numTemps), NumberSet(numTemps));
 
-	NumberSet	totalRequired2(numTemps);
-
-	do {
-		ResetVisited();
-	} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired2));
+	SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredTempSet);
 
 	ResetVisited();
 	mEntryBlock->PruneUnusedIntegerRangeSets();
@@ -31218,11 +31276,7 @@ void InterCodeProcedure::ReduceTemporaries(bool final)
 	ResetVisited();
 	mEntryBlock->BuildGlobalProvidedTempSet(NumberSet(numRenamedTemps), NumberSet(numRenamedTemps));
 
-	NumberSet	totalRequired3(numRenamedTemps);
-
-	do {
-		ResetVisited();
-	} while (mEntryBlock->BuildGlobalRequiredTempSet(totalRequired3));
+	SolveRequiredSets(&InterCodeBasicBlock::UpdateGlobalRequiredTempSet);
 }
 
 void InterCodeProcedure::MapCallerSavedTemps(void)
@@ -31371,7 +31425,8 @@ void InterCodeProcedure::Disassemble(const char* name, bool dumpSets)
 }
 
 InterCodeModule::InterCodeModule(Errors* errors, Linker * linker)
-	: mErrors(errors), mLinker(linker), mGlobalVars(nullptr), mProcedures(nullptr), mCompilerOptions(0), mParamLinkerObject(nullptr), mParamLinkerSection(nullptr)
+	: mErrors(errors), mLinker(linker), mGlobalVars(nullptr), mProcedures(nullptr), mCompilerOptions(0), mParamLinkerObject(nullptr), mParamLinkerSection(nullptr),
+	  mDeferredProcedures(nullptr), mTimeReport(nullptr)
 {
 }
 
@@ -31389,6 +31444,202 @@ void InterCodeModule::InitParamStack(LinkerSection* stackSection)
 	mParamLinkerObject = mLinker->AddObject(Location(), Ident::Unique("sstack"), mParamLinkerSection, LOT_STACK);
 }
 
+static void CollectReferencedProcedures(InterCodeProcedure* proc, ExpandingArray<InterCodeProcedure*>& procs)
+{
+	ExpandingArray<LinkerObject*>	objects;
+
+	for (int i = 0; i < proc->mCalledFunctions.Size(); i++)
+		procs.Push(proc->mCalledFunctions[i]);
+
+	for (int i = 0; i < proc->mBlocks.Size(); i++)
+	{
+		InterCodeBasicBlock* block = proc->mBlocks[i];
+		for (int j = 0; block && j < block->mInstructions.Size(); j++)
+		{
+			InterInstruction* ins = block->mInstructions[j];
+			if (ins)
+			{
+				if (ins->mConst.mLinkerObject && !objects.Contains(ins->mConst.mLinkerObject))
+					objects.Push(ins->mConst.mLinkerObject);
+				for (int k = 0; k < ins->mNumOperands; k++)
+				{
+					if (ins->mSrc[k].mLinkerObject && !objects.Contains(ins->mSrc[k].mLinkerObject))
+						objects.Push(ins->mSrc[k].mLinkerObject);
+				}
+			}
+		}
+	}
+
+	// Constant propagation may follow references in constant data
+
+	for (int i = 0; i < objects.Size(); i++)
+	{
+		LinkerObject* lobj = objects[i];
+		if (lobj->mProc)
+			procs.Push(lobj->mProc);
+		else if (lobj->mFlags & LOBJF_CONST)
+		{
+			for (int j = 0; j < lobj->mReferences.Size(); j++)
+			{
+				LinkerObject* robj = lobj->mReferences[j]->mRefObject;
+				if (robj && !objects.Contains(robj))
+					objects.Push(robj);
+			}
+		}
+	}
+}
+
+void InterCodeModule::CloseDeferredProcedures(int numThreads)
+{
+	int	numTasks = mDeferredProcedures.Size();
+
+	// Reserve the global variable indices for locals moved to a static stack,
+	// slots of procedures not yet closed hold an empty placeholder
+
+	for (int i = 0; i < numTasks; i++)
+	{
+		InterCodeProcedure* proc = mDeferredProcedures[i];
+
+		proc->mStaticVarsBase = mGlobalVars.Size();
+		proc->mNumStaticVars = proc->mNumLocals > proc->mLocalVars.Size() ? proc->mNumLocals : proc->mLocalVars.Size();
+		for (int j = 0; j < proc->mNumStaticVars; j++)
+		{
+			InterVariable* var = new InterVariable();
+			var->mIndex = mGlobalVars.Size();
+			mGlobalVars.Push(var);
+		}
+	}
+
+	// In serial order a procedure sees all procedures before it closed and
+	// all after it still open.  A task therefore waits for the procedures it
+	// references with a lower number, and procedures with a higher number
+	// wait for it, including those reached through already closed procedures
+
+	GrowingIntArray	taskIndex(-1);
+	for (int i = 0; i < numTasks; i++)
+		taskIndex[mDeferredProcedures[i]->mID] = i;
+
+	ExpandingArray<int>	*	dependencies = new ExpandingArray<int>[numTasks];
+	ExpandingArray<int>	*	successors = new ExpandingArray<int>[numTasks];
+	GrowingIntArray			stamp(-1);
+
+	for (int t = 0; t < numTasks; t++)
+	{
+		ExpandingArray<InterCodeProcedure*>	procs;
+		CollectReferencedProcedures(mDeferredProcedures[t], procs);
+
+		ExpandingArray<int>	refs;
+		for (int i = 0; i < procs.Size(); i++)
+		{
+			int	r = taskIndex[procs[i]->mID];
+			if (r >= 0 && r != t && stamp[r] != t)
+			{
+				stamp[r] = t;
+				refs.Push(r);
+			}
+		}
+
+		int	n = refs.Size();
+		for (int i = 0; i < n; i++)
+		{
+			int	q = refs[i];
+			if (q < t)
+			{
+				for (int j = 0; j < successors[q].Size(); j++)
+				{
+					int	r = successors[q][j];
+					if (r != t && stamp[r] != t)
+					{
+						stamp[r] = t;
+						refs.Push(r);
+					}
+				}
+			}
+		}
+
+		for (int i = 0; i < refs.Size(); i++)
+		{
+			int	r = refs[i];
+			if (r < t)
+				dependencies[t].Push(r);
+			else
+			{
+				dependencies[r].Push(t);
+				successors[t].Push(r);
+			}
+		}
+	}
+
+	LinkerQueue						*	objects = new LinkerQueue[numTasks];
+	ExpandingArray<ErrorMessage>	*	messages = new ExpandingArray<ErrorMessage>[numTasks];
+	ExpandingArray<InterVariable*>	*	staticVars = new ExpandingArray<InterVariable*>[numTasks];
+
+	ThreadPool	pool(numThreads);
+
+	pool.Run(numTasks, dependencies, [&](int task) {
+		InterCodeProcedure* proc = mDeferredProcedures[task];
+
+		// Each task works on its own copy of the global variable table, it
+		// contains the static stack variables of all its dependencies
+
+		InterCodeModule		view(*this);
+		NumberSet			visited(numTasks);
+		ExpandingArray<int>	stack;
+
+		for (int i = 0; i < dependencies[task].Size(); i++)
+			stack.Push(dependencies[task][i]);
+
+		while (stack.Size() > 0)
+		{
+			int	t = stack.Pop();
+			if (!visited[t])
+			{
+				visited += t;
+				for (int i = 0; i < staticVars[t].Size(); i++)
+					view.mGlobalVars[staticVars[t][i]->mIndex] = staticVars[t][i];
+				for (int i = 0; i < dependencies[t].Size(); i++)
+					stack.Push(dependencies[t][i]);
+			}
+		}
+
+		LinkerQueue* pobjects = mLinker->DeferObjects(objects + task);
+		ExpandingArray<ErrorMessage>* pmessages = mErrors->DeferMessages(messages + task);
+
+		if (mCompilerOptions & COPT_VERBOSE2)
+			printf("Optimize intermediate code <%s>\n", proc->mIdent->mString);
+
+		proc->mModule = &view;
+		proc->Close();
+		proc->mModule = this;
+
+		for (int i = 0; i < proc->mNumStaticVars; i++)
+		{
+			InterVariable* var = view.mGlobalVars[proc->mStaticVarsBase + i];
+			if (var->mLinkerObject)
+				staticVars[task].Push(var);
+		}
+
+		mErrors->DeferMessages(pmessages);
+		mLinker->DeferObjects(pobjects);
+	});
+
+	for (int i = 0; i < numTasks; i++)
+	{
+		mLinker->InsertDeferredObjects(objects[i]);
+		mErrors->FlushDeferredMessages(messages[i]);
+		for (int j = 0; j < staticVars[i].Size(); j++)
+			mGlobalVars[staticVars[i][j]->mIndex] = staticVars[i][j];
+	}
+
+	delete[] dependencies;
+	delete[] successors;
+	delete[] objects;
+	delete[] messages;
+	delete[] staticVars;
+
+	mDeferredProcedures.SetSize(0);
+}
+
 bool InterCodeModule::Disassemble(const char* filename)
 {
 	FILE* file;
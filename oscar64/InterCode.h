@@ -8,6 +8,8 @@
 #include "MachineTypes.h"
 #include "Ident.h"
 #include "Linker.h"
+#include "MemoryArena.h"
+#include "TimeReport.h"
 
 class Declaration;
 
@@ -315,7 +317,7 @@ public:
 	void Disassemble(FILE* file, InterCodeProcedure* proc);
 };
 
-class InterInstruction
+class InterInstruction : public PermanentObject
 {
 public:
 	Location							mLocation;
@@ -355,13 +357,13 @@ public:
 	void FilterTempUsage(NumberSet& requiredTemps, NumberSet& providedTemps);
 	void FilterVarsUsage(const GrowingVariableArray& localVars, NumberSet& requiredVars, NumberSet& providedVars, const GrowingVariableArray& params, NumberSet& requiredParams, NumberSet& providedParams, InterMemory paramMemory);
 	void FilterStaticVarsUsage(const GrowingVariableArray& staticVars, NumberSet& requiredVars, NumberSet& providedVars);
-	void FilterStaticVarsByteUsage(const GrowingVariableArray& staticVars, NumberSet& requiredVars, NumberSet& providedVars, Errors * errors);
+	void FilterStaticVarsByteUsage(const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, NumberSet& requiredVars, NumberSet& providedVars, Errors * errors);
 	void FilterLocalVarsByteUsage(const GrowingVariableArray& lovalVars, NumberSet& requiredVars, NumberSet& providedVars, Errors* errors);
 
 	bool RemoveUnusedResultInstructions(InterInstruction* pre, NumberSet& requiredTemps);
 	bool RemoveUnusedStoreInstructions(const GrowingVariableArray& localVars, NumberSet& requiredVars, const GrowingVariableArray& params, NumberSet& requiredParams, InterMemory paramMemory);
 	bool RemoveUnusedStaticStoreInstructions(InterCodeBasicBlock * block, const GrowingVariableArray& staticVars, NumberSet& requiredVars, GrowingInstructionPtrArray& storeIns);
-	bool RemoveUnusedStaticStoreByteInstructions(InterCodeBasicBlock* block, const GrowingVariableArray& staticVars, NumberSet& requiredVars);
+	bool RemoveUnusedStaticStoreByteInstructions(InterCodeBasicBlock* block, const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, NumberSet& requiredVars);
 	bool RemoveUnusedLocalStoreByteInstructions(InterCodeBasicBlock* block, const GrowingVariableArray& localVars, NumberSet& requiredVars);
 	bool RemoveUndefinedLocalLoadByteInstructions(InterCodeBasicBlock* block, const GrowingVariableArray& localVars, NumberSet& providedVars);
 	void PerformValueForwarding(GrowingInstructionPtrArray& tvalue, FastNumberSet& tvalid);
@@ -390,7 +392,7 @@ public:
 	void Disassemble(FILE* file, InterCodeProcedure * proc);
 };
 
-class InterCodeBasicBlock
+class InterCodeBasicBlock : public ArenaObject<InterCodeBasicBlock>
 {
 public:
 	InterCodeProcedure			*	mProc;
@@ -481,7 +483,8 @@ public:
 
 	void BuildLocalTempSets(int num);
 	void BuildGlobalProvidedTempSet(const NumberSet & fromProvidedTemps, const NumberSet& potentialProvidedTemps);
-	bool BuildGlobalRequiredTempSet(NumberSet& fromRequiredTemps);
+	void CollectPostOrder(ExpandingArray<InterCodeBasicBlock*>& order);
+	bool UpdateGlobalRequiredTempSet(void);
 	bool RemoveUnusedResultInstructions(void);
 	void BuildCallerSaveTempSet(NumberSet& callerSaveTemps);
 	void BuildConstTempSets(void);
@@ -490,7 +493,7 @@ public:
 
 	void BuildLocalVariableSets(const GrowingVariableArray& localVars, const GrowingVariableArray& params, InterMemory paramMemory);
 	void BuildGlobalProvidedVariableSet(const GrowingVariableArray& localVars, NumberSet fromProvidedVars, const GrowingVariableArray& params, NumberSet fromProvidedParams, InterMemory paramMemory);
-	bool BuildGlobalRequiredVariableSet(const GrowingVariableArray& localVars, NumberSet& fromRequiredVars, const GrowingVariableArray& params, NumberSet& fromRequiredParams, InterMemory paramMemory);
+	bool UpdateGlobalRequiredVariableSet(void);
 	bool RemoveUnusedStoreInstructions(const GrowingVariableArray& localVars, const GrowingVariableArray& params, InterMemory paramMemory);
 	bool RemoveUnusedIndirectStoreInstructions(void);
 
@@ -501,14 +504,14 @@ public:
 
 	void BuildStaticVariableSet(const GrowingVariableArray& staticVars);
 	void BuildGlobalProvidedStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet fromProvidedVars);
-	bool BuildGlobalRequiredStaticVariableSet(const GrowingVariableArray& staticVars, NumberSet& fromRequiredVars);
+	bool UpdateGlobalRequiredStaticVariableSet(void);
 	bool RemoveUnusedStaticStoreInstructions(const GrowingVariableArray& staticVars);
 
 	void BuildLocalVariableByteSet(const GrowingVariableArray& localVars, int bsize);
 	bool RemoveUndefinedPartialLocalInstructions(const GrowingVariableArray& localVars, int bsize);
 
-	void BuildStaticVariableByteSet(const GrowingVariableArray& staticVars, int bsize);
-	bool RemoveUnusedStaticStoreByteInstructions(const GrowingVariableArray& staticVars, int bsize);
+	void BuildStaticVariableByteSet(const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, int bsize);
+	bool RemoveUnusedStaticStoreByteInstructions(const GrowingVariableArray& staticVars, const GrowingIntArray& byteIndex, int bsize);
 
 	bool CheckSingleBlockLimitedLoop(InterCodeBasicBlock*& pblock, int64 & nloop, bool & nfixed);
 
@@ -786,6 +789,8 @@ public:
 	InterCodeBasicBlock				*	mEntryBlock;
 	int									mNumBlocks;
 	GrowingInterCodeBasicBlockPtrArray	mBlocks;
+	MemoryArena							mArena;
+	PassTimer						*	mPassTimer;
 	GrowingTypeArray					mTemporaries;
 	GrowingIntArray						mTempOffset, mTempSizes;
 	int									mTempSize, mCommonFrameSize, mCallerSavedTemps, mFreeCallerSavedTemps, mFastCallBase, mNumRestricted;
@@ -801,6 +806,7 @@ public:
 	int									mID;
 
 	int									mLocalSize, mNumLocals, mNumParams, mParamVarsSize;
+	int									mStaticVarsBase, mNumStaticVars;
 	GrowingVariableArray				mLocalVars, mParamVars;
 	NumberSet							mLocalAliasedSet, mParamAliasedSet;
 
@@ -833,8 +839,9 @@ public:
 
 	void MapCallerSavedTemps(void);
 
-	bool ReferencesGlobal(int varindex);
-	bool ModifiesGlobal(int varindex);
+	// The variable index refers to the global variables seen by the caller
+	bool ReferencesGlobal(int varindex, const GrowingVariableArray& globalVars);
+	bool ModifiesGlobal(int varindex, const GrowingVariableArray& globalVars);
 
 	void MapVariables(void);
 	void ReduceTemporaries(bool final = false);
@@ -845,6 +852,8 @@ protected:
 	void BuildTraces(int expand, bool dominators = true, bool compact = false);
 	void TrimBlocks(void);
 	void EarlyBranchElimination(void);
+	void SolveRequiredSets(bool (InterCodeBasicBlock::* update)(void));
+	int NumInstructions(void) const;
 	void BuildDataFlowSets(void);
 	void RenameTemporaries(void);
 	void TempForwarding(bool reverse = false, bool checkloops = false);
@@ -922,7 +931,12 @@ public:
 
 	bool Disassemble(const char* name);
 
+	// Close all procedures deferred during translation, independent procedures
+	// are optimized in parallel with a result identical to the serial order
+	void CloseDeferredProcedures(int numThreads);
+
 	GrowingInterCodeProcedurePtrArray	mProcedures;
+	GrowingInterCodeProcedurePtrArray	mDeferredProcedures;
 
 	GrowingVariableArray				mGlobalVars;
 	LinkerObject					*	mParamLinkerObject;
@@ -930,6 +944,7 @@ public:
 
 	Linker							*	mLinker;
 	Errors* mErrors;
+	TimeReport						*	mTimeReport;
 
 	uint64				mCompilerOptions;
 
@@ -904,11 +904,11 @@ void InterCodeGenerator::TranslateAssembler(InterCodeModule* mod, Declaration *
 
 		if (aexp)
 		{
-			if (cexp->mAsmInsMode == ASMIM_ABSOLUTE && HasAsmInstructionMode(cexp->mAsmInsType, ASMIM_ZERO_PAGE) && aexp->mType == DT_VARIABLE && (aexp->mFlags & DTF_GLOBAL) && (aexp->mFlags & DTF_ZEROPAGE))
+			if (cexp->mAsmInsMode == ASMIM_ABSOLUTE && HasAsmInstructionMode(cexp->mAsmInsType, ASMIM_ZERO_PAGE, TargetCPU(mCompilerOptions)) && aexp->mType == DT_VARIABLE && (aexp->mFlags & DTF_GLOBAL) && (aexp->mFlags & DTF_ZEROPAGE))
 			{
 				cexp->mAsmInsMode = ASMIM_ZERO_PAGE;
 			}
-			else if (cexp->mAsmInsMode == ASMIM_ABSOLUTE && HasAsmInstructionMode(cexp->mAsmInsType, ASMIM_ZERO_PAGE) && aexp->mType == DT_VARIABLE_REF && (aexp->mBase->mFlags & DTF_GLOBAL) && (aexp->mBase->mFlags & DTF_ZEROPAGE))
+			else if (cexp->mAsmInsMode == ASMIM_ABSOLUTE && HasAsmInstructionMode(cexp->mAsmInsType, ASMIM_ZERO_PAGE, TargetCPU(mCompilerOptions)) && aexp->mType == DT_VARIABLE_REF && (aexp->mBase->mFlags & DTF_GLOBAL) && (aexp->mBase->mFlags & DTF_ZEROPAGE))
 			{
 				cexp->mAsmInsMode = ASMIM_ZERO_PAGE;
 			}
@@ -950,6 +950,12 @@ void InterCodeGenerator::TranslateAssembler(InterCodeModule* mod, Declaration *
 		if (cexp->mLeft)
 			aexp = cexp->mLeft->mDecValue;
 
+		if (IsQuadAsmInstruction(cexp->mAsmInsType))
+		{
+			d[offset++] = ASM_QUAD_PREFIX;
+			d[offset++] = ASM_QUAD_PREFIX;
+		}
+
 		if (cexp->mAsmInsType != ASMIT_BYTE)
 		{
 			int	opcode = AsmInsOpcodes[cexp->mAsmInsType][cexp->mAsmInsMode];
@@ -1073,6 +1079,7 @@ void InterCodeGenerator::TranslateAssembler(InterCodeModule* mod, Declaration *
 		case ASMIM_ZERO_PAGE_X:
 		case ASMIM_INDIRECT_X:
 		case ASMIM_INDIRECT_Y:
+		case ASMIM_INDIRECT_ZERO_PAGE:
 			if (!aexp)
 				mErrors->Error(cexp->mLocation, EERR_ASM_INVALD_OPERAND, "Missing assembler operand");
 			else if (aexp->mType == DT_VARIABLE_REF)
@@ -1157,6 +1164,7 @@ void InterCodeGenerator::TranslateAssembler(InterCodeModule* mod, Declaration *
 		case ASMIM_INDIRECT:
 		case ASMIM_ABSOLUTE_X:
 		case ASMIM_ABSOLUTE_Y:
+		case ASMIM_INDIRECT_ABSOLUTE_X:
 			if (!aexp)
 				mErrors->Error(cexp->mLocation, EERR_ASM_INVALD_OPERAND, "Missing assembler operand");
 			else if (aexp->mType == DT_CONST_INTEGER)
@@ -6337,6 +6345,8 @@ InterCodeProcedure* InterCodeGenerator::TranslateProcedure(InterCodeModule * mod
 	InterCodeProcedure* proc = new InterCodeProcedure(mod, dec->mLocation, dec->mQualIdent, mLinker->AddObject(dec->mLocation, dec->mQualIdent, dec->mSection, LOT_BYTE_CODE, dec->mAlignment));
 	proc->mLinkerObject->mFullIdent = dec->FullIdent();
 
+	MemoryArenaScope	scope(&proc->mArena);
+
 #if 0
 	if (proc->mIdent && !strcmp(proc->mIdent->mString, "test"))
 		exp->Dump(0);
@@ -6544,12 +6554,7 @@ InterCodeProcedure* InterCodeGenerator::TranslateProcedure(InterCodeModule * mod
 	exitBlock->Close(nullptr, nullptr);
 
 	if (mErrors->mErrorCount == 0 && proc != mMainInitProc)
-	{
-		if (mCompilerOptions & COPT_VERBOSE2)
-			printf("Optimize intermediate code <%s>\n", proc->mIdent->mString);
-
-		proc->Close();
-	}
+		mod->mDeferredProcedures.Push(proc);
 
 	mCompilerOptions = outerCompilerOptions;
 
@@ -6564,9 +6569,6 @@ void InterCodeGenerator::CompleteMainInit(InterCodeModule* mod)
 		mMainInitBlock->Append(ins);
 		mMainInitBlock->Close(mMainStartupBlock, nullptr);
 
-		if (mCompilerOptions & COPT_VERBOSE2)
-			printf("Optimize intermediate code <%s>\n", mMainInitProc->mIdent->mString);
-
-		mMainInitProc->Close();
+		mod->mDeferredProcedures.Push(mMainInitProc);
 	}
 }
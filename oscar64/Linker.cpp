@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include "CompilerTypes.h"
 #include "Compression.h"
+#include <algorithm>
 
 LinkerRegion::LinkerRegion(void)
 	: mSections(nullptr), mFreeChunks(FreeChunk{ 0, 0 } ), mLastObject(nullptr), mInlayObject(nullptr), mCartridgeBanks(0)
@@ -45,7 +46,7 @@ bool LinkerReference::operator!=(const LinkerReference& ref)
 }
 
 LinkerObject::LinkerObject(void)
-	: mReferences(nullptr), mNumTemporaries(0), mSize(0), mStripe(0), mAlignment(1), mStackSection(nullptr), mIdent(nullptr), mFullIdent(nullptr), mStartUsed(0x10000), mEndUsed(0x00000), mMemory(nullptr)
+	: mReferences(nullptr), mMapOffset(0), mNumTemporaries(0), mSize(0), mStripe(0), mAlignment(1), mStackSection(nullptr), mIdent(nullptr), mFullIdent(nullptr), mStartUsed(0x10000), mEndUsed(0x00000), mMemory(nullptr)
 	, mPrefix(nullptr), mSuffix(nullptr), mProc(nullptr), mNativeProc(nullptr), mOwnerProc(nullptr)
 {}
 
@@ -169,7 +170,7 @@ LinkerOverlay::~LinkerOverlay(void)
 }
 
 Linker::Linker(Errors* errors)
-	: mErrors(errors), mSections(nullptr), mReferences(nullptr), mObjects(nullptr), mRegions(nullptr), mOverlays(nullptr), mBreakpoints(0), mCompilerOptions(COPT_DEFAULT)
+	: mErrors(errors), mSections(nullptr), mReferences(nullptr), mObjects(nullptr), mRegions(nullptr), mOverlays(nullptr), mBreakpoints(0), mCompilerOptions(COPT_DEFAULT), mIndexValid(false)
 {
 	for (int i = 0; i < 64; i++)
 	{
@@ -213,12 +214,17 @@ LinkerRegion* Linker::FindRegion(const Ident* region)
 	return nullptr;
 }
 
+static thread_local LinkerQueue* DeferredObjects = nullptr;
+
 LinkerSection* Linker::AddSection(const Ident* section, LinkerSectionType type)
 {
 	LinkerSection* lsec = new LinkerSection;
 	lsec->mIdent = section;
 	lsec->mType = type;
-	mSections.Push(lsec);
+	if (DeferredObjects)
+		DeferredObjects->mSections.Push(lsec);
+	else
+		mSections.Push(lsec);
 	return lsec;
 
 }
@@ -275,8 +281,95 @@ bool Linker::IsSectionPlaced(LinkerSection* section)
 	return false;
 }
 
+void Linker::AddressIndex::Build(void)
+{
+	if (mObjects.Size() > 0)
+		std::stable_sort(&mObjects[0], &mObjects[0] + mObjects.Size(), [](const LinkerObject* l, const LinkerObject* r) { return l->mAddress > r->mAddress; });
+
+	mMaxEnd.SetSize(mObjects.Size());
+	int	end = 0;
+	for (int i = mObjects.Size() - 1; i >= 0; i--)
+	{
+		if (mObjects[i]->mAddress + mObjects[i]->mSize > end)
+			end = mObjects[i]->mAddress + mObjects[i]->mSize;
+		mMaxEnd[i] = end;
+	}
+}
+
+LinkerObject* Linker::AddressIndex::Find(int addr, InterCodeProcedure* proc) const
+{
+	int	l = 0, h = mObjects.Size();
+	while (l < h)
+	{
+		int m = (l + h) >> 1;
+		if (mObjects[m]->mAddress > addr)
+			l = m + 1;
+		else
+			h = m;
+	}
+
+	while (l < mObjects.Size() && mMaxEnd[l] > addr)
+	{
+		LinkerObject* lobj = mObjects[l];
+		if (addr < lobj->mAddress + lobj->mSize && (!proc || lobj->mOwnerProc == proc))
+			return lobj;
+		l++;
+	}
+
+	return nullptr;
+}
+
+void Linker::BuildObjectIndex(void)
+{
+	mAddressIndex.mObjects.SetSize(0);
+	for (int i = 0; i < 64; i++)
+		mBankIndex[i].mObjects.SetSize(0);
+
+	int	nsize = 16;
+	while (nsize < 2 * mObjects.Size())
+		nsize *= 2;
+	mNameHash.SetSize(nsize);
+	mNameHash.Fill(nullptr);
+
+	for (int i = 0; i < mObjects.Size(); i++)
+	{
+		LinkerObject* lobj = mObjects[i];
+		if (lobj->mFlags & LOBJF_PLACED)
+		{
+			mAddressIndex.mObjects.Push(lobj);
+			if (lobj->mRegion)
+			{
+				for (int j = 0; j < 64; j++)
+					if ((1ULL << j) & lobj->mRegion->mCartridgeBanks)
+						mBankIndex[j].mObjects.Push(lobj);
+			}
+
+			if (lobj->mIdent)
+			{
+				int	h = lobj->mIdent->mHash & (nsize - 1);
+				while (mNameHash[h] && mNameHash[h]->mIdent != lobj->mIdent)
+					h = (h + 1) & (nsize - 1);
+				if (!mNameHash[h])
+					mNameHash[h] = lobj;
+			}
+		}
+	}
+
+	mAddressIndex.Build();
+	for (int i = 0; i < 64; i++)
+		mBankIndex[i].Build();
+
+	mIndexValid = true;
+}
+
 LinkerObject* Linker::FindObjectByAddr(int addr, InterCodeProcedure* proc)
 {
+	if (mIndexValid)
+	{
+		LinkerObject* lobj = proc ? mAddressIndex.Find(addr, proc) : nullptr;
+		return lobj ? lobj : mAddressIndex.Find(addr, nullptr);
+	}
+
 	LinkerObject* bobj = nullptr;
 
 	if (proc)
@@ -314,6 +407,16 @@ LinkerObject* Linker::FindObjectByAddr(int addr, InterCodeProcedure* proc)
 
 LinkerObject* Linker::FindObjectByName(const char* name)
 {
+	if (mIndexValid)
+	{
+		const Ident* ident = Ident::Unique(name);
+
+		int	h = ident->mHash & (mNameHash.Size() - 1);
+		while (mNameHash[h] && mNameHash[h]->mIdent != ident)
+			h = (h + 1) & (mNameHash.Size() - 1);
+		return mNameHash[h];
+	}
+
 	for (int i = 0; i < mObjects.Size(); i++)
 	{
 		LinkerObject* lobj = mObjects[i];
@@ -329,6 +432,14 @@ LinkerObject* Linker::FindObjectByName(const char* name)
 
 LinkerObject* Linker::FindObjectByAddr(int bank, int addr, InterCodeProcedure* proc)
 {
+	if (mIndexValid && bank >= 0 && bank < 64)
+	{
+		LinkerObject* lobj = proc ? mBankIndex[bank].Find(addr, proc) : nullptr;
+		if (!lobj)
+			lobj = mBankIndex[bank].Find(addr, nullptr);
+		return lobj ? lobj : FindObjectByAddr(addr, proc);
+	}
+
 	LinkerObject* bobj = nullptr;
 
 	if (proc)
@@ -373,16 +484,65 @@ LinkerObject* Linker::FindObjectByAddr(int bank, int addr, InterCodeProcedure* p
 	return FindObjectByAddr(addr, proc);
 }
 
+void Linker::AddSameHash(int i)
+{
+	int	h = mSameCode[i] & (mSameHash.Size() - 1);
+	mSameNext[i] = mSameHash[h];
+	mSameHash[h] = i;
+}
+
 LinkerObject* Linker::FindSame(LinkerObject* obj)
 {
-	for (int i = 0; i < mObjects.Size(); i++)
+	if (!(obj->mFlags & LOBJF_CONST))
+		return nullptr;
+
+	// Hash the objects added since the last call, an object whose data
+	// changes after it was hashed is only missed as a merge candidate
+
+	int	n = mSameCode.Size();
+	if (2 * mObjects.Size() > mSameHash.Size())
+	{
+		int	hsize = 256;
+		while (hsize < 2 * mObjects.Size())
+			hsize *= 2;
+		mSameHash.SetSize(hsize);
+		mSameHash.Fill(-1);
+		for (int i = 0; i < n; i++)
+			AddSameHash(i);
+	}
+
+	mSameCode.SetSize(mObjects.Size());
+	mSameNext.SetSize(mObjects.Size());
+	for (int i = n; i < mObjects.Size(); i++)
+	{
+		mSameCode[i] = mObjects[i]->ConstHash();
+		AddSameHash(i);
+	}
+
+	// Chains are in descending object order, the last match is the first object
+
+	LinkerObject* bobj = nullptr;
+	int	i = mSameHash[obj->ConstHash() & (mSameHash.Size() - 1)];
+	while (i >= 0)
 	{
 		LinkerObject* lobj = mObjects[i];
 		if (lobj != obj && obj->IsSameConst(lobj))
-			return lobj;
+			bobj = lobj;
+		i = mSameNext[i];
 	}
 
-	return nullptr;
+	return bobj;
+}
+
+unsigned int LinkerObject::ConstHash(void) const
+{
+	unsigned int	hash = mSize;
+	if (mData)
+	{
+		for (int i = 0; i < mSize; i++)
+			hash = hash * 31 + mData[i];
+	}
+	return hash;
 }
 
 bool LinkerObject::IsSameConst(const LinkerObject* obj) const
@@ -443,11 +603,47 @@ bool LinkerObject::IsBefore(const LinkerObject* obj) const
 		return false;
 }
 
+LinkerQueue* Linker::DeferObjects(LinkerQueue* queue)
+{
+	LinkerQueue* pqueue = DeferredObjects;
+	DeferredObjects = queue;
+	return pqueue;
+}
+
+void Linker::DeferObject(LinkerObject* obj)
+{
+	if (DeferredObjects)
+		DeferredObjects->mObjects.Push(obj);
+}
+
+void Linker::InsertDeferredObjects(const LinkerQueue& queue)
+{
+	for (int i = 0; i < queue.mSections.Size(); i++)
+		mSections.Push(queue.mSections[i]);
+
+	for (int i = 0; i < queue.mObjects.Size(); i++)
+	{
+		LinkerObject* obj = queue.mObjects[i];
+		if (obj->mID < 0)
+		{
+			obj->mID = obj->mMapID = mObjects.Size();
+			obj->mSection->mObjects.Push(obj);
+			mObjects.Push(obj);
+		}
+	}
+}
+
 LinkerObject * Linker::AddObject(const Location& location, const Ident* ident, LinkerSection * section, LinkerObjectType type, int alignment)
 {
 	LinkerObject* obj = new LinkerObject;
 	obj->mLocation = location;
-	obj->mID = obj->mMapID = mObjects.Size();
+	if (DeferredObjects)
+	{
+		obj->mID = obj->mMapID = -1;
+		DeferredObjects->mObjects.Push(obj);
+	}
+	else
+		obj->mID = obj->mMapID = mObjects.Size();
 	obj->mType = type;
 	obj->mData = nullptr;
 	obj->mSize = 0;
@@ -459,8 +655,11 @@ LinkerObject * Linker::AddObject(const Location& location, const Ident* ident, L
 	obj->mVariable = nullptr;
 	obj->mFlags = 0;
 	obj->mAlignment = alignment;
-	section->mObjects.Push(obj);
-	mObjects.Push(obj);
+	if (!DeferredObjects)
+	{
+		section->mObjects.Push(obj);
+		mObjects.Push(obj);
+	}
 	return obj;
 }
 
@@ -545,51 +744,161 @@ void Linker::CheckDirectJumps(void)
 	}
 }
 
+LinkerObject* Linker::MappedObject(LinkerObject* obj)
+{
+	while (obj->mMapID != mObjects[obj->mMapID]->mMapID)
+		obj->mMapID = mObjects[obj->mMapID]->mMapID;
+	return mObjects[obj->mMapID];
+}
+
+unsigned int Linker::MergeHash(LinkerObject* obj)
+{
+	unsigned int	hash = obj->ConstHash() * 7 + obj->mReferences.Size();
+	for (int i = 0; i < obj->mReferences.Size(); i++)
+	{
+		const LinkerReference* ref = obj->mReferences[i];
+		hash = hash * 31 + ref->mOffset;
+		hash = hash * 31 + ref->mRefOffset;
+		hash = hash * 31 + MappedObject(ref->mRefObject)->mID;
+	}
+	return hash;
+}
+
+bool Linker::IsSameMerge(LinkerObject* dobj, LinkerObject* sobj)
+{
+	if (dobj->mSize != sobj->mSize || dobj->mSection != sobj->mSection || dobj->mReferences.Size() != sobj->mReferences.Size())
+		return false;
+
+	for (int i = 0; i < sobj->mSize; i++)
+		if (sobj->mData[i] != dobj->mData[i])
+			return false;
+
+	for (int i = 0; i < sobj->mReferences.Size(); i++)
+	{
+		const LinkerReference* sref = sobj->mReferences[i], * dref = dobj->mReferences[i];
+		if (sref->mFlags != dref->mFlags || sref->mOffset != dref->mOffset || sref->mRefOffset != dref->mRefOffset ||
+			MappedObject(sref->mRefObject) != MappedObject(dref->mRefObject))
+			return false;
+	}
+
+	return true;
+}
+
 void Linker::CombineSameConst(void)
 {
+	ExpandingArray<LinkerObject*>	cobjs;
+	for (int i = 0; i < mObjects.Size(); i++)
+	{
+		LinkerObject* lobj(mObjects[i]);
+		if ((lobj->mFlags & LOBJF_REFERENCED) && (lobj->mFlags & LOBJF_CONST) && lobj->mType != LOT_INLAY)
+			cobjs.Push(lobj);
+	}
+
+	// Merge objects with same content and references into the first one,
+	// repeat until merging does not make more references identical
+
+	int	hsize = 16;
+	while (hsize < 2 * cobjs.Size())
+		hsize *= 2;
+
+	ExpandingArray<int>	hash, next;
+	next.SetSize(cobjs.Size());
+
 	bool changed = true;
 	while (changed)
 	{
 		changed = false;
 
-		for (int i = 0; i < mObjects.Size(); i++)
-		{
-			LinkerObject* dobj(mObjects[i]);
-			while (dobj->mMapID != mObjects[dobj->mMapID]->mMapID)
-				dobj->mMapID = mObjects[dobj->mMapID]->mMapID;
+		hash.SetSize(hsize);
+		hash.Fill(-1);
 
-			if ((dobj->mFlags & LOBJF_REFERENCED) && (dobj->mFlags & LOBJF_CONST) && dobj->mMapID == dobj->mID && dobj->mType != LOT_INLAY)
+		for (int i = 0; i < cobjs.Size(); i++)
+		{
+			LinkerObject* sobj(cobjs[i]);
+			if (MappedObject(sobj) == sobj)
 			{
-				for (int j = i + 1; j < mObjects.Size(); j++)
+				int	h = MergeHash(sobj) & (hsize - 1);
+
+				int	j = hash[h];
+				while (j >= 0 && !IsSameMerge(cobjs[j], sobj))
+					j = next[j];
+
+				if (j >= 0)
 				{
-					LinkerObject* sobj(mObjects[j]);
+					LinkerObject* dobj(cobjs[j]);
 
-					if ((sobj->mFlags & LOBJF_REFERENCED) && (sobj->mFlags & LOBJF_CONST) && sobj->mMapID == sobj->mID && sobj->mType != LOT_INLAY)
-					{
-						if (dobj->mSize == sobj->mSize && dobj->mSection == sobj->mSection && dobj->mReferences.Size() == sobj->mReferences.Size())
-						{
-							int i = 0;
-							while (i < sobj->mSize && sobj->mData[i] == dobj->mData[i])
-								i++;
-							if (i == sobj->mSize)
-							{
-								i = 0;
-								while (i < sobj->mReferences.Size() && *sobj->mReferences[i] == *dobj->mReferences[i])
-									i++;
-								if (i == sobj->mReferences.Size())
-								{
-									sobj->mMapID = dobj->mMapID;
-									changed = true;
+					sobj->mMapID = dobj->mMapID;
+					changed = true;
 
-									if (dobj->mIdent && sobj->mIdent && (mCompilerOptions & COPT_VERBOSE2))
-									{
-										printf("Match %s : %s\n", dobj->mIdent->mString, sobj->mIdent->mString);
-									}
-								}
-							}
-						}
+					if (dobj->mIdent && sobj->mIdent && (mCompilerOptions & COPT_VERBOSE2))
+					{
+						printf("Match %s : %s\n", dobj->mIdent->mString, sobj->mIdent->mString);
 					}
 				}
+				else
+				{
+					next[i] = hash[h];
+					hash[h] = i;
+				}
+			}
+		}
+	}
+
+	// Share the tails of const data, sorting the remaining data objects by
+	// their reversed content puts each object directly before the next
+	// longer one that ends with it
+
+	ExpandingArray<LinkerObject*>	tobjs;
+	for (int i = 0; i < cobjs.Size(); i++)
+	{
+		LinkerObject* lobj(cobjs[i]);
+		if (lobj->mMapID == lobj->mID && lobj->mType == LOT_DATA && lobj->mSize > 0 && lobj->mReferences.Size() == 0 &&
+			lobj->mAlignment <= 1 && !(lobj->mFlags & (LOBJF_FORCE_ALIGN | LOBJF_ZEROPAGE)))
+			tobjs.Push(lobj);
+	}
+
+	if (tobjs.Size() > 1)
+	{
+		std::sort(&tobjs[0], &tobjs[0] + tobjs.Size(), [](const LinkerObject* l, const LinkerObject* r)
+		{
+			if (l->mSection != r->mSection)
+				return ptrdiff_t(l->mSection) < ptrdiff_t(r->mSection);
+
+			int	i = 1;
+			while (i <= l->mSize && i <= r->mSize && l->mData[l->mSize - i] == r->mData[r->mSize - i])
+				i++;
+			if (i <= l->mSize && i <= r->mSize)
+				return l->mData[l->mSize - i] < r->mData[r->mSize - i];
+			else
+				return l->mSize < r->mSize;
+		});
+
+		for (int i = tobjs.Size() - 2; i >= 0; i--)
+		{
+			LinkerObject* sobj(tobjs[i]), * dobj(tobjs[i + 1]);
+
+			// A tail does not cross a page if the containing object does not
+			uint32	cross = sobj->mFlags & (LOBJF_NO_CROSS | LOBJF_NEVER_CROSS);
+			if (cross & LOBJF_NEVER_CROSS)
+				cross = LOBJF_NEVER_CROSS;
+			else if (mCompilerOptions & COPT_OPTIMIZE_CODE_SIZE)
+				cross = 0;
+			else if (cross)
+				cross = LOBJF_NO_CROSS | LOBJF_NEVER_CROSS;
+
+			if (sobj->mSection == dobj->mSection && sobj->mSize < dobj->mSize &&
+				(!cross || ((dobj->mFlags & cross) && dobj->mSize <= 256)) &&
+				!memcmp(sobj->mData, dobj->mData + dobj->mSize - sobj->mSize, sobj->mSize))
+			{
+				LinkerObject* mobj = MappedObject(dobj);
+
+				sobj->mMapID = mobj->mID;
+				sobj->mMapOffset = dobj->mMapOffset + dobj->mSize - sobj->mSize;
+
+				if (mCompilerOptions & COPT_VERBOSE2)
+				{
+					printf("Suffix %s : %s + %d\n", mobj->mIdent ? mobj->mIdent->mString : "-", sobj->mIdent ? sobj->mIdent->mString : "-", sobj->mMapOffset);
+				}
 			}
 		}
 	}
@@ -604,7 +913,14 @@ void Linker::CombineSameConst(void)
 			else
 			{
 				for (int j = 0; j < lobj->mReferences.Size(); j++)
-					lobj->mReferences[j]->mRefObject = mObjects[lobj->mReferences[j]->mRefObject->mMapID];
+				{
+					LinkerReference* ref = lobj->mReferences[j];
+					while (ref->mRefObject->mMapID != ref->mRefObject->mID)
+					{
+						ref->mRefOffset += ref->mRefObject->mMapOffset;
+						ref->mRefObject = mObjects[ref->mRefObject->mMapID];
+					}
+				}
 			}
 		}
 	}
@@ -1059,6 +1375,8 @@ void Linker::PatchReferences(bool inlays)
 
 void Linker::PlaceObjects(bool retry)
 {
+	mIndexValid = false;
+
 	for (int i = 0; i < mRegions.Size(); i++)
 	{
 		LinkerRegion* lrgn = mRegions[i];
@@ -1273,6 +1591,7 @@ void Linker::Link(void)
 	}
 
 	SortObjects();
+	BuildObjectIndex();
 }
 
 static const char * LinkerObjectTypeNames[] = 
@@ -1575,6 +1894,61 @@ static uint32 flip32(uint32 d)
 	return uint32(flip16(uint16(d >> 16))) | (uint32(flip16(uint16(d))) << 16);
 }
 
+// The first bank of an easyflash cartridge holds the startup code and the
+// compressed main region, and the boot code in the ultimax ROM at $e000
+
+bool Linker::BuildEasyFlashBoot(uint8* bootmem)
+{
+	memset(bootmem, 0, 0x4000);
+
+	if (mCartridgeBankUsed[0])
+		memcpy(bootmem, mCartridge[0] + 0x8000, 0x4000);
+
+	LinkerRegion* mainRegion = FindRegion(Ident::Unique("main"));
+	LinkerRegion* startupRegion = FindRegion(Ident::Unique("startup"));
+
+	memcpy(bootmem, mMemory + startupRegion->mStart, startupRegion->mNonzero - startupRegion->mStart);
+	int usedlz = memlzcomp(bootmem + 0x0100, mMemory + mainRegion->mStart, mainRegion->mNonzero - mainRegion->mStart);
+
+	Location	loc;
+
+	if (usedlz > 0x03e00)
+	{
+		mErrors->Error(loc, ERRR_INSUFFICIENT_MEMORY, "Can not fit main region into first ROM bank");
+		return false;
+	}
+
+	bootmem[0x3ffc] = 0x00;
+	bootmem[0x3ffd] = 0xff;
+
+	uint8	bootcode[] = {
+		0xa9, 0x87,
+		0x8d, 0x02, 0xde,
+		0xa9, 0x00,
+		0x8d, 0x00, 0xde,
+		0x6c, 0xfc, 0xff
+	};
+
+	int j = 0x3f00;
+	for (int i = 0; i < sizeof(bootcode); i++)
+	{
+		bootmem[j++] = 0xa9;
+		bootmem[j++] = bootcode[i];
+		bootmem[j++] = 0x8d;
+		bootmem[j++] = i;
+		bootmem[j++] = 0x04;
+	}
+	bootmem[j++] = 0x4c;
+	bootmem[j++] = 0x00;
+	bootmem[j++] = 0x04;
+
+	mCartridgeBankUsed[0] = true;
+	mCartridgeBankStart[0] = 0x8000;
+	mCartridgeBankEnd[0] = 0x8000 + usedlz + 0x200;
+
+	return true;
+}
+
 bool Linker::WriteCrtFile(const char* filename, uint16 id, uint8 subtype, const char* cname)
 {
 	FILE* file;
@@ -1649,50 +2023,12 @@ bool Linker::WriteCrtFile(const char* filename, uint16 id, uint8 subtype, const
 
 			uint8 bootmem[0x4000];
 
-			memset(bootmem, 0, 0x4000);
-
-			if (mCartridgeBankUsed[0])
-				memcpy(bootmem, mCartridge[0] + 0x8000, 0x4000);
-
-			LinkerRegion* mainRegion = FindRegion(Ident::Unique("main"));
-			LinkerRegion* startupRegion = FindRegion(Ident::Unique("startup"));
-
-			memcpy(bootmem, mMemory + startupRegion->mStart, startupRegion->mNonzero - startupRegion->mStart);
-			int usedlz = memlzcomp(bootmem + 0x0100, mMemory + mainRegion->mStart, mainRegion->mNonzero - mainRegion->mStart);
-
-			Location	loc;
-
-			if (usedlz > 0x03e00)
+			if (!BuildEasyFlashBoot(bootmem))
 			{
-				mErrors->Error(loc, ERRR_INSUFFICIENT_MEMORY, "Can not fit main region into first ROM bank");
 				fclose(file);
 				return false;
 			}
 
-			bootmem[0x3ffc] = 0x00;
-			bootmem[0x3ffd] = 0xff;
-
-			uint8	bootcode[] = {
-				0xa9, 0x87,
-				0x8d, 0x02, 0xde,
-				0xa9, 0x00,
-				0x8d, 0x00, 0xde,
-				0x6c, 0xfc, 0xff
-			};
-
-			int j = 0x3f00;
-			for (int i = 0; i < sizeof(bootcode); i++)
-			{
-				bootmem[j++] = 0xa9;
-				bootmem[j++] = bootcode[i];
-				bootmem[j++] = 0x8d;
-				bootmem[j++] = i;
-				bootmem[j++] = 0x04;
-			}
-			bootmem[j++] = 0x4c;
-			bootmem[j++] = 0x00;
-			bootmem[j++] = 0x04;
-
 			chipHeader.mLoadAddress = 0x0080;
 			fwrite(&chipHeader, sizeof(chipHeader), 1, file);
 			fwrite(bootmem, 1, 0x2000, file);
@@ -1701,10 +2037,6 @@ bool Linker::WriteCrtFile(const char* filename, uint16 id, uint8 subtype, const
 			fwrite(&chipHeader, sizeof(chipHeader), 1, file);
 			fwrite(bootmem + 0x2000, 1, 0x2000, file);
 
-			mCartridgeBankUsed[0] = true;
-			mCartridgeBankStart[0] = 0x8000;
-			mCartridgeBankEnd[0] = 0x8000 + usedlz + 0x200;
-
 			for (int i = 1; i < 64; i++)
 			{
 				if (mCartridgeBankUsed[i])
@@ -2106,6 +2438,8 @@ bool Linker::WriteAsmFile(const char* filename, const char* version)
 	{
 		fprintf(file, "; Compiled with %s\n", version);
 
+		mNativeDisassembler.mCPU = TargetCPU(mCompilerOptions);
+
 		for (int i = 0; i < mObjects.Size(); i++)
 		{
 			LinkerObject* obj = mObjects[i];
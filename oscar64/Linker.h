@@ -198,7 +198,7 @@ public:
 	Location							mLocation;
 	const Ident						*	mIdent, * mFullIdent;
 	LinkerObjectType					mType;
-	int									mID, mMapID;
+	int									mID, mMapID, mMapOffset;
 	int									mAddress, mRefAddress;
 	int									mSize, mAlignment, mStripe, mStartUsed, mEndUsed;
 	LinkerSection					*	mSection;
@@ -243,6 +243,7 @@ public:
 	void MarkRelevant(void);
 
 	bool IsSameConst(const LinkerObject* obj) const;
+	unsigned int ConstHash(void) const;
 
 	bool IsBefore(const LinkerObject* obj) const;
 	int FirstBank(void) const;
@@ -260,6 +261,13 @@ public:
 	bool							mCompressed;
 };
 
+class LinkerQueue
+{
+public:
+	ExpandingArray<LinkerSection*>	mSections;
+	ExpandingArray<LinkerObject*>	mObjects;
+};
+
 class Linker
 {
 public:
@@ -283,6 +291,13 @@ public:
 	LinkerObject * AddObject(const Location & location, const Ident* ident, LinkerSection * section, LinkerObjectType type, int alignment = 1);
 	LinkerObject* FindSame(LinkerObject* obj);
 
+	// Sections and objects added by the current thread while a queue is set
+	// are only entered into the linker lists by InsertDeferredObjects, this
+	// keeps their order independent of thread scheduling
+	LinkerQueue* DeferObjects(LinkerQueue* queue);
+	void DeferObject(LinkerObject* obj);
+	void InsertDeferredObjects(const LinkerQueue& queue);
+
 	LinkerOverlay* AddOverlay(const Location& location, const Ident* ident, int bank);
 
 	void SortObjects(void);
@@ -296,6 +311,7 @@ public:
 	bool WriteAsmFile(const char* filename, const char * version);
 	bool WriteLblFile(const char* filename);
 	bool WriteCrtFile(const char* filename, uint16 id, uint8 subtype, const char * cname);
+	bool BuildEasyFlashBoot(uint8* bootmem);
 	bool WriteBinFile(const char* filename);
 	bool WriteNesFile(const char* filename, TargetMachine machine);
 	bool WriteMlbFile(const char* filename, TargetMachine machine);
@@ -338,7 +354,34 @@ protected:
 	ByteCodeDisassembler	mByteCodeDisassembler;
 
 	bool Forwards(LinkerObject* pobj, LinkerObject* lobj);
+
+	LinkerObject* MappedObject(LinkerObject* obj);
+	unsigned int MergeHash(LinkerObject* obj);
+	bool IsSameMerge(LinkerObject* dobj, LinkerObject* sobj);
 	void SortObjectsPartition(int l, int r);
 
+	// Placed objects ordered by descending address with the maximum end
+	// address of all objects from the position on, built after linking
+	struct AddressIndex
+	{
+		ExpandingArray<LinkerObject*>	mObjects;
+		ExpandingArray<int>				mMaxEnd;
+
+		void Build(void);
+		LinkerObject* Find(int addr, InterCodeProcedure* proc) const;
+	};
+
+	AddressIndex					mAddressIndex, mBankIndex[64];
+	ExpandingArray<LinkerObject*>	mNameHash;
+	bool							mIndexValid;
+
+	void BuildObjectIndex(void);
+
+	// Content hash of the objects for FindSame, filled on demand
+	ExpandingArray<int>				mSameHash, mSameNext;
+	ExpandingArray<unsigned int>	mSameCode;
+
+	void AddSameHash(int i);
+
 	Errors* mErrors;
 };
@@ -0,0 +1,198 @@
+#include "MemoryArena.h"
+#include "ThreadPool.h"
+
+static const size_t ArenaAlignment = 16;
+static const size_t ArenaMinChunk = 4096;
+static const size_t ArenaMaxChunk = 256 * 1024;
+static const size_t ArenaLargeObject = 16 * 1024;
+
+static const size_t HeaderSize = (sizeof(void*) * 5 + ArenaAlignment - 1) & ~(ArenaAlignment - 1);
+static const size_t ChunkHeaderSize = (sizeof(void*) + ArenaAlignment - 1) & ~(ArenaAlignment - 1);
+
+#ifdef OSCAR_NO_THREADS
+static MemoryArena* CurrentArena = nullptr;
+static MemoryArena* PermanentArena = nullptr;
+#else
+static thread_local MemoryArena* CurrentArena = nullptr;
+static thread_local MemoryArena* PermanentArena = nullptr;
+#endif
+
+MemoryArena::MemoryArena(void)
+	: mChunks(nullptr), mObjects(nullptr), mPos(nullptr), mEnd(nullptr), mChunkSize(ArenaMinChunk)
+{
+}
+
+MemoryArena::~MemoryArena(void)
+{
+	Release();
+}
+
+void MemoryArena::Release(void)
+{
+	Header* h = mObjects;
+	while (h)
+	{
+		Header* n = h->mNext;
+		if (h->mDestroy)
+		{
+			void (*destroy)(void*) = h->mDestroy;
+			h->mDestroy = nullptr;
+			destroy((uint8*)h + HeaderSize);
+		}
+		if (HeaderSize + h->mSize > ArenaLargeObject)
+			free(h);
+		h = n;
+	}
+	mObjects = nullptr;
+	mFree.SetSize(0);
+
+	while (mChunks)
+	{
+		Chunk* c = mChunks;
+		mChunks = c->mNext;
+		free(c);
+	}
+
+	mPos = mEnd = nullptr;
+	mChunkSize = ArenaMinChunk;
+}
+
+void* MemoryArena::Bump(size_t size)
+{
+	size = (size + ArenaAlignment - 1) & ~(ArenaAlignment - 1);
+
+	if (!mPos || mPos + size > mEnd)
+	{
+		// Chunks grow with the arena, small procedures only use a few pages
+
+		size_t	csize = mChunkSize;
+		if (mChunkSize < ArenaMaxChunk)
+			mChunkSize *= 2;
+		if (csize < ChunkHeaderSize + size)
+			csize = ChunkHeaderSize + size;
+
+		Chunk* c = (Chunk*)malloc(csize);
+		c->mNext = mChunks;
+		mChunks = c;
+
+		mPos = (uint8*)c + ChunkHeaderSize;
+		mEnd = (uint8*)c + csize;
+	}
+
+	void* p = mPos;
+	mPos += size;
+	return p;
+}
+
+void* MemoryArena::Allocate(size_t size, void (*destroy)(void*))
+{
+	MemoryArena* arena = CurrentArena;
+
+	Header* h;
+	if (HeaderSize + size > ArenaLargeObject)
+		h = (Header*)malloc(HeaderSize + size);
+	else if (arena && arena->mFree.Size() > 0 && arena->mFree.Last()->mSize == size)
+	{
+		// Objects of a procedure are mostly of the same type, so a deleted
+		// object of the same size is usually at the end of the free list
+
+		h = arena->mFree.Pop();
+		h->mDestroy = destroy;
+		return (uint8*)h + HeaderSize;
+	}
+	else if (arena)
+		h = (Header*)arena->Bump(HeaderSize + size);
+	else
+		h = (Header*)Permanent()->Bump(HeaderSize + size);
+
+	h->mArena = arena;
+	h->mSize = size;
+	h->mPrev = nullptr;
+
+	if (arena)
+	{
+		h->mDestroy = destroy;
+		h->mNext = arena->mObjects;
+		if (h->mNext)
+			h->mNext->mPrev = h;
+		arena->mObjects = h;
+	}
+	else
+	{
+		h->mDestroy = nullptr;
+		h->mNext = nullptr;
+	}
+
+	return (uint8*)h + HeaderSize;
+}
+
+void* MemoryArena::AllocatePermanent(size_t size)
+{
+	return Permanent()->Bump(size);
+}
+
+void MemoryArena::Free(void* ptr)
+{
+	if (ptr)
+	{
+		Header* h = (Header*)((uint8*)ptr - HeaderSize);
+		h->mDestroy = nullptr;
+
+		bool	large = HeaderSize + h->mSize > ArenaLargeObject;
+
+		if (!h->mArena)
+		{
+			if (large)
+				free(h);
+		}
+		else if (h->mArena == CurrentArena)
+		{
+			// The arena may be in use by another thread, if it is not the
+			// current one, the memory is reclaimed when the arena is released
+
+			if (large)
+			{
+				if (h->mPrev)
+					h->mPrev->mNext = h->mNext;
+				else
+					h->mArena->mObjects = h->mNext;
+				if (h->mNext)
+					h->mNext->mPrev = h->mPrev;
+				free(h);
+			}
+			else
+				h->mArena->mFree.Push(h);
+		}
+	}
+}
+
+MemoryArena* MemoryArena::Permanent(void)
+{
+	// Never released, objects created by worker threads outlive the thread
+
+	if (!PermanentArena)
+		PermanentArena = new MemoryArena();
+	return PermanentArena;
+}
+
+MemoryArenaScope::MemoryArenaScope(MemoryArena* arena)
+	: mPrevious(CurrentArena)
+{
+	CurrentArena = arena;
+}
+
+MemoryArenaScope::~MemoryArenaScope(void)
+{
+	CurrentArena = mPrevious;
+}
+
+MemoryArenaPermanentScope::MemoryArenaPermanentScope(MemoryArena* arena)
+	: mPrevious(PermanentArena)
+{
+	PermanentArena = arena;
+}
+
+MemoryArenaPermanentScope::~MemoryArenaPermanentScope(void)
+{
+	PermanentArena = mPrevious;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Array.h"
+
+// Bump allocator for the basic blocks of a procedure.  Objects allocated
+// while an arena is installed for the current thread live until the arena
+// is released, the memory of deleted objects is reused for new objects of
+// the same size.  Large objects are allocated individually and freed when
+// deleted.  Objects allocated without an arena are kept in a permanent
+// arena of the thread.
+
+class MemoryArena
+{
+public:
+	MemoryArena(void);
+	~MemoryArena(void);
+
+	// Run the destructors of all objects not yet deleted and free the memory
+	void Release(void);
+
+	static void* Allocate(size_t size, void (*destroy)(void*));
+	static void* AllocatePermanent(size_t size);
+	static void Free(void* ptr);
+
+protected:
+	struct Chunk
+	{
+		Chunk	*	mNext;
+	};
+
+	struct Header
+	{
+		Header		*	mPrev, * mNext;
+		void			(*mDestroy)(void*);
+		MemoryArena	*	mArena;
+		size_t			mSize;
+	};
+
+	Chunk					*	mChunks;
+	Header					*	mObjects;
+	ExpandingArray<Header*>		mFree;
+	uint8					*	mPos, * mEnd;
+	size_t						mChunkSize;
+
+	void* Bump(size_t size);
+
+	static MemoryArena* Permanent(void);
+};
+
+// Installs an arena for allocations on the current thread
+
+class MemoryArenaScope
+{
+public:
+	MemoryArenaScope(MemoryArena* arena);
+	~MemoryArenaScope(void);
+
+protected:
+	MemoryArena* mPrevious;
+};
+
+// Replaces the permanent arena of the current thread, a compilation in a
+// batch releases all its permanent objects at the end
+
+class MemoryArenaPermanentScope
+{
+public:
+	MemoryArenaPermanentScope(MemoryArena* arena);
+	~MemoryArenaPermanentScope(void);
+
+protected:
+	MemoryArena* mPrevious;
+};
+
+// Base class for objects allocated from the arena of the current thread
+
+template<class T>
+class ArenaObject
+{
+public:
+	static void* operator new(size_t size)
+	{
+		return MemoryArena::Allocate(size, Destroy);
+	}
+
+	static void operator delete(void* ptr)
+	{
+		MemoryArena::Free(ptr);
+	}
+
+protected:
+	static void Destroy(void* ptr)
+	{
+		static_cast<T*>(ptr)->~T();
+	}
+};
+
+// Base class for objects living until the end of the compilation
+
+class PermanentObject
+{
+public:
+	static void* operator new(size_t size)
+	{
+		return MemoryArena::AllocatePermanent(size);
+	}
+
+	static void operator delete(void* ptr)
+	{
+	}
+};
@@ -8,8 +8,8 @@
 #define REYCLE_JUMPS	1
 #define DISASSEMBLE_OPT	0
 
-static bool CheckFunc;
-static bool CheckCase;
+static thread_local bool CheckFunc;
+static thread_local bool CheckCase;
 
 
 static const int CPU_REG_A = 256;
@@ -31,7 +31,7 @@ static const uint32 LIVE_MEM	   = 0x00000020;
 
 static const uint32 LIVE_ALL	   = 0x000000ff;
 
-static int GlobalValueNumber = 0;
+static thread_local int GlobalValueNumber = 0;
 
 static bool IsPowerOf2(unsigned n)
 {
@@ -231,7 +231,7 @@ void NativeRegisterDataSet::ResetCall(const NativeCodeInstruction& ins, int fast
 					{
 						if (var->mIndex && var->mIndex < ins.mLinkerObject->mProc->mModule->mGlobalVars.Size() && var == ins.mLinkerObject->mProc->mModule->mGlobalVars[var->mIndex])
 						{
-							if (ins.mLinkerObject->mProc->ModifiesGlobal(var->mIndex))
+							if (ins.mLinkerObject->mProc->ModifiesGlobal(var->mIndex, ins.mLinkerObject->mProc->mModule->mGlobalVars))
 								mRegs[i].Reset();
 						}
 						else
@@ -839,6 +839,12 @@ void NativeCodeInstruction::Disassemble(FILE* file) const
 	case ASMIM_INDIRECT_Y:
 		fprintf(file, "%s (%s), y\t[%02x-%02x] {%s}", AsmInstructionNames[mType], AddrName(buffer), mMinVal, mMaxVal, flags);
 		break;
+	case ASMIM_INDIRECT_ZERO_PAGE:
+		fprintf(file, "%s (%s)\t[%02x-%02x] {%s}", AsmInstructionNames[mType], AddrName(buffer), mMinVal, mMaxVal, flags);
+		break;
+	case ASMIM_INDIRECT_ABSOLUTE_X:
+		fprintf(file, "%s (%s, x)", AsmInstructionNames[mType], AddrName(buffer));
+		break;
 	case ASMIM_RELATIVE:
 		fprintf(file, "%s %d", AsmInstructionNames[mType], mAddress);
 		break;
@@ -5567,29 +5573,35 @@ void NativeCodeInstruction::Assemble(NativeCodeBasicBlock* block)
 		}
 
 		AsmInsMode	mode = mMode;
+		AsmCPU		cpu = TargetCPU(block->mProc->mCompilerOptions);
 
-		if (mode == ASMIM_ABSOLUTE && !mLinkerObject && mAddress < 256 && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE))
+		if (mode == ASMIM_ABSOLUTE && !mLinkerObject && mAddress < 256 && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE, cpu))
 			mode = ASMIM_ZERO_PAGE;
-		else if (mode == ASMIM_ABSOLUTE_X && !mLinkerObject && mAddress < 256 && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_X))
+		else if (mode == ASMIM_ABSOLUTE_X && !mLinkerObject && mAddress < 256 && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_X, cpu))
 			mode = ASMIM_ZERO_PAGE_X;
-		else if (mode == ASMIM_ABSOLUTE_Y && !mLinkerObject && mAddress < 256 && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_Y))
+		else if (mode == ASMIM_ABSOLUTE_Y && !mLinkerObject && mAddress < 256 && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_Y, cpu))
 			mode = ASMIM_ZERO_PAGE_Y;
-		else if (mode == ASMIM_ABSOLUTE && mLinkerObject && (mLinkerObject->mFlags & LOBJF_ZEROPAGE) && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE))
+		else if (mode == ASMIM_ABSOLUTE && mLinkerObject && (mLinkerObject->mFlags & LOBJF_ZEROPAGE) && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE, cpu))
 			mode = ASMIM_ZERO_PAGE;
-		else if (mode == ASMIM_ABSOLUTE_X && mLinkerObject && (mLinkerObject->mFlags & LOBJF_ZEROPAGE) && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_X))
+		else if (mode == ASMIM_ABSOLUTE_X && mLinkerObject && (mLinkerObject->mFlags & LOBJF_ZEROPAGE) && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_X, cpu))
 			mode = ASMIM_ZERO_PAGE_X;
-		else if (mode == ASMIM_ABSOLUTE_Y && mLinkerObject && (mLinkerObject->mFlags & LOBJF_ZEROPAGE) && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_Y))
+		else if (mode == ASMIM_ABSOLUTE_Y && mLinkerObject && (mLinkerObject->mFlags & LOBJF_ZEROPAGE) && HasAsmInstructionMode(mType, ASMIM_ZERO_PAGE_Y, cpu))
 			mode = ASMIM_ZERO_PAGE_Y;
 
 		if (mode == ASMIM_IMMEDIATE_ADDRESS)
 		{
 			assert((mFlags & (NCIF_LOWER | NCIF_UPPER)) != (NCIF_LOWER | NCIF_UPPER));
-			assert(HasAsmInstructionMode(mType, ASMIM_IMMEDIATE));
+			assert(HasAsmInstructionMode(mType, ASMIM_IMMEDIATE, cpu));
 			block->PutOpcode(AsmInsOpcodes[mType][ASMIM_IMMEDIATE]);
 		}
 		else
 		{
-			assert(HasAsmInstructionMode(mType, mode));
+			assert(HasAsmInstructionMode(mType, mode, cpu));
+			if (IsQuadAsmInstruction(mType))
+			{
+				block->PutByte(ASM_QUAD_PREFIX);
+				block->PutByte(ASM_QUAD_PREFIX);
+			}
 			block->PutOpcode(AsmInsOpcodes[mType][mode]);
 		}
 		
@@ -5602,6 +5614,7 @@ void NativeCodeInstruction::Assemble(NativeCodeBasicBlock* block)
 		case ASMIM_ZERO_PAGE_Y:
 		case ASMIM_INDIRECT_X:
 		case ASMIM_INDIRECT_Y:
+		case ASMIM_INDIRECT_ZERO_PAGE:
 			if (mLinkerObject)
 			{
 				LinkerReference		rl;
@@ -5654,6 +5667,7 @@ void NativeCodeInstruction::Assemble(NativeCodeBasicBlock* block)
 		case ASMIM_INDIRECT:
 		case ASMIM_ABSOLUTE_X:
 		case ASMIM_ABSOLUTE_Y:
+		case ASMIM_INDIRECT_ABSOLUTE_X:
 			if (mLinkerObject)
 			{
 				if (mFlags & NCIF_SELFMOD)
@@ -5848,6 +5862,12 @@ int NativeCodeBasicBlock::PutJump(NativeCodeProcedure* proc, NativeCodeBasicBloc
 			PutByte(to - from - 2);
 			return 2;
 		}
+		else if (mProc->mCompilerOptions & COPT_CPU_65C02)
+		{
+			PutOpcode(AsmInsOpcodes[ASMIT_BRA][ASMIM_RELATIVE]);
+			PutByte(to - from - 2);
+			return 2;
+		}
 #if JUMP_TO_BRANCH
 		else if (mNDataSet[CPU_REG_C].mMode == NRDM_IMMEDIATE)
 		{
@@ -5915,6 +5935,8 @@ int NativeCodeBasicBlock::CheckFinalBranchByteSize(NativeCodeBasicBlock* target,
 		if (target->mAsmFromJump >= 0 && target->mAsmFromJump - from >= -126)
 			return 2;
 #endif
+		if (mProc->mCompilerOptions & COPT_CPU_45GS02)
+			return 3;
 		return 5;
 	}
 }
@@ -5933,9 +5955,13 @@ int NativeCodeBasicBlock::BranchByteSize(NativeCodeBasicBlock* target, int from,
 			if (target->mAsmFromJump >= 0 && target->mAsmFromJump - from >= -126)
 				return 2;
 #endif
+			if (mProc->mCompilerOptions & COPT_CPU_45GS02)
+				return 3;
 			target->mAsmFromJump = from + 2;
 			return 5;
 		}
+		else if (mProc->mCompilerOptions & COPT_CPU_45GS02)
+			return 3;
 		else
 		{
 			return 5;
@@ -5960,6 +5986,8 @@ int NativeCodeBasicBlock::JumpByteSize(NativeCodeBasicBlock* target, int from, i
 	{
 		if (second)
 			return 2;
+		else if (mProc->mCompilerOptions & COPT_CPU_65C02)
+			return 2;
 #if JUMP_TO_BRANCH
 		else if (mNDataSet[CPU_REG_C].mMode == NRDM_IMMEDIATE)
 			return 2;
@@ -5999,6 +6027,12 @@ int NativeCodeBasicBlock::PutBranch(NativeCodeProcedure* proc, NativeCodeBasicBl
 		return 2;
 	}
 #endif
+	else if ((proc->mCompilerOptions & COPT_CPU_45GS02) && !(target->mIns.Size() == 1 && target->mIns[0].mType == ASMIT_RTS))
+	{
+		PutOpcode(AsmInsOpcodes[code][ASMIM_RELATIVE_LONG]);
+		PutWord(uint16(to - from - 2));
+		return 3;
+	}
 	else
 	{
 		PutOpcode(AsmInsOpcodes[InvertBranchCondition(code)][ASMIM_RELATIVE]);
@@ -9952,7 +9986,7 @@ int NativeCodeBasicBlock::ShortMultiply(InterCodeProcedure* proc, NativeCodeProc
 			mIns.Push(NativeCodeInstruction(ins, ASMIT_LDX, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[ins->mSrc[index].mTemp]));
 		}
 
-		mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_MUL, mul, int(ins->mSrc[index].mRange.mMaxValue) + 1, false)));
+		mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_MUL, mul, int(ins->mSrc[index].mRange.mMaxValue) + 1, false)));
 		mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, dreg));
 		if (ins->mDst.IsUByte())
 		{
@@ -9961,7 +9995,7 @@ int NativeCodeBasicBlock::ShortMultiply(InterCodeProcedure* proc, NativeCodeProc
 		}
 		else
 		{
-			mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_MUL, mul, int(ins->mSrc[index].mRange.mMaxValue) + 1, true)));
+			mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_MUL, mul, int(ins->mSrc[index].mRange.mMaxValue) + 1, true)));
 			mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, dreg + 1));
 		}
 
@@ -12746,7 +12780,7 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BinaryOperator(InterCodeProcedure* p
 				}
 				mIns.Push(NativeCodeInstruction(ins, ASMIT_TAX, ASMIM_IMPLIED));
 
-				mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_SHL, int(ins->mSrc[1].mIntConst), size, false)));
+				mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_SHL, int(ins->mSrc[1].mIntConst), size, false)));
 				mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, treg));
 				if (ins->mDst.IsUByte())
 				{
@@ -12755,7 +12789,7 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BinaryOperator(InterCodeProcedure* p
 				}
 				else
 				{
-					mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_SHL, int(ins->mSrc[1].mIntConst), size, true)));
+					mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_SHL, int(ins->mSrc[1].mIntConst), size, true)));
 					mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, treg + 1));
 				}
 			}
@@ -13014,7 +13048,7 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BinaryOperator(InterCodeProcedure* p
 				}
 				mIns.Push(NativeCodeInstruction(ins, ASMIT_TAX, ASMIM_IMPLIED));
 
-				mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_SHR, int(ins->mSrc[1].mIntConst), size, false)));
+				mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_SHR, int(ins->mSrc[1].mIntConst), size, false)));
 				mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, treg));
 				if (ins->mDst.IsUByte())
 				{
@@ -13023,7 +13057,7 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BinaryOperator(InterCodeProcedure* p
 				}
 				else
 				{
-					mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_SHR, int(ins->mSrc[1].mIntConst), size, true)));
+					mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_SHR, int(ins->mSrc[1].mIntConst), size, true)));
 					mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, treg + 1));
 				}
 			}
@@ -13364,7 +13398,7 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BinaryOperator(InterCodeProcedure* p
 				}
 				mIns.Push(NativeCodeInstruction(ins, ASMIT_TAX, ASMIM_IMPLIED));
 
-				mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_SAR, int(ins->mSrc[1].mIntConst), size, false)));
+				mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_SAR, int(ins->mSrc[1].mIntConst), size, false)));
 				mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, treg));
 				if (ins->mDst.IsUByte())
 				{
@@ -13373,7 +13407,7 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BinaryOperator(InterCodeProcedure* p
 				}
 				else
 				{
-					mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->mGenerator->AllocateShortMulTable(IA_SAR, int(ins->mSrc[1].mIntConst), size, true)));
+					mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, nproc->AllocateShortMulTable(IA_SAR, int(ins->mSrc[1].mIntConst), size, true)));
 					mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, treg + 1));
 				}
 			}
@@ -13541,7 +13575,7 @@ void NativeCodeBasicBlock::BinaryFloatOperatorLookup(InterCodeProcedure* proc, c
 
 	for (int i = 0; i < 4; i++)
 	{
-		mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, mProc->mGenerator->AllocateFloatTable(ins->mOperator, reverse,
+		mIns.Push(NativeCodeInstruction(ins, ASMIT_LDA, ASMIM_ABSOLUTE_X, 0, mProc->AllocateFloatTable(ins->mOperator, reverse,
 			int(cins->mSrc[0].mRange.mMinValue), int(cins->mSrc[0].mRange.mMaxValue), float(fconst), i)));
 		mIns.Push(NativeCodeInstruction(ins, ASMIT_STA, ASMIM_ZERO_PAGE, BC_REG_TMP + proc->mTempOffset[ins->mDst.mTemp] + i));
 	}
@@ -15612,7 +15646,7 @@ NativeCodeInstruction NativeCodeBasicBlock::DecodeNative(const InterInstruction*
 {
 	uint8	op = lobj->mData[offset++];
 
-	AsmInsData			d = DecInsData[op];
+	AsmInsData			d = CPUInsData[TargetCPU(mProc->mCompilerOptions)][op];
 	int					address = 0;
 	LinkerObject	*	linkerObject = nullptr;
 	uint32				flags = NCIF_LOWER | NCIF_UPPER;
@@ -15624,6 +15658,7 @@ NativeCodeInstruction NativeCodeBasicBlock::DecodeNative(const InterInstruction*
 	case ASMIM_ABSOLUTE_X:
 	case ASMIM_ABSOLUTE_Y:
 	case ASMIM_INDIRECT:
+	case ASMIM_INDIRECT_ABSOLUTE_X:
 		lref = lobj->FindReference(offset);
 		address = lobj->mData[offset++];
 		address += lobj->mData[offset++] << 8;
@@ -15640,6 +15675,7 @@ NativeCodeInstruction NativeCodeBasicBlock::DecodeNative(const InterInstruction*
 	case ASMIM_ZERO_PAGE_Y:
 	case ASMIM_INDIRECT_X:
 	case ASMIM_INDIRECT_Y:
+	case ASMIM_INDIRECT_ZERO_PAGE:
 		lref = lobj->FindReference(offset);
 		address = lobj->mData[offset++];
 		if (lref && (lref->mFlags & LREF_TEMPORARY))
@@ -15656,6 +15692,11 @@ NativeCodeInstruction NativeCodeBasicBlock::DecodeNative(const InterInstruction*
 		address = lobj->mData[offset++];
 		address += offset;
 		break;
+	case ASMIM_RELATIVE_LONG:
+		address = lobj->mData[offset++];
+		address += lobj->mData[offset++] << 8;
+		address += offset - 1;
+		break;
 	case ASMIM_IMMEDIATE:
 		lref = lobj->FindReference(offset);
 		address = lobj->mData[offset++];
@@ -15774,6 +15815,8 @@ void NativeCodeBasicBlock::CallAssembler(InterCodeProcedure* proc, NativeCodePro
 					simple = false;
 				if (dins.mFlags & NCIF_VOLATILE)
 					simple = false;
+				if (!HasAsmInstructionMode(dins.mType, dins.mMode))
+					simple = false;
 
 				if (dins.mMode == ASMIM_ZERO_PAGE)
 				{
@@ -22939,7 +22982,11 @@ bool NativeCodeBasicBlock::SimpleInlineCalls(void)
 						NativeCodeBasicBlock* sins = proc->mEntryBlock->mTrueJump;
 						mIns.Remove(i);
 						for (int j = 0; j < sins->mIns.Size(); j++)
+						{
 							mIns.Insert(i + j, sins->mIns[j]);
+							if (mIns[i + j].mLinkerObject && proc->mTableViews.Size() > 0)
+								mIns[i + j].mLinkerObject = mProc->TranslateTableView(proc, mIns[i + j].mLinkerObject);
+						}
 						changed = true;
 					}
 				}
@@ -30129,7 +30176,7 @@ bool NativeCodeBasicBlock::ShortcutIndirectLoadStore(void)
 }
 
 #if 0
-static int NativeCodeExpressionID;
+static thread_local int NativeCodeExpressionID;
 
 struct NativeCodeExpression
 {
@@ -67563,7 +67610,7 @@ bool NativeCodeBasicBlock::PeepHoleOptimizer(int pass)
 	return false;
 }
 
-void NativeCodeBasicBlock::AddToSuffixTree(NativeCodeMapper& mapper, SuffixTree * tree)
+void NativeCodeBasicBlock::AddToSuffixArray(NativeCodeMapper& mapper, SuffixArray* sarray)
 {
 	if (!mVisited)
 	{
@@ -67591,10 +67638,10 @@ void NativeCodeBasicBlock::AddToSuffixTree(NativeCodeMapper& mapper, SuffixTree
 		mSuffixString[mIns.Size() + 1] = -1;
 
 		if (!rel)
-			tree->AddString(mSuffixString);
+			sarray->AddString(this, mSuffixString);
 
-		if (mTrueJump) mTrueJump->AddToSuffixTree(mapper, tree);
-		if (mFalseJump) mFalseJump->AddToSuffixTree(mapper, tree);
+		if (mTrueJump) mTrueJump->AddToSuffixArray(mapper, sarray);
+		if (mFalseJump) mFalseJump->AddToSuffixArray(mapper, sarray);
 	}
 }
 
@@ -67776,6 +67823,8 @@ void NativeCodeBasicBlock::Assemble(void)
 			this->mTrueJump->Assemble();
 		if (this->mFalseJump)
 			this->mFalseJump->Assemble();
+		for (int i = 0; i < mJumpTable.Size(); i++)
+			mJumpTable[i]->Assemble();
 	}
 }
 
@@ -67823,6 +67872,8 @@ NativeCodeBasicBlock* NativeCodeBasicBlock::BypassEmptyBlocks(void)
 			mFalseJump = mFalseJump->BypassEmptyBlocks();
 		if (mTrueJump)
 			mTrueJump = mTrueJump->BypassEmptyBlocks();
+		for (int i = 0; i < mJumpTable.Size(); i++)
+			mJumpTable[i] = mJumpTable[i]->BypassEmptyBlocks();
 
 		return this;
 	}
@@ -68216,6 +68267,1073 @@ void NativeCodeBasicBlock::ShortcutTailRecursion()
 
 		if (mTrueJump) mTrueJump->ShortcutTailRecursion();
 		if (mFalseJump) mFalseJump->ShortcutTailRecursion();
+		for (int i = 0; i < mJumpTable.Size(); i++)
+			mJumpTable[i]->ShortcutTailRecursion();
+	}
+}
+
+static int JumpTableCompareReg(const NativeCodeInstruction& ins)
+{
+	if (ins.mMode == ASMIM_IMMEDIATE)
+	{
+		switch (ins.mType)
+		{
+		case ASMIT_CMP:
+			return 0;
+		case ASMIT_CPX:
+			return 1;
+		case ASMIT_CPY:
+			return 2;
+		}
+	}
+	return -1;
+}
+
+static bool JumpTableTransfer(const NativeCodeInstruction& ins, int& sreg, int& dreg)
+{
+	switch (ins.mType)
+	{
+	case ASMIT_TAX:
+		sreg = 0; dreg = 1;
+		return true;
+	case ASMIT_TAY:
+		sreg = 0; dreg = 2;
+		return true;
+	case ASMIT_TXA:
+		sreg = 1; dreg = 0;
+		return true;
+	case ASMIT_TYA:
+		sreg = 2; dreg = 0;
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsJumpTableTreeBlock(const NativeCodeBasicBlock* block, int start)
+{
+	if (!block->mFalseJump)
+		return false;
+
+	switch (block->mBranch)
+	{
+	case ASMIT_BEQ:
+	case ASMIT_BNE:
+	case ASMIT_BCC:
+	case ASMIT_BCS:
+	case ASMIT_BMI:
+	case ASMIT_BPL:
+		break;
+	default:
+		return false;
+	}
+
+	int	sreg, dreg;
+	for (int i = start; i < block->mIns.Size(); i++)
+	{
+		if (JumpTableCompareReg(block->mIns[i]) < 0 && !JumpTableTransfer(block->mIns[i], sreg, dreg))
+			return false;
+	}
+	return true;
+}
+
+// Generate the register moves and carry needed to enter a switch target from
+// the jump table dispatch, register contents are tagged with the register
+// that held the value at the start of the compare tree
+static bool BuildJumpTableFixup(ExpandingArray<NativeCodeInstruction>& fix, const InterInstruction* ins, const int* dtag, int dcarry, const int* rtag, int rcarry)
+{
+	static const AsmInsType	toindex[3] = { ASMIT_NOP, ASMIT_TAX, ASMIT_TAY };
+	static const AsmInsType	fromindex[3] = { ASMIT_NOP, ASMIT_TXA, ASMIT_TYA };
+
+	int	tag[3] = { dtag[0], dtag[1], dtag[2] };
+
+	for (int r = 1; r < 3; r++)
+	{
+		if (rtag[r] >= 0 && tag[r] != rtag[r])
+		{
+			if (tag[0] != rtag[r])
+				return false;
+			fix.Push(NativeCodeInstruction(ins, toindex[r]));
+			tag[r] = tag[0];
+		}
+	}
+
+	if (rtag[0] >= 0 && tag[0] != rtag[0])
+	{
+		if (tag[1] == rtag[0])
+			fix.Push(NativeCodeInstruction(ins, fromindex[1]));
+		else if (tag[2] == rtag[0])
+			fix.Push(NativeCodeInstruction(ins, fromindex[2]));
+		else
+			return false;
+	}
+
+	if (rcarry >= 0 && dcarry != rcarry)
+		fix.Push(NativeCodeInstruction(ins, rcarry ? ASMIT_SEC : ASMIT_CLC));
+
+	return true;
+}
+
+// The final jump encoding uses flags known at the block exit, which are no longer
+// valid below a switch target if the target does not need them itself
+static void ResetJumpTableFlags(NativeCodeBasicBlock* block, bool carry, bool zero, NumberSet& cblocks, NumberSet& zblocks)
+{
+	if (carry && cblocks[block->mIndex])
+		carry = false;
+	if (zero && zblocks[block->mIndex])
+		zero = false;
+
+	if (carry || zero)
+	{
+		if (carry)
+			cblocks += block->mIndex;
+		if (zero)
+			zblocks += block->mIndex;
+
+		for (int i = 0; i < block->mIns.Size(); i++)
+		{
+			if (block->mIns[i].ChangesCarry())
+				carry = false;
+			if (block->mIns[i].ChangesZFlag())
+				zero = false;
+		}
+
+		if (carry)
+			block->mNDataSet.Reset(CPU_REG_C);
+		if (zero)
+			block->mNDataSet.Reset(CPU_REG_Z);
+
+		if (carry || zero)
+		{
+			if (block->mTrueJump)
+				ResetJumpTableFlags(block->mTrueJump, carry, zero, cblocks, zblocks);
+			if (block->mFalseJump)
+				ResetJumpTableFlags(block->mFalseJump, carry, zero, cblocks, zblocks);
+			for (int i = 0; i < block->mJumpTable.Size(); i++)
+				ResetJumpTableFlags(block->mJumpTable[i], carry, zero, cblocks, zblocks);
+		}
+	}
+}
+
+bool NativeCodeBasicBlock::BuildJumpTable(GrowingArray<int>& entries, int numBlocks)
+{
+	if (!IsJumpTableTreeBlock(this, mIns.Size()))
+		return false;
+
+	int	start = mIns.Size();
+	while (start > 0 && IsJumpTableTreeBlock(this, start - 1))
+		start--;
+
+	// Find the register compared first, this is the switch value
+
+	int	tag[3] = { 0, 1, 2 };
+	int	sreg = -1;
+	for (int i = start; sreg < 0 && i < mIns.Size(); i++)
+	{
+		int	r = JumpTableCompareReg(mIns[i]), fr, tr;
+		if (r >= 0)
+			sreg = tag[r];
+		else if (JumpTableTransfer(mIns[i], fr, tr))
+			tag[tr] = tag[fr];
+	}
+
+	if (sreg < 0)
+		return false;
+
+	// Collect the single entry compare blocks below the root
+
+	NumberSet								inner(mProc->mTempBlocks), reached(mProc->mTempBlocks);
+	ExpandingArray<NativeCodeBasicBlock*>	tree;
+
+	tree.Push(this);
+	for (int i = 0; i < tree.Size(); i++)
+	{
+		NativeCodeBasicBlock* succ[2] = { tree[i]->mTrueJump, tree[i]->mFalseJump };
+		for (int j = 0; j < 2; j++)
+		{
+			NativeCodeBasicBlock* b = succ[j];
+			if (b != this && b->mIndex < numBlocks && !inner[b->mIndex] && entries[b->mIndex] == 1 && IsJumpTableTreeBlock(b, 0))
+			{
+				inner += b->mIndex;
+				tree.Push(b);
+			}
+		}
+	}
+
+	if (tree.Size() < 5)
+		return false;
+
+	// Evaluate the tree for every value of the switch register, blocks
+	// that cannot be resolved statically become leaves
+
+	ExpandingArray<NativeCodeBasicBlock*>	leaves;
+	int		leaf[256], ltag[256][3], lcarry[256], cycles[256];
+
+	bool	retry;
+	do
+	{
+		retry = false;
+		leaves.SetSize(0);
+		reached.Clear();
+
+		for (int v = 0; !retry && v < 256; v++)
+		{
+			NativeCodeBasicBlock* b = this;
+			int		i = start, carry = -1, zero = -1, neg = -1, cyc = 0;
+			int		rtag[3] = { 0, 1, 2 };
+
+			for (;;)
+			{
+				bool	known = true;
+				for (; known && i < b->mIns.Size(); i++)
+				{
+					int	r = JumpTableCompareReg(b->mIns[i]), fr, tr;
+					if (r >= 0)
+					{
+						if (rtag[r] != sreg)
+							known = false;
+						else
+						{
+							carry = v >= b->mIns[i].mAddress;
+							zero = v == b->mIns[i].mAddress;
+							neg = ((v - b->mIns[i].mAddress) & 0x80) != 0;
+						}
+					}
+					else
+					{
+						JumpTableTransfer(b->mIns[i], fr, tr);
+						rtag[tr] = rtag[fr];
+						zero = rtag[tr] == sreg ? v == 0 : -1;
+						neg = rtag[tr] == sreg ? (v & 0x80) != 0 : -1;
+					}
+					cyc += 2;
+				}
+
+				bool	taken = false;
+				if (known)
+				{
+					switch (b->mBranch)
+					{
+					case ASMIT_BEQ:
+						known = zero >= 0;
+						taken = zero == 1;
+						break;
+					case ASMIT_BNE:
+						known = zero >= 0;
+						taken = zero == 0;
+						break;
+					case ASMIT_BCS:
+						known = carry >= 0;
+						taken = carry == 1;
+						break;
+					case ASMIT_BCC:
+						known = carry >= 0;
+						taken = carry == 0;
+						break;
+					case ASMIT_BMI:
+						known = neg >= 0;
+						taken = neg == 1;
+						break;
+					case ASMIT_BPL:
+						known = neg >= 0;
+						taken = neg == 0;
+						break;
+					}
+				}
+
+				if (!known)
+				{
+					if (b == this)
+						return false;
+					inner -= b->mIndex;
+					retry = true;
+					break;
+				}
+
+				cyc += taken ? 3 : 2;
+
+				NativeCodeBasicBlock* next = taken ? b->mTrueJump : b->mFalseJump;
+				if (next != this && inner[next->mIndex])
+				{
+					reached += next->mIndex;
+					b = next;
+					i = 0;
+				}
+				else
+				{
+					for (int k = 0; k < 8 && next->mIns.Size() == 0 && !next->mFalseJump && next->mTrueJump; k++)
+						next = next->mTrueJump;
+
+					int	li = leaves.IndexOf(next);
+					if (li < 0)
+					{
+						li = leaves.Size();
+						leaves.Push(next);
+					}
+					leaf[v] = li;
+					for (int r = 0; r < 3; r++)
+						ltag[v][r] = rtag[r];
+					lcarry[v] = carry;
+					cycles[v] = cyc;
+					break;
+				}
+			}
+		}
+	} while (retry);
+
+	if (leaves.Size() < 4)
+		return false;
+
+	int	nodes = 0, treeBytes = 0;
+	for (int i = 0; i < tree.Size(); i++)
+	{
+		NativeCodeBasicBlock* b = tree[i];
+		if (b == this || reached[b->mIndex])
+		{
+			nodes++;
+			treeBytes += 2;
+			for (int j = b == this ? start : 0; j < b->mIns.Size(); j++)
+				treeBytes += b->mIns[j].mMode == ASMIM_IMMEDIATE ? 2 : 1;
+		}
+	}
+
+	// The default target is the one that leaves the smallest dense range
+
+	int	dleaf = -1, a = 0, b = 255;
+	for (int li = 0; li < leaves.Size(); li++)
+	{
+		int	la = 0, lb = 255;
+		while (la < 256 && leaf[la] == li)
+			la++;
+		while (lb >= 0 && leaf[lb] == li)
+			lb--;
+		if (la <= lb && (dleaf < 0 || lb - la < b - a))
+		{
+			dleaf = li;
+			a = la;
+			b = lb;
+		}
+	}
+
+	if (dleaf < 0 || b - a + 1 > 4 * nodes)
+		return false;
+
+	// A short gap below the first case is cheaper in the table than in a compare
+
+	if (!(mProc->mCompilerOptions & COPT_OPTIMIZE_CODE_SIZE) && 2 * a <= b - a + 1)
+		a = 0;
+
+	int	size = b - a + 1;
+
+	// Check what the targets expect from the compare tree
+
+	GrowingArray<int>	reqtag(-2), reqcarry(-2), edges(0);
+
+	for (int v = 0; v < 256; v++)
+	{
+		int		li = leaf[v];
+		NativeCodeBasicBlock* lb = leaves[li];
+
+		if (lb->mIndex >= numBlocks || entries[lb->mIndex] <= 0)
+			return false;
+		if (lb->mEntryRequiredRegs[CPU_REG_Z] || lb->mEntryRequiredRegs[BC_REG_ADDR] || lb->mEntryRequiredRegs[BC_REG_ADDR + 1])
+			return false;
+
+		for (int r = 0; r < 3; r++)
+		{
+			int	t = lb->mEntryRequiredRegs[CPU_REG_A + r] ? ltag[v][r] : -1;
+			if (reqtag[3 * li + r] == -2)
+				reqtag[3 * li + r] = t;
+			else if (reqtag[3 * li + r] != t)
+				return false;
+		}
+
+		int	c = lb->mEntryRequiredRegs[CPU_REG_C] ? lcarry[v] : -1;
+		if (lb->mEntryRequiredRegs[CPU_REG_C] && c < 0)
+			return false;
+		if (reqcarry[li] == -2)
+			reqcarry[li] = c;
+		else if (reqcarry[li] != c)
+			return false;
+	}
+
+	// Targets only entered from the tree can take the fixup code directly
+
+	for (int i = 0; i < tree.Size(); i++)
+	{
+		NativeCodeBasicBlock* tb = tree[i];
+		if (tb == this || reached[tb->mIndex])
+		{
+			NativeCodeBasicBlock* succ[2] = { tb->mTrueJump, tb->mFalseJump };
+			for (int j = 0; j < 2; j++)
+			{
+				int	li = leaves.IndexOf(succ[j]);
+				if (li >= 0)
+					edges[li]++;
+			}
+		}
+	}
+
+	// Select the index register, the switch value stays in it
+
+	int	ireg = sreg, jreg;
+	ExpandingArray<NativeCodeInstruction>	fix[256], lfix, hfix;
+	int		dtag[3], rtag[3];
+	int		dcarry = b < 255 ? 0 : (a > 0 ? 1 : -1);
+
+	for (;;)
+	{
+		if (sreg == 0)
+		{
+			if (ireg == 0)
+				ireg = 1;
+			else if (ireg == 1)
+				ireg = 2;
+			else
+				return false;
+		}
+		jreg = 3 - ireg;
+
+		dtag[0] = -1; dtag[ireg] = sreg; dtag[jreg] = jreg;
+
+		int	li = 0;
+		while (li < leaves.Size())
+		{
+			fix[li].SetSize(0);
+			if (!BuildJumpTableFixup(fix[li], mBranchIns, dtag, dcarry, &reqtag[3 * li], reqcarry[li]))
+				break;
+			li++;
+		}
+
+		if (li == leaves.Size())
+			break;
+		else if (sreg != 0)
+			return false;
+	}
+
+	rtag[0] = 0; rtag[ireg] = sreg; rtag[jreg] = jreg;
+
+	if (a > 0 && !BuildJumpTableFixup(lfix, mBranchIns, rtag, 0, &reqtag[3 * dleaf], reqcarry[dleaf]))
+		return false;
+	if (b < 255 && !BuildJumpTableFixup(hfix, mBranchIns, rtag, 1, &reqtag[3 * dleaf], reqcarry[dleaf]))
+		return false;
+
+	bool	exclusive[256];
+	for (int li = 0; li < leaves.Size(); li++)
+	{
+		NativeCodeBasicBlock* lb = leaves[li];
+		exclusive[li] = lb != this && edges[li] == entries[lb->mIndex];
+	}
+
+	if (exclusive[dleaf])
+	{
+		const ExpandingArray<NativeCodeInstruction>& dfix(fix[dleaf]);
+		for (int k = 0; k < 2; k++)
+		{
+			const ExpandingArray<NativeCodeInstruction>& rfix(k == 0 ? lfix : hfix);
+			if (k == 0 ? a > 0 : b < 255)
+			{
+				if (rfix.Size() != dfix.Size())
+					exclusive[dleaf] = false;
+				else
+				{
+					for (int i = 0; i < rfix.Size(); i++)
+						if (rfix[i].mType != dfix[i].mType)
+							exclusive[dleaf] = false;
+				}
+			}
+		}
+	}
+
+	// Compare the average cycles of the tree and the dispatch over the table range
+
+	int	dispatch = 19 + (sreg == 0 ? 2 : 0) + (a > 0 ? 4 : 0) + (b < 255 ? 4 : 0);
+
+	int	treeCycles = 0, tableCycles = 0;
+	for (int v = a; v <= b; v++)
+	{
+		int	li = leaf[v];
+		treeCycles += cycles[v];
+		tableCycles += dispatch + 2 * fix[li].Size();
+		if (fix[li].Size() > 0 && !exclusive[li])
+			tableCycles += 3;
+	}
+
+	if (tableCycles + size >= treeCycles)
+		return false;
+
+	if ((mProc->mCompilerOptions & COPT_OPTIMIZE_CODE_SIZE) && 2 * size + 22 > treeBytes)
+		return false;
+
+	// Build the range checks and the dispatch
+
+	for (int i = 1; i < tree.Size(); i++)
+		if (reached[tree[i]->mIndex])
+			entries[tree[i]->mIndex] = -1;
+	entries[mIndex] = -1;
+
+	const InterInstruction* iins = mBranchIns;
+
+	ExpandingArray<NativeCodeBasicBlock*>	targets;
+	for (int li = 0; li < leaves.Size(); li++)
+	{
+		NativeCodeBasicBlock* lb = leaves[li];
+		if (fix[li].Size() == 0)
+			targets.Push(lb);
+		else if (exclusive[li])
+		{
+			for (int i = 0; i < fix[li].Size(); i++)
+				lb->mIns.Insert(i, fix[li][i]);
+			entries[lb->mIndex] = -1;
+			targets.Push(lb);
+		}
+		else
+		{
+			NativeCodeBasicBlock* target = mProc->AllocateBlock();
+			target->mIns = fix[li];
+			target->Close(iins, lb, nullptr, ASMIT_JMP);
+			target->mNumEntries = 1;
+			targets.Push(target);
+		}
+	}
+
+	mIns.SetSize(start);
+	if (sreg == 0)
+		mIns.Push(NativeCodeInstruction(iins, ireg == 1 ? ASMIT_TAX : ASMIT_TAY));
+
+	AsmInsType	cmp = ireg == 1 ? ASMIT_CPX : ASMIT_CPY;
+	AsmInsMode	mode = ireg == 1 ? ASMIM_ABSOLUTE_X : ASMIM_ABSOLUTE_Y;
+
+	NativeCodeBasicBlock* block = this;
+	for (int k = 0; k < 2; k++)
+	{
+		const ExpandingArray<NativeCodeInstruction>& rfix(k == 0 ? lfix : hfix);
+
+		if (k == 0 ? a > 0 : b < 255)
+		{
+			NativeCodeBasicBlock* target = leaves[dleaf];
+			if (exclusive[dleaf])
+				target = targets[dleaf];
+			else if (rfix.Size() > 0)
+			{
+				target = mProc->AllocateBlock();
+				target->mIns = rfix;
+				target->Close(iins, leaves[dleaf], nullptr, ASMIT_JMP);
+				target->mNumEntries = 1;
+			}
+
+			NativeCodeBasicBlock* nblock = mProc->AllocateBlock();
+			block->mIns.Push(NativeCodeInstruction(iins, cmp, ASMIM_IMMEDIATE, k == 0 ? a : b + 1));
+			block->Close(iins, target, nblock, k == 0 ? ASMIT_BCC : ASMIT_BCS);
+			nblock->mNumEntries = 1;
+			block = nblock;
+		}
+	}
+
+	NativeCodeProcedure::JumpTable	jt;
+
+	char	name[100];
+	sprintf_s(name, "__jumptab%dL", mProc->mJumpTables.Size());
+	jt.mLinkerLSB = mProc->mGenerator->mLinker->AddObject(mProc->mLocation, Ident::Unique(name), mProc->mLinkerObject->mSection, LOT_DATA);
+	sprintf_s(name, "__jumptab%dH", mProc->mJumpTables.Size());
+	jt.mLinkerMSB = mProc->mGenerator->mLinker->AddObject(mProc->mLocation, Ident::Unique(name), mProc->mLinkerObject->mSection, LOT_DATA);
+	jt.mLinkerLSB->mFlags |= LOBJF_CONST;
+	jt.mLinkerMSB->mFlags |= LOBJF_CONST;
+	jt.mLinkerLSB->AddSpace(size);
+	jt.mLinkerMSB->AddSpace(size);
+	jt.mBlock = block;
+	mProc->mJumpTables.Push(jt);
+
+	block->mIns.Push(NativeCodeInstruction(iins, ASMIT_LDA, mode, -a, jt.mLinkerLSB));
+	block->mIns.Push(NativeCodeInstruction(iins, ASMIT_STA, ASMIM_ZERO_PAGE, BC_REG_ADDR));
+	block->mIns.Push(NativeCodeInstruction(iins, ASMIT_LDA, mode, -a, jt.mLinkerMSB));
+	block->mIns.Push(NativeCodeInstruction(iins, ASMIT_STA, ASMIM_ZERO_PAGE, BC_REG_ADDR + 1));
+	block->mIns.Push(NativeCodeInstruction(iins, ASMIT_JMP, ASMIM_INDIRECT, BC_REG_ADDR));
+	block->Close(iins, nullptr, nullptr, ASMIT_RTS);
+
+	for (int v = a; v <= b; v++)
+		block->mJumpTable.Push(targets[leaf[v]]);
+
+	NumberSet	cblocks(mProc->mTempBlocks), zblocks(mProc->mTempBlocks);
+	for (int li = 0; li < leaves.Size(); li++)
+		ResetJumpTableFlags(leaves[li], reqcarry[li] < 0, true, cblocks, zblocks);
+
+	return true;
+}
+
+// CPU registers used and changed by an instruction, for the late 65C02
+// and 45GS02 passes that run on the final instruction sequence
+
+static void CPURegUseDef(const NativeCodeInstruction& ins, uint32& use, uint32& def)
+{
+	use = 0;
+	def = 0;
+
+	switch (ins.mType)
+	{
+	case ASMIT_JMP:
+	case ASMIT_RTI:
+	case ASMIT_BRK:
+	case ASMIT_BYTE:
+	case ASMIT_INV:
+		use = LIVE_CPU_REG;
+		return;
+	case ASMIT_RTS:
+		use = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y;
+		return;
+	case ASMIT_PHA:
+		use = LIVE_CPU_REG_A;
+		return;
+	case ASMIT_PHX:
+		use = LIVE_CPU_REG_X;
+		return;
+	case ASMIT_PHY:
+		use = LIVE_CPU_REG_Y;
+		return;
+	case ASMIT_PHP:
+		use = LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_PLA:
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_PLX:
+	case ASMIT_TSX:
+		def = LIVE_CPU_REG_X | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_PLY:
+		def = LIVE_CPU_REG_Y | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_PLP:
+		def = LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_TXS:
+		use = LIVE_CPU_REG_X;
+		return;
+	case ASMIT_BIT:
+	case ASMIT_TSB:
+	case ASMIT_TRB:
+		use = LIVE_CPU_REG_A;
+		def = LIVE_CPU_REG_Z;
+		if (ins.RequiresXReg())
+			use |= LIVE_CPU_REG_X;
+		return;
+	case ASMIT_PHZ:
+		return;
+	case ASMIT_PLZ:
+	case ASMIT_LDZ:
+	case ASMIT_INZ:
+	case ASMIT_DEZ:
+	case ASMIT_INW:
+	case ASMIT_DEW:
+		def = LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_CPZ:
+	case ASMIT_ASW:
+		def = LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_ROW:
+		use = LIVE_CPU_REG_C;
+		def = LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_TAZ:
+		use = LIVE_CPU_REG_A;
+		def = LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_TZA:
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_NEG:
+		use = LIVE_CPU_REG_A;
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_ASR:
+		def = LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		if (ins.mMode == ASMIM_IMPLIED)
+		{
+			use = LIVE_CPU_REG_A;
+			def |= LIVE_CPU_REG_A;
+		}
+		else if (ins.mMode == ASMIM_ZERO_PAGE_X)
+			use = LIVE_CPU_REG_X;
+		return;
+	case ASMIT_LDQ:
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_STQ:
+		use = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y;
+		return;
+	case ASMIT_ADCQ:
+	case ASMIT_SBCQ:
+		use = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y | LIVE_CPU_REG_C;
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y | LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_ANDQ:
+	case ASMIT_ORAQ:
+	case ASMIT_EORQ:
+		use = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y;
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_CMPQ:
+		use = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y;
+		def = LIVE_CPU_REG_C | LIVE_CPU_REG_Z;
+		return;
+	case ASMIT_ASLQ:
+	case ASMIT_LSRQ:
+	case ASMIT_ROLQ:
+	case ASMIT_RORQ:
+	case ASMIT_INQ:
+	case ASMIT_DEQ:
+		def = LIVE_CPU_REG_Z;
+		if (ins.mType != ASMIT_INQ && ins.mType != ASMIT_DEQ)
+			def |= LIVE_CPU_REG_C;
+		if (ins.mType == ASMIT_ROLQ || ins.mType == ASMIT_RORQ)
+			use |= LIVE_CPU_REG_C;
+		if (ins.mMode == ASMIM_IMPLIED)
+		{
+			use |= LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y;
+			def |= LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y;
+		}
+		return;
+	}
+
+	if (ins.mMode == ASMIM_RELATIVE)
+	{
+		use = LIVE_CPU_REG;
+		return;
+	}
+
+	if ((ins.mType == ASMIT_INC || ins.mType == ASMIT_DEC) && ins.mMode == ASMIM_IMPLIED)
+	{
+		use = LIVE_CPU_REG_A;
+		def = LIVE_CPU_REG_A | LIVE_CPU_REG_Z;
+		return;
+	}
+
+	if (ins.RequiresAccu())
+		use |= LIVE_CPU_REG_A;
+	if (ins.RequiresXReg())
+		use |= LIVE_CPU_REG_X;
+	if (ins.RequiresYReg())
+		use |= LIVE_CPU_REG_Y;
+	if (ins.RequiresCarry())
+		use |= LIVE_CPU_REG_C;
+
+	if (ins.ChangesAccu())
+		def |= LIVE_CPU_REG_A;
+	if (ins.ChangesXReg())
+		def |= LIVE_CPU_REG_X;
+	if (ins.ChangesYReg())
+		def |= LIVE_CPU_REG_Y;
+	if (ins.ChangesCarry())
+		def |= LIVE_CPU_REG_C;
+	if (ins.ChangesZFlag())
+		def |= LIVE_CPU_REG_Z;
+}
+
+uint32 NativeCodeBasicBlock::CPURegExitLive(const GrowingArray<uint32>& entryLive) const
+{
+	uint32	live = 0;
+
+	if (mTrueJump)
+		live |= entryLive[mTrueJump->mIndex];
+	if (mFalseJump)
+		live |= entryLive[mFalseJump->mIndex];
+	for (int i = 0; i < mJumpTable.Size(); i++)
+		live |= entryLive[mJumpTable[i]->mIndex];
+
+	switch (mBranch)
+	{
+	case ASMIT_BCC:
+	case ASMIT_BCS:
+		live |= LIVE_CPU_REG_C;
+		break;
+	case ASMIT_BEQ:
+	case ASMIT_BNE:
+	case ASMIT_BMI:
+	case ASMIT_BPL:
+	case ASMIT_BVC:
+	case ASMIT_BVS:
+		live |= LIVE_CPU_REG_Z;
+		break;
+	}
+
+	return live;
+}
+
+uint32 NativeCodeBasicBlock::CPURegEntryLive(uint32 exitLive) const
+{
+	uint32	live = exitLive;
+
+	for (int i = mIns.Size() - 1; i >= 0; i--)
+	{
+		uint32	use, def;
+		CPURegUseDef(mIns[i], use, def);
+		live = (live & ~def) | use;
+	}
+
+	return live;
+}
+
+void NativeCodeBasicBlock::Optimize65C02(uint32 exitLive, bool overflow)
+{
+	// Branches inside the block may skip parts of a sequence
+
+	for (int i = 0; i < mIns.Size(); i++)
+		if (mIns[i].mMode == ASMIM_RELATIVE)
+			return;
+
+	ExpandingArray<uint32>	live;
+	live.SetSize(mIns.Size());
+
+	uint32	l = exitLive;
+	for (int i = mIns.Size() - 1; i >= 0; i--)
+	{
+		live[i] = l;
+		uint32	use, def;
+		CPURegUseDef(mIns[i], use, def);
+		l = (l & ~def) | use;
+	}
+
+	// Patterns that depend on the registers live after the sequence, removing
+	// instructions from the end keeps the liveness of the earlier ones valid
+
+	for (int i = mIns.Size() - 2; i >= 0; i--)
+	{
+		NativeCodeInstruction& ins0(mIns[i + 0]);
+		NativeCodeInstruction& ins1(mIns[i + 1]);
+
+		if (!overflow && ins1.mMode == ASMIM_IMMEDIATE && !(live[i + 1] & LIVE_CPU_REG_C) &&
+			(ins0.mType == ASMIT_CLC && ins1.mType == ASMIT_ADC || ins0.mType == ASMIT_SEC && ins1.mType == ASMIT_SBC))
+		{
+			int	d = ins1.mType == ASMIT_ADC ? ins1.mAddress : -ins1.mAddress;
+			if (d == 1 || d == -255)
+			{
+				ins1 = NativeCodeInstruction(ins1.mIns, ASMIT_INC, ASMIM_IMPLIED);
+				mIns.Remove(i);
+				live.Remove(i);
+			}
+			else if (d == -1 || d == 255)
+			{
+				ins1 = NativeCodeInstruction(ins1.mIns, ASMIT_DEC, ASMIM_IMPLIED);
+				mIns.Remove(i);
+				live.Remove(i);
+			}
+		}
+		else if (ins1.mType == ASMIT_PHA && !(live[i + 1] & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z)) && (ins0.mType == ASMIT_TXA || ins0.mType == ASMIT_TYA))
+		{
+			ins1.mType = ins0.mType == ASMIT_TXA ? ASMIT_PHX : ASMIT_PHY;
+			mIns.Remove(i);
+			live.Remove(i);
+		}
+		else if (ins0.mType == ASMIT_PLA && !(live[i + 1] & LIVE_CPU_REG_A) && (ins1.mType == ASMIT_TAX || ins1.mType == ASMIT_TAY))
+		{
+			ins1.mType = ins1.mType == ASMIT_TAX ? ASMIT_PLX : ASMIT_PLY;
+			mIns.Remove(i);
+			live.Remove(i);
+		}
+		else if (i + 2 < mIns.Size() &&
+			ins0.mType == ASMIT_LDA && (ins0.mMode == ASMIM_ZERO_PAGE || ins0.mMode == ASMIM_ABSOLUTE) && !(ins0.mFlags & NCIF_VOLATILE) &&
+			(ins1.mType == ASMIT_ORA || ins1.mType == ASMIT_AND) && ins1.mMode == ASMIM_IMMEDIATE &&
+			mIns[i + 2].mType == ASMIT_STA && mIns[i + 2].SameEffectiveAddress(ins0) && !(mIns[i + 2].mFlags & NCIF_VOLATILE) &&
+			!(live[i + 2] & (LIVE_CPU_REG_A | LIVE_CPU_REG_Z)))
+		{
+			mIns[i + 2].mType = ins1.mType == ASMIT_ORA ? ASMIT_TSB : ASMIT_TRB;
+			ins0 = NativeCodeInstruction(ins1.mIns, ASMIT_LDA, ASMIM_IMMEDIATE, ins1.mType == ASMIT_ORA ? ins1.mAddress : ~ins1.mAddress & 0xff);
+			mIns.Remove(i + 1);
+			live.Remove(i + 1);
+		}
+	}
+
+	// Stores of a register known to be zero and indirect accesses with
+	// a zero index
+
+	bool	azero = false, xzero = false, yzero = false;
+	for (int i = 0; i < mIns.Size(); i++)
+	{
+		NativeCodeInstruction& ins(mIns[i]);
+
+		if (ins.mType == ASMIT_STA && azero || ins.mType == ASMIT_STX && xzero || ins.mType == ASMIT_STY && yzero)
+		{
+			if (HasAsmInstructionMode(ASMIT_STZ, ins.mMode, ASMCPU_65C02))
+				ins.mType = ASMIT_STZ;
+		}
+		else if (ins.mMode == ASMIM_INDIRECT_Y && yzero && HasAsmInstructionMode(ins.mType, ASMIM_INDIRECT_ZERO_PAGE, ASMCPU_65C02))
+			ins.mMode = ASMIM_INDIRECT_ZERO_PAGE;
+
+		uint32	use, def;
+		CPURegUseDef(ins, use, def);
+		if (def & LIVE_CPU_REG_A)
+			azero = ins.mType == ASMIT_LDA && ins.mMode == ASMIM_IMMEDIATE && ins.mAddress == 0;
+		if (def & LIVE_CPU_REG_X)
+			xzero = ins.mType == ASMIT_LDX && ins.mMode == ASMIM_IMMEDIATE && ins.mAddress == 0;
+		if (def & LIVE_CPU_REG_Y)
+			yzero = ins.mType == ASMIT_LDY && ins.mMode == ASMIM_IMMEDIATE && ins.mAddress == 0;
+	}
+
+	// Remove the immediate loads that are no longer used
+
+	l = exitLive;
+	for (int i = mIns.Size() - 1; i >= 0; i--)
+	{
+		const NativeCodeInstruction& ins(mIns[i]);
+
+		uint32	reg = 0;
+		if (ins.mMode == ASMIM_IMMEDIATE)
+		{
+			if (ins.mType == ASMIT_LDA)
+				reg = LIVE_CPU_REG_A;
+			else if (ins.mType == ASMIT_LDX)
+				reg = LIVE_CPU_REG_X;
+			else if (ins.mType == ASMIT_LDY)
+				reg = LIVE_CPU_REG_Y;
+		}
+
+		if (reg && !(l & (reg | LIVE_CPU_REG_Z)))
+			mIns.Remove(i);
+		else
+		{
+			uint32	use, def;
+			CPURegUseDef(ins, use, def);
+			l = (l & ~def) | use;
+		}
+	}
+}
+
+// Four consecutive bytes of memory that can be accessed by a quad
+// instruction of the 45GS02
+
+static bool IsQuadOperand(const NativeCodeInstruction& ins, const NativeCodeInstruction& base, int offset)
+{
+	return
+		(base.mMode == ASMIM_ZERO_PAGE || base.mMode == ASMIM_ABSOLUTE) && ins.mMode == base.mMode &&
+		ins.mLinkerObject == base.mLinkerObject && ins.mAddress == base.mAddress + offset &&
+		!(ins.mFlags & NCIF_VOLATILE);
+}
+
+// A quad store that partially overlaps a quad operand it replaces would
+// see bytes of the result that the byte sequence had not yet written
+
+static bool QuadOperandsOverlap(const NativeCodeInstruction& ins0, const NativeCodeInstruction& ins1)
+{
+	if (ins0.mLinkerObject == ins1.mLinkerObject)
+		return ins0.mAddress != ins1.mAddress && ins0.mAddress < ins1.mAddress + 4 && ins1.mAddress < ins0.mAddress + 4;
+	else
+		return !ins0.mLinkerObject || !ins1.mLinkerObject;
+}
+
+void NativeCodeBasicBlock::Optimize45GS02(uint32 exitLive)
+{
+	for (int i = 0; i < mIns.Size(); i++)
+		if (mIns[i].mMode == ASMIM_RELATIVE)
+			return;
+
+	ExpandingArray<uint32>	live;
+	live.SetSize(mIns.Size());
+
+	uint32	l = exitLive;
+	for (int i = mIns.Size() - 1; i >= 0; i--)
+	{
+		live[i] = l;
+		uint32	use, def;
+		CPURegUseDef(mIns[i], use, def);
+		l = (l & ~def) | use;
+	}
+
+	// Replacing a sequence from the end keeps the liveness of the
+	// instructions before it valid
+
+	const uint32	qregs = LIVE_CPU_REG_A | LIVE_CPU_REG_X | LIVE_CPU_REG_Y | LIVE_CPU_REG_Z;
+
+	for (int i = mIns.Size() - 4; i >= 0; i--)
+	{
+		ExpandingArray<NativeCodeInstruction>	qins;
+		int		n = 0;
+
+		// 32 bit shifts of memory, the quad shift sets the flags for all
+		// four bytes
+
+		if (!(live[i + 3] & LIVE_CPU_REG_Z) &&
+			(mIns[i].mType == ASMIT_ASL || mIns[i].mType == ASMIT_ROL) &&
+			mIns[i + 1].mType == ASMIT_ROL && mIns[i + 2].mType == ASMIT_ROL && mIns[i + 3].mType == ASMIT_ROL &&
+			IsQuadOperand(mIns[i], mIns[i], 0) && IsQuadOperand(mIns[i + 1], mIns[i], 1) && IsQuadOperand(mIns[i + 2], mIns[i], 2) && IsQuadOperand(mIns[i + 3], mIns[i], 3))
+		{
+			n = 4;
+			qins.Push(NativeCodeInstruction(mIns[i].mIns, mIns[i].mType == ASMIT_ASL ? ASMIT_ASLQ : ASMIT_ROLQ, mIns[i]));
+		}
+		else if (!(live[i + 3] & LIVE_CPU_REG_Z) &&
+			(mIns[i].mType == ASMIT_LSR || mIns[i].mType == ASMIT_ROR) &&
+			mIns[i + 1].mType == ASMIT_ROR && mIns[i + 2].mType == ASMIT_ROR && mIns[i + 3].mType == ASMIT_ROR &&
+			IsQuadOperand(mIns[i], mIns[i + 3], 3) && IsQuadOperand(mIns[i + 1], mIns[i + 3], 2) && IsQuadOperand(mIns[i + 2], mIns[i + 3], 1) && IsQuadOperand(mIns[i + 3], mIns[i + 3], 0))
+		{
+			n = 4;
+			qins.Push(NativeCodeInstruction(mIns[i].mIns, mIns[i].mType == ASMIT_LSR ? ASMIT_LSRQ : ASMIT_RORQ, mIns[i + 3]));
+		}
+		else if (mIns[i].mType == ASMIT_LDA && IsQuadOperand(mIns[i], mIns[i], 0))
+		{
+			// 32 bit copy and add or subtract through the Q register, the Z
+			// register is cleared again after the sequence
+
+			int		j = i + 1;
+			bool	carry = false;
+			if (j < mIns.Size() && (mIns[j].mType == ASMIT_CLC || mIns[j].mType == ASMIT_SEC))
+			{
+				carry = true;
+				j++;
+			}
+
+			if (j + 6 < mIns.Size() && mIns[j].mType == ASMIT_STA && !carry)
+			{
+				int	k = 0;
+				while (k < 4 && 
+					mIns[i + 2 * k].mType == ASMIT_LDA && IsQuadOperand(mIns[i + 2 * k], mIns[i], k) &&
+					mIns[i + 2 * k + 1].mType == ASMIT_STA && IsQuadOperand(mIns[i + 2 * k + 1], mIns[i + 1], k))
+					k++;
+
+				if (k == 4 && !(live[i + 7] & qregs) && !QuadOperandsOverlap(mIns[i], mIns[i + 1]))
+				{
+					n = 8;
+					qins.Push(NativeCodeInstruction(mIns[i].mIns, ASMIT_LDQ, mIns[i]));
+					qins.Push(NativeCodeInstruction(mIns[i + 1].mIns, ASMIT_STQ, mIns[i + 1]));
+				}
+			}
+			else if (j + 10 < mIns.Size() && (mIns[j].mType == ASMIT_ADC || mIns[j].mType == ASMIT_SBC) && mIns[j + 1].mType == ASMIT_STA)
+			{
+				AsmInsType	op = mIns[j].mType;
+				const NativeCodeInstruction& ains(mIns[i]), & bins(mIns[j]), & cins(mIns[j + 1]);
+
+				int	k = 0;
+				while (k < 4 &&
+					(k == 0 || mIns[j + 3 * k - 1].mType == ASMIT_LDA && IsQuadOperand(mIns[j + 3 * k - 1], ains, k)) &&
+					mIns[j + 3 * k].mType == op && IsQuadOperand(mIns[j + 3 * k], bins, k) &&
+					mIns[j + 3 * k + 1].mType == ASMIT_STA && IsQuadOperand(mIns[j + 3 * k + 1], cins, k))
+					k++;
+
+				if (k == 4 && !(live[j + 10] & qregs) && !QuadOperandsOverlap(ains, cins) && !QuadOperandsOverlap(bins, cins))
+				{
+					n = j + 11 - i;
+					qins.Push(NativeCodeInstruction(ains.mIns, ASMIT_LDQ, ains));
+					if (carry)
+						qins.Push(mIns[i + 1]);
+					qins.Push(NativeCodeInstruction(bins.mIns, op == ASMIT_ADC ? ASMIT_ADCQ : ASMIT_SBCQ, bins));
+					qins.Push(NativeCodeInstruction(cins.mIns, ASMIT_STQ, cins));
+				}
+			}
+
+			if (n)
+				qins.Push(NativeCodeInstruction(mIns[i + n - 1].mIns, ASMIT_LDZ, ASMIM_IMMEDIATE, 0));
+		}
+
+		if (n)
+		{
+			uint32	l = live[i + n - 1];
+			mIns.Remove(i, n);
+			live.Remove(i, n);
+			for (int k = 0; k < qins.Size(); k++)
+			{
+				mIns.Insert(i + k, qins[k]);
+				live.Insert(i + k, l);
+			}
+		}
 	}
 }
 
@@ -68383,6 +69501,8 @@ NativeCodeBasicBlock::NativeCodeBasicBlock(NativeCodeProcedure* proc)
 	mBranch = ASMIT_RTS;
 	mBranchIns = nullptr;
 	mTrueJump = mFalseJump = NULL;
+	mFromJump = nullptr;
+	mSameBlock = nullptr;
 	mOffset = -1;
 	mPlaced = false;
 	mCopied = false;
@@ -68411,7 +69531,8 @@ NativeCodeBasicBlock::~NativeCodeBasicBlock(void)
 }
 
 NativeCodeProcedure::NativeCodeProcedure(NativeCodeGenerator* generator)
-	: mGenerator(generator), mSimpleInline(false)
+	: mGenerator(generator), mSimpleInline(false), mTaskIndex(-1), mTableViewsPopulated(false),
+	mEntryBlock(nullptr), mExitBlock(nullptr), tblocks(nullptr), mInterProc(nullptr), mLinkerObject(nullptr), mPassTimer(nullptr)
 {
 	mTempBlocks = 1000;
 }
@@ -68421,6 +69542,18 @@ NativeCodeProcedure::~NativeCodeProcedure(void)
 
 }
 
+int NativeCodeProcedure::NumInstructions(void) const
+{
+	int	num = 0;
+	for (int i = 0; i < mBlocks.Size(); i++)
+	{
+		const NativeCodeBasicBlock* block = mBlocks[i];
+		if (block == mEntryBlock || block->mNumEntries > 0)
+			num += block->mIns.Size();
+	}
+	return num;
+}
+
 void NativeCodeProcedure::DisassembleDebug(const char* name)
 {
 #if DISASSEMBLE_OPT
@@ -68465,10 +69598,10 @@ void NativeCodeProcedure::Disassemble(FILE* file)
 	mEntryBlock->Disassemble(file);
 }
 
-void NativeCodeProcedure::AddToSuffixTree(NativeCodeMapper& mapper, SuffixTree* tree)
+void NativeCodeProcedure::AddToSuffixArray(NativeCodeMapper& mapper, SuffixArray* sarray)
 {
 	ResetVisited();
-	mEntryBlock->AddToSuffixTree(mapper, tree);
+	mEntryBlock->AddToSuffixArray(mapper, sarray);
 }
 
 void NativeCodeProcedure::CompressTemporaries(bool singles)
@@ -68667,6 +69800,8 @@ void NativeCodeProcedure::LoadTempsFromStack(int tempSave)
 
 void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 {
+	MemoryArenaScope	scope(&mArena);
+
 	mInterProc = proc;
 	mLinkerObject = proc->mLinkerObject;
 	mIdent = proc->mIdent;
@@ -68675,6 +69810,9 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 		
 	mInterProc->mLinkerObject->mNativeProc = this;
 
+	if (mGenerator->mTimeReport)
+		mPassTimer = mGenerator->mTimeReport->Start("native", mIdent, 0);
+
 	CheckFunc = !strcmp(mIdent->mString, "setspr");
 
 	int	nblocks = proc->mBlocks.Size();
@@ -68799,7 +69937,13 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 #endif
 	}
 
-	mGenerator->PopulateShortMulTables();
+	if (mGenerator->mThreadPool)
+		PopulateTableViews();
+	else
+		mGenerator->PopulateShortMulTables();
+
+	if (mPassTimer)
+		mPassTimer->Mark("translate", -1, NumInstructions());
 
 	Optimize();
 #if 1
@@ -69306,6 +70450,15 @@ void NativeCodeProcedure::Compile(InterCodeProcedure* proc)
 		}
 	}
 
+	if (mPassTimer)
+	{
+		mPassTimer->Mark("finalize", -1, NumInstructions());
+		mPassTimer = nullptr;
+	}
+}
+
+void NativeCodeProcedure::RegisterFunctionCalls(void)
+{
 	if (mCompilerOptions & COPT_OPTIMIZE_MERGE_CALLS)
 	{
 		ResetVisited();
@@ -69322,10 +70475,211 @@ void NativeCodeProcedure::MergeCalls(void)
 	}
 }
 
+void NativeCodeProcedure::BuildJumpTables(void)
+{
+	if (!(mCompilerOptions & COPT_OPTIMIZE_BASIC) || !mInterProc || mInterProc->mInterrupt || mInterProc->mHardwareInterrupt)
+		return;
+
+	ExpandingArray<NativeCodeBasicBlock*>	blocks;
+	GrowingArray<int>						entries(0);
+
+	ResetVisited();
+	mEntryBlock->mVisited = true;
+	blocks.Push(mEntryBlock);
+	entries[mEntryBlock->mIndex] = 1;
+
+	bool	candidate = false;
+	for (int i = 0; i < blocks.Size(); i++)
+	{
+		NativeCodeBasicBlock* block = blocks[i];
+		NativeCodeBasicBlock* succ[2] = { block->mTrueJump, block->mFalseJump };
+
+		for (int j = 0; j < 2; j++)
+		{
+			if (succ[j])
+			{
+				entries[succ[j]->mIndex]++;
+				if (!succ[j]->mVisited)
+				{
+					succ[j]->mVisited = true;
+					blocks.Push(succ[j]);
+				}
+			}
+		}
+
+		if (block->mFalseJump && block->mIns.Size() > 0 && block->mIns.Last().mMode == ASMIM_IMMEDIATE)
+			candidate = true;
+	}
+
+	if (candidate)
+	{
+		BuildDataFlowSets();
+
+		int	numBlocks = mTempBlocks;
+		for (int i = 0; i < blocks.Size(); i++)
+		{
+			if (entries[blocks[i]->mIndex] > 0)
+				blocks[i]->BuildJumpTable(entries, numBlocks);
+		}
+
+		if (mJumpTables.Size() > 0 && (mLinkerObject->mFlags & LOBJF_ZEROPAGESET))
+		{
+			mLinkerObject->mZeroPageSet += BC_REG_ADDR;
+			mLinkerObject->mZeroPageSet += BC_REG_ADDR + 1;
+		}
+	}
+}
+
+void NativeCodeProcedure::OptimizeTargetCPU(void)
+{
+	if (!(mCompilerOptions & COPT_CPU_65C02))
+		return;
+
+	ExpandingArray<NativeCodeBasicBlock*>	blocks;
+
+	ResetVisited();
+	mEntryBlock->mVisited = true;
+	blocks.Push(mEntryBlock);
+
+	bool	overflow = false;
+	for (int i = 0; i < blocks.Size(); i++)
+	{
+		NativeCodeBasicBlock* block = blocks[i];
+
+		if (block->mBranch == ASMIT_BVC || block->mBranch == ASMIT_BVS)
+			overflow = true;
+		for (int j = 0; j < block->mIns.Size(); j++)
+		{
+			AsmInsType	type = block->mIns[j].mType;
+			if (type == ASMIT_BVC || type == ASMIT_BVS || type == ASMIT_PHP)
+				overflow = true;
+		}
+
+		NativeCodeBasicBlock* succ[2] = { block->mTrueJump, block->mFalseJump };
+		for (int j = 0; j < 2; j++)
+		{
+			if (succ[j] && !succ[j]->mVisited)
+			{
+				succ[j]->mVisited = true;
+				blocks.Push(succ[j]);
+			}
+		}
+		for (int j = 0; j < block->mJumpTable.Size(); j++)
+		{
+			if (!block->mJumpTable[j]->mVisited)
+			{
+				block->mJumpTable[j]->mVisited = true;
+				blocks.Push(block->mJumpTable[j]);
+			}
+		}
+	}
+
+	GrowingArray<uint32>	entryLive(0);
+
+	bool	changed;
+	do {
+		changed = false;
+		for (int i = blocks.Size() - 1; i >= 0; i--)
+		{
+			NativeCodeBasicBlock* block = blocks[i];
+			uint32	live = block->CPURegEntryLive(block->CPURegExitLive(entryLive));
+			if (live != entryLive[block->mIndex])
+			{
+				entryLive[block->mIndex] = live;
+				changed = true;
+			}
+		}
+	} while (changed);
+
+	for (int i = 0; i < blocks.Size(); i++)
+		blocks[i]->Optimize65C02(blocks[i]->CPURegExitLive(entryLive), overflow);
+
+	if (!(mCompilerOptions & COPT_CPU_45GS02))
+		return;
+
+	// The Z register is kept at zero outside of the quad sequences, so
+	// the 65C02 instructions that store zero remain valid
+
+	for (int i = 0; i < blocks.Size(); i++)
+		blocks[i]->Optimize45GS02(blocks[i]->CPURegExitLive(entryLive));
+
+	// Merge the carry of a 16 bit increment into INW
+
+	GrowingArray<int>	entries(0);
+	for (int i = 0; i < blocks.Size(); i++)
+	{
+		NativeCodeBasicBlock* block = blocks[i];
+		if (block->mTrueJump)
+			entries[block->mTrueJump->mIndex]++;
+		if (block->mFalseJump)
+			entries[block->mFalseJump->mIndex]++;
+		for (int j = 0; j < block->mJumpTable.Size(); j++)
+			entries[block->mJumpTable[j]->mIndex]++;
+	}
+
+	for (int i = 0; i < blocks.Size(); i++)
+	{
+		NativeCodeBasicBlock* block = blocks[i];
+		if (block->mIns.Size() > 0 && (block->mBranch == ASMIT_BNE || block->mBranch == ASMIT_BEQ))
+		{
+			NativeCodeBasicBlock* next = block->mBranch == ASMIT_BNE ? block->mTrueJump : block->mFalseJump;
+			NativeCodeBasicBlock* iblock = block->mBranch == ASMIT_BNE ? block->mFalseJump : block->mTrueJump;
+			NativeCodeInstruction& lins(block->mIns.Last());
+
+			if (lins.mType == ASMIT_INC && lins.mMode == ASMIM_ZERO_PAGE && !(lins.mFlags & NCIF_VOLATILE) &&
+				iblock != block && iblock != next && entries[iblock->mIndex] == 1 &&
+				iblock->mIns.Size() == 1 && iblock->mTrueJump == next && !iblock->mFalseJump && iblock->mJumpTable.Size() == 0 &&
+				iblock->mIns[0].mType == ASMIT_INC && iblock->mIns[0].mMode == ASMIM_ZERO_PAGE &&
+				iblock->mIns[0].mLinkerObject == lins.mLinkerObject && iblock->mIns[0].mAddress == lins.mAddress + 1 &&
+				!(iblock->mIns[0].mFlags & NCIF_VOLATILE) &&
+				!(entryLive[next->mIndex] & LIVE_CPU_REG_Z))
+			{
+				lins.mType = ASMIT_INW;
+				block->mBranch = ASMIT_JMP;
+				block->mTrueJump = next;
+				block->mFalseJump = nullptr;
+
+				entries[iblock->mIndex]--;
+				entries[next->mIndex]--;
+				iblock->mEntryBlocks.RemoveAll(block);
+				iblock->mNumEntries--;
+				next->mEntryBlocks.RemoveAll(iblock);
+				next->mNumEntries--;
+			}
+		}
+	}
+
+	// An interrupt may stop a quad sequence while Z is not zero
+
+	if (mInterProc && mInterProc->mInterrupt)
+	{
+		for (int i = 0; i < blocks.Size(); i++)
+		{
+			NativeCodeBasicBlock* block = blocks[i];
+			for (int j = 0; j < block->mIns.Size(); j++)
+			{
+				if (block->mIns[j].mType == ASMIT_RTS || block->mIns[j].mType == ASMIT_RTI)
+				{
+					block->mIns.Insert(j, NativeCodeInstruction(block->mIns[j].mIns, ASMIT_PLZ));
+					j++;
+				}
+			}
+		}
+
+		mEntryBlock->mIns.Insert(0, NativeCodeInstruction(nullptr, ASMIT_LDZ, ASMIM_IMMEDIATE, 0));
+		mEntryBlock->mIns.Insert(0, NativeCodeInstruction(nullptr, ASMIT_PHZ));
+	}
+}
+
 void NativeCodeProcedure::Assemble(void)
 {
+	MemoryArenaScope	scope(&mArena);
+
 	CheckFunc = !strcmp(mIdent->mString, "cwin_edit_char");
 
+	BuildJumpTables();
+	OptimizeTargetCPU();
+
 	mEntryBlock->Assemble();
 
 	ResetVisited();
@@ -69341,6 +70695,12 @@ void NativeCodeProcedure::Assemble(void)
 
 	mEntryBlock->BuildPlacement(placement);
 
+	for (int i = 0; i < placement.Size(); i++)
+	{
+		for (int j = 0; j < placement[i]->mJumpTable.Size(); j++)
+			placement[i]->mJumpTable[j]->BuildPlacement(placement);
+	}
+
 	for (int i = 0; i < placement.Size(); i++)
 		placement[i]->OptimizePlacement();;
 
@@ -69391,6 +70751,24 @@ void NativeCodeProcedure::Assemble(void)
 		placement[i]->CopyCode(this, data);
 	}
 
+	for (int i = 0; i < mJumpTables.Size(); i++)
+	{
+		const JumpTable& jt(mJumpTables[i]);
+		for (int j = 0; j < jt.mBlock->mJumpTable.Size(); j++)
+		{
+			LinkerReference	rl;
+			rl.mObject = jt.mLinkerLSB;
+			rl.mOffset = j;
+			rl.mRefObject = mLinkerObject;
+			rl.mRefOffset = jt.mBlock->mJumpTable[j]->mOffset;
+			rl.mFlags = LREF_LOWBYTE;
+			jt.mLinkerLSB->AddReference(rl);
+			rl.mObject = jt.mLinkerMSB;
+			rl.mFlags = LREF_HIGHBYTE;
+			jt.mLinkerMSB->AddReference(rl);
+		}
+	}
+
 	for (int i = 0; i < mRelocations.Size(); i++)
 	{
 		LinkerReference& rl(mRelocations[i]);
@@ -69451,6 +70829,19 @@ void NativeCodeProcedure::Assemble(void)
 	}
 }
 
+void NativeCodeProcedure::ReleaseBlocks(void)
+{
+	if (mLinkerObject && mLinkerObject->mNativeProc == this)
+		mLinkerObject->mNativeProc = nullptr;
+
+	delete[] tblocks;
+	tblocks = nullptr;
+
+	mEntryBlock = mExitBlock = nullptr;
+	mBlocks.SetSize(0);
+	mArena.Release();
+}
+
 bool NativeCodeProcedure::MapFastParamsToTemps(void)
 {
 	NumberSet	used(256), modified(256), statics(256), pairs(256);
@@ -70946,6 +72337,9 @@ void NativeCodeProcedure::Optimize(void)
 		DisassembleDebug(fname);
 #endif
 
+		if (mPassTimer)
+			mPassTimer->Mark("optimize", step, NumInstructions());
+
 #if 1
 		if (cnt > 190)
 		{
@@ -71315,6 +72709,179 @@ void NativeCodeProcedure::BuildDataFlowSets(void)
 	} while (mBlocks[0]->BuildGlobalRequiredRegSet(totalRequired));
 }
 
+LinkerObject* NativeCodeProcedure::AllocateShortMulTable(InterOperator op, int factor, int size, bool msb)
+{
+	if (!mGenerator->mThreadPool)
+		return mGenerator->AllocateShortMulTable(op, factor, size, msb);
+
+	ThreadLock	lock(mGenerator->mMutex);
+
+	LinkerObject* lo = mGenerator->AllocateShortMulTable(op, factor, size, msb);
+
+	int	i = 0;
+	while (mGenerator->mMulTables[i].mLinkerLSB != lo && mGenerator->mMulTables[i].mLinkerMSB != lo)
+		i++;
+
+	// A serial compile would create the table here, if no earlier procedure did
+
+	mGenerator->mLinker->DeferObject(mGenerator->mMulTables[i].mLinkerLSB);
+	mGenerator->mLinker->DeferObject(mGenerator->mMulTables[i].mLinkerMSB);
+
+	NativeCodeGenerator::TableRequest	req;
+	req.mFloat = false;
+	req.mIndex = i;
+	req.mTask = mTaskIndex;
+	req.mSize = size;
+	mGenerator->mTableRequests.Push(req);
+
+	return AddTableView(lo, false, i, msb ? 1 : 0);
+}
+
+LinkerObject* NativeCodeProcedure::AllocateFloatTable(InterOperator op, bool reverse, int minval, int maxval, float fval, int index)
+{
+	if (!mGenerator->mThreadPool)
+		return mGenerator->AllocateFloatTable(op, reverse, minval, maxval, fval, index);
+
+	ThreadLock	lock(mGenerator->mMutex);
+
+	LinkerObject* lo = mGenerator->AllocateFloatTable(op, reverse, minval, maxval, fval, index);
+
+	int	i = 0;
+	while (mGenerator->mFloatTables[i].mLinker[index] != lo)
+		i++;
+
+	for (int j = 0; j < 4; j++)
+		mGenerator->mLinker->DeferObject(mGenerator->mFloatTables[i].mLinker[j]);
+
+	NativeCodeGenerator::TableRequest	req;
+	req.mFloat = true;
+	req.mIndex = i;
+	req.mTask = mTaskIndex;
+	req.mSize = maxval + 1 - minval;
+	mGenerator->mTableRequests.Push(req);
+
+	return AddTableView(lo, true, i, index);
+}
+
+LinkerObject* NativeCodeProcedure::AddTableView(LinkerObject* table, bool isfloat, int index, int part)
+{
+	for (int i = 0; i < mTableViews.Size(); i++)
+	{
+		if (mTableViews[i].mTable == table)
+			return mTableViews[i].mView;
+	}
+
+	TableView	view;
+	view.mTable = table;
+	view.mFloat = isfloat;
+	view.mIndex = index;
+	view.mPart = part;
+
+	view.mView = new LinkerObject();
+	view.mView->mLocation = table->mLocation;
+	view.mView->mIdent = table->mIdent;
+	view.mView->mFullIdent = table->mFullIdent;
+	view.mView->mType = table->mType;
+	view.mView->mID = view.mView->mMapID = -1;
+	view.mView->mSection = table->mSection;
+	view.mView->mRegion = nullptr;
+	view.mView->mVariable = nullptr;
+	view.mView->mFlags = LOBJF_CONST;
+	view.mView->mData = nullptr;
+	view.mView->mSize = 0;
+
+	mTableViews.Push(view);
+
+	if (mTableViewsPopulated)
+		PopulateTableView(mTableViews[mTableViews.Size() - 1]);
+
+	return view.mView;
+}
+
+LinkerObject* NativeCodeProcedure::TranslateTableView(const NativeCodeProcedure* proc, LinkerObject* lobj)
+{
+	for (int i = 0; i < proc->mTableViews.Size(); i++)
+	{
+		const TableView& view(proc->mTableViews[i]);
+		if (view.mView == lobj)
+			return AddTableView(view.mTable, view.mFloat, view.mIndex, view.mPart);
+	}
+
+	return lobj;
+}
+
+void NativeCodeProcedure::PopulateTableView(TableView& view)
+{
+	// All procedures before this one in serial order must have placed their
+	// requests, the generator lock must not be held while waiting
+
+	mGenerator->mThreadPool->WaitMilestones(mTaskIndex);
+
+	ThreadLock	lock(mGenerator->mMutex);
+
+	int	size = 0;
+	for (int i = 0; i < mGenerator->mTableRequests.Size(); i++)
+	{
+		const NativeCodeGenerator::TableRequest& req(mGenerator->mTableRequests[i]);
+		if (req.mFloat == view.mFloat && req.mIndex == view.mIndex && req.mTask <= mTaskIndex && req.mSize > size)
+			size = req.mSize;
+	}
+
+	view.mView->AddSpace(size);
+
+	if (view.mFloat)
+	{
+		const NativeCodeGenerator::FloatTable& f(mGenerator->mFloatTables[view.mIndex]);
+		for (int j = 0; j < size; j++)
+		{
+			uint8	u[4];
+			mGenerator->FloatTableValue(f, f.mMinValue + j, u);
+			view.mView->mData[j] = u[view.mPart];
+		}
+	}
+	else
+	{
+		const NativeCodeGenerator::MulTable& m(mGenerator->mMulTables[view.mIndex]);
+		for (int j = 0; j < size; j++)
+		{
+			int val = mGenerator->ShortMulTableValue(m, j);
+			view.mView->mData[j] = view.mPart ? (uint8)(val >> 8) : (uint8)(val);
+		}
+	}
+}
+
+void NativeCodeProcedure::PopulateTableViews(void)
+{
+	mGenerator->mThreadPool->Milestone(mTaskIndex);
+
+	mTableViewsPopulated = true;
+	for (int i = 0; i < mTableViews.Size(); i++)
+		PopulateTableView(mTableViews[i]);
+}
+
+void NativeCodeProcedure::ResolveTableViews(void)
+{
+	if (mTableViews.Size() > 0)
+	{
+		for (int i = 0; i < mBlocks.Size(); i++)
+		{
+			NativeCodeBasicBlock* block = mBlocks[i];
+			for (int j = 0; j < block->mIns.Size(); j++)
+			{
+				NativeCodeInstruction& ins(block->mIns[j]);
+				if (ins.mLinkerObject)
+				{
+					for (int k = 0; k < mTableViews.Size(); k++)
+					{
+						if (ins.mLinkerObject == mTableViews[k].mView)
+							ins.mLinkerObject = mTableViews[k].mTable;
+					}
+				}
+			}
+		}
+	}
+}
+
 NativeCodeBasicBlock* NativeCodeProcedure::AllocateBlock(void)
 {
 	NativeCodeBasicBlock* block = new NativeCodeBasicBlock(this);
@@ -72178,7 +73745,7 @@ void NativeCodeProcedure::CompileInterBlock(InterCodeProcedure* iproc, InterCode
 
 
 NativeCodeGenerator::NativeCodeGenerator(Errors* errors, Linker* linker, LinkerSection* runtimeSection)
-	: mErrors(errors), mLinker(linker), mRuntimeSection(runtimeSection), mCompilerOptions(COPT_DEFAULT), mFunctionCalls(nullptr)
+	: mErrors(errors), mLinker(linker), mRuntimeSection(runtimeSection), mCompilerOptions(COPT_DEFAULT), mFunctionCalls(nullptr), mThreadPool(nullptr), mTimeReport(nullptr)
 {
 }
 
@@ -72193,6 +73760,61 @@ void NativeCodeGenerator::CompleteRuntime(void)
 }
 
 
+int NativeCodeGenerator::ShortMulTableValue(const MulTable& m, int index) const
+{
+	int val = m.mFactor;
+	switch (m.mOperator)
+	{
+	case IA_MUL:
+		val *= index;
+		break;
+	case IA_SHL:
+		val <<= index;
+		break;
+	case IA_SHR:
+		val = (val & 0xffff) >> index;
+		break;
+	case IA_SAR:
+		val = (int)(short)val >> index;
+		break;
+	}
+
+	return val;
+}
+
+void NativeCodeGenerator::FloatTableValue(const FloatTable& f, int index, uint8* data) const
+{
+	union {
+		float	f;
+		uint8	u[4];
+	}	fu;
+
+	switch (f.mOperator)
+	{
+	case IA_MUL:
+		fu.f = f.mConst * float(index);
+		break;
+	case IA_ADD:
+		fu.f = f.mConst * float(index);
+		break;
+	case IA_SUB:
+		if (f.mReverse)
+			fu.f = f.mConst - float(index);
+		else
+			fu.f = float(index) - f.mConst;
+		break;
+	case IA_DIVS:
+		if (f.mReverse)
+			fu.f = f.mConst / float(index);
+		else
+			fu.f = float(index) / f.mConst;
+		break;
+	}
+
+	for (int k = 0; k < 4; k++)
+		data[k] = fu.u[k];
+}
+
 void NativeCodeGenerator::PopulateShortMulTables(void)
 {
 	for (int i = 0; i < mMulTables.Size(); i++)
@@ -72205,22 +73827,7 @@ void NativeCodeGenerator::PopulateShortMulTables(void)
 
 			for (int j = 0; j < m.mSize; j++)
 			{
-				int val = m.mFactor;
-				switch (m.mOperator)
-				{
-				case IA_MUL:
-					val *= j;
-					break;
-				case IA_SHL:
-					val <<= j;
-					break;
-				case IA_SHR:
-					val = (val & 0xffff) >> j;
-					break;
-				case IA_SAR:
-					val = (int)(short)val >> j;
-					break;
-				}
+				int val = ShortMulTableValue(m, j);
 
 				m.mLinkerLSB->mData[j] = (uint8)(val);
 				m.mLinkerMSB->mData[j] = (uint8)(val >> 8);
@@ -72239,35 +73846,12 @@ void NativeCodeGenerator::PopulateShortMulTables(void)
 
 		for (int j = f.mMinValue; j <= f.mMaxValue; j++)
 		{
-			union {
-				float	f;
-				uint8	u[4];
-			}	fu;
+			uint8	u[4];
 
-			switch (f.mOperator)
-			{
-			case IA_MUL:
-				fu.f = f.mConst * float(j);
-				break;
-			case IA_ADD:
-				fu.f = f.mConst * float(j);
-				break;
-			case IA_SUB:
-				if (f.mReverse)
-					fu.f = f.mConst - float(j);
-				else
-					fu.f = float(j) - f.mConst;
-				break;
-			case IA_DIVS:
-				if (f.mReverse)
-					fu.f = f.mConst / float(j);
-				else
-					fu.f = float(j) / f.mConst;
-				break;
-			}
+			FloatTableValue(f, j, u);
 
 			for (int k = 0; k < 4; k++)
-				f.mLinker[k]->mData[j - f.mMinValue] = fu.u[k];
+				f.mLinker[k]->mData[j - f.mMinValue] = u[k];
 		}
 	}
 }
@@ -72636,41 +74220,39 @@ void NativeCodeGenerator::OutlineFunctions(void)
 {
 	NativeCodeMapper	mapper;
 
-	bool	progress;
+	PassTimer* timer = mTimeReport ? mTimeReport->Start("outline", nullptr, 0) : nullptr;
 
-	int k = 0;
+	bool	progress;
 
 	int numOutlines = 0;
 	do {
 		progress = false;
 
-		SuffixTree* tree = new SuffixTree(nullptr, 0, nullptr);
+		SuffixArray	sarray;
 
 		for (int i = 0; i < mProcedures.Size(); i++)
 		{
 			if ((mProcedures[i]->mCompilerOptions & COPT_OPTIMIZE_OUTLINE))
-				mProcedures[i]->AddToSuffixTree(mapper, tree);
+				mProcedures[i]->AddToSuffixArray(mapper, &sarray);
 		}
-		tree->AddParents(nullptr);
+		sarray.Build();
+		sarray.CollectRepeats(mapper, 6, 6);
 
-#if 0
-		FILE* f;
-
-		if (!fopen_s(&f, "r:\\suffix.txt", "w"))
-		{
-			tree->Print(f, mapper, 0);
-			fclose(f);
-		}
-#endif
+		if (timer)
+			timer->Mark("suffix", -1, numOutlines);
 
-		SuffixTree* ltree = nullptr;
-		int lsize = 6;
+		// Outline all repeats in order of benefit, that do not touch code
+		// changed by a previous outline of this round
 
-		tree->LongestMatch(mapper, 0, 0, lsize, ltree);
-		if (lsize > 6)
+		SuffixRepeat	repeat;
+		while (sarray.NextRepeat(6, repeat))
 		{
 			ExpandingArray<SuffixSegment>	segs;
-			ltree->ReplaceCalls(mapper, segs);
+			sarray.CollectSegments(repeat, segs);
+
+#if 0
+			sarray.Print(stdout, mapper, repeat);
+#endif
 
 			NativeCodeBasicBlock* block = segs[0].mBlock;
 
@@ -72684,12 +74266,13 @@ void NativeCodeGenerator::OutlineFunctions(void)
 			nproc->mCompilerOptions = block->mProc->mCompilerOptions;
 			nproc->mIdent = Ident::Unique("$outline", numOutlines);
 			nproc->mLinkerObject = mLinker->AddObject(nproc->mLocation, nproc->mIdent, block->mProc->mLinkerObject->mSection, LOT_NATIVE_CODE);
+			nproc->mLinkerObject->mFlags |= LOBJF_CONST;
 			nproc->mEntryBlock = nblock;
 			nproc->mInterProc = nullptr;
 
 			bool dojmp = false;
 
-			ltree->ParentCollect(mapper, nblock);
+			sarray.CollectInstructions(mapper, repeat, nblock);
 			if (nblock->mIns[nblock->mIns.Size() - 1].mType == ASMIT_JSR)
 				nblock->mIns[nblock->mIns.Size() - 1].mType = ASMIT_JMP;
 			else if (nblock->mIns[nblock->mIns.Size() - 1].mType == ASMIT_RTS || nblock->mIns[nblock->mIns.Size() - 1].mType == ASMIT_JMP)
@@ -72828,6 +74411,8 @@ void NativeCodeGenerator::OutlineFunctions(void)
 
 			mProcedures.Push(nproc);
 
+			sarray.Invalidate(repeat);
+
 			if (mergeBlocks)
 			{
 				ExpandingArray<NativeCodeProcedure *>	procs;
@@ -72841,6 +74426,7 @@ void NativeCodeGenerator::OutlineFunctions(void)
 						procs.Push(p);
 						p->ResetVisited();
 						p->mEntryBlock->MergeBasicBlocks();
+						sarray.Invalidate(p);
 					}			
 				}
 			}
@@ -72848,21 +74434,11 @@ void NativeCodeGenerator::OutlineFunctions(void)
 			numOutlines++;
 			progress = true;
 		}
-#if 0
-		if (!fopen_s(&f, "r:\\lsuffix.txt", "w"))
-		{
-			ltree->ParentPrint(f, mapper);
-			fclose(f);
-		}
-#endif
-		delete tree;
-		mapper.Reset();
 
-#if 0
-		k++;
-		if (k == 2)
-			break;
-#endif
+		if (timer)
+			timer->Mark("replace", -1, numOutlines);
+
+		mapper.Reset();
 	} while (progress);
 }
 
@@ -3,6 +3,7 @@
 #include "Assembler.h"
 #include "Linker.h"
 #include "InterCode.h"
+#include "ThreadPool.h"
 
 class NativeCodeProcedure;
 class NativeCodeBasicBlock;
@@ -10,7 +11,7 @@ class NativeCodeGenerator;
 class NativeCodeInstruction;
 
 class NativeCodeMapper;
-class SuffixTree;
+class SuffixArray;
 
 enum NativeRegisterDataMode : uint8
 {
@@ -309,7 +310,7 @@ struct NativeCodeLoadStorePair
 };
 
 
-class NativeCodeBasicBlock
+class NativeCodeBasicBlock : public ArenaObject<NativeCodeBasicBlock>
 {
 public:
 	NativeCodeBasicBlock(NativeCodeProcedure * proc);
@@ -329,6 +330,7 @@ public:
 	ExpandingArray<LinkerReference>	mRelocations;
 
 	ExpandingArray<NativeCodeBasicBlock*>	mEntryBlocks;
+	ExpandingArray<NativeCodeBasicBlock*>	mJumpTable;
 
 	int							mOffset, mSize, mPlace, mNumEntries, mNumEntered, mFrameOffset, mTemp;
 	bool						mPlaced, mCopied, mKnownShortBranch, mBypassed, mAssembled, mNoFrame, mVisited, mLoopHead, mVisiting, mLocked, mPatched, mPatchFail, mPatchChecked, mPatchUsed, mPatchStart, mPatchLoop, mPatchLoopChanged, mPatchExit;
@@ -382,6 +384,13 @@ public:
 	void ShortcutTailRecursion();
 	void ShortcutJump(int offset);
 
+	bool BuildJumpTable(GrowingArray<int>& entries, int numBlocks);
+
+	uint32 CPURegExitLive(const GrowingArray<uint32>& entryLive) const;
+	uint32 CPURegEntryLive(uint32 exitLive) const;
+	void Optimize65C02(uint32 exitLive, bool overflow);
+	void Optimize45GS02(uint32 exitLive);
+
 	bool ReferencesAccu(int from = 0, int to = 65536) const;
 	bool ReferencesYReg(int from = 0, int to = 65536) const;
 	bool ReferencesXReg(int from = 0, int to = 65536) const;
@@ -1082,7 +1091,7 @@ public:
 
 	int mSuffixStringLength;
 	int* mSuffixString;
-	void AddToSuffixTree(NativeCodeMapper& mapper, SuffixTree * tree);
+	void AddToSuffixArray(NativeCodeMapper& mapper, SuffixArray* sarray);
 
 };
 
@@ -1108,20 +1117,54 @@ class NativeCodeProcedure
 		bool	mNoFrame, mSimpleInline;
 		int		mTempBlocks;
 
+		// Position in the serial compile order when compiled in parallel
+		int		mTaskIndex;
+
+		// Private copies of the shared multiplication and float tables, sized as
+		// a serial compile would see them when reaching this procedure
+		struct TableView
+		{
+			LinkerObject	*	mTable, * mView;
+			bool				mFloat;
+			int					mIndex, mPart;
+		};
+
+		ExpandingArray<TableView>	mTableViews;
+		bool						mTableViewsPopulated;
+
 		ExpandingArray<LinkerReference>	mRelocations;
 		ExpandingArray< NativeCodeBasicBlock*>	 mBlocks;
+		MemoryArena							mArena;
+		PassTimer						*	mPassTimer;
 		ExpandingArray<CodeLocation>		mCodeLocations, mCodeOrigins;
 		ExpandingArray< SelfModReference>	mSelfModSources;
 
+		// Dense switch dispatch, the block jumps indirect through the split
+		// address tables, entries are resolved after the final placement
+		struct JumpTable
+		{
+			NativeCodeBasicBlock	*	mBlock;
+			LinkerObject			*	mLinkerLSB, * mLinkerMSB;
+		};
+
+		ExpandingArray<JumpTable>			mJumpTables;
+
 		void DisassembleDebug(const char* name);
 		void Disassemble(FILE* file);
+		int NumInstructions(void) const;
 
 		void Compile(InterCodeProcedure* proc);
 		void Optimize(void);
+		void RegisterFunctionCalls(void);
 		void MergeCalls(void);
 		void Assemble(void);
+		void BuildJumpTables(void);
+		void OptimizeTargetCPU(void);
+
+		// Free all basic blocks, once the procedure is assembled
+		void ReleaseBlocks(void);
 
-		void AddToSuffixTree(NativeCodeMapper& mapper, SuffixTree* tree);
+		void AddToSuffixArray(NativeCodeMapper& mapper, SuffixArray* sarray);
 
 		NativeCodeBasicBlock* CompileBlock(InterCodeProcedure* iproc, InterCodeBasicBlock* block);
 		NativeCodeBasicBlock* AllocateBlock(void);
@@ -1143,6 +1186,15 @@ class NativeCodeProcedure
 
 		void SaveTempsToStack(int tempSave);
 		void LoadTempsFromStack(int tempSave);
+
+		LinkerObject* AllocateShortMulTable(InterOperator op, int factor, int size, bool msb);
+		LinkerObject* AllocateFloatTable(InterOperator op, bool reverse, int minval, int maxval, float fval, int index);
+
+		LinkerObject* AddTableView(LinkerObject* table, bool isfloat, int index, int part);
+		LinkerObject* TranslateTableView(const NativeCodeProcedure* proc, LinkerObject* lobj);
+		void PopulateTableView(TableView& view);
+		void PopulateTableViews(void);
+		void ResolveTableViews(void);
 };
 
 class NativeCodeGenerator
@@ -1183,6 +1235,22 @@ public:
 	LinkerObject* AllocateFloatTable(InterOperator op, bool reverse, int minval, int maxval, float fval, int index);
 	void PopulateShortMulTables(void);
 
+	int ShortMulTableValue(const MulTable& m, int index) const;
+	void FloatTableValue(const FloatTable& f, int index, uint8* data) const;
+
+	// Table requests of procedures compiled in parallel, tagged with their
+	// position in the serial compile order
+	struct TableRequest
+	{
+		bool	mFloat;
+		int		mIndex, mTask, mSize;
+	};
+
+	ThreadPool		*	mThreadPool;
+	TimeReport		*	mTimeReport;
+	ThreadMutex			mMutex;
+	ExpandingArray<TableRequest>	mTableRequests;
+
 	Runtime& ResolveRuntime(const Ident* ident);
 
 	Errors* mErrors;
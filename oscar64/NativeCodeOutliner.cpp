@@ -1,4 +1,5 @@
 #include "NativeCodeOutliner.h"
+#include <algorithm>
 
 
 NativeCodeMapper::NativeCodeMapper(void)
@@ -53,327 +54,340 @@ int NativeCodeMapper::MapInstruction(const NativeCodeInstruction& ins, LinkerSec
 	return n->mIndex;
 }
 
-SuffixTree::SuffixTree(const int* str, int s, SuffixTree* n)
+SuffixArray::SuffixArray(void)
 {
-	mSeg = str;
-	mSize = s;
-	mNext = n;
-	mParent = nullptr;
-	mFirst = nullptr;
 }
 
-SuffixTree::~SuffixTree(void)
+SuffixArray::~SuffixArray(void)
 {
-	delete[] mFirst;
 }
 
-void SuffixTree::AddParents(SuffixTree* parent)
+void SuffixArray::AddString(NativeCodeBasicBlock* block, const int* str)
 {
-	mParent = parent;
-	if (mFirst)
+	int b = mBlocks.Size();
+	mBlocks.Push(block);
+	mBlockStart.Push(mString.Size());
+	mInvalid.Push(false);
+
+	int i = 0;
+	while (str[i] >= 0)
 	{
-		for (int i = 0; i < HashSize; i++)
-		{
-			SuffixTree* n = mFirst[i];
-			while (n)
-			{
-				n->AddParents(this);
-				n = n->mNext;
-			}
-		}
+		mString.Push(str[i]);
+		mPosBlock.Push(b);
+		i++;
 	}
+	mString.Push(str[i]);
+	mPosBlock.Push(b);
 }
 
-void SuffixTree::AddSuffix(const int* str, int s)
+void SuffixArray::Build(void)
 {
-	int hi = str[0] & (HashSize - 1);
-	SuffixTree* c = mFirst ? mFirst[hi] : nullptr;
-	while (c && c->mSeg[0] != str[0])
-		c = c->mNext;
+	// Prefix doubling with counting sorts, the unique block terminators
+	// limit the number of rounds to the log of the longest repeat
+
+	int n = mString.Size();
+
+	mSuffix.SetSize(n);
+	mLCP.SetSize(n + 1);
+	if (n == 0)
+		return;
 
-	if (c)
+	int	maxc = 0;
+	for (int i = 0; i < n; i++)
+		if (mString[i] >= maxc)
+			maxc = mString[i] + 1;
+
+	int	* rank = new int[n], * nrank = new int[n], * tmp = new int[n];
+
+	int range = n;
+	for (int i = 0; i < n; i++)
 	{
-		int k = 1;
-		while (k < c->mSize && str[k] == c->mSeg[k])
-			k++;
-		if (k == c->mSize)
-			c->AddSuffix(str + k, s - k);
-		else
-		{
-			SuffixTree * n = new SuffixTree(c->mSeg + k, c->mSize - k, nullptr);
-			if (c->mFirst)
-			{
-				n->mFirst = new SuffixTree * [HashSize];
-				for (int i = 0; i < HashSize; i++)
-				{
-					n->mFirst[i] = c->mFirst[i];
-					c->mFirst[i] = nullptr;
-				}
-			}
-			else
-			{
-				c->mFirst = new SuffixTree * [HashSize];
-				for (int i = 0; i < HashSize; i++)
-					c->mFirst[i] = nullptr;
-			}
-			c->mFirst[c->mSeg[k] & (HashSize - 1)] = n;
-			int hk = str[k] & (HashSize - 1);
-			c->mFirst[hk] = new SuffixTree(str + k, s - k, c->mFirst[hk]);
-			c->mSize = k;
-		}
+		int c = mString[i];
+		rank[i] = c >= 0 ? c : maxc - c - 1;
+		if (rank[i] >= range)
+			range = rank[i] + 1;
 	}
-	else
+
+	int* count = new int[range + 1];
+	for (int i = 0; i <= range; i++)
+		count[i] = 0;
+	for (int i = 0; i < n; i++)
+		count[rank[i] + 1]++;
+	for (int i = 0; i < range; i++)
+		count[i + 1] += count[i];
+	for (int i = 0; i < n; i++)
+		mSuffix[count[rank[i]]++] = i;
+
+	int classes = 0;
+	nrank[mSuffix[0]] = 0;
+	for (int i = 1; i < n; i++)
 	{
-		if (!mFirst)
+		if (rank[mSuffix[i]] != rank[mSuffix[i - 1]])
+			classes++;
+		nrank[mSuffix[i]] = classes;
+	}
+	classes++;
+	std::swap(rank, nrank);
+
+	for (int k = 1; classes < n; k *= 2)
+	{
+		int p = 0;
+		for (int i = n - k; i < n; i++)
+			if (i >= 0)
+				tmp[p++] = i;
+		for (int i = 0; i < n; i++)
+			if (mSuffix[i] >= k)
+				tmp[p++] = mSuffix[i] - k;
+
+		for (int i = 0; i <= classes; i++)
+			count[i] = 0;
+		for (int i = 0; i < n; i++)
+			count[rank[i] + 1]++;
+		for (int i = 0; i < classes; i++)
+			count[i + 1] += count[i];
+		for (int i = 0; i < n; i++)
+			mSuffix[count[rank[tmp[i]]]++] = tmp[i];
+
+		int c = 0;
+		nrank[mSuffix[0]] = 0;
+		for (int i = 1; i < n; i++)
 		{
-			mFirst = new SuffixTree * [HashSize];
-			for (int i = 0; i < HashSize; i++)
-				mFirst[i] = nullptr;
+			int a = mSuffix[i - 1], b = mSuffix[i];
+			if (rank[a] != rank[b] || (a + k < n ? rank[a + k] : -1) != (b + k < n ? rank[b + k] : -1))
+				c++;
+			nrank[b] = c;
 		}
-
-		mFirst[hi] = new SuffixTree(str, s, mFirst[hi]);
+		classes = c + 1;
+		std::swap(rank, nrank);
 	}
-}
 
-void SuffixTree::AddString(const int* str)
-{
-	int s = 0;
-	while(str[s] >= 0)
-		s++;
-	s++;
+	// Longest common prefix of neighbouring suffixes
 
-	int i = 0;
-	while (str[i] >= 0)
-	{
-		AddSuffix(str + i, s - i);
-		i++;
-	}
-	AddSuffix(str + i, 1);
-}
+	for (int i = 0; i < n; i++)
+		rank[mSuffix[i]] = i;
 
-void SuffixTree::CollectSuffix(NativeCodeMapper& map, int offset, ExpandingArray<SuffixSegment>& segs)
-{
-	offset += mSize;
-	if (mFirst)
+	int h = 0;
+	mLCP[0] = 0;
+	mLCP[n] = 0;
+	for (int i = 0; i < n; i++)
 	{
-		for (int i = 0; i < HashSize; i++)
+		if (rank[i] > 0)
 		{
-			SuffixTree* t = mFirst[i];
-
-			while (t)
-			{
-				t->CollectSuffix(map, offset, segs);
-				t = t->mNext;
-			}
+			int j = mSuffix[rank[i] - 1];
+			while (i + h < n && j + h < n && mString[i + h] == mString[j + h])
+				h++;
+			mLCP[rank[i]] = h;
+			if (h > 0)
+				h--;
 		}
+		else
+			h = 0;
 	}
-	else
-	{
-		NativeCodeBasicBlock* block = map.mBlocks[-(mSeg[mSize - 1] + 1)];
 
-		SuffixSegment	seg;
-		seg.mBlock = block;
-		seg.mStart = offset;
-		seg.mEnd = block->mIns.Size() + 1;
-		segs.Push(seg);
-	}
+	delete[] count;
+	delete[] rank;
+	delete[] nrank;
+	delete[] tmp;
 }
 
-int SuffixTree::LongestMatch(NativeCodeMapper& map, int size, int isize, int& msize, SuffixTree*& mtree)
+void SuffixArray::CollectRepeats(NativeCodeMapper& map, int minSize, int minBenefit)
 {
-	if (mFirst)
-	{
-		isize += mSize;
+	int n = mString.Size();
 
-		for (int i = 0; i < mSize; i++)
-		{
-			if (mSeg[i] >= 0)
-				size += AsmInsModeSize[map.mIns[mSeg[i]].mMode];
-		}
+	mBytes.SetSize(n + 1);
+	mBytes[0] = 0;
+	for (int i = 0; i < n; i++)
+		mBytes[i + 1] = mBytes[i] + (mString[i] >= 0 ? AsmInsModeSize[map.mIns[mString[i]].mMode] : 0);
+
+	mHeap.SetSize(0);
 
-		assert(size < 10000);
+	// Each lcp interval corresponds to an inner node of the suffix tree,
+	// the benefit without overlap check is an upper bound for the real one
 
-		int cnt = 0;
-		for (int i = 0; i < HashSize; i++)
+	struct Interval
+	{
+		int	mLCP, mLow;
+	};
+
+	ExpandingArray<Interval>	stack;
+	Interval					iv;
+	iv.mLCP = 0;
+	iv.mLow = 0;
+	stack.Push(iv);
+
+	for (int i = 1; i <= n; i++)
+	{
+		int low = i - 1;
+		while (mLCP[i] < stack.Last().mLCP)
 		{
-			SuffixTree* t = mFirst[i];
-			while (t)
-			{
-				cnt += t->LongestMatch(map, size, isize, msize, mtree);
-				t = t->mNext;
-			}
+			iv = stack.Pop();
+
+			SuffixRepeat	r;
+			r.mLow = iv.mLow;
+			r.mHigh = i;
+			r.mLength = iv.mLCP;
+			r.mSize = mBytes[mSuffix[r.mLow] + r.mLength] - mBytes[mSuffix[r.mLow]];
+			r.mBenefit = (r.mSize - 3) * (r.mHigh - r.mLow - 1);
+			r.mExact = false;
+			if (r.mSize >= minSize && r.mBenefit > minBenefit)
+				HeapPush(r);
+
+			low = iv.mLow;
 		}
-
-		if (size >= 6 && (size - 3) * (cnt - 1) > msize)
+		if (mLCP[i] > stack.Last().mLCP)
 		{
-			// Second run to cross check for overlaps
-			ExpandingArray<SuffixSegment>	segs;
-			for (int i = 0; i < HashSize; i++)
-			{
-				SuffixTree* t = mFirst[i];
-				while (t)
-				{
-					t->CollectSuffix(map, 0, segs);
-					t = t->mNext;
-				}
-			}
-			segs.Sort([](const SuffixSegment& l, const SuffixSegment& r)->bool {
-				return l.mBlock == r.mBlock ? l.mStart < r.mStart : ptrdiff_t(l.mBlock) < ptrdiff_t(r.mBlock);
-			});
-
-			for (int i = 0; i + 1 < segs.Size(); i++)
-			{
-				if (segs[i].mBlock == segs[i + 1].mBlock && segs[i].mStart + isize > segs[i + 1].mStart)
-					cnt--;
-			}
-
-			if (cnt > 1 && (size - 3) * (cnt - 1) > msize)
-			{
-				msize = (size - 3) * (cnt - 1);
-				mtree = this;
-			}
+			iv.mLCP = mLCP[i];
+			iv.mLow = low;
+			stack.Push(iv);
 		}
-
-		return cnt;
 	}
-	else
-		return 1;
 }
 
-void SuffixTree::Print(FILE * file, NativeCodeMapper& map, int depth)
+int SuffixArray::CountRepeats(const SuffixRepeat& r) const
 {
-	for (int i = 0; i < depth; i++)
-		fprintf(file, ".");
-
-	for (int i = 0; i < mSize; i++)
+	int		n = r.mHigh - r.mLow;
+	int	*	pos = new int[n];
+	for (int i = 0; i < n; i++)
+		pos[i] = mSuffix[r.mLow + i];
+	std::sort(pos, pos + n);
+
+	int cnt = n;
+	for (int i = 0; i + 1 < n; i++)
 	{
-		fprintf(file, "[");
-
-		if (mSeg[i] >= 0)
-			map.mIns[mSeg[i]].Disassemble(file);
-		else
-		{
-			NativeCodeBasicBlock* block = map.mBlocks[- (mSeg[i] + 1)];
-			fprintf(file, "%s,%d", block->mProc->mInterProc->mIdent->mString, block->mIndex);
-		}
-		fprintf(file, "]");
+		if (pos[i] + r.mLength > pos[i + 1])
+			cnt--;
 	}
-	fprintf(file, "\n");
 
-	if (mFirst)
-	{
-		for (int i = 0; i < HashSize; i++)
-		{
-			SuffixTree* n = mFirst[i];
-			while (n)
-			{
-				n->Print(file, map, depth + 1);
-				n = n->mNext;
-			}
-		}
-	}
+	delete[] pos;
+	return cnt;
 }
 
-void SuffixTree::ParentPrint(FILE* file, NativeCodeMapper& map)
+bool SuffixArray::NextRepeat(int minBenefit, SuffixRepeat& r)
 {
-	if (mParent)
-		mParent->ParentPrint(file, map);
-	for (int i = 0; i < mSize; i++)
+	while (mHeap.Size() > 0)
 	{
-		if (mSeg[i] >= 0)
-			map.mIns[mSeg[i]].Disassemble(file);
-		else
+		r = HeapPop();
+		if (IsValid(r))
 		{
-			NativeCodeBasicBlock* block = map.mBlocks[-(mSeg[i] + 1)];
-			fprintf(file, "%s,%d", block->mProc->mInterProc->mIdent->mString, block->mIndex);
+			if (r.mExact)
+				return true;
+
+			r.mBenefit = (r.mSize - 3) * (CountRepeats(r) - 1);
+			r.mExact = true;
+			if (r.mBenefit > minBenefit)
+				HeapPush(r);
 		}
-		fprintf(file, "\n");
 	}
+
+	return false;
 }
 
-int SuffixTree::ParentCodeSize(NativeCodeMapper& map) const
+bool SuffixArray::IsValid(const SuffixRepeat& r) const
 {
-	int size = 0;
-	for (int i = 0; i < mSize; i++)
-	{
-		if (mSeg[i] >= 0)
-			size += AsmInsModeSize[map.mIns[mSeg[i]].mMode];
-	}
-
-	if (mParent)
-		size += mParent->ParentCodeSize(map);
+	for (int i = r.mLow; i < r.mHigh; i++)
+		if (mInvalid[mPosBlock[mSuffix[i]]])
+			return false;
+	return true;
+}
 
-	return size;
+void SuffixArray::Invalidate(const SuffixRepeat& r)
+{
+	for (int i = r.mLow; i < r.mHigh; i++)
+		mInvalid[mPosBlock[mSuffix[i]]] = true;
 }
 
-void SuffixTree::ParentCollect(NativeCodeMapper& map, NativeCodeBasicBlock* block)
+void SuffixArray::Invalidate(NativeCodeProcedure* proc)
 {
-	if (mParent)
-		mParent->ParentCollect(map, block);
-	for (int i = 0; i < mSize; i++)
-		block->mIns.Push(map.mIns[mSeg[i]]);
+	for (int i = 0; i < mBlocks.Size(); i++)
+		if (mBlocks[i]->mProc == proc)
+			mInvalid[i] = true;
 }
 
-void SuffixTree::ReplaceCalls(NativeCodeMapper& map, ExpandingArray<SuffixSegment>& segs)
+void SuffixArray::CollectSegments(const SuffixRepeat& r, ExpandingArray<SuffixSegment>& segs) const
 {
-	if (mFirst)
+	for (int i = r.mLow; i < r.mHigh; i++)
 	{
-		for (int i = 0; i < HashSize; i++)
-		{
-			SuffixTree* n = mFirst[i];
-			while (n)
-			{
-				n->ChildReplaceCalls(map, this, 0, segs);
-				n = n->mNext;
-			}
-		}
+		int p = mSuffix[i];
+		int b = mPosBlock[p];
+
+		SuffixSegment	seg;
+		seg.mBlock = mBlocks[b];
+		seg.mStart = p - mBlockStart[b];
+		seg.mEnd = seg.mStart + r.mLength;
+		segs.Push(seg);
 	}
 }
 
-void SuffixTree::ChildReplaceCalls(NativeCodeMapper& map, SuffixTree* tree, int offset, ExpandingArray<SuffixSegment>& segs)
+void SuffixArray::CollectInstructions(NativeCodeMapper& map, const SuffixRepeat& r, NativeCodeBasicBlock* block) const
 {
-	for (int i = 0; i < mSize; i++)
-	{
-		if (mSeg[i] >= 0)
-			offset ++;
-	}
+	int p = mSuffix[r.mLow];
+	for (int i = 0; i < r.mLength; i++)
+		block->mIns.Push(map.mIns[mString[p + i]]);
+}
+
+void SuffixArray::Print(FILE* file, NativeCodeMapper& map, const SuffixRepeat& r) const
+{
+	fprintf(file, "Repeat %d x %d bytes, benefit %d\n", r.mHigh - r.mLow, r.mSize, r.mBenefit);
 
-	if (mFirst)
+	int p = mSuffix[r.mLow];
+	for (int i = 0; i < r.mLength; i++)
 	{
-		for (int i = 0; i < HashSize; i++)
-		{
-			SuffixTree* n = mFirst[i];
-			while (n)
-			{
-				n->ChildReplaceCalls(map, tree, offset, segs);
-				n = n->mNext;
-			}
-		}
+		map.mIns[mString[p + i]].Disassemble(file);
+		fprintf(file, "\n");
 	}
+}
+
+bool SuffixArray::HeapLess(const SuffixRepeat& l, const SuffixRepeat& r) const
+{
+	if (l.mBenefit != r.mBenefit)
+		return l.mBenefit < r.mBenefit;
+	else if (l.mLength != r.mLength)
+		return l.mLength < r.mLength;
 	else
+		return l.mLow > r.mLow;
+}
+
+void SuffixArray::HeapPush(const SuffixRepeat& r)
+{
+	int i = mHeap.Size();
+	mHeap.Push(r);
+	while (i > 0)
 	{
-		NativeCodeBasicBlock* block = map.mBlocks[-(mSeg[mSize - 1] + 1)];
-		tree->ParentReplaceCalls(map, block, offset, 0, segs);
+		int p = (i - 1) / 2;
+		if (!HeapLess(mHeap[p], mHeap[i]))
+			break;
+		SuffixRepeat	t = mHeap[p];
+		mHeap[p] = mHeap[i];
+		mHeap[i] = t;
+		i = p;
 	}
 }
 
-void SuffixTree::ParentReplaceCalls(NativeCodeMapper& map, NativeCodeBasicBlock* block, int offset, int size, ExpandingArray<SuffixSegment>& segs)
+SuffixRepeat SuffixArray::HeapPop(void)
 {
-	for (int i = 0; i < mSize; i++)
+	SuffixRepeat	r = mHeap[0];
+	SuffixRepeat	l = mHeap.Pop();
+
+	int n = mHeap.Size();
+	if (n > 0)
 	{
-		if (mSeg[i] >= 0)
-			size ++;
+		mHeap[0] = l;
+		int i = 0;
+		for (;;)
+		{
+			int c = 2 * i + 1;
+			if (c >= n)
+				break;
+			if (c + 1 < n && HeapLess(mHeap[c], mHeap[c + 1]))
+				c++;
+			if (!HeapLess(mHeap[i], mHeap[c]))
+				break;
+			SuffixRepeat	t = mHeap[c];
+			mHeap[c] = mHeap[i];
+			mHeap[i] = t;
+			i = c;
+		}
 	}
-	if (mParent)
-		mParent->ParentReplaceCalls(map, block, offset, size, segs);
-	else
-	{
-		int at = block->mIns.Size() - offset - size;
 
-		SuffixSegment	seg;
-		seg.mBlock = block;
-		seg.mStart = at;
-		seg.mEnd = at + size;
-		segs.Push(seg);
-	}
+	return r;
 }
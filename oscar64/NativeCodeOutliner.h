@@ -35,32 +35,45 @@ struct SuffixSegment
 	int							mStart, mEnd;
 };
 
-class SuffixTree
-{
-public:
-	const int	*	mSeg;
-	int				mSize;
+// Suffix array over the mapped instruction strings of all basic blocks,
+// each string is terminated by the unique id of its block, so repeats
+// never cross block boundaries.
 
-	static const int HashSize = 32;
+struct SuffixRepeat
+{
+	int		mLow, mHigh, mLength, mSize, mBenefit;
+	bool	mExact;
+};
 
-	SuffixTree* mNext, * mParent, ** mFirst;
+class SuffixArray
+{
+public:
+	SuffixArray(void);
+	~SuffixArray(void);
 
-	SuffixTree(const int* str, int s, SuffixTree* n);
-	~SuffixTree(void);
+	void AddString(NativeCodeBasicBlock* block, const int* str);
+	void Build(void);
 
-	void AddParents(SuffixTree* parent);
+	void CollectRepeats(NativeCodeMapper& map, int minSize, int minBenefit);
+	bool NextRepeat(int minBenefit, SuffixRepeat& r);
 
-	void AddSuffix(const int* str, int s);
-	void AddString(const int* str);
+	bool IsValid(const SuffixRepeat& r) const;
+	void Invalidate(const SuffixRepeat& r);
+	void Invalidate(NativeCodeProcedure* proc);
 
-	void Print(FILE* file, NativeCodeMapper & map, int depth);
-	void ParentPrint(FILE* file, NativeCodeMapper& map);
-	int LongestMatch(NativeCodeMapper& map, int size, int isize, int & msize, SuffixTree *& mtree);
-	void CollectSuffix(NativeCodeMapper& map, int offset, ExpandingArray<SuffixSegment>& segs);
-	int ParentCodeSize(NativeCodeMapper& map) const;
-	void ParentCollect(NativeCodeMapper& map, NativeCodeBasicBlock * block);
-	void ReplaceCalls(NativeCodeMapper& map, ExpandingArray<SuffixSegment> & segs);
-	void ChildReplaceCalls(NativeCodeMapper& map, SuffixTree * tree, int offset, ExpandingArray<SuffixSegment>& segs);
-	void ParentReplaceCalls(NativeCodeMapper& map, NativeCodeBasicBlock* block, int offset, int size, ExpandingArray<SuffixSegment>& segs);
+	void CollectSegments(const SuffixRepeat& r, ExpandingArray<SuffixSegment>& segs) const;
+	void CollectInstructions(NativeCodeMapper& map, const SuffixRepeat& r, NativeCodeBasicBlock* block) const;
 
-};
\ No newline at end of file
+	void Print(FILE* file, NativeCodeMapper& map, const SuffixRepeat& r) const;
+protected:
+	ExpandingArray<int>						mString, mBytes, mPosBlock, mSuffix, mLCP;
+	ExpandingArray<NativeCodeBasicBlock*>	mBlocks;
+	ExpandingArray<int>						mBlockStart;
+	ExpandingArray<bool>					mInvalid;
+	ExpandingArray<SuffixRepeat>			mHeap;
+
+	int CountRepeats(const SuffixRepeat& r) const;
+	bool HeapLess(const SuffixRepeat& l, const SuffixRepeat& r) const;
+	void HeapPush(const SuffixRepeat& r);
+	SuffixRepeat HeapPop(void);
+};
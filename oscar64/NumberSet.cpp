@@ -2,49 +2,176 @@
 
 #define VALGRIND	0
 
+// Sets up to this number of words are always kept as bit vectors
+
+static const int SparseMinWords = 4;
+
+#if defined(__GNUC__) || defined(__clang__)
+static inline int LowestBit(uint64 w)
+{
+	return __builtin_ctzll(w);
+}
+
+static inline int CountBits(uint64 w)
+{
+	return __builtin_popcountll(w);
+}
+#else
+static inline int LowestBit(uint64 w)
+{
+	int	i = 0;
+	if (!(w & 0xffffffffull)) { w >>= 32; i += 32; }
+	if (!(w & 0xffff)) { w >>= 16; i += 16; }
+	if (!(w & 0xff)) { w >>= 8; i += 8; }
+	if (!(w & 0xf)) { w >>= 4; i += 4; }
+	if (!(w & 0x3)) { w >>= 2; i += 2; }
+	if (!(w & 0x1)) i++;
+	return i;
+}
+
+static inline int CountBits(uint64 w)
+{
+	w = w - ((w >> 1) & 0x5555555555555555ull);
+	w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+	w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0full;
+	return int((w * 0x0101010101010101ull) >> 56);
+}
+#endif
+
 NumberSet::NumberSet(void)
 {
 	size = 0;
 	dwsize = 0;
-	bits = 0;
+	bits = nullptr;
+	elems = nullptr;
+	num = 0;
+	capacity = 0;
+	dense = true;
 }
 
 NumberSet::NumberSet(int size, bool set)
+{
+	dwsize = 0;
+	bits = nullptr;
+	elems = nullptr;
+	num = 0;
+	capacity = 0;
+
+	Reset(size, set);
+}
+
+NumberSet::NumberSet(const NumberSet& set)
 {
 	int i;
 
-	this->size = size;
-	dwsize = (size + 63) >> 6;
+	this->size = set.size;
+	this->dwsize = set.dwsize;
+	this->dense = set.dense;
+	this->num = set.num;
 
-	bits = new uint64[dwsize];
+	bits = nullptr;
+	elems = nullptr;
+	capacity = 0;
 
-	if (set)
+	if (dense)
 	{
+		bits = new uint64[dwsize];
 		for (i = 0; i < dwsize; i++)
-			bits[i] = ~0ull;
+			bits[i] = set.bits[i];
 	}
-	else
+	else if (num > 0)
 	{
-		for (i = 0; i < dwsize; i++)
-			bits[i] = 0;
+		capacity = num;
+		elems = new uint32[capacity];
+		for (i = 0; i < num; i++)
+			elems[i] = set.elems[i];
 	}
 }
 
-NumberSet::NumberSet(const NumberSet& set)
+NumberSet::~NumberSet(void)
 {
-	int i;
+	delete[] bits;
+	delete[] elems;
+}
 
-	this->size = set.size;
-	this->dwsize = set.dwsize;
-	this->bits = new uint64[dwsize];
+int NumberSet::Find(int elem) const
+{
+	int	l = 0, h = num;
+	while (l < h)
+	{
+		int	m = (l + h) >> 1;
+		if (elems[m] < uint32(elem))
+			l = m + 1;
+		else
+			h = m;
+	}
+	return l;
+}
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] = set.bits[i];
+void NumberSet::Grow(int n)
+{
+	if (n > capacity)
+	{
+		int	ncapacity = capacity ? 2 * capacity : 4;
+		while (ncapacity < n)
+			ncapacity *= 2;
+		if (ncapacity > dwsize && n <= dwsize)
+			ncapacity = dwsize;
+
+		uint32* nelems = new uint32[ncapacity];
+		for (int i = 0; i < num; i++)
+			nelems[i] = elems[i];
+		delete[] elems;
+		elems = nelems;
+		capacity = ncapacity;
+	}
 }
 
-NumberSet::~NumberSet(void)
+void NumberSet::Insert(int elem)
 {
-	delete[] bits;
+	int	i = Find(elem);
+	if (i < num && elems[i] == uint32(elem))
+		return;
+
+	if (num >= dwsize)
+	{
+		MakeDense();
+		bits[elem >> 6] |= (1ULL << (elem & 63));
+	}
+	else
+	{
+		Grow(num + 1);
+		for (int j = num; j > i; j--)
+			elems[j] = elems[j - 1];
+		elems[i] = elem;
+		num++;
+	}
+}
+
+void NumberSet::Remove(int elem)
+{
+	int	i = Find(elem);
+	if (i < num && elems[i] == uint32(elem))
+	{
+		num--;
+		for (int j = i; j < num; j++)
+			elems[j] = elems[j + 1];
+	}
+}
+
+void NumberSet::MakeDense(void)
+{
+	if (!dense)
+	{
+		if (!bits)
+			bits = new uint64[dwsize];
+		for (int i = 0; i < dwsize; i++)
+			bits[i] = 0;
+		for (int i = 0; i < num; i++)
+			bits[elems[i] >> 6] |= 1ULL << (elems[i] & 63);
+		num = 0;
+		dense = true;
+	}
 }
 
 void NumberSet::Expand(int size, bool set)
@@ -54,14 +181,22 @@ void NumberSet::Expand(int size, bool set)
 		int ndwsize = (size + 63) >> 6;
 		if (dwsize != ndwsize)
 		{
-			uint64	*	nbits = new uint64[ndwsize];
-			for (int i = 0; i < dwsize; i++)
-				nbits[i] = bits[i];
-			for (int i = dwsize; i < ndwsize; i++)
-				nbits[i] = 0;
-			delete[] bits;
+			if (dense)
+			{
+				uint64* nbits = new uint64[ndwsize];
+				for (int i = 0; i < dwsize; i++)
+					nbits[i] = bits[i];
+				for (int i = dwsize; i < ndwsize; i++)
+					nbits[i] = 0;
+				delete[] bits;
+				bits = nbits;
+			}
+			else
+			{
+				delete[] bits;
+				bits = nullptr;
+			}
 			dwsize = ndwsize;
-			bits = nbits;
 		}
 		this->size = size;
 	}
@@ -75,21 +210,28 @@ void NumberSet::Reset(int size, bool set)
 	if (this->dwsize != ndwsize)
 	{
 		delete[] bits;
+		bits = nullptr;
 		dwsize = ndwsize;
-		bits = new uint64[dwsize];
 	}
 
 	this->size = size;
+	num = 0;
 
-	if (set)
+	if (set || dwsize <= SparseMinWords)
 	{
+		if (!bits)
+			bits = new uint64[dwsize];
+		dense = true;
+
+		uint64	w = set ? ~0ull : 0;
 		for (i = 0; i < dwsize; i++)
-			bits[i] = ~0ull;
+			bits[i] = w;
 	}
 	else
 	{
-		for (i = 0; i < dwsize; i++)
-			bits[i] = 0;
+		delete[] bits;
+		bits = nullptr;
+		dense = false;
 	}
 }
 
@@ -125,6 +267,14 @@ void NumberSet::Fill(void)
 {
 	int i;
 
+	if (!dense)
+	{
+		if (!bits)
+			bits = new uint64[dwsize];
+		num = 0;
+		dense = true;
+	}
+
 	for (i = 0; i < dwsize; i++)
 		bits[i] = ~0ull;
 }
@@ -133,65 +283,244 @@ void NumberSet::OrNot(const NumberSet& set)
 {
 	int i;
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] |= ~set.bits[i];
+	MakeDense();
+
+	if (set.dense)
+	{
+		for (i = 0; i < dwsize; i++)
+			bits[i] |= ~set.bits[i];
+	}
+	else
+	{
+		int	k = 0;
+		for (i = 0; i < dwsize; i++)
+		{
+			uint64	w = 0;
+			while (k < set.num && int(set.elems[k] >> 6) == i)
+			{
+				w |= 1ULL << (set.elems[k] & 63);
+				k++;
+			}
+			bits[i] |= ~w;
+		}
+	}
 }
 
 void NumberSet::Clear(void)
 {
 	int i;
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] = 0;
+	// Keeps the bit vector, the set is likely to grow again
+
+	if (dwsize > SparseMinWords)
+	{
+		num = 0;
+		dense = false;
+	}
+	else
+	{
+		for (i = 0; i < dwsize; i++)
+			bits[i] = 0;
+	}
 }
 
 NumberSet& NumberSet::operator=(const NumberSet& set)
 {
+	if (this == &set)
+		return *this;
+
 	this->size = set.size;
 
 	if (dwsize != set.dwsize)
 	{
 		delete[] bits;
+		bits = nullptr;
 		this->dwsize = set.dwsize;
-		this->bits = new uint64[dwsize];
 	}
 
-	int	size = dwsize;
-	const uint64* sbits = set.bits;
-	uint64* dbits = bits;
+	if (set.dense)
+	{
+		if (!bits)
+			bits = new uint64[dwsize];
+
+		int	size = dwsize;
+		const uint64* sbits = set.bits;
+		uint64* dbits = bits;
 
-	for (int i = 0; i < size; i++)
-		dbits[i] = sbits[i];
+		for (int i = 0; i < size; i++)
+			dbits[i] = sbits[i];
+
+		num = 0;
+		dense = true;
+	}
+	else
+	{
+		num = 0;
+		Grow(set.num);
+		for (int i = 0; i < set.num; i++)
+			elems[i] = set.elems[i];
+		num = set.num;
+		dense = false;
+	}
 
 	return *this;
 }
 
 NumberSet& NumberSet::operator&=(const NumberSet& set)
+{
+	Intersect(set);
+	return *this;
+}
+
+bool NumberSet::Intersect(const NumberSet& set)
 {
 	assert(dwsize == set.dwsize);
 
-	int	size = dwsize;
-	const uint64* sbits = set.bits;
-	uint64* dbits = bits;
+	if (this == &set)
+		return false;
 
-	for (int i = 0; i < size; i++)
-		dbits[i] &= sbits[i];
+	bool	changed = false;
 
-	return *this;
+	if (dense && set.dense)
+	{
+		int	size = dwsize;
+		const uint64* sbits = set.bits;
+		uint64* dbits = bits;
+
+		for (int i = 0; i < size; i++)
+		{
+			uint64	w = dbits[i] & sbits[i];
+			if (w != dbits[i])
+			{
+				dbits[i] = w;
+				changed = true;
+			}
+		}
+	}
+	else if (dense)
+	{
+		// The result is a subset of the sparse set
+
+		Grow(set.num);
+		int	k = 0;
+		for (int i = 0; i < set.num; i++)
+		{
+			uint32	e = set.elems[i];
+			if (bits[e >> 6] & (1ULL << (e & 63)))
+				elems[k++] = e;
+		}
+		changed = k != Num();
+		num = k;
+		dense = false;
+	}
+	else
+	{
+		int	k = 0;
+		for (int i = 0; i < num; i++)
+		{
+			if (set.Test(elems[i]))
+				elems[k++] = elems[i];
+		}
+		changed = k != num;
+		num = k;
+	}
+
+	return changed;
 }
 
 NumberSet& NumberSet::operator|=(const NumberSet& set)
+{
+	Union(set);
+	return *this;
+}
+
+bool NumberSet::Union(const NumberSet& set)
 {
 	assert(dwsize >= set.dwsize);
 
-	int	size = dwsize < set.dwsize ? dwsize : set.dwsize;
-	const uint64* sbits = set.bits;
-	uint64* dbits = bits;
+	if (this == &set)
+		return false;
 
-	for (int i = 0; i < size; i++)
-		dbits[i] |= sbits[i];
+	bool	changed = false;
 
-	return *this;
+	if (!set.dense)
+	{
+		if (dense)
+		{
+			for (int i = 0; i < set.num; i++)
+			{
+				uint32	e = set.elems[i];
+				uint64	m = 1ULL << (e & 63);
+				if (!(bits[e >> 6] & m))
+				{
+					bits[e >> 6] |= m;
+					changed = true;
+				}
+			}
+		}
+		else if (num + set.num > dwsize)
+		{
+			int	n = num;
+			MakeDense();
+			for (int i = 0; i < set.num; i++)
+				bits[set.elems[i] >> 6] |= 1ULL << (set.elems[i] & 63);
+			changed = Num() != n;
+		}
+		else if (set.num > 0)
+		{
+			// Merge from the back, duplicates leave a gap that is closed
+			// afterwards
+
+			int	n = num + set.num;
+			Grow(n);
+
+			int	i = num - 1, j = set.num - 1, k = n - 1;
+			while (j >= 0)
+			{
+				if (i >= 0 && elems[i] > set.elems[j])
+					elems[k--] = elems[i--];
+				else if (i >= 0 && elems[i] == set.elems[j])
+				{
+					elems[k--] = elems[i--];
+					j--;
+				}
+				else
+				{
+					elems[k--] = set.elems[j--];
+					changed = true;
+				}
+			}
+
+			if (k > i)
+			{
+				for (int l = k + 1; l < n; l++)
+					elems[++i] = elems[l];
+				num = i + 1;
+			}
+			else
+				num = n;
+		}
+	}
+	else
+	{
+		MakeDense();
+
+		int	size = dwsize < set.dwsize ? dwsize : set.dwsize;
+		const uint64* sbits = set.bits;
+		uint64* dbits = bits;
+
+		for (int i = 0; i < size; i++)
+		{
+			uint64	w = dbits[i] | sbits[i];
+			if (w != dbits[i])
+			{
+				dbits[i] = w;
+				changed = true;
+			}
+		}
+	}
+
+	return changed;
 }
 
 NumberSet& NumberSet::operator-=(const NumberSet& set)
@@ -200,8 +529,28 @@ NumberSet& NumberSet::operator-=(const NumberSet& set)
 
 	int i;
 
-	for (i = 0; i < dwsize; i++)
-		bits[i] &= ~set.bits[i];
+	if (this == &set)
+		Clear();
+	else if (!dense)
+	{
+		int	k = 0;
+		for (i = 0; i < num; i++)
+		{
+			if (!set.Test(elems[i]))
+				elems[k++] = elems[i];
+		}
+		num = k;
+	}
+	else if (!set.dense)
+	{
+		for (i = 0; i < set.num; i++)
+			bits[set.elems[i] >> 6] &= ~(1ULL << (set.elems[i] & 63));
+	}
+	else
+	{
+		for (i = 0; i < dwsize; i++)
+			bits[i] &= ~set.bits[i];
+	}
 
 	return *this;
 }
@@ -212,12 +561,115 @@ bool NumberSet::operator<=(const NumberSet& set) const
 
 	int i;
 
-	for (i = 0; i < dwsize; i++)
-		if (bits[i] & ~set.bits[i]) return false;
+	if (!dense)
+	{
+		for (i = 0; i < num; i++)
+			if (!set.Test(elems[i])) return false;
+	}
+	else if (!set.dense)
+	{
+		for (i = 0; i < dwsize; i++)
+		{
+			uint64	w = bits[i];
+			while (w)
+			{
+				if (!set.Test(i * 64 + LowestBit(w))) return false;
+				w &= w - 1;
+			}
+		}
+	}
+	else
+	{
+		for (i = 0; i < dwsize; i++)
+			if (bits[i] & ~set.bits[i]) return false;
+	}
 
 	return true;
 }
 
+bool NumberSet::operator==(const NumberSet& set) const
+{
+	if (dwsize != set.dwsize)
+		return false;
+
+	for (int i = 0; i < dwsize; i++)
+		if (Word(i) != set.Word(i)) return false;
+
+	return true;
+}
+
+uint64 NumberSet::Word(int i) const
+{
+	uint64	w = 0;
+
+	if (dense)
+		w = bits[i];
+	else
+	{
+		for (int j = Find(i * 64); j < num && int(elems[j] >> 6) == i; j++)
+			w |= 1ULL << (elems[j] & 63);
+	}
+
+	if (i == dwsize - 1 && (size & 63))
+		w &= (1ULL << (size & 63)) - 1;
+
+	return w;
+}
+
+int NumberSet::First(void) const
+{
+	return Next(-1);
+}
+
+int NumberSet::Next(int elem) const
+{
+	elem++;
+
+	if (elem >= size)
+		return -1;
+	else if (dense)
+	{
+		int		i = elem >> 6;
+		uint64	w = bits[i] & (~0ULL << (elem & 63));
+
+		for (;;)
+		{
+			if (w)
+			{
+				elem = i * 64 + LowestBit(w);
+				return elem < size ? elem : -1;
+			}
+			i++;
+			if (i >= dwsize)
+				return -1;
+			w = bits[i];
+		}
+	}
+	else
+	{
+		int	i = Find(elem);
+		return i < num && int(elems[i]) < size ? int(elems[i]) : -1;
+	}
+}
+
+bool NumberSet::Empty(void) const
+{
+	return First() < 0;
+}
+
+int NumberSet::Num(void) const
+{
+	if (dense)
+	{
+		int	n = 0;
+		for (int i = 0; i < dwsize; i++)
+			n += CountBits(Word(i));
+		return n;
+	}
+	else
+		return num;
+}
+
 
 
 FastNumberSet::FastNumberSet(void)
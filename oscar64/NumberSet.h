@@ -4,11 +4,26 @@
 
 #include "MachineTypes.h"
 
+// Set of non negative integers below a given size.  Sets with a large
+// range and only a few elements keep a sorted list of their elements,
+// and switch to a bit vector once the list would use more than half the
+// memory of the bit vector.
+
 class NumberSet
 {
 protected:
 	uint64				* bits;
+	uint32				* elems;
 	int					size, dwsize;
+	int					num, capacity;
+	bool				dense;
+
+	bool Test(int elem) const;
+	int Find(int elem) const;
+	void Insert(int elem);
+	void Remove(int elem);
+	void Grow(int n);
+	void MakeDense(void);
 public:
 	NumberSet(void);
 	NumberSet(int size, bool set = false);
@@ -30,6 +45,12 @@ public:
 	NumberSet& operator-=(const NumberSet& set);
 
 	bool operator<=(const NumberSet& set) const;
+	bool operator==(const NumberSet& set) const;
+	bool operator!=(const NumberSet& set) const { return !(*this == set); }
+
+	// Same as |= and &=, but return true if the set changed
+	bool Union(const NumberSet& set);
+	bool Intersect(const NumberSet& set);
 
 	void OrNot(const NumberSet& set);
 
@@ -40,13 +61,38 @@ public:
 	bool RangeClear(int elem, int num) const;
 	bool RangeFilled(int elem, int num) const;
 
+	// Iterate the elements in ascending order, returns -1 after the last
+	int First(void) const;
+	int Next(int elem) const;
+
+	// Bits 64 * i to 64 * i + 63 of the set
+	uint64 Word(int i) const;
+	int Words(void) const { return dwsize; }
+
+	bool Empty(void) const;
+	int Num(void) const;
+
 	int Size(void) { return size; }
 };
 
+inline bool NumberSet::Test(int elem) const
+{
+	if (dense)
+		return (bits[elem >> 6] & (1ULL << (elem & 63))) != 0;
+	else
+	{
+		int	i = Find(elem);
+		return i < num && elems[i] == uint32(elem);
+	}
+}
+
 inline NumberSet& NumberSet::operator+=(int elem)
 {
 	assert(elem >= 0 && elem < size);
-	bits[elem >> 6] |= (1ULL << (elem & 63));
+	if (dense)
+		bits[elem >> 6] |= (1ULL << (elem & 63));
+	else
+		Insert(elem);
 
 	return *this;
 }
@@ -54,7 +100,10 @@ inline NumberSet& NumberSet::operator+=(int elem)
 inline NumberSet& NumberSet::operator-=(int elem)
 {
 	assert(elem >= 0 && elem < size);
-	bits[elem >> 6] &= ~(1ULL << (elem & 63));
+	if (dense)
+		bits[elem >> 6] &= ~(1ULL << (elem & 63));
+	else
+		Remove(elem);
 
 	return *this;
 }
@@ -62,7 +111,7 @@ inline NumberSet& NumberSet::operator-=(int elem)
 inline bool NumberSet::operator[](int elem) const
 {
 	assert(elem >= 0 && elem < size);
-	return (bits[elem >> 6] & (1ULL << (elem & 63))) != 0;
+	return Test(elem);
 }
 
 
@@ -14225,12 +14225,13 @@ Expression* Parser::ParseAssembler(Declaration* vdasm)
 	vdasm->mValue = ifirst;
 
 	int		offset = 0;
+	AsmCPU	cpu = TargetCPU(mCompilerOptions);
 
 	while (mScanner->mToken != TK_CLOSE_BRACE && mScanner->mToken != TK_EOF)
 	{
 		if (mScanner->mToken == TK_IDENT)
 		{
-			AsmInsType	ins = FindAsmInstruction(mScanner->mTokenIdent->mString);
+			AsmInsType	ins = FindAsmInstruction(mScanner->mTokenIdent->mString, cpu);
 			if (ins == ASMIT_INV)
 			{
 				const Ident* label = mScanner->mTokenIdent;
@@ -14335,7 +14336,10 @@ Expression* Parser::ParseAssembler(Declaration* vdasm)
 						mScanner->NextToken();
 						if (mScanner->mToken == TK_IDENT && (!strcmp(mScanner->mTokenIdent->mString, "x") || !strcmp(mScanner->mTokenIdent->mString, "X")))
 						{
-							ilast->mAsmInsMode = ASMIM_INDIRECT_X;
+							if (ilast->mAsmInsType == ASMIT_JMP)
+								ilast->mAsmInsMode = ASMIM_INDIRECT_ABSOLUTE_X;
+							else
+								ilast->mAsmInsMode = ASMIM_INDIRECT_X;
 							mScanner->NextToken();
 							if (mScanner->mToken == TK_CLOSE_PARENTHESIS)
 								mScanner->NextToken();
@@ -14356,13 +14360,18 @@ Expression* Parser::ParseAssembler(Declaration* vdasm)
 								ilast->mAsmInsMode = ASMIM_INDIRECT_Y;
 								mScanner->NextToken();
 							}
+							else if (cpu == ASMCPU_45GS02 && mScanner->mToken == TK_IDENT && (!strcmp(mScanner->mTokenIdent->mString, "z") || !strcmp(mScanner->mTokenIdent->mString, "Z")))
+							{
+								ilast->mAsmInsMode = ASMIM_INDIRECT_ZERO_PAGE;
+								mScanner->NextToken();
+							}
 							else
 								mErrors->Error(mScanner->mLocation, EERR_SYNTAX, "',y' expected");
 						}
-						else
-						{
+						else if (ilast->mAsmInsType == ASMIT_JMP)
 							ilast->mAsmInsMode = ASMIM_INDIRECT;
-						}
+						else
+							ilast->mAsmInsMode = ASMIM_INDIRECT_ZERO_PAGE;
 					}
 					else
 						mErrors->Error(mScanner->mLocation, EERR_SYNTAX, "',' or ')' expected");
@@ -14388,10 +14397,10 @@ Expression* Parser::ParseAssembler(Declaration* vdasm)
 					}
 					else
 					{
-						if (HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_RELATIVE))
+						if (HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_RELATIVE, cpu))
 							ilast->mAsmInsMode = ASMIM_RELATIVE;
 						else if (
-							HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_IMMEDIATE) &&
+							HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_IMMEDIATE, cpu) &&
 							ilast->mLeft &&
 							ilast->mLeft->mType == EX_CONSTANT && 
 							ilast->mLeft->mDecValue->mType == DT_VARIABLE &&
@@ -14417,15 +14426,18 @@ Expression* Parser::ParseAssembler(Declaration* vdasm)
 						(ilast->mLeft->mDecValue->mType == DT_VARIABLE && (ilast->mLeft->mDecValue->mFlags & DTF_ZEROPAGE)) ||
 						ilast->mLeft->mDecValue->mType == DT_ARGUMENT)
 					{
-						if (ilast->mAsmInsMode == ASMIM_ABSOLUTE && HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_ZERO_PAGE))
+						if (ilast->mAsmInsMode == ASMIM_ABSOLUTE && HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_ZERO_PAGE, cpu))
 							ilast->mAsmInsMode = ASMIM_ZERO_PAGE;
-						else if (ilast->mAsmInsMode == ASMIM_ABSOLUTE_X && HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_ZERO_PAGE_X))
+						else if (ilast->mAsmInsMode == ASMIM_ABSOLUTE_X && HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_ZERO_PAGE_X, cpu))
 							ilast->mAsmInsMode = ASMIM_ZERO_PAGE_X;
-						else if (ilast->mAsmInsMode == ASMIM_ABSOLUTE_Y && HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_ZERO_PAGE_Y))
+						else if (ilast->mAsmInsMode == ASMIM_ABSOLUTE_Y && HasAsmInstructionMode(ilast->mAsmInsType, ASMIM_ZERO_PAGE_Y, cpu))
 							ilast->mAsmInsMode = ASMIM_ZERO_PAGE_Y;
 					}
 				}
 
+				if (ilast->mAsmInsType != ASMIT_BYTE && !HasAsmInstructionMode(ilast->mAsmInsType, ilast->mAsmInsMode, cpu))
+					mErrors->Error(ilast->mLocation, EERR_ASM_INVALID_MODE, "Invalid address mode for instruction", AsmInstructionNames[ilast->mAsmInsType]);
+
 				offset += AsmInsSize(ilast->mAsmInsType, ilast->mAsmInsMode);
 
 				uint32 flags = AsmInsFlags(ilast->mAsmInsType, ilast->mAsmInsMode);
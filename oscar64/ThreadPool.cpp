@@ -0,0 +1,228 @@
+#include "ThreadPool.h"
+
+#ifndef OSCAR_NO_THREADS
+#ifdef _WIN32
+#include <thread>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
+// The code generators recurse deeply along the control flow graph, and a
+// waiting task may execute other tasks on top of its own stack
+
+static const size_t WorkerStackSize = 64 * 1024 * 1024;
+
+void ThreadMutex::Lock(void)
+{
+#ifndef OSCAR_NO_THREADS
+	mMutex.lock();
+#endif
+}
+
+void ThreadMutex::Unlock(void)
+{
+#ifndef OSCAR_NO_THREADS
+	mMutex.unlock();
+#endif
+}
+
+ThreadPool::ThreadPool(int numThreads)
+	: mNumThreads(numThreads), mNumTasks(0), mFirstOpen(0), mFirstMilestone(0), mCompleted(0),
+	  mPending(nullptr), mMilestones(nullptr), mStates(nullptr), mDependents(nullptr), mTask(nullptr)
+{
+#ifdef OSCAR_NO_THREADS
+	mNumThreads = 1;
+#endif
+	if (mNumThreads < 1)
+		mNumThreads = 1;
+}
+
+ThreadPool::~ThreadPool(void)
+{
+}
+
+int ThreadPool::HardwareThreads(void)
+{
+#ifndef OSCAR_NO_THREADS
+#ifdef _WIN32
+	int n = int(std::thread::hardware_concurrency());
+#else
+	int n = int(sysconf(_SC_NPROCESSORS_ONLN));
+#endif
+	if (n > 0)
+		return n;
+#endif
+	return 1;
+}
+
+void ThreadPool::PassMilestone(int task)
+{
+	mMilestones[task] = true;
+	while (mFirstMilestone < mNumTasks && mMilestones[mFirstMilestone])
+		mFirstMilestone++;
+}
+
+void ThreadPool::Run(int numTasks, const ExpandingArray<int>* dependencies, const std::function<void(int)>& task)
+{
+	mNumTasks = numTasks;
+	mFirstOpen = 0;
+	mFirstMilestone = 0;
+	mCompleted = 0;
+	mTask = &task;
+
+	mPending = new int[numTasks];
+	mMilestones = new bool[numTasks];
+	mStates = new TaskState[numTasks];
+	mDependents = new ExpandingArray<int>[numTasks];
+
+	for (int i = 0; i < numTasks; i++)
+	{
+		mPending[i] = dependencies[i].Size();
+		mMilestones[i] = false;
+		mStates[i] = TS_WAITING;
+		for (int j = 0; j < dependencies[i].Size(); j++)
+			mDependents[dependencies[i][j]].Push(i);
+	}
+
+	if (mNumThreads == 1 || numTasks < 2)
+	{
+		for (int i = 0; i < numTasks; i++)
+		{
+			mStates[i] = TS_RUNNING;
+			task(i);
+			mStates[i] = TS_DONE;
+			PassMilestone(i);
+			mCompleted++;
+		}
+	}
+#ifndef OSCAR_NO_THREADS
+	else
+	{
+		int	numWorkers = mNumThreads < numTasks ? mNumThreads : numTasks;
+
+#ifdef _WIN32
+		std::thread	** workers = new std::thread*[numWorkers];
+		for (int i = 0; i < numWorkers; i++)
+			workers[i] = new std::thread(WorkerEntry, this);
+		for (int i = 0; i < numWorkers; i++)
+		{
+			workers[i]->join();
+			delete workers[i];
+		}
+		delete[] workers;
+#else
+		pthread_t* workers = new pthread_t[numWorkers];
+
+		pthread_attr_t	attr;
+		pthread_attr_init(&attr);
+		pthread_attr_setstacksize(&attr, WorkerStackSize);
+
+		int	started = 0;
+		while (started < numWorkers && pthread_create(workers + started, &attr, WorkerEntry, this) == 0)
+			started++;
+
+		pthread_attr_destroy(&attr);
+
+		// Fall back to the calling thread, if no worker could be created
+		if (started == 0)
+			Worker();
+
+		for (int i = 0; i < started; i++)
+			pthread_join(workers[i], nullptr);
+		delete[] workers;
+#endif
+	}
+#endif
+
+	delete[] mPending;
+	delete[] mMilestones;
+	delete[] mStates;
+	delete[] mDependents;
+
+	mPending = nullptr;
+	mMilestones = nullptr;
+	mStates = nullptr;
+	mDependents = nullptr;
+	mTask = nullptr;
+}
+
+void ThreadPool::Milestone(int task)
+{
+#ifndef OSCAR_NO_THREADS
+	std::unique_lock<std::mutex>	lock(mMutex);
+	PassMilestone(task);
+	mCondition.notify_all();
+#else
+	PassMilestone(task);
+#endif
+}
+
+void ThreadPool::WaitMilestones(int task)
+{
+#ifndef OSCAR_NO_THREADS
+	std::unique_lock<std::mutex>	lock(mMutex);
+	while (mFirstMilestone < task)
+	{
+		int	t = NextReady(task);
+		if (t >= 0)
+			Execute(t, lock);
+		else
+			mCondition.wait(lock);
+	}
+#endif
+}
+
+#ifndef OSCAR_NO_THREADS
+
+void* ThreadPool::WorkerEntry(void* pool)
+{
+	((ThreadPool*)pool)->Worker();
+	return nullptr;
+}
+
+void ThreadPool::Worker(void)
+{
+	std::unique_lock<std::mutex>	lock(mMutex);
+	while (mCompleted < mNumTasks)
+	{
+		int	t = NextReady(mNumTasks);
+		if (t >= 0)
+			Execute(t, lock);
+		else
+			mCondition.wait(lock);
+	}
+}
+
+int ThreadPool::NextReady(int limit)
+{
+	while (mFirstOpen < mNumTasks && mStates[mFirstOpen] != TS_WAITING)
+		mFirstOpen++;
+
+	for (int i = mFirstOpen; i < limit; i++)
+	{
+		if (mStates[i] == TS_WAITING && mPending[i] == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+void ThreadPool::Execute(int task, std::unique_lock<std::mutex>& lock)
+{
+	mStates[task] = TS_RUNNING;
+	lock.unlock();
+
+	(*mTask)(task);
+
+	lock.lock();
+	mStates[task] = TS_DONE;
+	PassMilestone(task);
+	for (int i = 0; i < mDependents[task].Size(); i++)
+		mPending[mDependents[task][i]]--;
+	mCompleted++;
+	mCondition.notify_all();
+}
+
+#endif
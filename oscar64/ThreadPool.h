@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Array.h"
+#include <functional>
+
+#if defined(__wasi__) && !defined(_REENTRANT)
+#define OSCAR_NO_THREADS
+#endif
+
+#ifndef OSCAR_NO_THREADS
+#include <mutex>
+#include <condition_variable>
+#endif
+
+class ThreadMutex
+{
+public:
+	void Lock(void);
+	void Unlock(void);
+
+#ifndef OSCAR_NO_THREADS
+protected:
+	std::recursive_mutex	mMutex;
+#endif
+};
+
+class ThreadLock
+{
+public:
+	ThreadLock(ThreadMutex& mutex)
+		: mMutex(mutex)
+	{
+		mMutex.Lock();
+	}
+
+	~ThreadLock(void)
+	{
+		mMutex.Unlock();
+	}
+
+protected:
+	ThreadMutex& mMutex;
+};
+
+// Runs a set of numbered tasks on worker threads.  A task is started once
+// all its dependencies are completed, ready tasks with lower numbers are
+// started first.  Dependencies must always have lower numbers than the
+// task depending on them, so running the tasks in ascending order on a
+// single thread is always a valid schedule.
+
+class ThreadPool
+{
+public:
+	ThreadPool(int numThreads);
+	~ThreadPool(void);
+
+	int		mNumThreads;
+
+	void Run(int numTasks, const ExpandingArray<int>* dependencies, const std::function<void(int)>& task);
+
+	// A task signals, that it has passed its milestone, completion of a task
+	// implies passing its milestone
+	void Milestone(int task);
+
+	// Wait until all tasks numbered below task have passed their milestone,
+	// the waiting thread executes ready tasks below task in the meantime
+	void WaitMilestones(int task);
+
+	static int HardwareThreads(void);
+
+protected:
+	enum TaskState
+	{
+		TS_WAITING,
+		TS_RUNNING,
+		TS_DONE
+	};
+
+	int					mNumTasks, mFirstOpen, mFirstMilestone, mCompleted;
+	int				*	mPending;
+	bool			*	mMilestones;
+	TaskState		*	mStates;
+	ExpandingArray<int>	*	mDependents;
+
+	const std::function<void(int)>	*	mTask;
+
+#ifndef OSCAR_NO_THREADS
+	std::mutex				mMutex;
+	std::condition_variable	mCondition;
+
+	void Worker(void);
+	int NextReady(int limit);
+	void Execute(int task, std::unique_lock<std::mutex>& lock);
+
+	static void* WorkerEntry(void* pool);
+#endif
+
+	void PassMilestone(int task);
+};
@@ -0,0 +1,234 @@
+#include "TimeReport.h"
+#include <algorithm>
+#include <string.h>
+
+PassTimer::PassTimer(const char* phase, const Ident* ident, int instructions)
+	: mPhase(phase), mIdent(ident), mTime(0), mInstructions(instructions)
+{
+	mLast = std::chrono::steady_clock::now();
+}
+
+void PassTimer::Mark(const char* name, int step, int instructions)
+{
+	std::chrono::steady_clock::time_point	now = std::chrono::steady_clock::now();
+	double	t = std::chrono::duration<double>(now - mLast).count();
+	mLast = now;
+
+	int	i = 0;
+	while (i < mPasses.Size() && !(mPasses[i].mStep == step && !strcmp(mPasses[i].mName, name)))
+		i++;
+
+	if (i == mPasses.Size())
+	{
+		Pass	pass;
+		pass.mName = name;
+		pass.mStep = step;
+		pass.mCount = 0;
+		pass.mChanged = 0;
+		pass.mTime = 0;
+		mPasses.Push(pass);
+	}
+
+	Pass& pass(mPasses[i]);
+	pass.mCount++;
+	pass.mChanged += instructions > mInstructions ? instructions - mInstructions : mInstructions - instructions;
+	pass.mTime += t;
+
+	mTime += t;
+	mInstructions = instructions;
+}
+
+TimeReport::TimeReport(void)
+{
+}
+
+TimeReport::~TimeReport(void)
+{
+	for (int i = 0; i < mTimers.Size(); i++)
+		delete mTimers[i];
+}
+
+PassTimer* TimeReport::Start(const char* phase, const Ident* ident, int instructions)
+{
+	PassTimer* timer = new PassTimer(phase, ident, instructions);
+
+	ThreadLock	lock(mMutex);
+	mTimers.Push(timer);
+
+	return timer;
+}
+
+void TimeReport::CollectPasses(ExpandingArray<PassTimer::Pass>& passes, ExpandingArray<const char*>& phases)
+{
+	for (int i = 0; i < mTimers.Size(); i++)
+	{
+		const PassTimer* timer = mTimers[i];
+		for (int j = 0; j < timer->mPasses.Size(); j++)
+		{
+			const PassTimer::Pass& tpass(timer->mPasses[j]);
+
+			int	k = 0;
+			while (k < passes.Size() && !(passes[k].mStep == tpass.mStep && !strcmp(passes[k].mName, tpass.mName) && !strcmp(phases[k], timer->mPhase)))
+				k++;
+
+			if (k == passes.Size())
+			{
+				PassTimer::Pass	pass(tpass);
+				pass.mCount = 0;
+				pass.mChanged = 0;
+				pass.mTime = 0;
+				passes.Push(pass);
+				phases.Push(timer->mPhase);
+			}
+
+			passes[k].mCount += tpass.mCount;
+			passes[k].mChanged += tpass.mChanged;
+			passes[k].mTime += tpass.mTime;
+		}
+	}
+}
+
+static void PrintPassName(FILE* file, const char* phase, const PassTimer::Pass& pass)
+{
+	char	name[120];
+	if (pass.mStep >= 0)
+		snprintf(name, sizeof(name), "%s: %s %d", phase, pass.mName, pass.mStep);
+	else
+		snprintf(name, sizeof(name), "%s: %s", phase, pass.mName);
+	fprintf(file, "%-40s", name);
+}
+
+void TimeReport::Print(FILE* file, int top)
+{
+	ExpandingArray<PassTimer::Pass>	passes;
+	ExpandingArray<const char*>		phases;
+
+	CollectPasses(passes, phases);
+
+	double	total = 0;
+	for (int i = 0; i < mTimers.Size(); i++)
+		total += mTimers[i]->mTime;
+
+	ExpandingArray<int>	order;
+	for (int i = 0; i < passes.Size(); i++)
+		order.Push(i);
+	if (order.Size() > 0)
+		std::sort(&order[0], &order[0] + order.Size(), [&](int a, int b) { return passes[a].mTime > passes[b].mTime; });
+
+	fprintf(file, "Time report, %.3fs in %d procedures\n", total, mTimers.Size());
+	fprintf(file, "\nPass                                         Time   Iter  Changed\n");
+	for (int i = 0; i < order.Size() && i < top; i++)
+	{
+		const PassTimer::Pass& pass(passes[order[i]]);
+		PrintPassName(file, phases[order[i]], pass);
+		fprintf(file, " %9.3fs %6d %8d\n", pass.mTime, pass.mCount, pass.mChanged);
+	}
+
+	ExpandingArray<PassTimer*>	timers;
+	for (int i = 0; i < mTimers.Size(); i++)
+		timers.Push(mTimers[i]);
+	if (timers.Size() > 0)
+		std::sort(&timers[0], &timers[0] + timers.Size(), [](const PassTimer* a, const PassTimer* b) { return a->mTime > b->mTime; });
+
+	fprintf(file, "\nProcedure                                    Time   Slowest pass\n");
+	for (int i = 0; i < timers.Size() && i < top; i++)
+	{
+		const PassTimer* timer = timers[i];
+
+		char	name[120];
+		snprintf(name, sizeof(name), "%s: %s", timer->mPhase, timer->mIdent ? timer->mIdent->mString : "-");
+		fprintf(file, "%-40s %9.3fs  ", name, timer->mTime);
+
+		int	k = -1;
+		for (int j = 0; j < timer->mPasses.Size(); j++)
+			if (k < 0 || timer->mPasses[j].mTime > timer->mPasses[k].mTime)
+				k = j;
+		if (k >= 0)
+		{
+			const PassTimer::Pass& pass(timer->mPasses[k]);
+			if (pass.mStep >= 0)
+				fprintf(file, "%s %d (%.3fs)\n", pass.mName, pass.mStep, pass.mTime);
+			else
+				fprintf(file, "%s (%.3fs)\n", pass.mName, pass.mTime);
+		}
+		else
+			fprintf(file, "\n");
+	}
+}
+
+static void WriteJSONString(FILE* file, const char* str)
+{
+	fputc('"', file);
+	while (*str)
+	{
+		unsigned char	c = *str++;
+		if (c == '"' || c == '\\')
+			fprintf(file, "\\%c", c);
+		else if (c < 32)
+			fprintf(file, "\\u%04x", c);
+		else
+			fputc(c, file);
+	}
+	fputc('"', file);
+}
+
+static void WriteJSONPass(FILE* file, const char* phase, const PassTimer::Pass& pass)
+{
+	fprintf(file, "{");
+	if (phase)
+	{
+		fprintf(file, "\"phase\": ");
+		WriteJSONString(file, phase);
+		fprintf(file, ", ");
+	}
+	fprintf(file, "\"name\": ");
+	WriteJSONString(file, pass.mName);
+	if (pass.mStep >= 0)
+		fprintf(file, ", \"step\": %d", pass.mStep);
+	fprintf(file, ", \"time\": %f, \"iterations\": %d, \"changed\": %d}", pass.mTime, pass.mCount, pass.mChanged);
+}
+
+bool TimeReport::WriteJSON(const char* filename)
+{
+	FILE* file;
+	fopen_s(&file, filename, "wb");
+	if (file)
+	{
+		ExpandingArray<PassTimer::Pass>	passes;
+		ExpandingArray<const char*>		phases;
+
+		CollectPasses(passes, phases);
+
+		fprintf(file, "{\n\t\"passes\": [");
+		for (int i = 0; i < passes.Size(); i++)
+		{
+			fprintf(file, i > 0 ? ",\n\t\t" : "\n\t\t");
+			WriteJSONPass(file, phases[i], passes[i]);
+		}
+		fprintf(file, "\n\t],\n\t\"procedures\": [");
+
+		for (int i = 0; i < mTimers.Size(); i++)
+		{
+			const PassTimer* timer = mTimers[i];
+
+			fprintf(file, i > 0 ? ",\n\t\t" : "\n\t\t");
+			fprintf(file, "{\"name\": ");
+			WriteJSONString(file, timer->mIdent ? timer->mIdent->mString : "");
+			fprintf(file, ", \"phase\": ");
+			WriteJSONString(file, timer->mPhase);
+			fprintf(file, ", \"time\": %f, \"instructions\": %d, \"passes\": [", timer->mTime, timer->mInstructions);
+			for (int j = 0; j < timer->mPasses.Size(); j++)
+			{
+				fprintf(file, j > 0 ? ",\n\t\t\t" : "\n\t\t\t");
+				WriteJSONPass(file, nullptr, timer->mPasses[j]);
+			}
+			fprintf(file, "\n\t\t]}");
+		}
+		fprintf(file, "\n\t]\n}\n");
+
+		fclose(file);
+		return true;
+	}
+	else
+		return false;
+}
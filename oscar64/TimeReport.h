@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Array.h"
+#include "Ident.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <stdio.h>
+
+// Wall time, iterations and instruction count changes of the optimizer
+// passes of a single procedure.  A pass starts at the previous mark and
+// ends at its own mark, repeated passes are accumulated.
+
+class PassTimer
+{
+public:
+	PassTimer(const char* phase, const Ident* ident, int instructions);
+
+	void Mark(const char* name, int step, int instructions);
+
+	struct Pass
+	{
+		const char	*	mName;
+		int				mStep, mCount, mChanged;
+		double			mTime;
+	};
+
+	const char			*	mPhase;
+	const Ident			*	mIdent;
+	ExpandingArray<Pass>	mPasses;
+	double					mTime;
+	int						mInstructions;
+
+protected:
+	std::chrono::steady_clock::time_point	mLast;
+};
+
+// Collects the pass timers of all procedures of a compilation
+
+class TimeReport
+{
+public:
+	TimeReport(void);
+	~TimeReport(void);
+
+	PassTimer* Start(const char* phase, const Ident* ident, int instructions);
+
+	void Print(FILE* file, int top);
+	bool WriteJSON(const char* filename);
+
+protected:
+	ThreadMutex					mMutex;
+	ExpandingArray<PassTimer*>	mTimers;
+
+	void CollectPasses(ExpandingArray<PassTimer::Pass>& passes, ExpandingArray<const char*>& phases);
+};
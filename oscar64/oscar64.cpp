@@ -14,6 +14,7 @@
 #include "Compiler.h"
 #include "DiskImage.h"
 #include <time.h>
+#include <chrono>
 
 #ifdef _WIN64
 #include <Dbghelp.h>
@@ -77,7 +78,12 @@ void writeHelp(void)
 	printf("-o  : optional output file name\n");
 	printf("-rt : alternative runtime library, replaces the crt.c(or empty for none)\n");
 	printf("-e  : execute the result in the integrated emulator\n");
-	printf("-ep : execute and profile the result in the integrated emulator\n");
+	printf("-em : execute with the C64 timing model, pal or ntsc, with bad lines, sprite DMA and raster interrupts\n");
+	printf("-e-snap=<file> : execute and save a snapshot of the emulator at the trigger given with -e-at\n");
+	printf("-e-at=<trigger> : snapshot trigger, a cycle count, an address $xxxx, a native function or breakpoint (default)\n");
+	printf("-e-reu=<kb> : execute with a RAM expansion unit of the given size in KB at $df00\n");
+	printf("-e-from=<file> : execute from a snapshot of the same program instead of the start, combines with -ep\n");
+	printf("-ep : execute and profile the result in the integrated emulator, writes the call tree to .calls.json and .folded files, with -g a source line profile to a .lines file\n");
 	printf("-bc : create byte code for all functions\n");
 	printf("-n  : create pure native code for all functions(now default)\n");
 	printf("-d  : define a symbol(e.g.NOFLOAT or NOLONG to avoid float / long code in printf)\n");
@@ -91,6 +97,7 @@ void writeHelp(void)
 	printf("-Oa : optimize inline assembler(part of O2 / O3)\n");
 	printf("-Oa : optimize inline assembler(part of O2 / O3)\n");
 	printf("-Oz : enable auto placement of global variables in zero page(part of O3)\n");
+	printf("-zph=<file> : place global variables in zero page by the cycles saved in a profiled run(.zp file of -ep), implies -Oz\n");
 	printf("-Op : optimize constant parameters\n");
 	printf("-Oo : optimize size using \"outliner\" (extract repeated code sequences into functions)\n");
 	printf("-Ox : optimize pointer arithmetic by blocking shorter arrays to not cross page boundaries\n");
@@ -98,6 +105,7 @@ void writeHelp(void)
 	printf("-gp : create source level debug info and add source line numbers to asm listing and static profile data\n");
 	printf("-tf : target format, may be prg, crt or bin\n");
 	printf("-tm : target machine\n");
+	printf("-cpu : target cpu, may be 6502, 65c02 or 45gs02 for mega65, defaults to 65c02 for x16\n");
 	printf("-d64 : create a d64 disk image\n");
 	printf("-f  : add a binary file to the disk image\n");
 	printf("-fz : add a compressed binary file to the disk image\n");
@@ -110,652 +118,1120 @@ void writeHelp(void)
 	printf("-strict : use strict ANSI C parsing(no C++ goodies)\n");
 	printf("-psci : use PETSCII encoding for all strings without prefix\n");
 	printf("-rmp : generate error files: .error.map and .error.asm when linker fails\n");
+	printf("-j  : number of threads used for optimization and code generation(e.g. -j 8 or -j=8)\n");
+	printf("-cache=<dir> : reuse generated native code of unchanged functions from a cache directory\n");
+	printf("-time-report : print the time spent in each optimizer pass and write it to a .time.json file\n");
+	printf("-bench=<file> : execute the result and append cycles, code size and compile time as a JSON line to a file\n");
+	printf("-benchbase=<file> : compare the benchmark result against a baseline file and fail on regressions\n");
+	printf("-fprofile-generate=<file> : execute the result and write the calls and cycles of each function and the zero page candidates to a profile\n");
+	printf("-fprofile-use=<file> : use a profile to compile hot functions native and for speed, unused functions for size, and to place variables in zero page\n");
+	printf("-batch=<file> : compile and run each line of a file as a separate compilation in parallel\n");
+	printf("-junit=<file> : write the batch results as JUnit XML\n");
+	printf("-json=<file> : write the batch results as JSON\n");
 }
 
-int main2(int argc, const char** argv)
+static int CompileProgram(int argc, const char** argv, const char* basePath, const char* strProductName, const char* strProductVersion, FILE* output)
 {
-	InitDeclarations();
-	InitAssembler();
+	char	crtPath[200], includePath[200], targetPath[200], diskPath[200];
+	int		dataFileInterleave = 10;
 
-	if (argc > 1)
-	{
-		char	basePath[200], crtPath[200], includePath[200], targetPath[200], diskPath[200];
-		char	strProductName[100], strProductVersion[200];
-		int		dataFileInterleave = 10;
-
-#ifdef _WIN32
-			GetProductAndVersion(strProductName, strProductVersion);
+	Compiler* compiler = new Compiler();
 
-			DWORD length = ::GetModuleFileNameA(NULL, basePath, sizeof(basePath));
-
-#else
-		strcpy(strProductName, "oscar64");
-		strcpy(strProductVersion, "1.32.273");
-
-#ifdef __APPLE__
-		uint32_t length = sizeof(basePath);
-
-		_NSGetExecutablePath(basePath, &length);
-		length = strlen(basePath);
-#else
-#ifdef __FreeBSD__
-		size_t length = 200;
-		int oid[4] = {CTL_KERN, KERN_PROC, KERN_PROC_PATHNAME, -1};
-		if (sysctl((const int *)&oid[0], 4, basePath, &length, NULL, 0) < 0) {
-		  length = 0;
-		}
-#else
-#ifdef __amigaos__
-		int length = 0;
-		strcpy(basePath, "PROGDIR:");
-#else
-		int length = readlink("/proc/self/exe", basePath, sizeof(basePath));
+	compiler->mCompilerOptions |= COPT_NATIVE;
 
-		//		strcpy(basePath, argv[0]);
-		//		int length = strlen(basePath);
-#endif
-#endif
-#endif
-#endif
-		while (length > 0 && basePath[length - 1] != '/' && basePath[length - 1] != '\\')
-			length--;
+	// A job of a batch reports into its own output and does not write any
+	// files unless an output file is given explicitly
 
-		if (length > 0)
-		{
-			length--;
-			while (length > 0 && basePath[length - 1] != '/' && basePath[length - 1] != '\\')
-				length--;
-		}
+	bool	writeFiles = true;
+	if (output)
+	{
+		compiler->mOutput = output;
+		compiler->mErrors->mOutput = output;
+		compiler->mErrors->mExitOnErrors = false;
+		compiler->mSharedZeroPage = true;
+		writeFiles = false;
+	}
 
-		basePath[length] = 0;
+	Location	loc;
 
-		Compiler* compiler = new Compiler();
+	GrowingArray<const char*>	dataFiles(nullptr);
+	GrowingArray<bool>			dataFileCompressed(false);
 
-		compiler->mCompilerOptions |= COPT_NATIVE;
+	bool		emulate = false, profile = false, customCRT = false, asserts = false, iorange = false, showHelp = false, hasSources = false;
+	int			trace = 0, vicmodel = VICM_NONE;
 
-		Location	loc;
+	char	benchPath[200], benchBase[200], benchOptions[100], profilePath[200];
+	benchPath[0] = 0;
+	profilePath[0] = 0;
+	benchBase[0] = 0;
+	benchOptions[0] = 0;
 
-		GrowingArray<const char*>	dataFiles(nullptr);
-		GrowingArray<bool>			dataFileCompressed(false);
+	compiler->mPreprocessor->AddPath(basePath);
+	strcpy_s(includePath, basePath);
+	strcat_s(includePath, "include");
 
-		bool		emulate = false, profile = false, customCRT = false, asserts = false, iorange = false, showHelp = false, hasSources = false;
-		int			trace = 0;
+	targetPath[0] = 0;
+	diskPath[0] = 0;
 
-		compiler->mPreprocessor->AddPath(basePath);
-		strcpy_s(includePath, basePath);
-		strcat_s(includePath, "include");
+	char	targetFormat[20];
+	strcpy_s(targetFormat, "prg");
 
-		targetPath[0] = 0;
-		diskPath[0] = 0;
+	char	targetMachine[20];
+	strcpy_s(targetMachine, "c64");
 
-		char	targetFormat[20];
-		strcpy_s(targetFormat, "prg");
+	char	targetCPU[20];
+	targetCPU[0] = 0;
 
-		char	targetMachine[20];
-		strcpy_s(targetMachine, "c64");
+	compiler->AddDefine(Ident::Unique("__OSCAR64C__"), "1");
+	compiler->AddDefine(Ident::Unique("__STDC__"), "1");
+	compiler->AddDefine(Ident::Unique("__STDC_VERSION__"), "199901L");
 
-		compiler->AddDefine(Ident::Unique("__OSCAR64C__"), "1");
-		compiler->AddDefine(Ident::Unique("__STDC__"), "1");
-		compiler->AddDefine(Ident::Unique("__STDC_VERSION__"), "199901L");
+	bool	defining = false;
 
-		bool	defining = false;
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (defining)
+		{
+			defining = false;
 
-		for (int i = 1; i < argc; i++)
+			char	def[100];
+			int i = 0;
+			while (arg[i] && arg[i] != '=')
+			{
+				def[i] = arg[i];
+				i++;
+			}
+			def[i] = 0;
+			if (arg[i] == '=')
+				compiler->AddDefine(Ident::Unique(def), _strdup(arg + i + 1));
+			else
+				compiler->AddDefine(Ident::Unique(def), "");
+		}
+		else if (arg[0] == '-')
 		{
-			const char* arg = argv[i];
-			if (defining)
+			if (arg[1] == 'O' || (arg[1] == 'n' && !arg[2]) || (arg[1] == 'b' && arg[2] == 'c' && !arg[3]) || (arg[1] == 't' && arg[2] == 'm') || (arg[1] == 'x' && arg[2] == 'z'))
 			{
-				defining = false;
+				if (benchOptions[0])
+					strcat_s(benchOptions, " ");
+				strcat_s(benchOptions, arg);
+			}
 
+			if (arg[1] == 'i' && arg[2] == '=')
+			{
+				compiler->mPreprocessor->AddPath(arg + 3);
+			}
+			else if (arg[1] == 'i' && arg[2] == 'i' && arg[3] == '=')
+			{
+				strcpy_s(includePath, arg + 4);
+			}
+			else if (arg[1] == 'f' && arg[2] == '=')
+			{
+				dataFiles.Push(arg + 3);
+				dataFileCompressed.Push(false);
+			}
+			else if (arg[1] == 'f' && arg[2] == 'z' && arg[3] == '=')
+			{
+				dataFiles.Push(arg + 4);
+				dataFileCompressed.Push(true);
+			}
+			else if (arg[1] == 'f' && arg[2] == 'i' && arg[3] == '=')
+			{
+				dataFileInterleave = atoi(arg + 4);
+			}
+			else if (arg[1] == 'o' && arg[2] == '=')
+			{
+				strcpy_s(targetPath, arg + 3);
+				writeFiles = true;
+			}
+			else if (arg[1] == 'r' && arg[2] == 't' && arg[3] == '=')
+			{
+				strcpy_s(crtPath, arg + 4);
+				customCRT = true;
+			}
+			else if (arg[1] == 'd' && arg[2] == '6' && arg[3] == '4' && arg[4] == '=')
+			{
+				strcpy_s(diskPath, arg + 5);
+			}
+			else if (arg[1] == 't' && arg[2] == 'f' && arg[3] == '=')
+			{
+				strcpy_s(targetFormat, arg + 4);
+			}
+			else if (arg[1] == 't' && arg[2] == 'm' && arg[3] == '=')
+			{
+				strcpy_s(targetMachine, arg + 4);
+			}
+			else if (arg[1] == 'c' && arg[2] == 'p' && arg[3] == 'u' && arg[4] == '=')
+			{
+				strcpy_s(targetCPU, arg + 5);
+			}
+			else if (arg[1] == 'c' && arg[2] == 'i' && arg[3] == 'd' && arg[4] == '=')
+			{
+				char	cid[10];
+				strcpy_s(cid, arg + 5);
+				compiler->mCartridgeID = atoi(cid);
+			}
+			else if (arg[1] == 'c' && arg[2] == 's' && arg[3] == 'u' && arg[4] == 'b' && arg[5] == '=')
+			{
+				char	cid[10];
+				strcpy_s(cid, arg + 6);
+				compiler->mCartridgeSubType = atoi(cid);
+			}
+			else if (arg[1] == 'c' && arg[2] == 'n' && arg[3] == 'a' && arg[4] == 'm' && arg[5] == 'e' && arg[6] == '=')
+			{
+				strcpy_s(compiler->mCartridgeName, arg + 7);
+			}
+			else if (arg[1] == 'n' && arg[2] == 0)
+			{
+				compiler->mCompilerOptions |= COPT_NATIVE;
+			}
+			else if (arg[1] == 'b' && arg[2] == 'c' && arg[3] == 0)
+			{
+				compiler->mCompilerOptions &= ~COPT_NATIVE;
+			}
+			else if (arg[1] == 'p' && arg[2] == 's' && arg[3] == 'c' && arg[4] == 'i' && arg[5] == 0)
+			{
+				compiler->mCompilerOptions |= COPT_PETSCII;
+				compiler->AddDefine(Ident::Unique("__PETSCII__"), "1");
+			}
+			else if (arg[1] == 'O')
+			{
+				if (arg[2] == '0' && !arg[3])
+					compiler->mCompilerOptions &= ~(COPT_OPTIMIZE_ALL);
+				else if (arg[2] == '1' && !arg[3] || arg[2] == 0)
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_DEFAULT;
+				else if (arg[2] == '2' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_SPEED;
+				else if (arg[2] == '3' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_ALL;
+				else if (arg[2] == 's' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_SIZE;
+				else if (arg[2] == 'a' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_ASSEMBLER;
+				else if (arg[2] == 'i' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_INLINE;
+				else if (arg[2] == 'i' && arg[3] == 'i' && !arg[4])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_INLINE | COPT_OPTIMIZE_AUTO_INLINE_ALL;
+				else if (arg[2] == 'z' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_ZEROPAGE;
+				else if (arg[2] == 'p' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_CONST_PARAMS;
+				else if (arg[2] == 'g' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_GLOBAL;
+				else if (arg[2] == 'm' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_MERGE_CALLS;
+				else if (arg[2] == 'o' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_OUTLINE;
+				else if (arg[2] == 'x' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_PAGE_CROSSING;
+				else if (arg[2] == 'M' && !arg[3])
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_SELF_MOD;
+				else
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
+			}
+			else if (!strncmp(arg, "-e-snap=", 8))
+			{
+				strcpy_s(compiler->mSnapshotSave, arg + 8);
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-e-at=", 6))
+			{
+				strcpy_s(compiler->mSnapshotAt, arg + 6);
+			}
+			else if (!strncmp(arg, "-e-reu=", 7))
+			{
+				int	size = atoi(arg + 7);
+				if (size >= 128 && size <= 16384 && !(size & (size - 1)))
+					compiler->mREUSize = size;
+				else
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid REU size", arg);
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-e-from=", 8))
+			{
+				strcpy_s(compiler->mSnapshotFrom, arg + 8);
+				emulate = true;
+			}
+			else if (arg[1] == 'e' && arg[2] == 'm' && arg[3] == '=')
+			{
+				emulate = true;
+				if (!strcmp(arg + 4, "pal"))
+					vicmodel = VICM_PAL;
+				else if (!strcmp(arg + 4, "ntsc"))
+					vicmodel = VICM_NTSC;
+				else
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid emulator timing model", arg);
+			}
+			else if (arg[1] == 'e')
+			{
+				emulate = true;
+				int i = 2;
+				while (arg[i])
+				{
+					if (arg[i] == 'p')
+						profile = true;
+					else if (arg[i] == 't')
+						trace = 2;
+					else if (arg[i] == 'b')
+						trace = 1;
+					else if (arg[i] == 'a')
+						asserts = true;
+					else if (arg[i] == 'i')
+						iorange = true;
+					i++;
+				}
+			}
+			else if (arg[1] == 'D' && !arg[2])
+			{
+				defining = true;
+			}
+			else if (arg[1] == 'd' || arg[1] == 'D')
+			{
 				char	def[100];
-				int i = 0;
+				int i = 2;
 				while (arg[i] && arg[i] != '=')
 				{
-					def[i] = arg[i];
+					def[i - 2] = arg[i];
 					i++;
 				}
-				def[i] = 0;
+				def[i - 2] = 0;
 				if (arg[i] == '=')
 					compiler->AddDefine(Ident::Unique(def), _strdup(arg + i + 1));
 				else
 					compiler->AddDefine(Ident::Unique(def), "");
 			}
-			else if (arg[0] == '-')
+			else if (arg[1] == 'g' && !arg[2])
 			{
-				if (arg[1] == 'i' && arg[2] == '=')
-				{
-					compiler->mPreprocessor->AddPath(arg + 3);
-				}
-				else if (arg[1] == 'i' && arg[2] == 'i' && arg[3] == '=')
-				{
-					strcpy_s(includePath, arg + 4);
-				}
-				else if (arg[1] == 'f' && arg[2] == '=')
-				{
-					dataFiles.Push(arg + 3);
-					dataFileCompressed.Push(false);
-				}
-				else if (arg[1] == 'f' && arg[2] == 'z' && arg[3] == '=')
-				{
-					dataFiles.Push(arg + 4);
-					dataFileCompressed.Push(true);
-				}
-				else if (arg[1] == 'f' && arg[2] == 'i' && arg[3] == '=')
-				{
-					dataFileInterleave = atoi(arg + 4);
-				}
-				else if (arg[1] == 'o' && arg[2] == '=')
-				{
-					strcpy_s(targetPath, arg + 3);
-				}
-				else if (arg[1] == 'r' && arg[2] == 't' && arg[3] == '=')
-				{
-					strcpy_s(crtPath, arg + 4);
-					customCRT = true;
-				}
-				else if (arg[1] == 'd' && arg[2] == '6' && arg[3] == '4' && arg[4] == '=')
-				{
-					strcpy_s(diskPath, arg + 5);
-				}
-				else if (arg[1] == 't' && arg[2] == 'f' && arg[3] == '=')
-				{
-					strcpy_s(targetFormat, arg + 4);
-				}
-				else if (arg[1] == 't' && arg[2] == 'm' && arg[3] == '=')
-				{
-					strcpy_s(targetMachine, arg + 4);
-				}
-				else if (arg[1] == 'c' && arg[2] == 'i' && arg[3] == 'd' && arg[4] == '=')
-				{
-					char	cid[10];
-					strcpy_s(cid, arg + 5);
-					compiler->mCartridgeID = atoi(cid);
-				}
-				else if (arg[1] == 'c' && arg[2] == 's' && arg[3] == 'u' && arg[4] == 'b' && arg[5] == '=')
-				{
-					char	cid[10];
-					strcpy_s(cid, arg + 6);
-					compiler->mCartridgeSubType = atoi(cid);
-				}
-				else if (arg[1] == 'c' && arg[2] == 'n' && arg[3] == 'a' && arg[4] == 'm' && arg[5] == 'e' && arg[6] == '=')
-				{
-					strcpy_s(compiler->mCartridgeName, arg + 7);
-				}
-				else if (arg[1] == 'n' && arg[2] == 0)
-				{
-					compiler->mCompilerOptions |= COPT_NATIVE;
-				}
-				else if (arg[1] == 'b' && arg[2] == 'c' && arg[3] == 0)
-				{
-					compiler->mCompilerOptions &= ~COPT_NATIVE;
-				}
-				else if (arg[1] == 'p' && arg[2] == 's' && arg[3] == 'c' && arg[4] == 'i' && arg[5] == 0)
-				{
-					compiler->mCompilerOptions |= COPT_PETSCII;
-					compiler->AddDefine(Ident::Unique("__PETSCII__"), "1");
-				}
-				else if (arg[1] == 'O')
-				{
-					if (arg[2] == '0' && !arg[3])
-						compiler->mCompilerOptions &= ~(COPT_OPTIMIZE_ALL);
-					else if (arg[2] == '1' && !arg[3] || arg[2] == 0)
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_DEFAULT;
-					else if (arg[2] == '2' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_SPEED;
-					else if (arg[2] == '3' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_ALL;
-					else if (arg[2] == 's' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_SIZE;
-					else if (arg[2] == 'a' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_ASSEMBLER;
-					else if (arg[2] == 'i' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_INLINE;
-					else if (arg[2] == 'i' && arg[3] == 'i' && !arg[4])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_INLINE | COPT_OPTIMIZE_AUTO_INLINE_ALL;
-					else if (arg[2] == 'z' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_ZEROPAGE;
-					else if (arg[2] == 'p' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_CONST_PARAMS;
-					else if (arg[2] == 'g' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_GLOBAL;
-					else if (arg[2] == 'm' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_MERGE_CALLS;
-					else if (arg[2] == 'o' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_OUTLINE;
-					else if (arg[2] == 'x' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_PAGE_CROSSING;
-					else if (arg[2] == 'M' && !arg[3])
-						compiler->mCompilerOptions |= COPT_OPTIMIZE_SELF_MOD;
-					else
-						compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
-				}
-				else if (arg[1] == 'e')
-				{
-					emulate = true;
-					int i = 2;
-					while (arg[i])
-					{
-						if (arg[i] == 'p')
-							profile = true;
-						else if (arg[i] == 't')
-							trace = 2;
-						else if (arg[i] == 'b')
-							trace = 1;
-						else if (arg[i] == 'a')
-							asserts = true;
-						else if (arg[i] == 'i')
-							iorange = true;
-						i++;
-					}
-				}
-				else if (arg[1] == 'D' && !arg[2])
-				{
-					defining = true;
-				}
-				else if (arg[1] == 'd' || arg[1] == 'D')
-				{
-					char	def[100];
-					int i = 2;
-					while (arg[i] && arg[i] != '=')
-					{
-						def[i - 2] = arg[i];
-						i++;
-					}
-					def[i - 2] = 0;
-					if (arg[i] == '=')
-						compiler->AddDefine(Ident::Unique(def), _strdup(arg + i + 1));
-					else
-						compiler->AddDefine(Ident::Unique(def), "");
-				}
-				else if (arg[1] == 'g' && !arg[2])
-				{
-					compiler->mCompilerOptions |= COPT_DEBUGINFO;
-				}
-				else if (arg[1] == 'g' && arg[2] == 'p' && !arg[3])
-				{
-					compiler->mCompilerOptions |= COPT_DEBUGINFO | COPT_PROFILEINFO;
-				}
-				else if (arg[1] == 'h' && !arg[2])
-				{
-					showHelp = true;
-				}
-				else if (arg[1] == 'v')
-				{
-					compiler->mCompilerOptions |= COPT_VERBOSE;
-					if (arg[2] == '1')
-						;
-					else if (arg[2] == '2')
-						compiler->mCompilerOptions |= COPT_VERBOSE2;
-					else if (arg[2] == '3')
-						compiler->mCompilerOptions |= COPT_VERBOSE2 | COPT_VERBOSE3;
-					else if (arg[2])
-						compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
-				}
-				else if (arg[1] == 'x' && arg[2] == 'z' && !arg[3])
-				{
-					compiler->mCompilerOptions |= COPT_EXTENDED_ZERO_PAGE;
-				}
-				else if (arg[1] == 'p' && arg[2] == 'p' && !arg[3])
-				{
-					compiler->mCompilerOptions |= COPT_CPLUSPLUS;
-					compiler->AddDefine(Ident::Unique("__cplusplus"), "1");
-					compiler->AddDefine(Ident::Unique("__cplusplus__"), "1");
+				compiler->mCompilerOptions |= COPT_DEBUGINFO;
+			}
+			else if (arg[1] == 'g' && arg[2] == 'p' && !arg[3])
+			{
+				compiler->mCompilerOptions |= COPT_DEBUGINFO | COPT_PROFILEINFO;
+			}
+			else if (arg[1] == 'h' && !arg[2])
+			{
+				showHelp = true;
+			}
+			else if (arg[1] == 'v')
+			{
+				compiler->mCompilerOptions |= COPT_VERBOSE;
+				if (arg[2] == '1')
+					;
+				else if (arg[2] == '2')
+					compiler->mCompilerOptions |= COPT_VERBOSE2;
+				else if (arg[2] == '3')
+					compiler->mCompilerOptions |= COPT_VERBOSE2 | COPT_VERBOSE3;
+				else if (arg[2])
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
+			}
+			else if (arg[1] == 'x' && arg[2] == 'z' && !arg[3])
+			{
+				compiler->mCompilerOptions |= COPT_EXTENDED_ZERO_PAGE;
+			}
+			else if (arg[1] == 'p' && arg[2] == 'p' && !arg[3])
+			{
+				compiler->mCompilerOptions |= COPT_CPLUSPLUS;
+				compiler->AddDefine(Ident::Unique("__cplusplus"), "1");
+				compiler->AddDefine(Ident::Unique("__cplusplus__"), "1");
+			}
+			else if (arg[1] == 's' && arg[2] == 't' && arg[3] == 'r' && arg[4] == 'i' && arg[5] == 'c' && arg[6] == 't' && !arg[7])
+			{
+				compiler->mCompilerOptions |= COPT_STRICT;
+				compiler->AddDefine(Ident::Unique("__strict__"), "1");
 				}
-				else if (arg[1] == 's' && arg[2] == 't' && arg[3] == 'r' && arg[4] == 'i' && arg[5] == 'c' && arg[6] == 't' && !arg[7])
-				{
-					compiler->mCompilerOptions |= COPT_STRICT;
-					compiler->AddDefine(Ident::Unique("__strict__"), "1");
-					}
-				else if (arg[1] == 'r' && arg[2] == 'm' && arg[3] == 'p' && !arg[4])
+			else if (arg[1] == 'r' && arg[2] == 'm' && arg[3] == 'p' && !arg[4])
+			{
+				compiler->mCompilerOptions |= COPT_ERROR_FILES;
+			}
+			else if (arg[1] == 'j')
+			{
+				const char* num = arg + 2;
+				if (num[0] == '=')
+					num++;
+				else if (!num[0] && i + 1 < argc)
+					num = argv[++i];
+
+				compiler->mThreads = atoi(num);
+				if (compiler->mThreads < 1)
+					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid number of threads", arg);
+			}
+			else if (arg[1] == 'c' && arg[2] == 'a' && arg[3] == 'c' && arg[4] == 'h' && arg[5] == 'e' && arg[6] == '=' && arg[7])
+			{
+				compiler->mCache = new CompilationCache(arg + 7);
+				if (!compiler->mCache->Open(compiler->mErrors))
 				{
-					compiler->mCompilerOptions |= COPT_ERROR_FILES;
+					delete compiler->mCache;
+					compiler->mCache = nullptr;
 				}
-				else
-					compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
+			}
+			else if (!strncmp(arg, "-bench=", 7))
+			{
+				strcpy_s(benchPath, arg + 7);
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-benchbase=", 11))
+			{
+				strcpy_s(benchBase, arg + 11);
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-fprofile-generate=", 19))
+			{
+				strcpy_s(profilePath, arg + 19);
+				emulate = true;
+			}
+			else if (!strncmp(arg, "-fprofile-use=", 14))
+			{
+				if (compiler->mGlobalAnalyzer->LoadProfile(arg + 14))
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_ZEROPAGE;
+			}
+			else if (!strncmp(arg, "-zph=", 5))
+			{
+				if (compiler->mGlobalAnalyzer->LoadZeroPageHints(arg + 5))
+					compiler->mCompilerOptions |= COPT_OPTIMIZE_AUTO_ZEROPAGE;
+			}
+			else if (!strcmp(arg, "-time-report"))
+			{
+				if (!compiler->mTimeReport)
+					compiler->mTimeReport = new TimeReport();
 			}
 			else
+				compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid command line argument", arg);
+		}
+		else
+		{
+			if (!targetPath[0])
+				strcpy_s(targetPath, argv[i]);
+
+			ptrdiff_t n = strlen(argv[i]);
+			if (n > 4 && argv[i][n - 4] == '.' && argv[i][n - 3] == 'c' && argv[i][n - 2] == 'p' && argv[i][n - 1] == 'p')
 			{
-				if (!targetPath[0])
-					strcpy_s(targetPath, argv[i]);
+				compiler->mCompilerOptions |= COPT_CPLUSPLUS;
+				compiler->AddDefine(Ident::Unique("__cplusplus"), "1");
+				compiler->AddDefine(Ident::Unique("__cplusplus__"), "1");
+			}
 
-				ptrdiff_t n = strlen(argv[i]);
-				if (n > 4 && argv[i][n - 4] == '.' && argv[i][n - 3] == 'c' && argv[i][n - 2] == 'p' && argv[i][n - 1] == 'p')
-				{
-					compiler->mCompilerOptions |= COPT_CPLUSPLUS;
-					compiler->AddDefine(Ident::Unique("__cplusplus"), "1");
-					compiler->AddDefine(Ident::Unique("__cplusplus__"), "1");
-				}
+			compiler->mCompilationUnits->AddUnit(loc, argv[i], nullptr);
+
+			hasSources = true;
+		}
+	}
+
+	if (compiler->mCompilerOptions & COPT_NATIVE)
+	{
+		compiler->AddDefine(Ident::Unique("OSCAR_NATIVE_ALL"), "1");
+	}
+
+
+	// REMOVE ME
+	// compiler->mCompilerOptions |= COPT_OPTIMIZE_GLOBAL;
+	// REMOVE ME
+
+	char	basicStart[10];
+	strcpy_s(basicStart, "0x0801");
+
+	if (!strcmp(targetMachine, "c64"))
+	{
+		compiler->mTargetMachine = TMACH_C64;
+		compiler->AddDefine(Ident::Unique("__C64__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "c128"))
+	{
+		strcpy_s(basicStart, "0x1c01");
+		compiler->mTargetMachine = TMACH_C128;
+		compiler->AddDefine(Ident::Unique("__C128__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "c128b"))
+	{
+		strcpy_s(basicStart, "0x1c01");
+		compiler->mTargetMachine = TMACH_C128B;
+		compiler->AddDefine(Ident::Unique("__C128B__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "c128e"))
+	{
+		strcpy_s(basicStart, "0x1c01");
+		compiler->mTargetMachine = TMACH_C128E;
+		compiler->AddDefine(Ident::Unique("__C128E__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "vic20"))
+	{
+		strcpy_s(basicStart, "0x1001");
+		compiler->mTargetMachine = TMACH_VIC20;
+		compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "vic20+3"))
+	{
+		strcpy_s(basicStart, "0x0401");
+		compiler->mTargetMachine = TMACH_VIC20_3K;
+		compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "vic20+8"))
+	{
+		strcpy_s(basicStart, "0x1201");
+		compiler->mTargetMachine = TMACH_VIC20_8K;
+		compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "vic20+16"))
+	{
+		strcpy_s(basicStart, "0x1201");
+		compiler->mTargetMachine = TMACH_VIC20_16K;
+		compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "vic20+24"))
+	{
+		strcpy_s(basicStart, "0x1201");
+		compiler->mTargetMachine = TMACH_VIC20_24K;
+		compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "pet"))
+	{
+		strcpy_s(basicStart, "0x0401");
+		compiler->mTargetMachine = TMACH_PET_8K;
+		compiler->AddDefine(Ident::Unique("__CBMPET__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "pet16"))
+	{
+		strcpy_s(basicStart, "0x0401");
+		compiler->mTargetMachine = TMACH_PET_16K;
+		compiler->AddDefine(Ident::Unique("__CBMPET__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "pet32"))
+	{
+		strcpy_s(basicStart, "0x0401");
+		compiler->mTargetMachine = TMACH_PET_32K;
+		compiler->AddDefine(Ident::Unique("__CBMPET__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "plus4"))
+	{
+		strcpy_s(basicStart, "0x1001");
+		compiler->mTargetMachine = TMACH_PLUS4;
+		compiler->AddDefine(Ident::Unique("__PLUS4__"), "1");
+		compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+	}
+	else if (!strcmp(targetMachine, "mega65"))
+	{
+		strcpy_s(basicStart, "0x2001");		
+		compiler->mTargetMachine = TMACH_MEGA65;
+		compiler->AddDefine(Ident::Unique("__MEGA65__"), "1");
+	}
+	else if (!strcmp(targetMachine, "x16"))
+	{
+		strcpy_s(basicStart, "0x0801");
+		compiler->mTargetMachine = TMACH_X16;
+		compiler->AddDefine(Ident::Unique("__X16__"), "1");
+	}
+	else if (!strcmp(targetMachine, "nes"))
+	{
+		compiler->mTargetMachine = TMACH_NES;
+	}
+	else if (!strcmp(targetMachine, "nes_nrom_h"))
+	{
+		compiler->mTargetMachine = TMACH_NES_NROM_H;
+	}
+	else if (!strcmp(targetMachine, "nes_nrom_v"))
+	{
+		compiler->mTargetMachine = TMACH_NES_NROM_V;
+	}
+	else if (!strcmp(targetMachine, "nes_mmc1"))
+	{
+		compiler->mTargetMachine = TMACH_NES_MMC1;
+	}
+	else if (!strcmp(targetMachine, "nes_mmc3"))
+	{
+		compiler->mTargetMachine = TMACH_NES_MMC3;
+	}
+	else if (!strcmp(targetMachine, "atari"))
+	{
+		compiler->mTargetMachine = TMACH_ATARI;
+		compiler->AddDefine(Ident::Unique("__ATARI__"), "1");
+	}
+	else
+		compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target machine option", targetMachine);
+
+	if (!targetCPU[0])
+		strcpy_s(targetCPU, compiler->mTargetMachine == TMACH_X16 ? "65c02" : "6502");
 
-				compiler->mCompilationUnits->AddUnit(loc, argv[i], nullptr);
+	if (!strcmp(targetCPU, "65c02"))
+	{
+		compiler->mCompilerOptions |= COPT_CPU_65C02;
+		compiler->AddDefine(Ident::Unique("__65C02__"), "1");
+	}
+	else if (!strcmp(targetCPU, "45gs02"))
+	{
+		if (compiler->mTargetMachine != TMACH_MEGA65)
+			compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Target cpu 45gs02 requires the mega65 target machine");
 
-				hasSources = true;
-			}
-		}
+		compiler->mCompilerOptions |= COPT_CPU_65C02 | COPT_CPU_45GS02;
+		compiler->AddDefine(Ident::Unique("__65C02__"), "1");
+		compiler->AddDefine(Ident::Unique("__45GS02__"), "1");
+	}
+	else if (strcmp(targetCPU, "6502"))
+		compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target cpu option", targetCPU);
 
-		if (compiler->mCompilerOptions & COPT_NATIVE)
+
+	if (compiler->mTargetMachine >= TMACH_NES && compiler->mTargetMachine <= TMACH_NES_MMC3)
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_NES;
+		compiler->mCompilerOptions |= COPT_EXTENDED_ZERO_PAGE;
+		compiler->mCompilerOptions |= COPT_NATIVE;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_NES"), "1");
+		switch (compiler->mTargetMachine)
 		{
-			compiler->AddDefine(Ident::Unique("OSCAR_NATIVE_ALL"), "1");
+		default:
+		case TMACH_NES:
+		case TMACH_NES_NROM_H:
+		case TMACH_NES_NROM_V:
+			break;
+		case TMACH_NES_MMC1:
+			compiler->AddDefine(Ident::Unique("__NES_MMC1__"), "1");
+			break;
+		case TMACH_NES_MMC3:
+			compiler->AddDefine(Ident::Unique("__NES_MMC3__"), "1");
+			break;
 		}
+		compiler->AddDefine(Ident::Unique("__NES__"), "1");
+	}
+	else if (!strcmp(targetFormat, "prg"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_PRG;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_PRG"), "1");
+		compiler->AddDefine(Ident::Unique("OSCAR_BASIC_START"), basicStart);
+	}
+	else if (!strcmp(targetFormat, "crt"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_CRT_EASYFLASH;
+		compiler->mCartridgeID = 0x0020;
 
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT_EASYFLASH"), "1");
+	}
+	else if (!strcmp(targetFormat, "crt32"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_CRT32;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT32"), "1");
+	}
+	else if (!strcmp(targetFormat, "crt16"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_CRT16;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT16"), "1");
+	}
+	else if (!strcmp(targetFormat, "crt8"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_CRT8;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT8"), "1");
+	}
+	else if (!strcmp(targetFormat, "bin"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_BIN;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_BIN"), "1");
+	}
+	else if (!strcmp(targetFormat, "lzo"))
+	{
+		compiler->mCompilerOptions |= COPT_TARGET_LZO;
+		compiler->AddDefine(Ident::Unique("OSCAR_TARGET_LZO"), "1");
+		compiler->AddDefine(Ident::Unique("OSCAR_BASIC_START"), basicStart);
+	}
+	else
+		compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target format option", targetFormat);
 
-		// REMOVE ME
-		// compiler->mCompilerOptions |= COPT_OPTIMIZE_GLOBAL;
-		// REMOVE ME
+	if (showHelp)
+		writeHelp();
 
-		char	basicStart[10];
-		strcpy_s(basicStart, "0x0801");
+	strcpy_s(compiler->mVersion, strProductVersion);
+
+	if (compiler->mCompilerOptions & COPT_VERBOSE)
+	{
+		printf("Starting %s %s\n", strProductName, strProductVersion);
+	}
+	DiskImage* d64;
+
+	if (diskPath[0] != '\0')
+		d64 = new DiskImage(diskPath, compiler->mErrors);
+	else
+		d64 = nullptr;
+
+	if (compiler->mErrors->mErrorCount == 0 && (customCRT || hasSources))
+	{
+		if (writeFiles)
+			compiler->RemoveErrorFile(targetPath);
+
+		std::chrono::steady_clock::time_point	compileStart = std::chrono::steady_clock::now();
 
-		if (!strcmp(targetMachine, "c64"))
-		{
-			compiler->mTargetMachine = TMACH_C64;
-			compiler->AddDefine(Ident::Unique("__C64__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "c128"))
-		{
-			strcpy_s(basicStart, "0x1c01");
-			compiler->mTargetMachine = TMACH_C128;
-			compiler->AddDefine(Ident::Unique("__C128__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "c128b"))
-		{
-			strcpy_s(basicStart, "0x1c01");
-			compiler->mTargetMachine = TMACH_C128B;
-			compiler->AddDefine(Ident::Unique("__C128B__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "c128e"))
-		{
-			strcpy_s(basicStart, "0x1c01");
-			compiler->mTargetMachine = TMACH_C128E;
-			compiler->AddDefine(Ident::Unique("__C128E__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "vic20"))
-		{
-			strcpy_s(basicStart, "0x1001");
-			compiler->mTargetMachine = TMACH_VIC20;
-			compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "vic20+3"))
-		{
-			strcpy_s(basicStart, "0x0401");
-			compiler->mTargetMachine = TMACH_VIC20_3K;
-			compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "vic20+8"))
-		{
-			strcpy_s(basicStart, "0x1201");
-			compiler->mTargetMachine = TMACH_VIC20_8K;
-			compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "vic20+16"))
-		{
-			strcpy_s(basicStart, "0x1201");
-			compiler->mTargetMachine = TMACH_VIC20_16K;
-			compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "vic20+24"))
-		{
-			strcpy_s(basicStart, "0x1201");
-			compiler->mTargetMachine = TMACH_VIC20_24K;
-			compiler->AddDefine(Ident::Unique("__VIC20__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "pet"))
-		{
-			strcpy_s(basicStart, "0x0401");
-			compiler->mTargetMachine = TMACH_PET_8K;
-			compiler->AddDefine(Ident::Unique("__CBMPET__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "pet16"))
-		{
-			strcpy_s(basicStart, "0x0401");
-			compiler->mTargetMachine = TMACH_PET_16K;
-			compiler->AddDefine(Ident::Unique("__CBMPET__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "pet32"))
-		{
-			strcpy_s(basicStart, "0x0401");
-			compiler->mTargetMachine = TMACH_PET_32K;
-			compiler->AddDefine(Ident::Unique("__CBMPET__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
-		}
-		else if (!strcmp(targetMachine, "plus4"))
 		{
-			strcpy_s(basicStart, "0x1001");
-			compiler->mTargetMachine = TMACH_PLUS4;
-			compiler->AddDefine(Ident::Unique("__PLUS4__"), "1");
-			compiler->AddDefine(Ident::Unique("__CBM__"), "1");
+			char dstring[100], tstring[100];
+			time_t now = time(NULL);
+			struct tm t;
+#ifdef _WIN32
+			localtime_s(&t, &now);
+#else
+			localtime_r(&now, &t);
+#endif
+
+			strftime(dstring, sizeof(tstring) - 1, "\"%b %d %Y\"", &t);
+			strftime(tstring, sizeof(dstring) - 1, "\"%H:%M:%S\"", &t);
+
+			compiler->AddDefine(Ident::Unique("__DATE__"), _strdup(dstring));
+			compiler->AddDefine(Ident::Unique("__TIME__"), _strdup(tstring));
 		}
-		else if (!strcmp(targetMachine, "mega65"))
+
+		if (compiler->mCompilerOptions & COPT_OPTIMIZE_CODE_SIZE)
+			compiler->AddDefine(Ident::Unique("OSCAR_OPTIMIZE_SIZE"), "1");
+
+
+		// Add runtime module
+
+		compiler->mPreprocessor->AddPath(includePath);
+
+		if (hasSources && !customCRT)
 		{
-			strcpy_s(basicStart, "0x2001");		
-			compiler->mTargetMachine = TMACH_MEGA65;
-			compiler->AddDefine(Ident::Unique("__MEGA65__"), "1");
+			FILE* crtFile;
+			char crtFileNamePath[FILENAME_MAX];
+			crtFileNamePath[FILENAME_MAX - 1] = '\0';
+			strcpy_s(crtFileNamePath, includePath);
+			strcat_s(crtFileNamePath, "/crt.h");
+
+			if (fopen_s(&crtFile, crtFileNamePath, "r"))
+			{
+				strcpy_s(crtFileNamePath, basePath);
+				strcat_s(crtFileNamePath, "include/oscar64/crt.h");
+
+				if (!fopen_s(&crtFile, crtFileNamePath, "r")) {
+					strcpy_s(includePath, basePath);
+					strcat_s(includePath, "include/oscar64/");
+					compiler->mPreprocessor->AddPath(includePath);
+				}
+				else
+				{
+					printf("Could not locate Oscar64 includes under %s\n", basePath);
+					return 20;
+				}
+			}
+			fclose(crtFile);
+
+			strcpy_s(crtPath, includePath);
+			strcat_s(crtPath, "/crt.c");
 		}
-		else if (!strcmp(targetMachine, "x16"))
+
+		if (crtPath[0] != '\0')
+			compiler->mCompilationUnits->AddUnit(loc, crtPath, nullptr);
+
+		if (compiler->mCompilerOptions & COPT_TARGET_LZO)
 		{
-			strcpy_s(basicStart, "0x0801");
-			compiler->mTargetMachine = TMACH_X16;
-			compiler->AddDefine(Ident::Unique("__X16__"), "1");
+			compiler->BuildLZO(targetPath);
 		}
-		else if (!strcmp(targetMachine, "nes"))
+		else if (compiler->ParseSource() && compiler->GenerateCode())
 		{
-			compiler->mTargetMachine = TMACH_NES;
+			if (writeFiles)
+				compiler->WriteOutputFile(targetPath, d64);
+
+			double	compileTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - compileStart).count();
+
+			if (emulate)
+				compiler->ExecuteCode(targetPath, profile, trace, asserts, iorange, vicmodel, profilePath[0] ? profilePath : nullptr);
+
+			if (benchPath[0] || benchBase[0])
+			{
+				const char* name = targetPath + strlen(targetPath);
+				while (name > targetPath && name[-1] != '/' && name[-1] != '\\')
+					name--;
+
+				compiler->WriteBenchmark(benchPath, benchBase, name, benchOptions, compileTime);
+			}
 		}
-		else if (!strcmp(targetMachine, "nes_nrom_h"))
+		else if (writeFiles && (compiler->mCompilerOptions & COPT_ERROR_FILES))
 		{
-			compiler->mTargetMachine = TMACH_NES_NROM_H;
+			compiler->WriteErrorFile(targetPath);
 		}
-		else if (!strcmp(targetMachine, "nes_nrom_v"))
+	}
+
+	if (compiler->mErrors->mErrorCount == 0 && d64 != nullptr)
+	{
+		for (int i = 0; i < dataFiles.Size() && compiler->mErrors->mErrorCount == 0; i++)
 		{
-			compiler->mTargetMachine = TMACH_NES_NROM_V;
+			if (!d64->WriteFile(dataFiles[i], dataFileCompressed[i], dataFileInterleave))
+			{
+				printf("Could not embed disk file %s\n", dataFiles[i]);
+				return 20;
+			}
 		}
-		else if (!strcmp(targetMachine, "nes_mmc1"))
+
+		if (compiler->mErrors->mErrorCount == 0 && !d64->WriteImage(diskPath))
 		{
-			compiler->mTargetMachine = TMACH_NES_MMC1;
+			printf("Could not write disk image %s\n", diskPath);
+			return 20;
 		}
-		else if (!strcmp(targetMachine, "nes_mmc3"))
+	}
+
+	int	result = compiler->mErrors->mErrorCount != 0 ? 20 : 0;
+
+	if (output)
+		delete compiler;
+
+	return result;
+}
+
+struct BatchJob
+{
+	ExpandingArray<const char*>	mArgs;
+	const char	*	mLine;
+	int				mLayout, mResult;
+	double			mTime;
+	char		*	mOutput;
+};
+
+static void WriteXMLString(FILE* file, const char* str)
+{
+	while (*str)
+	{
+		char	c = *str++;
+		if (c == '<')
+			fprintf(file, "&lt;");
+		else if (c == '>')
+			fprintf(file, "&gt;");
+		else if (c == '&')
+			fprintf(file, "&amp;");
+		else if (c == '"')
+			fprintf(file, "&quot;");
+		else if (c >= 32 || c == '\n' || c == '\t')
+			fputc(c, file);
+	}
+}
+
+static void WriteJSONString(FILE* file, const char* str)
+{
+	fputc('"', file);
+	while (*str)
+	{
+		char	c = *str++;
+		if (c == '"' || c == '\\')
+			fprintf(file, "\\%c", c);
+		else if (c == '\n')
+			fprintf(file, "\\n");
+		else if (c == '\t')
+			fprintf(file, "\\t");
+		else if (c >= 32)
+			fputc(c, file);
+	}
+	fputc('"', file);
+}
+
+static void RunBatchJob(BatchJob& job, const char* basePath, const char* strProductName, const char* strProductVersion)
+{
+	std::chrono::steady_clock::time_point	start = std::chrono::steady_clock::now();
+
+	FILE* output = tmpfile();
+	{
+		MemoryArena					arena;
+		MemoryArenaPermanentScope	scope(&arena);
+
+		job.mResult = CompileProgram(job.mArgs.Size(), &job.mArgs[0], basePath, strProductName, strProductVersion, output ? output : stdout);
+	}
+	job.mTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	if (output)
+	{
+		long	size = ftell(output);
+		job.mOutput = new char[size + 1];
+		rewind(output);
+		size = long(fread(job.mOutput, 1, size, output));
+		job.mOutput[size] = 0;
+		fclose(output);
+	}
+	else
+	{
+		job.mOutput = new char[1];
+		job.mOutput[0] = 0;
+	}
+}
+
+// Compile and run a list of programs, one per line of the batch file, each
+// line has the options followed by the sources.  The jobs run in parallel
+// with independent compilers, grouped by their zero page layout.
+
+static int RunBatch(int argc, const char** argv, const char* basePath, const char* strProductName, const char* strProductVersion)
+{
+	const char* batchPath = nullptr, * junitPath = nullptr, * jsonPath = nullptr;
+	int			numThreads = 1;
+
+	ExpandingArray<const char*>	common;
+	common.Push(argv[0]);
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		if (!strncmp(arg, "-batch", 6))
 		{
-			compiler->mTargetMachine = TMACH_NES_MMC3;
+			if (arg[6] == '=')
+				batchPath = arg + 7;
+			else if (i + 1 < argc)
+				batchPath = argv[++i];
 		}
-		else if (!strcmp(targetMachine, "atari"))
+		else if (!strncmp(arg, "-junit=", 7))
+			junitPath = arg + 7;
+		else if (!strncmp(arg, "-json=", 6))
+			jsonPath = arg + 6;
+		else if (arg[0] == '-' && arg[1] == 'j')
 		{
-			compiler->mTargetMachine = TMACH_ATARI;
-			compiler->AddDefine(Ident::Unique("__ATARI__"), "1");
+			const char* num = arg + 2;
+			if (num[0] == '=')
+				num++;
+			else if (!num[0] && i + 1 < argc)
+				num = argv[++i];
+			numThreads = atoi(num);
 		}
 		else
-			compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target machine option", targetMachine);
+			common.Push(arg);
+	}
 
+	if (!batchPath || numThreads < 1)
+	{
+		printf("Invalid batch arguments\n");
+		return 20;
+	}
 
-		if (compiler->mTargetMachine >= TMACH_NES && compiler->mTargetMachine <= TMACH_NES_MMC3)
-		{
-			compiler->mCompilerOptions |= COPT_TARGET_NES;
-			compiler->mCompilerOptions |= COPT_EXTENDED_ZERO_PAGE;
-			compiler->mCompilerOptions |= COPT_NATIVE;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_NES"), "1");
-			switch (compiler->mTargetMachine)
-			{
-			default:
-			case TMACH_NES:
-			case TMACH_NES_NROM_H:
-			case TMACH_NES_NROM_V:
-				break;
-			case TMACH_NES_MMC1:
-				compiler->AddDefine(Ident::Unique("__NES_MMC1__"), "1");
-				break;
-			case TMACH_NES_MMC3:
-				compiler->AddDefine(Ident::Unique("__NES_MMC3__"), "1");
-				break;
-			}
-			compiler->AddDefine(Ident::Unique("__NES__"), "1");
-		}
-		else if (!strcmp(targetFormat, "prg"))
-		{
-			compiler->mCompilerOptions |= COPT_TARGET_PRG;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_PRG"), "1");
-			compiler->AddDefine(Ident::Unique("OSCAR_BASIC_START"), basicStart);
-		}
-		else if (!strcmp(targetFormat, "crt"))
-		{
-			compiler->mCompilerOptions |= COPT_TARGET_CRT_EASYFLASH;
-			compiler->mCartridgeID = 0x0020;
+	FILE* file;
+	if (fopen_s(&file, batchPath, "r"))
+	{
+		printf("Could not open batch file %s\n", batchPath);
+		return 20;
+	}
 
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT_EASYFLASH"), "1");
-		}
-		else if (!strcmp(targetFormat, "crt32"))
-		{
-			compiler->mCompilerOptions |= COPT_TARGET_CRT32;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT32"), "1");
-		}
-		else if (!strcmp(targetFormat, "crt16"))
+	ExpandingArray<BatchJob*>	jobs;
+
+	char	line[1024];
+	while (fgets(line, 1024, file))
+	{
+		char* p = line;
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if (*p == 0 || *p == '\n' || *p == '\r' || *p == '#')
+			continue;
+
+		BatchJob* job = new BatchJob();
+		job->mOutput = nullptr;
+		job->mResult = 0;
+		job->mTime = 0;
+		job->mLayout = 0;
+
+		char* q = _strdup(p);
+		ptrdiff_t	n = strlen(q);
+		while (n > 0 && (q[n - 1] == '\n' || q[n - 1] == '\r' || q[n - 1] == ' '))
+			q[--n] = 0;
+		job->mLine = _strdup(q);
+
+		for (int i = 0; i < common.Size(); i++)
+			job->mArgs.Push(common[i]);
+
+		while (*q)
 		{
-			compiler->mCompilerOptions |= COPT_TARGET_CRT16;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT16"), "1");
+			while (*q == ' ' || *q == '\t')
+				q++;
+			if (*q)
+			{
+				if (*q == '"')
+				{
+					job->mArgs.Push(++q);
+					while (*q && *q != '"')
+						q++;
+				}
+				else
+				{
+					job->mArgs.Push(q);
+					while (*q && *q != ' ' && *q != '\t')
+						q++;
+				}
+				if (*q)
+					*q++ = 0;
+			}
 		}
-		else if (!strcmp(targetFormat, "crt8"))
+
+		// The zero page registers are global, so jobs with a different layout
+		// can not run in parallel
+
+		for (int i = 1; i < job->mArgs.Size(); i++)
 		{
-			compiler->mCompilerOptions |= COPT_TARGET_CRT8;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_CRT8"), "1");
+			const char* arg = job->mArgs[i];
+			if (!strcmp(arg, "-xz") && job->mLayout == 0)
+				job->mLayout = 1;
+			else if (!strcmp(arg, "-tm=atari"))
+				job->mLayout = 2;
+			else if (!strcmp(arg, "-tm=x16"))
+				job->mLayout = 3;
 		}
-		else if (!strcmp(targetFormat, "bin"))
+
+		jobs.Push(job);
+	}
+
+	fclose(file);
+
+	std::chrono::steady_clock::time_point	start = std::chrono::steady_clock::now();
+
+	for (int layout = 0; layout < 4; layout++)
+	{
+		ExpandingArray<BatchJob*>	group;
+		for (int i = 0; i < jobs.Size(); i++)
+			if (jobs[i]->mLayout == layout)
+				group.Push(jobs[i]);
+
+		if (group.Size())
 		{
-			compiler->mCompilerOptions |= COPT_TARGET_BIN;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_BIN"), "1");
+			Compiler::SetupZeroPage(layout == 2 ? TMACH_ATARI : layout == 3 ? TMACH_X16 : TMACH_C64, layout == 1);
+
+			ExpandingArray<int>* dependencies = new ExpandingArray<int>[group.Size()];
+
+			ThreadPool	pool(numThreads);
+			pool.Run(group.Size(), dependencies, [&](int i) {
+				RunBatchJob(*group[i], basePath, strProductName, strProductVersion);
+			});
+
+			delete[] dependencies;
 		}
-		else if (!strcmp(targetFormat, "lzo"))
+	}
+
+	double	total = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	int	failed = 0;
+	for (int i = 0; i < jobs.Size(); i++)
+	{
+		BatchJob* job = jobs[i];
+		if (job->mResult)
 		{
-			compiler->mCompilerOptions |= COPT_TARGET_LZO;
-			compiler->AddDefine(Ident::Unique("OSCAR_TARGET_LZO"), "1");
-			compiler->AddDefine(Ident::Unique("OSCAR_BASIC_START"), basicStart);
+			printf("FAILED %s (%.2fs)\n%s", job->mLine, job->mTime, job->mOutput);
+			failed++;
 		}
 		else
-			compiler->mErrors->Error(loc, EERR_COMMAND_LINE, "Invalid target format option", targetFormat);
-
-		if (showHelp)
-			writeHelp();
+			printf("passed %s (%.2fs)\n", job->mLine, job->mTime);
+	}
 
-		strcpy_s(compiler->mVersion, strProductVersion);
+	printf("Batch %d jobs, %d passed, %d failed, %.2fs\n", jobs.Size(), jobs.Size() - failed, failed, total);
 
-		if (compiler->mCompilerOptions & COPT_VERBOSE)
+	if (junitPath)
+	{
+		if (!fopen_s(&file, junitPath, "w"))
 		{
-			printf("Starting %s %s\n", strProductName, strProductVersion);
+			fprintf(file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+			fprintf(file, "<testsuites tests=\"%d\" failures=\"%d\" time=\"%.3f\">\n", jobs.Size(), failed, total);
+			fprintf(file, "  <testsuite name=\"");
+			WriteXMLString(file, batchPath);
+			fprintf(file, "\" tests=\"%d\" failures=\"%d\" time=\"%.3f\">\n", jobs.Size(), failed, total);
+			for (int i = 0; i < jobs.Size(); i++)
+			{
+				BatchJob* job = jobs[i];
+				fprintf(file, "    <testcase classname=\"oscar64\" name=\"");
+				WriteXMLString(file, job->mLine);
+				fprintf(file, "\" time=\"%.3f\">\n", job->mTime);
+				if (job->mResult)
+					fprintf(file, "      <failure message=\"exit code %d\"/>\n", job->mResult);
+				fprintf(file, "      <system-out>");
+				WriteXMLString(file, job->mOutput);
+				fprintf(file, "</system-out>\n");
+				fprintf(file, "    </testcase>\n");
+			}
+			fprintf(file, "  </testsuite>\n");
+			fprintf(file, "</testsuites>\n");
+			fclose(file);
 		}
-		DiskImage* d64;
-
-		if (diskPath[0] != '\0')
-			d64 = new DiskImage(diskPath, compiler->mErrors);
 		else
-			d64 = nullptr;
+			printf("Could not write %s\n", junitPath);
+	}
 
-		if (compiler->mErrors->mErrorCount == 0 && (customCRT || hasSources))
+	if (jsonPath)
+	{
+		if (!fopen_s(&file, jsonPath, "w"))
 		{
-			compiler->RemoveErrorFile(targetPath);
-
+			fprintf(file, "{\n  \"tests\": %d,\n  \"failures\": %d,\n  \"time\": %.3f,\n  \"jobs\": [\n", jobs.Size(), failed, total);
+			for (int i = 0; i < jobs.Size(); i++)
 			{
-				char dstring[100], tstring[100];
-				time_t now = time(NULL);
-				struct tm t;
-#ifdef _WIN32
-				localtime_s(&t, &now);
-#else
-				localtime_r(&now, &t);
-#endif
-
-				strftime(dstring, sizeof(tstring) - 1, "\"%b %d %Y\"", &t);
-				strftime(tstring, sizeof(dstring) - 1, "\"%H:%M:%S\"", &t);
-
-				compiler->AddDefine(Ident::Unique("__DATE__"), _strdup(dstring));
-				compiler->AddDefine(Ident::Unique("__TIME__"), _strdup(tstring));
+				BatchJob* job = jobs[i];
+				fprintf(file, "    {\"job\": ");
+				WriteJSONString(file, job->mLine);
+				fprintf(file, ", \"result\": %d, \"time\": %.3f, \"output\": ", job->mResult, job->mTime);
+				WriteJSONString(file, job->mOutput);
+				fprintf(file, "}%s\n", i + 1 < jobs.Size() ? "," : "");
 			}
+			fprintf(file, "  ]\n}\n");
+			fclose(file);
+		}
+		else
+			printf("Could not write %s\n", jsonPath);
+	}
 
-			if (compiler->mCompilerOptions & COPT_OPTIMIZE_CODE_SIZE)
-				compiler->AddDefine(Ident::Unique("OSCAR_OPTIMIZE_SIZE"), "1");
-
+	return failed ? 20 : 0;
+}
 
-			// Add runtime module
+int main2(int argc, const char** argv)
+{
+	InitDeclarations();
+	InitAssembler();
 
-			compiler->mPreprocessor->AddPath(includePath);
+	if (argc > 1)
+	{
+		char	basePath[200];
+		char	strProductName[100], strProductVersion[200];
 
-			if (hasSources && !customCRT)
-			{
-				FILE* crtFile;
-				char crtFileNamePath[FILENAME_MAX];
-				crtFileNamePath[FILENAME_MAX - 1] = '\0';
-				strcpy_s(crtFileNamePath, includePath);
-				strcat_s(crtFileNamePath, "/crt.h");
+#ifdef _WIN32
+			GetProductAndVersion(strProductName, strProductVersion);
 
-				if (fopen_s(&crtFile, crtFileNamePath, "r"))
-				{
-					strcpy_s(crtFileNamePath, basePath);
-					strcat_s(crtFileNamePath, "include/oscar64/crt.h");
-
-					if (!fopen_s(&crtFile, crtFileNamePath, "r")) {
-						strcpy_s(includePath, basePath);
-						strcat_s(includePath, "include/oscar64/");
-						compiler->mPreprocessor->AddPath(includePath);
-					}
-					else
-					{
-						printf("Could not locate Oscar64 includes under %s\n", basePath);
-						return 20;
-					}
-				}
-				fclose(crtFile);
+			DWORD length = ::GetModuleFileNameA(NULL, basePath, sizeof(basePath));
 
-				strcpy_s(crtPath, includePath);
-				strcat_s(crtPath, "/crt.c");
-			}
+#else
+		strcpy(strProductName, "oscar64");
+		strcpy(strProductVersion, "1.32.273");
 
-			if (crtPath[0] != '\0')
-				compiler->mCompilationUnits->AddUnit(loc, crtPath, nullptr);
+#ifdef __APPLE__
+		uint32_t length = sizeof(basePath);
 
-			if (compiler->mCompilerOptions & COPT_TARGET_LZO)
-			{
-				compiler->BuildLZO(targetPath);
-			}
-			else if (compiler->ParseSource() && compiler->GenerateCode())
-			{
-				compiler->WriteOutputFile(targetPath, d64);
+		_NSGetExecutablePath(basePath, &length);
+		length = strlen(basePath);
+#else
+#ifdef __FreeBSD__
+		size_t length = 200;
+		int oid[4] = {CTL_KERN, KERN_PROC, KERN_PROC_PATHNAME, -1};
+		if (sysctl((const int *)&oid[0], 4, basePath, &length, NULL, 0) < 0) {
+		  length = 0;
+		}
+#else
+#ifdef __amigaos__
+		int length = 0;
+		strcpy(basePath, "PROGDIR:");
+#else
+		int length = readlink("/proc/self/exe", basePath, sizeof(basePath));
 
+		//		strcpy(basePath, argv[0]);
+		//		int length = strlen(basePath);
+#endif
+#endif
+#endif
+#endif
+		while (length > 0 && basePath[length - 1] != '/' && basePath[length - 1] != '\\')
+			length--;
 
-				if (emulate)
-					compiler->ExecuteCode(profile, trace, asserts, iorange);
-			}
-			else if (compiler->mCompilerOptions & COPT_ERROR_FILES)
-			{
-				compiler->WriteErrorFile(targetPath);
-			}
+		if (length > 0)
+		{
+			length--;
+			while (length > 0 && basePath[length - 1] != '/' && basePath[length - 1] != '\\')
+				length--;
 		}
 
-		if (compiler->mErrors->mErrorCount == 0 && d64 != nullptr)
-		{
-			for (int i = 0; i < dataFiles.Size() && compiler->mErrors->mErrorCount == 0; i++)
-			{
-				if (!d64->WriteFile(dataFiles[i], dataFileCompressed[i], dataFileInterleave))
-				{
-					printf("Could not embed disk file %s\n", dataFiles[i]);
-					return 20;
-				}
-			}
+		basePath[length] = 0;
 
-			if (compiler->mErrors->mErrorCount == 0 && !d64->WriteImage(diskPath))
-			{
-				printf("Could not write disk image %s\n", diskPath);
-				return 20;
-			}
+		for (int i = 1; i < argc; i++)
+		{
+			if (!strncmp(argv[i], "-batch", 6) && (argv[i][6] == 0 || argv[i][6] == '='))
+				return RunBatch(argc, argv, basePath, strProductName, strProductVersion);
 		}
 
-		if (compiler->mErrors->mErrorCount != 0)
-			return 20;
+		return CompileProgram(argc, argv, basePath, strProductName, strProductVersion, nullptr);
 	}
 	else
 	{